@@ -26,7 +26,7 @@ using namespace SST;
 using namespace SST::GNAComponent;
 
 GNA::GNA(ComponentId_t id, Params& params) :
-    Component(id), state(IDLE), now(0), numFirings(0), numDeliveries(0)
+    Component(id), state(IDLE), now(0), numFirings(0), numDeliveries(0), clockOn(true)
 {
     uint32_t outputLevel = params.find<uint32_t>("verbose", 0);
     out.init("GNA:@p:@l: ", outputLevel, 0, Output::STDOUT);
@@ -57,6 +57,8 @@ GNA::GNA(ComponentId_t id, Params& params) :
     std::string clockFreq = params.find<std::string>("clock", "1GHz");
     clockHandler = new Clock::Handler<GNA>(this, &GNA::clockTic);
     clockTC = registerClock(clockFreq, clockHandler);
+    clockGating = params.find<bool>("clock_gating", false);
+    verifyGating = params.find<bool>("verify_clock_gating", false);
 
     // tell the simulator not to end without us
     registerAsPrimaryComponent();
@@ -97,7 +99,7 @@ void GNA::init(unsigned int phase) {
     }
 
     // initialize neurons
-    neurons = new neuron[numNeurons];
+    neurons.resize(numNeurons);
 
     SST::RNG::MarsagliaRNG rng(1,13);
 
@@ -105,21 +107,21 @@ void GNA::init(unsigned int phase) {
     // neurons
 #if 0 
     for (int nrn_num=0;nrn_num<=8;nrn_num++)
-        neurons[nrn_num].configure((T_NctFl){1000,-2.0,0.0});
+        neurons.configure(nrn_num, (T_NctFl){1000,-2.0,0.0});
     for (int nrn_num=9;nrn_num<=11;nrn_num++)
-        neurons[nrn_num].configure((T_NctFl){ 750,-2.0,0.0});
+        neurons.configure(nrn_num, (T_NctFl){ 750,-2.0,0.0});
     for (int nrn_num=12;nrn_num<=12;nrn_num++)
-        neurons[nrn_num].configure((T_NctFl){1000,-2.0,0.0});
+        neurons.configure(nrn_num, (T_NctFl){1000,-2.0,0.0});
     for (int nrn_num=13;nrn_num<=15;nrn_num++)
-        neurons[nrn_num].configure((T_NctFl){ 750,-2.0,0.0});
+        neurons.configure(nrn_num, (T_NctFl){ 750,-2.0,0.0});
     for (int nrn_num=16;nrn_num<=23;nrn_num++)
-        neurons[nrn_num].configure((T_NctFl){ 500,-2.0,0.0});
+        neurons.configure(nrn_num, (T_NctFl){ 500,-2.0,0.0});
     for (int nrn_num=24;nrn_num<=31;nrn_num++)
-        neurons[nrn_num].configure((T_NctFl){1500,-2.0,0.0});
+        neurons.configure(nrn_num, (T_NctFl){1500,-2.0,0.0});
 #else
     for (int nrn_num=0;nrn_num<numNeurons;nrn_num++) {
         uint16_t trig = rng.generateNextUInt32() % 100 + 350;
-        neurons[nrn_num].configure((T_NctFl){float(trig),0.0,float(trig/10.)});
+        neurons.configure(nrn_num, (T_NctFl){float(trig),0.0,float(trig/10.)});
     }
 #endif
 
@@ -142,7 +144,7 @@ void GNA::init(unsigned int phase) {
         }
 
         countLinks += numCon;
-        neurons[n].setWML(startAddr,numCon);
+        neurons.setWML(n,startAddr,numCon);
         for (int nn=0; nn<numCon; ++nn) {
 
             uint16_t targ;
@@ -233,6 +235,35 @@ void GNA::handleEvent(Interfaces::SimpleMem::Request * req)
         requestor->returnRequest(req);
         // clean up
         requests.erase(i);
+        turnClockOn();
+    }
+}
+
+// true if ticking changes nothing until a memory response arrives:
+// every busy STS is waiting on memory and there is nothing else to do
+bool GNA::quiescent() {
+    if (state != PROCESS_FIRE || !outgoingReqs.empty() || !firedNeurons.empty()) {
+        return false;
+    }
+    if (BWPs.find(now) != BWPs.end()) {
+        return false;
+    }
+    bool waiting = false;
+    for(auto &e: STSUnits) {
+        if (e.hasResponses()) return false;
+        waiting |= !e.isFree();
+    }
+    return waiting;
+}
+
+void GNA::turnClockOn() {
+    if (clockOn) {
+        return;
+    }
+    clockOn = true;
+    // in verify mode the clock was never turned off
+    if (!verifyGating) {
+        reregisterClock(clockTC, clockHandler);
     }
 }
 
@@ -240,7 +271,7 @@ void GNA::deliver(float val, int targetN, int time) {
     // AFR: should really throttle this in some way
     numDeliveries++;
     if(targetN < numNeurons) {
-        neurons[targetN].deliverSpike(val, time);
+        neurons.deliverSpike(targetN, val, time, now);
         //printf("deliver %f to %d @ %d\n", val, targetN, time);
     } else {
         out.fatal(CALL_INFO, -1,"Invalid Neuron Address\n");
@@ -317,17 +348,14 @@ void GNA::processFire() {
 
 // run LIF on all neurons
 void GNA::lifAll() {
-    for (uint n = 0; n < numNeurons; ++n) {
-        bool fired = neurons[n].lif(now);
-        if (fired) {
-            //printf(" %d fired\n", n);
-            firedNeurons.push_back(n);
-        }
-    }
+    neurons.lifAll(now, firedNeurons);
 }
 
 bool GNA::clockTic( Cycle_t )
 {
+    // in verify mode, a cycle clock gating would have skipped
+    bool skippable = !clockOn;
+
     // send some outgoing mem reqs
     int maxOut = maxOutMem;
     //if((!outgoingReqs.empty()) && (now & 0x3f) == 0) {
@@ -362,6 +390,19 @@ bool GNA::clockTic( Cycle_t )
         out.fatal(CALL_INFO, -1,"Invalid GNA state\n");
     }
 
+    if (skippable) {
+        if (!quiescent()) {
+            out.fatal(CALL_INFO, -1, "GNA did work on a cycle clock gating skips @ %d\n", now);
+        }
+        return false;
+    }
+
+    // sleep until a memory response comes back
+    if (clockGating && quiescent()) {
+        clockOn = false;
+        return !verifyGating;
+    }
+
     // return false so we keep going
     return false;
 }
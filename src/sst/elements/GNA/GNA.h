@@ -52,7 +52,9 @@ public:
             {"STSDispatch",               "Max # spikes that can be dispatched to the STS in a clock cycle","2"},
             {"STSParallelism",               "Max # spikes the STS can process in parallelism ","2"},
             {"MaxOutMem", "Maximum # of outgoing memory requests per cycle","STSParallelism"},
-            {"neurons",                  "(uint) number of neurons", "32"}
+            {"neurons",                  "(uint) number of neurons", "32"},
+            {"clock_gating",             "(bool) Turn the clock off while all spike transfers are waiting on memory", "0"},
+            {"verify_clock_gating",      "(bool) Keep the clock on and check that the cycles clock gating would skip do no work", "0"}
                             )
 
     SST_ELI_DOCUMENT_PORTS( {"mem_link", "Connection to memory", { "memHierarchy.MemEventBase" } } )
@@ -68,7 +70,7 @@ public:
 
 public:
     void deliver(float val, int targetN, int time);
-    neuron* getNeuron(int n) {return &neurons[n];}
+    const neuronArray& getNeurons() const {return neurons;}
     void readMem(Interfaces::SimpleMem::Request *req, STS *requestor) {
         // queue the request to send later
         outgoingReqs.push(req);
@@ -84,6 +86,8 @@ private:
     
     void handleEvent( SST::Interfaces::SimpleMem::Request * req );
     virtual bool clockTic( SST::Cycle_t );
+    bool quiescent();
+    void turnClockOn();
     bool deliverBWPs();
     void assignSTS();
     void processFire();
@@ -104,7 +108,7 @@ private:
     uint numDeliveries;
     queue<SST::Interfaces::SimpleMem::Request *> outgoingReqs;
 
-    neuron *neurons;
+    neuronArray neurons;
     vector<STS> STSUnits;
 
     typedef multimap<const uint, Ctrl_And_Stat_Types::T_BwpFl> BWPBuf_t;
@@ -116,6 +120,9 @@ private:
 
     TimeConverter *clockTC;
     Clock::HandlerBase *clockHandler;
+    bool clockOn;
+    bool clockGating;
+    bool verifyGating;
 
 };
 
@@ -16,7 +16,10 @@
 #ifndef _NEURON_H
 #define _NEURON_H
 
+#include <stdint.h>
+#include <deque>
 #include <map>
+#include <vector>
 #include "gna_lib.h"
 
 namespace SST {
@@ -24,65 +27,124 @@ namespace GNAComponent {
 
 using namespace std;
 
-class neuron {
+// All of the GNA's neurons, stored as parallel arrays (structure of
+// arrays) so the leaky integrate and fire step is one branch-free loop
+// over contiguous floats that the compiler can vectorize.
+//
+// Spikes waiting to be integrated are kept in a time wheel: one slot per
+// timestep for the next WHEEL_SLOTS timesteps, each an append-only list of
+// (neuron, strength).  Spikes further in the future wait in an overflow
+// map until they come within range.  Slots are drained in arrival order,
+// so each neuron's input sums in the same order as it did with a per-neuron
+// map.
+class neuronArray {
 public:
-    void configure(const Neuron_Loader_Types::T_NctFl &in) {
-        config = in;
+    neuronArray() : numNeurons(0), wheel(WHEEL_SLOTS) { }
+
+    void resize(uint n) {
+        numNeurons = n;
+        value.assign(n, 0);
+        threshold.assign(n, 0);
+        minimum.assign(n, 0);
+        leak.assign(n, 0);
+        input.assign(n, 0);
+        fired.assign(n, 0);
+        WMLAddr.assign(n, 0);
+        WMLLen.assign(n, 0);
     }
-    void deliverSpike(float str, uint when) {
-        temporalBuffer[when] += str;
-        //printf(" got %f @ %d\n", str, when);
+
+    uint size() const {return numNeurons;}
+
+    void configure(uint n, const Neuron_Loader_Types::T_NctFl &in) {
+        threshold[n] = in.NrnThr;
+        minimum[n] = in.NrnMin;
+        leak[n] = in.NrnLkg;
     }
-    // performs Leaky Integrate and Fire. Returns true if fired.
-    bool lif(const uint now) {
-        // Leak
-        value -= config.NrnLkg;
-
-        // Bound?
-        // AFR: is this right?
-        if (value < config.NrnMin) {
-            value = 0;
-        }
 
-        // Integrate
-        value += getCurrentSpikes(now);
+    void setWML(uint n, uint64_t addr, uint32_t entries) {
+        WMLAddr[n] = addr;
+        WMLLen[n] = entries;
+    }
+    uint32_t getWMLLen(uint n) const {return WMLLen[n];}
+    uint64_t getWMLAddr(uint n) const {return WMLAddr[n];}
 
-        // Fire?
-        if (value > config.NrnThr) {
-            value = config.NrnMin;
-            return true;
+    // Spikes for a timestep that has already been integrated are never seen
+    void deliverSpike(uint n, float str, uint when, uint now) {
+        if (when < now) return;
+        if (when - now < WHEEL_SLOTS) {
+            wheel[when & (WHEEL_SLOTS - 1)].push_back(spike_t(n, str));
         } else {
-            return false;
+            overflow.insert(make_pair(when, spike_t(n, str)));
         }
     }
-    void setWML(uint64_t addr, uint32_t entries) {
-        WMLAddr = addr;
-        WMLLen = entries;
+
+    // performs Leaky Integrate and Fire on every neuron for timestep
+    // 'now'. Appends the neurons that fired, in ascending order.
+    void lifAll(const uint now, deque<uint> &firedNeurons) {
+        // Integrate this timestep's spikes
+        vector<spike_t> &slot = wheel[now & (WHEEL_SLOTS - 1)];
+        for (vector<spike_t>::const_iterator i = slot.begin(); i != slot.end(); ++i) {
+            input[i->first] += i->second;
+        }
+        slot.clear();
+
+        const uint count = numNeurons;
+        lifKernel(value.data(), input.data(), fired.data(), threshold.data(), minimum.data(), leak.data(), count);
+
+        const uint8_t *f = fired.data();
+        for (uint n = 0; n < count; ++n) {
+            if (f[n]) firedNeurons.push_back(n);
+        }
+
+        // Bring spikes that are now within the wheel's range into it,
+        // before anything else is delivered for those timesteps
+        const uint next = now + 1;
+        while (!overflow.empty() && overflow.begin()->first - next < WHEEL_SLOTS) {
+            wheel[overflow.begin()->first & (WHEEL_SLOTS - 1)].push_back(overflow.begin()->second);
+            overflow.erase(overflow.begin());
+        }
     }
-    uint32_t getWMLLen() const {return WMLLen;}
-    uint32_t getWMLAddr() const {return WMLAddr;}
+
 private:
-    Neuron_Loader_Types::T_NctFl config;
-    float value;
-    // temporal buffer
-    typedef map<const uint, float> tBuf_t;
-    tBuf_t temporalBuffer;
-    // Neuron's white matter list
-    uint64_t WMLAddr; // start
-    uint32_t WMLLen; // number of entries in WML
-
-    // get any current spike values
-    float getCurrentSpikes(const int now) {
-        tBuf_t::iterator i = temporalBuffer.find(now);
-        if (i != temporalBuffer.end()) {
-            float val = i->second;
-            temporalBuffer.erase(i);
-            //printf(" got current spike %f @ %d\n", val, now);
-            return val;
-        } else {
-            return 0;
+    // Kept free of branches and aliasing so it vectorizes for whatever
+    // vector ISA the build targets
+    static void lifKernel(float * __restrict v, float * __restrict in, uint8_t * __restrict f,
+            const float * __restrict thr, const float * __restrict mn, const float * __restrict lk,
+            const uint count) {
+        for (uint n = 0; n < count; ++n) {
+            // Leak
+            float val = v[n] - lk[n];
+            // Bound?
+            // AFR: is this right?
+            val = (val < mn[n]) ? 0.0f : val;
+            // Integrate
+            val += in[n];
+            in[n] = 0;
+            // Fire?
+            const bool fire = val > thr[n];
+            v[n] = fire ? mn[n] : val;
+            f[n] = fire;
         }
     }
+
+    // Spike delays come from 16-bit temporal offsets
+    static const uint WHEEL_SLOTS = 1 << 16;
+
+    typedef pair<uint, float> spike_t;
+
+    uint numNeurons;
+    vector<float> value;
+    vector<float> threshold;
+    vector<float> minimum;
+    vector<float> leak;
+    vector<float> input;
+    vector<uint8_t> fired;
+    // Neuron's white matter list
+    vector<uint64_t> WMLAddr; // start
+    vector<uint32_t> WMLLen; // number of entries in WML
+
+    vector<vector<spike_t> > wheel;
+    multimap<uint, spike_t> overflow;
 };
 
 }
@@ -43,6 +43,7 @@ class STS {
 public:
     STS(GNA *parent, int n) : myGNA(parent), stsID(n), numSpikes(0) {;}
     bool isFree();
+    bool hasResponses() const { return !incomingReqs.empty(); }
     void assign(int);
     void advance(uint);
     void returnRequest(SST::Interfaces::SimpleMem::Request *req) {
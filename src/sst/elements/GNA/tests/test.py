@@ -11,6 +11,8 @@ op.add_option("-c", "--cacheSz", action="store", type="int", dest="cacheSz", def
 op.add_option("-s", "--STS", action="store", type="int", dest="sts", default=4)
 # max memory out
 op.add_option("-m", "--memOut", action="store", type="int", dest="memOut", default=4)
+# clock gating (see gating.csh)
+op.add_option("-g", "--gating", action="store", type="int", dest="gating", default=0)
 (options, args) = op.parse_args()
 
 # Define the simulation components
@@ -22,7 +24,8 @@ comp_gna.addParams({
     "BWPperTic" : 1,
     "STSDispatch" : options.sts,
     "STSParallelism" : options.sts,
-    "MaxOutMem" : options.memOut 
+    "MaxOutMem" : options.memOut,
+    "clock_gating" : options.gating
 })
 
 comp_l1cache = sst.Component("l1cache", "memHierarchy.Cache")
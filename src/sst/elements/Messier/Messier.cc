@@ -174,12 +174,12 @@ Messier::Messier(SST::ComponentId_t id, SST::Params& params): Component(id) {
 	// Instantiating the NVM-DIMM with the provided parameters 
 	DIMM = loadComponentExtension<NVM_DIMM>(*nvm_params);
 
-        m_memChan = configureLink(link_buffer, "1ns", new Event::Handler<NVM_DIMM>(DIMM, &NVM_DIMM::handleRequest));
+        m_memChan = configureLink(link_buffer, "1ns", new Event::Handler<Messier>(this, &Messier::handleRequest));
 
 
 	sprintf(link_buffer, "event_bus");
 
-        event_link = configureSelfLink(link_buffer, "1ns", new Event::Handler<NVM_DIMM>(DIMM, &NVM_DIMM::handleEvent));
+        event_link = configureSelfLink(link_buffer, "1ns", new Event::Handler<Messier>(this, &Messier::handleDIMMEvent));
 
 
 	DIMM->setMemChannel(m_memChan);
@@ -194,7 +194,16 @@ Messier::Messier(SST::ComponentId_t id, SST::Params& params): Component(id) {
         event_link->setDefaultTimeBase(tc);
 
 
-	registerClock( cpu_clock, new Clock::Handler<Messier>(this, &Messier::tick ) );
+	output = new Output("Messier[@p:@l]: ", 0, 0, Output::STDOUT);
+
+	clockGating = params.find<bool>("clock_gating", false);
+	verifyGating = params.find<bool>("verify_clock_gating", false);
+	clockOn = true;
+	lastCycle = 0;
+	idleTicks = 0;
+
+	clockHandler = new Clock::Handler<Messier>(this, &Messier::tick );
+	clockTC = registerClock( cpu_clock, clockHandler );
 
 }
 
@@ -215,5 +224,71 @@ bool Messier::tick(SST::Cycle_t x)
 //	for(uint32_t i = 0; i < core_count; ++i)
 	DIMM->tick();
 
+	lastCycle = x;
+
+	// In verify mode, this is a tick the clock would have skipped
+	if(!clockOn)
+	{
+		idleTicks++;
+		if(!DIMM->idle())
+			output->fatal(CALL_INFO, -1, "NVM_DIMM did work on a cycle clock gating skips (cycle %" PRIu64 ")\n", x);
+		return false;
+	}
+
+	if(clockGating && DIMM->idle())
+	{
+		clockOn = false;
+		if(verifyGating)
+		{
+			idleState = DIMM->getIdleState();
+			idleTicks = 0;
+			return false;
+		}
+		return true;
+	}
+
 	return false;
 }
+
+
+void Messier::turnClockOn()
+{
+
+	if(clockOn)
+		return;
+
+	clockOn = true;
+
+	if(verifyGating)
+	{
+		NVM_DIMM::IdleState expected = idleState;
+		DIMM->advanceIdleState(expected, idleTicks);
+		if(!(expected == DIMM->getIdleState()))
+			output->fatal(CALL_INFO, -1, "NVM_DIMM state after %lld idle ticks differs from skipping them (cycle %" PRIu64 ")\n", idleTicks, lastCycle);
+		return;
+	}
+
+	// The ticks up to and including the current cycle were skipped
+	SST::Cycle_t cycle = reregisterClock(clockTC, clockHandler) - 1;
+	DIMM->skipCycles(cycle - lastCycle);
+	lastCycle = cycle;
+
+}
+
+
+void Messier::handleRequest(SST::Event* event)
+{
+
+	turnClockOn();
+	DIMM->handleRequest(event);
+
+}
+
+
+void Messier::handleDIMMEvent(SST::Event* event)
+{
+
+	turnClockOn();
+	DIMM->handleEvent(event);
+
+}
@@ -98,7 +98,9 @@ namespace SST {
                     {"write_cancel", "This indicates that the write cancellation optimization: 0 means not enabled", "0"},
                     {"write_cancel_th", "This indicates that the write cancellation threshold: 0 means dynamic", "0"},
                     {"group_size", "This indicates the number of banks in each group, to be locked when draining", "0"},
-                    {"lock_period", "This indicates the period of locking a group in cycles", "10000"}
+                    {"lock_period", "This indicates the period of locking a group in cycles", "10000"},
+                    {"clock_gating", "Turn the clock off while the controller has nothing to schedule, and catch up when an event arrives", "0"},
+                    {"verify_clock_gating", "Keep the clock on and check that catching up gives the same controller state as ticking", "0"}
                 )
 
                 SST_ELI_DOCUMENT_STATISTICS(
@@ -118,6 +120,11 @@ namespace SST {
 				void handleEvent(SST::Event* event) {};
 				bool tick(SST::Cycle_t x);
 
+				// These wake the clock before passing the event to the DIMM
+				void handleRequest(SST::Event* event);
+				void handleDIMMEvent(SST::Event* event);
+				void turnClockOn();
+
 				void parser(NVM_PARAMS * nvm, SST::Params& params);				
 
 
@@ -135,6 +142,19 @@ namespace SST {
 				NVM_PARAMS * nvm_params;
 				NVM_DIMM * DIMM;
 
+				TimeConverter * clockTC;
+				Clock::HandlerBase * clockHandler;
+				bool clockOn;
+				bool clockGating;
+				bool verifyGating;
+
+				// The last cycle the clock ticked
+				SST::Cycle_t lastCycle;
+
+				// In verify mode, the state when the clock would have turned off and the ticks since
+				NVM_DIMM::IdleState idleState;
+				long long int idleTicks;
+
 			
 				long long int max_inst;
 				char* named_pipe;
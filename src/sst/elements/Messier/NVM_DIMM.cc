@@ -222,6 +222,82 @@ bool NVM_DIMM::tick()
 }
 
 
+bool NVM_DIMM::idle()
+{
+
+	return !enabled || (transactions.empty() && WB->empty() && ready_at_NVM.empty());
+
+}
+
+
+void NVM_DIMM::advanceIdleState(IdleState & state, long long int n)
+{
+
+	if(!enabled || n <= 0)
+		return;
+
+	state.cycles += n;
+
+	// With nothing to submit, each modulo tick still counts a read slot
+	if(params->modulo)
+		state.read_count += n;
+
+	while(!state.reads_complete.empty() && state.reads_complete.begin()->first <= state.cycles)
+	{
+		state.curr_reads = state.curr_reads - state.reads_complete.begin()->second;
+		state.reads_complete.erase(state.reads_complete.begin());
+	}
+
+	while(!state.writes_complete.empty() && state.writes_complete.begin()->first <= state.cycles)
+	{
+		state.curr_writes = state.curr_writes - state.writes_complete.begin()->second;
+		state.writes_complete.erase(state.writes_complete.begin());
+	}
+
+}
+
+
+NVM_DIMM::IdleState NVM_DIMM::getIdleState()
+{
+
+	IdleState state;
+	state.cycles = cycles;
+	state.read_count = read_count;
+	state.curr_reads = curr_reads;
+	state.curr_writes = curr_writes;
+	state.reads_complete = READS_COMPLETE;
+	state.writes_complete = WRITES_COMPLETE;
+	return state;
+
+}
+
+
+void NVM_DIMM::setIdleState(const IdleState & state)
+{
+
+	cycles = state.cycles;
+	read_count = state.read_count;
+	curr_reads = state.curr_reads;
+	curr_writes = state.curr_writes;
+	READS_COMPLETE = state.reads_complete;
+	WRITES_COMPLETE = state.writes_complete;
+
+}
+
+
+void NVM_DIMM::skipCycles(long long int n)
+{
+
+	if(!enabled || n <= 0)
+		return;
+
+	IdleState state = getIdleState();
+	advanceIdleState(state, n);
+	setIdleState(state);
+
+}
+
+
 void NVM_DIMM::schedule_delivery()
 {
 
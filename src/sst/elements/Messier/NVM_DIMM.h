@@ -120,11 +120,38 @@ namespace SST { namespace MessierComponent{
 
 		public: 
 
+		// This is the part of the controller state that changes on cycles where idle() holds
+		struct IdleState {
+			long long int cycles;
+			int read_count;
+			int curr_reads;
+			int curr_writes;
+			std::map<long long int, int> reads_complete;
+			std::map<long long int, int> writes_complete;
+
+			bool operator==(const IdleState& o) const {
+				return cycles == o.cycles && read_count == o.read_count && curr_reads == o.curr_reads && curr_writes == o.curr_writes
+					&& reads_complete == o.reads_complete && writes_complete == o.writes_complete;
+			}
+		};
+
 		// This is the constructor for the NVM-based DIMM
 		NVM_DIMM(SST::ComponentId_t id, NVM_PARAMS par); 
 
 		// This is the clock of the near memory controller
 		bool tick();
+
+		// This determines if the next ticks can only advance the IdleState, until an event arrives
+		bool idle();
+
+		// This applies n idle ticks to the state, the same as calling tick() n times while idle() holds
+		void advanceIdleState(IdleState & state, long long int n);
+
+		IdleState getIdleState();
+		void setIdleState(const IdleState & state);
+
+		// This catches up on the n ticks skipped while the clock was off
+		void skipCycles(long long int n);
 		
 		void finish(){}
 
@@ -0,0 +1,20 @@
+#!/bin/bash
+
+# Runs the GUPS configs with and without Messier's clock_gating.  Gating
+# catches up the skipped cycles, so the statistics and the simulated time
+# must not change.
+
+SST=${SST:-sst}
+failed=0
+for test in gupsgen gupsgen_2RANKS ; do
+    echo "running $test"
+    $SST $test.py > $test.ungated.out 2>&1
+    $SST --model-options="--gating" $test.py > $test.gated.out 2>&1
+    if diff $test.ungated.out $test.gated.out ; then
+        rm -f $test.ungated.out $test.gated.out
+    else
+        echo "FAILED: $test statistics differ with clock_gating"
+        failed=1
+    fi
+done
+exit $failed
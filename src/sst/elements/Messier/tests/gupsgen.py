@@ -1,4 +1,5 @@
 import sst
+import sys
 
 # Define SST core options
 sst.setProgramOption("timebase", "1ps")
@@ -76,6 +77,9 @@ messier_params = {
 }
 messier_inst.addParams(messier_params)
 
+# gating.sh runs this with --gating to compare against the ungated run
+messier_inst.addParams({ "clock_gating" : 1 if "--gating" in sys.argv[1:] else 0 })
+
 messier_inst.addParams({
       "tCL" : "30",
       "tRCD" : "300",
@@ -54,7 +54,20 @@ VaultSimC::VaultSimC( ComponentId_t id, Params& params ) :
 
     //DBG("new id=%lu\n",id);
   
+#if HAVE_LIBPHX == 1
     m_memChan = configureLink( "bus", "1 ns" );
+#else
+    clockGating = params.find<bool>("clock_gating", false);
+    verifyGating = params.find<bool>("verify_clock_gating", false);
+    clockOn = true;
+    lastCycle = 0;
+    idleOutstanding = 0;
+    if ( clockGating ) {
+        m_memChan = configureLink( "bus", "1 ns", new Event::Handler<VaultSimC>(this, &VaultSimC::handleBus) );
+    } else {
+        m_memChan = configureLink( "bus", "1 ns" );
+    }
+#endif /* HAVE_LIBPHX */
   
     int vid = params.find("VaultID", -1);
     if ( -1 == vid) {
@@ -83,12 +96,16 @@ VaultSimC::VaultSimC( ComponentId_t id, Params& params ) :
 #else
     // Configuration if we're not using Phx Library
 
-    registerClock( frequency, 
-                   new Clock::Handler<VaultSimC>(this, &VaultSimC::clock) );
+    clockHandler = new Clock::Handler<VaultSimC>(this, &VaultSimC::clock);
+    clockTC = registerClock( frequency, clockHandler );
 
     std::string delay = "40ns";
     delay = params.find<std::string>("delay", "40ns");
-    delayLine = configureSelfLink( "delayLine", delay);
+    if ( clockGating ) {
+        delayLine = configureSelfLink( "delayLine", delay, new Event::Handler<VaultSimC>(this, &VaultSimC::handleDelay) );
+    } else {
+        delayLine = configureSelfLink( "delayLine", delay);
+    }
 #endif /* HAVE_LIBPHX */
 
     // setup backing store
@@ -252,9 +269,48 @@ bool VaultSimC::clock_phx( Cycle_t current ) {
 
 // without PHX library ...
 
+SST::Event* VaultSimC::recv( Link* link, std::deque<SST::Event*>& queue ) {
+    if ( !clockGating ) {
+        return link->recv();
+    }
+    if ( queue.empty() ) {
+        return NULL;
+    }
+    SST::Event *e = queue.front();
+    queue.pop_front();
+    return e;
+}
+
+void VaultSimC::handleBus( SST::Event* ev ) {
+    turnClockOn();
+    busQueue.push_back(ev);
+}
+
+void VaultSimC::handleDelay( SST::Event* ev ) {
+    turnClockOn();
+    delayQueue.push_back(ev);
+}
+
+void VaultSimC::turnClockOn() {
+    if ( clockOn ) {
+        return;
+    }
+    clockOn = true;
+    if ( verifyGating ) {
+        return;
+    }
+    // record the outstanding count for the cycles the clock was off,
+    // up to and including this one
+    Cycle_t cycle = reregisterClock( clockTC, clockHandler ) - 1;
+    if ( cycle > lastCycle ) {
+        memOutStat->addDataNTimes( cycle - lastCycle, numOutstanding );
+    }
+    lastCycle = cycle;
+}
+
 bool VaultSimC::clock( Cycle_t current ) {
     SST::Event *e = 0;
-    while (NULL != (e = m_memChan->recv())) {
+    while (NULL != (e = recv(m_memChan, busQueue))) {
         // process incoming events
         MemReqEvent *event  = dynamic_cast<MemReqEvent*>(e);
         if (NULL == event) {
@@ -266,7 +322,7 @@ bool VaultSimC::clock( Cycle_t current ) {
     }
 
     e = 0;
-    while (NULL != (e = delayLine->recv())) {
+    while (NULL != (e = recv(delayLine, delayQueue))) {
         // process returned events
         MemReqEvent *event  = dynamic_cast<MemReqEvent*>(e);
         if (NULL == event) {
@@ -282,6 +338,21 @@ bool VaultSimC::clock( Cycle_t current ) {
     }
 
     memOutStat->addData(numOutstanding);
+    lastCycle = current;
+
+    // in verify mode, a cycle the clock would have skipped
+    if ( !clockOn ) {
+        if ( numOutstanding != idleOutstanding ) {
+            dbg.fatal(CALL_INFO, -1, "vault did work on a cycle clock gating skips (cycle %" PRIu64 ")\n", current);
+        }
+        return false;
+    }
+
+    if ( clockGating && busQueue.empty() && delayQueue.empty() ) {
+        clockOn = false;
+        idleOutstanding = numOutstanding;
+        return !verifyGating;
+    }
     return false;
 }
 
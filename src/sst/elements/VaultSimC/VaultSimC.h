@@ -22,6 +22,8 @@
 #include <sst/elements/memHierarchy/memEvent.h>
 #include <sst/core/output.h>
 
+#include <deque>
+
 /* If we have a PHX library to link to, we use that. Otherwise, we use
    a greatly simplifed timing model */
 #if HAVE_LIBPHX == 1
@@ -60,7 +62,9 @@ public: // functions
                             {"VaultID",            "Vault Unique ID (Unique to cube)."},
                             {"debug",              "0 (default): No debugging, 1: STDOUT, 2: STDERR, 3: FILE."},
 #if !(HAVE_LIBPHX == 1)
-                            {"delay", "Static vault delay", "40ns"}
+                            {"delay", "Static vault delay", "40ns"},
+                            {"clock_gating", "1: Turn the clock off while no requests are waiting to be handled. Events are then taken by handlers, so one arriving on a clock edge is handled on the next edge instead of that one. 0 (default): Poll every cycle.", "0"},
+                            {"verify_clock_gating", "1: Keep the clock on with clock_gating and check that the skipped cycles do no work.", "0"}
 #endif /* HAVE_LIBPHX */
                             )
 
@@ -101,6 +105,22 @@ private: // functions
 
     bool clock( Cycle_t );
     Link *delayLine;
+
+    // clock gating: events are queued by handlers instead of polled
+    SST::Event* recv( Link* link, std::deque<SST::Event*>& queue );
+    void handleBus( SST::Event* ev );
+    void handleDelay( SST::Event* ev );
+    void turnClockOn();
+
+    std::deque<SST::Event*> busQueue;
+    std::deque<SST::Event*> delayQueue;
+    TimeConverter* clockTC;
+    Clock::HandlerBase* clockHandler;
+    bool clockGating;
+    bool verifyGating;
+    bool clockOn;
+    Cycle_t lastCycle;
+    int idleOutstanding; // numOutstanding when the clock turned off (verify mode)
     
 #endif /* HAVE_LIBPHX */
     
@@ -59,13 +59,19 @@ logicLayer::logicLayer( ComponentId_t id, Params& params ) :
 
   bool terminal = params.find("terminal", 0);
 
+  clockGating = params.find<bool>("clock_gating", false);
+  verifyGating = params.find<bool>("verify_clock_gating", false);
+  clockOn = true;
+  lastCycle = 0;
+
   int numVaults = params.find("vaults", -1);
   if ( -1 != numVaults) {
+    portQueues.resize(VAULT_PORT + numVaults);
     // connect up our vaults
     for (int i = 0; i < numVaults; ++i) {
       char bus_name[50];
       snprintf(bus_name, 50, "bus_%d", i);
-      memChan_t *chan = configureLink( bus_name, "1 ns" );
+      memChan_t *chan = configurePort( bus_name, VAULT_PORT + i, "1 ns" );
       if (chan) {
 	m_memChans.push_back(chan);
 	dbg.output(" connected %s\n", bus_name);
@@ -81,14 +87,15 @@ logicLayer::logicLayer( ComponentId_t id, Params& params ) :
   }
 
   // connect chain
-  toCPU = configureLink( "toCPU");
+  toCPU = configurePort( "toCPU", CPU_PORT );
   if (!terminal) {
-    toMem = configureLink( "toMem");
+    toMem = configurePort( "toMem", MEM_PORT );
   } else {
     toMem = 0;
   }
 
-  registerClock( frequency, new Clock::Handler<logicLayer>(this, &logicLayer::clock) );
+  clockHandler = new Clock::Handler<logicLayer>(this, &logicLayer::clock);
+  clockTC = registerClock( frequency, clockHandler );
 
   dbg.output(CALL_INFO, "made logicLayer %d %p %p\n", llID, toMem, toCPU);
 
@@ -99,6 +106,64 @@ logicLayer::logicLayer( ComponentId_t id, Params& params ) :
   bwUsedToMem[1] = registerStatistic<uint64_t>("BW_send_to_Mem", "1");
 }
 
+logicLayer::memChan_t* logicLayer::configurePort( const std::string& name, int port, const char* tb )
+{
+  if (!clockGating) {
+    return tb ? configureLink( name, tb ) : configureLink( name );
+  }
+  Event::Handler<logicLayer,int>* handler = new Event::Handler<logicLayer,int>(this, &logicLayer::handleEvent, port);
+  return tb ? configureLink( name, tb, handler ) : configureLink( name, handler );
+}
+
+SST::Event* logicLayer::recv( memChan_t* link, int port )
+{
+  if (!clockGating) {
+    return link->recv();
+  }
+  std::deque<SST::Event*> &queue = portQueues[port];
+  if (queue.empty()) {
+    return NULL;
+  }
+  SST::Event* e = queue.front();
+  queue.pop_front();
+  return e;
+}
+
+void logicLayer::handleEvent( SST::Event* ev, int port )
+{
+  turnClockOn();
+  portQueues[port].push_back(ev);
+}
+
+bool logicLayer::eventsWaiting()
+{
+  for (size_t i = 0; i < portQueues.size(); ++i) {
+    if (!portQueues[i].empty()) return true;
+  }
+  return false;
+}
+
+void logicLayer::turnClockOn()
+{
+  if (clockOn) {
+    return;
+  }
+  clockOn = true;
+  if (verifyGating) {
+    return;
+  }
+  // no bandwidth was used on the cycles the clock was off, up to and
+  // including this one
+  Cycle_t cycle = reregisterClock( clockTC, clockHandler ) - 1;
+  if (cycle > lastCycle) {
+    for (int i = 0; i < 2; ++i) {
+      bwUsedToCpu[i]->addDataNTimes(cycle - lastCycle, 0);
+      bwUsedToMem[i]->addDataNTimes(cycle - lastCycle, 0);
+    }
+  }
+  lastCycle = cycle;
+}
+
 int logicLayer::Finish() 
 {
   printf("Logic Layer %d completed %lld ops\n", llID, memOps);
@@ -184,7 +249,7 @@ bool logicLayer::clock( Cycle_t current )
   int tc[2] = {0,0};
 
   // check for events from the CPU
-  while((tc[0] < bwlimit) && (e = toCPU->recv())) {
+  while((tc[0] < bwlimit) && (e = recv(toCPU, CPU_PORT))) {
     MemReqEvent *event  = dynamic_cast<MemReqEvent*>(e);
 //    dbg.output(CALL_INFO, "LL%d got req for %p (%lld %d)\n", llID, 
     dbg.output(CALL_INFO, "LL%d got req for %p (%" PRIu64 " %d)\n", llID, 
@@ -215,7 +280,7 @@ bool logicLayer::clock( Cycle_t current )
 
   // check for events from the memory chain
   if (toMem) {
-    while((tm[0] < bwlimit) && (e = toMem->recv())) {
+    while((tm[0] < bwlimit) && (e = recv(toMem, MEM_PORT))) {
       MemRespEvent *event  = dynamic_cast<MemRespEvent*>(e);
       if (event == NULL) {
 	dbg.fatal(CALL_INFO, -1, "logic layer got bad event\n");
@@ -232,10 +297,9 @@ bool logicLayer::clock( Cycle_t current )
   }
 	
   // check for incoming events from the vaults
-  for (memChans_t::iterator i = m_memChans.begin(); 
-       i != m_memChans.end(); ++i) {
-    memChan_t *m_memChan = *i;
-    while ((e = m_memChan->recv())) {
+  for (size_t i = 0; i < m_memChans.size(); ++i) {
+    memChan_t *m_memChan = m_memChans[i];
+    while ((e = recv(m_memChan, VAULT_PORT + i))) {
       MemRespEvent *event  = dynamic_cast<MemRespEvent*>(e);
       if (event == NULL) {
         dbg.fatal(CALL_INFO, -1, "logic layer got bad event from vaults\n");
@@ -262,7 +326,20 @@ bool logicLayer::clock( Cycle_t current )
   bwUsedToCpu[1]->addData(tc[1]);
   bwUsedToMem[0]->addData(tm[0]);
   bwUsedToMem[1]->addData(tm[1]);
-  
+  lastCycle = current;
+
+  // in verify mode, a cycle the clock would have skipped
+  if (!clockOn) {
+    if (tc[0] || tc[1] || tm[0] || tm[1]) {
+      dbg.fatal(CALL_INFO, -1, "ll%d did work on a cycle clock gating skips (cycle %" PRIu64 ")\n", llID, current);
+    }
+    return false;
+  }
+
+  if (clockGating && !eventsWaiting()) {
+    clockOn = false;
+    return !verifyGating;
+  }
 
   return false;
 }
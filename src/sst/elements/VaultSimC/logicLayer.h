@@ -24,6 +24,8 @@
 #include <sst/core/statapi/stathistogram.h>
 #include "vaultGlobals.h"
 
+#include <deque>
+
 using namespace std;
 
 namespace SST {
@@ -50,7 +52,9 @@ public: // functions
                             {"LL_MASK",            "Bitmask to determine 'ownership' of an address by a cube. A cube 'owns' an address if ((((addr >> LL_SHIFT) & LL_MASK) == llID) || (LL_MASK == 0)). LL_SHIFT is set in vaultGlobals.h and is 8 by default."},
                             {"terminal",           "Is this the last cube in the chain?"},
                             {"vaults",             "Number of vaults per cube."},
-                            {"debug",              "0 (default): No debugging, 1: STDOUT, 2: STDERR, 3: FILE."}
+                            {"debug",              "0 (default): No debugging, 1: STDOUT, 2: STDERR, 3: FILE."},
+                            {"clock_gating",       "1: Turn the clock off while no events are waiting. Events are then taken by handlers, so one arriving on a clock edge is handled on the next edge instead of that one. 0 (default): Poll every cycle.", "0"},
+                            {"verify_clock_gating", "1: Keep the clock on with clock_gating and check that the skipped cycles do no work.", "0"}
                                 );
 
    SST_ELI_DOCUMENT_STATISTICS(
@@ -79,6 +83,15 @@ private:
   
   logicLayer( const logicLayer& c );
   bool clock( Cycle_t );
+
+  // clock gating: events are queued by handlers instead of polled.
+  // Ports are numbered toCPU, toMem, then the vaults.
+  enum { CPU_PORT = 0, MEM_PORT = 1, VAULT_PORT = 2 };
+  memChan_t* configurePort( const std::string& name, int port, const char* tb = NULL );
+  SST::Event* recv( memChan_t* link, int port );
+  void handleEvent( SST::Event* ev, int port );
+  void turnClockOn();
+  bool eventsWaiting();
   // determine if we 'own' a given address
   bool isOurs(unsigned int addr) {
     return ((((addr >> LL_SHIFT) & LL_MASK) == llID)
@@ -96,6 +109,14 @@ private:
 
     Statistic<uint64_t>*  bwUsedToCpu[2]; 
     Statistic<uint64_t>*  bwUsedToMem[2]; 
+
+  std::vector<std::deque<SST::Event*> > portQueues;
+  TimeConverter* clockTC;
+  Clock::HandlerBase* clockHandler;
+  bool clockGating;
+  bool verifyGating;
+  bool clockOn;
+  Cycle_t lastCycle;
 };
 
 }
@@ -0,0 +1,294 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+
+#include <deque>
+#include <functional>
+#include <thread>
+
+#include "zlib.h"
+#include "arielchunktracegen.h"
+
+using namespace SST::ArielComponent;
+
+namespace SST {
+namespace ArielComponent {
+
+/*
+ * Compression threads shared by every ArielChunkedTraceGenerator in the
+ * process.  The first generator to start a pool decides its size; the
+ * threads exit when the last generator releases it.
+ */
+class ArielTraceCompressionPool {
+
+    public:
+        static ArielTraceCompressionPool* acquire(uint32_t threads) {
+            std::lock_guard<std::mutex> lock(poolLock);
+            if (NULL == instance) instance = new ArielTraceCompressionPool(threads);
+            instance->users++;
+            return instance;
+        }
+
+        static void release() {
+            ArielTraceCompressionPool* pool = NULL;
+            {
+                std::lock_guard<std::mutex> lock(poolLock);
+                if (--instance->users == 0) {
+                    pool = instance;
+                    instance = NULL;
+                }
+            }
+            delete pool;
+        }
+
+        void submit(const std::function<void()>& job) {
+            {
+                std::lock_guard<std::mutex> lock(jobLock);
+                jobs.push_back(job);
+            }
+            jobReady.notify_one();
+        }
+
+    private:
+        ArielTraceCompressionPool(uint32_t threads) : users(0), stopping(false) {
+            for (uint32_t i = 0; i < threads; i++) {
+                workers.push_back(std::thread(&ArielTraceCompressionPool::run, this));
+            }
+        }
+
+        ~ArielTraceCompressionPool() {
+            {
+                std::lock_guard<std::mutex> lock(jobLock);
+                stopping = true;
+            }
+            jobReady.notify_all();
+            for (std::vector<std::thread>::iterator it = workers.begin(); it != workers.end(); it++) {
+                it->join();
+            }
+        }
+
+        void run() {
+            while (true) {
+                std::function<void()> job;
+                {
+                    std::unique_lock<std::mutex> lock(jobLock);
+                    while (jobs.empty() && !stopping) jobReady.wait(lock);
+                    if (jobs.empty()) return;
+                    job = jobs.front();
+                    jobs.pop_front();
+                }
+                job();
+            }
+        }
+
+        static std::mutex poolLock;
+        static ArielTraceCompressionPool* instance;
+
+        uint32_t users;
+        bool stopping;
+        std::mutex jobLock;
+        std::condition_variable jobReady;
+        std::deque<std::function<void()> > jobs;
+        std::vector<std::thread> workers;
+};
+
+std::mutex ArielTraceCompressionPool::poolLock;
+ArielTraceCompressionPool* ArielTraceCompressionPool::instance = NULL;
+
+}
+}
+
+ArielChunkedTraceGenerator::ArielChunkedTraceGenerator(Params& params) :
+    ArielTraceGenerator(),
+    output("ArielChunkedTraceGenerator[@f:@l:@p] ", 0, 0, Output::STDOUT) {
+
+    tracePrefix = params.find<std::string>("trace_prefix", "ariel-core");
+    coreID = 0;
+    traceFile = NULL;
+
+    std::string compression = params.find<std::string>("compression", "zlib");
+    if (compression == "zlib" || compression == "gzip") {
+        codec = TraceChunk::CODEC_ZLIB;
+    } else if (compression == "none") {
+        codec = TraceChunk::CODEC_NONE;
+    } else {
+        output.fatal(CALL_INFO, -1, "Error: unknown trace compression \"%s\", supported values are zlib and none\n", compression.c_str());
+    }
+
+    compressionLevel = params.find<int>("compression_level", 1);
+    if (compressionLevel < 1 || compressionLevel > 9) {
+        output.fatal(CALL_INFO, -1, "Error: compression_level must be between 1 and 9, got %d\n", compressionLevel);
+    }
+
+    chunkRecords = params.find<uint64_t>("chunk_records", 65536);
+    if (0 == chunkRecords) {
+        output.fatal(CALL_INFO, -1, "Error: chunk_records must be greater than 0\n");
+    }
+
+    maxPendingChunks = params.find<size_t>("max_pending_chunks", 8);
+    if (0 == maxPendingChunks) maxPendingChunks = 1;
+
+    uint32_t threads = params.find<uint32_t>("compression_threads", 1);
+    pool = (0 == threads) ? NULL : ArielTraceCompressionPool::acquire(threads);
+
+    current = NULL;
+    nextSeq = 0;
+    nextWrite = 0;
+    pending = 0;
+    fileOffset = 0;
+    totalRecords = 0;
+}
+
+ArielChunkedTraceGenerator::~ArielChunkedTraceGenerator() {
+    if (NULL != current && current->records > 0) submitChunk();
+
+    // Wait for the compression threads to finish this core's chunks
+    {
+        std::unique_lock<std::mutex> lock(chunkLock);
+        while (pending > 0) chunkDone.wait(lock);
+    }
+
+    if (NULL != pool) ArielTraceCompressionPool::release();
+
+    if (NULL != traceFile) {
+        TraceChunk::Footer footer;
+        footer.indexOffset = fileOffset;
+        footer.chunks = index.size();
+        footer.records = totalRecords;
+        memcpy(footer.magic, TraceChunk::INDEX_MAGIC, sizeof(footer.magic));
+
+        fwrite(index.data(), sizeof(TraceChunk::IndexEntry), index.size(), traceFile);
+        fwrite(&footer, sizeof(footer), 1, traceFile);
+        fclose(traceFile);
+    }
+
+    delete current;
+    for (std::vector<Chunk*>::iterator it = freeChunks.begin(); it != freeChunks.end(); it++) {
+        delete *it;
+    }
+}
+
+void ArielChunkedTraceGenerator::setCoreID(const uint32_t core) {
+    coreID = core;
+
+    char* tracePath = (char*) malloc(sizeof(char) * PATH_MAX);
+    sprintf(tracePath, "%s-%" PRIu32 ".trace.chk", tracePrefix.c_str(), core);
+
+    traceFile = fopen(tracePath, "wb");
+    if (NULL == traceFile) {
+        output.fatal(CALL_INFO, -1, "Error: unable to open trace file %s\n", tracePath);
+    }
+
+    free(tracePath);
+
+    TraceChunk::FileHeader header;
+    memcpy(header.magic, TraceChunk::FILE_MAGIC, sizeof(header.magic));
+    header.version = TraceChunk::VERSION;
+    header.recordSize = TraceChunk::RECORD_SIZE;
+    fwrite(&header, sizeof(header), 1, traceFile);
+    fileOffset = sizeof(header);
+}
+
+void ArielChunkedTraceGenerator::startChunk() {
+    {
+        std::lock_guard<std::mutex> lock(chunkLock);
+        if (!freeChunks.empty()) {
+            current = freeChunks.back();
+            freeChunks.pop_back();
+        }
+    }
+
+    if (NULL == current) {
+        current = new Chunk();
+        current->raw.resize(chunkRecords * TraceChunk::RECORD_SIZE);
+    }
+    current->records = 0;
+}
+
+void ArielChunkedTraceGenerator::submitChunk() {
+    Chunk* chunk = current;
+    current = NULL;
+
+    {
+        std::unique_lock<std::mutex> lock(chunkLock);
+        while (pending >= maxPendingChunks) chunkDone.wait(lock);
+        pending++;
+        chunk->seq = nextSeq++;
+    }
+
+    if (NULL == pool) {
+        compressChunk(chunk);
+    } else {
+        pool->submit(std::bind(&ArielChunkedTraceGenerator::compressChunk, this, chunk));
+    }
+}
+
+void ArielChunkedTraceGenerator::compressChunk(Chunk* chunk) {
+    const uLong rawSize = chunk->records * TraceChunk::RECORD_SIZE;
+
+    chunk->codec = TraceChunk::CODEC_NONE;
+    if (TraceChunk::CODEC_ZLIB == codec) {
+        uLongf storedSize = compressBound(rawSize);
+        if (chunk->stored.size() < storedSize) chunk->stored.resize(storedSize);
+
+        // Keep the chunk raw if zlib fails or does not make it smaller
+        if (Z_OK == compress2((Bytef*) chunk->stored.data(), &storedSize, (const Bytef*) chunk->raw.data(), rawSize, compressionLevel)
+                && storedSize < rawSize) {
+            chunk->codec = TraceChunk::CODEC_ZLIB;
+            chunk->stored.resize(storedSize);
+        }
+    }
+
+    // Write this and any following chunks that are ready, in order
+    std::lock_guard<std::mutex> lock(chunkLock);
+    compressed.insert(std::make_pair(chunk->seq, chunk));
+
+    std::map<uint64_t, Chunk*>::iterator next = compressed.begin();
+    while (next != compressed.end() && next->first == nextWrite) {
+        writeChunk(next->second);
+        freeChunks.push_back(next->second);
+        compressed.erase(next++);
+        nextWrite++;
+        pending--;
+    }
+    chunkDone.notify_all();
+}
+
+void ArielChunkedTraceGenerator::writeChunk(Chunk* chunk) {
+    const std::vector<char>& payload = (TraceChunk::CODEC_NONE == chunk->codec) ? chunk->raw : chunk->stored;
+
+    TraceChunk::ChunkHeader header;
+    header.codec = chunk->codec;
+    header.reserved = 0;
+    header.rawSize = chunk->records * TraceChunk::RECORD_SIZE;
+    header.storedSize = (TraceChunk::CODEC_NONE == chunk->codec) ? header.rawSize : payload.size();
+    header.records = chunk->records;
+    header.firstPicoS = chunk->firstPicoS;
+    header.lastPicoS = chunk->lastPicoS;
+
+    TraceChunk::IndexEntry entry;
+    entry.offset = fileOffset;
+    entry.firstRecord = totalRecords;
+    entry.records = chunk->records;
+    entry.firstPicoS = chunk->firstPicoS;
+    index.push_back(entry);
+
+    fwrite(&header, sizeof(header), 1, traceFile);
+    fwrite(payload.data(), 1, header.storedSize, traceFile);
+
+    fileOffset += sizeof(header) + header.storedSize;
+    totalRecords += chunk->records;
+}
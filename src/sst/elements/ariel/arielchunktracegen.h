@@ -0,0 +1,125 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_ARIEL_CHUNKED_TRACE_GEN
+#define _H_SST_ARIEL_CHUNKED_TRACE_GEN
+
+#include <stdio.h>
+#include <climits>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include <sst/core/params.h>
+#include <sst/core/output.h>
+#include "arieltracegen.h"
+#include "arieltracechunk.h"
+
+namespace SST {
+namespace ArielComponent {
+
+class ArielTraceCompressionPool;
+
+/*
+ * Trace generator that appends records to an in-memory chunk and hands
+ * full chunks to a pool of compression threads shared by all cores, so the
+ * simulation thread only copies 21 bytes per record.  Chunks are written
+ * to the file in order by whichever thread finishes the next one; at most
+ * max_pending_chunks chunks per core are queued before publishEntry waits.
+ * See arieltracechunk.h for the file format.
+ */
+class ArielChunkedTraceGenerator : public ArielTraceGenerator {
+
+    public:
+
+        SST_ELI_REGISTER_MODULE(ArielChunkedTraceGenerator, "ariel", "ChunkedTraceGenerator",
+                SST_ELI_ELEMENT_VERSION(1,0,0), "Provides tracing to an indexed, chunk-compressed file (read by prospero.ProsperoChunkedTraceReader)", "SST::ArielComponent::ArielTraceGenerator")
+
+        SST_ELI_DOCUMENT_PARAMS(
+            { "trace_prefix", "Sets the prefix for the trace file, each core writes <trace_prefix>-<core>.trace.chk", "ariel-core" },
+            { "compression", "Compression for each chunk [zlib|none]", "zlib" },
+            { "compression_level", "zlib compression level, 1 (fastest) to 9 (smallest)", "1" },
+            { "chunk_records", "Number of records in each chunk", "65536" },
+            { "compression_threads", "Number of background compression threads shared by all cores, 0 to compress on the simulation thread", "1" },
+            { "max_pending_chunks", "Maximum number of chunks per core waiting to be compressed or written", "8" } )
+
+        ArielChunkedTraceGenerator(Params& params);
+
+        ~ArielChunkedTraceGenerator();
+
+        void publishEntry(const uint64_t picoS, const uint64_t physAddr,
+                const uint32_t reqLength, const ArielTraceEntryOperation op) {
+            if (NULL == current) startChunk();
+
+            TraceChunk::encodeRecord(&current->raw[current->records * TraceChunk::RECORD_SIZE],
+                    picoS, (READ == op) ? 'R' : 'W', physAddr, reqLength);
+            if (0 == current->records) current->firstPicoS = picoS;
+            current->lastPicoS = picoS;
+
+            if (++current->records == chunkRecords) submitChunk();
+        }
+
+        void setCoreID(const uint32_t core);
+
+    private:
+        struct Chunk {
+            std::vector<char> raw;
+            std::vector<char> stored;
+            uint64_t seq;
+            uint64_t records;
+            uint64_t firstPicoS;
+            uint64_t lastPicoS;
+            uint32_t codec;
+        };
+
+        void startChunk();
+        void submitChunk();
+        void compressChunk(Chunk* chunk);
+        void writeChunk(Chunk* chunk);
+
+        Output output;
+        std::string tracePrefix;
+        uint32_t coreID;
+        FILE* traceFile;
+
+        uint32_t codec;
+        int compressionLevel;
+        uint64_t chunkRecords;
+        size_t maxPendingChunks;
+        ArielTraceCompressionPool* pool;
+
+        Chunk* current;
+
+        // Shared with the compression threads, protected by chunkLock
+        std::mutex chunkLock;
+        std::condition_variable chunkDone;
+        std::vector<Chunk*> freeChunks;
+        std::map<uint64_t, Chunk*> compressed;     // Compressed but waiting for an earlier chunk to be written
+        uint64_t nextSeq;
+        uint64_t nextWrite;
+        size_t pending;
+
+        // Only touched while writing, in chunk order
+        uint64_t fileOffset;
+        uint64_t totalRecords;
+        std::vector<TraceChunk::IndexEntry> index;
+};
+
+}
+}
+
+#endif
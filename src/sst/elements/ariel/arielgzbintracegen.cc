@@ -19,16 +19,21 @@
 
 using namespace SST::ArielComponent;
 
+#define ARIEL_GZ_RECORD_SIZE (sizeof(uint64_t) + sizeof(char) + sizeof(uint64_t) + sizeof(uint32_t))
+#define ARIEL_GZ_BUFFER_RECORDS 4096
+
 ArielCompressedBinaryTraceGenerator::ArielCompressedBinaryTraceGenerator(Params& params) :
     ArielTraceGenerator() {
 
     tracePrefix = params.find<std::string>("trace_prefix", "ariel-core");
     coreID = 0;
 
-    buffer = (char*) malloc(sizeof(uint64_t) + sizeof(uint64_t) + sizeof(char) + sizeof(uint32_t));
+    buffer = (char*) malloc(ARIEL_GZ_RECORD_SIZE * ARIEL_GZ_BUFFER_RECORDS);
+    bufferUsed = 0;
 }
 
 ArielCompressedBinaryTraceGenerator::~ArielCompressedBinaryTraceGenerator() {
+    flush();
     gzclose(traceFile);
     free(buffer);
 }
@@ -40,12 +45,24 @@ void ArielCompressedBinaryTraceGenerator::publishEntry(const uint64_t picoS,
 		
     const char op_type = (READ == op) ? 'R' : 'W';
 
-    copy(&buffer[0], &picoS, sizeof(uint64_t));
-    copy(&buffer[sizeof(uint64_t)], &op_type, sizeof(char));
-    copy(&buffer[sizeof(uint64_t) + sizeof(char)], &physAddr, sizeof(uint64_t));
-    copy(&buffer[sizeof(uint64_t) + sizeof(char) + sizeof(uint64_t)], &reqLength, sizeof(uint32_t));
+    char* record = &buffer[bufferUsed];
+
+    copy(&record[0], &picoS, sizeof(uint64_t));
+    copy(&record[sizeof(uint64_t)], &op_type, sizeof(char));
+    copy(&record[sizeof(uint64_t) + sizeof(char)], &physAddr, sizeof(uint64_t));
+    copy(&record[sizeof(uint64_t) + sizeof(char) + sizeof(uint64_t)], &reqLength, sizeof(uint32_t));
+
+    bufferUsed += ARIEL_GZ_RECORD_SIZE;
+    if (bufferUsed == ARIEL_GZ_RECORD_SIZE * ARIEL_GZ_BUFFER_RECORDS) {
+        flush();
+    }
+}
 
-    gzwrite(traceFile, buffer, sizeof(uint64_t) + sizeof(char) + sizeof(uint64_t) + sizeof(uint32_t));
+void ArielCompressedBinaryTraceGenerator::flush() {
+    if (bufferUsed > 0) {
+        gzwrite(traceFile, buffer, (unsigned int) bufferUsed);
+        bufferUsed = 0;
+    }
 }
 
 void ArielCompressedBinaryTraceGenerator::setCoreID(const uint32_t core) {
@@ -46,11 +46,13 @@ class ArielCompressedBinaryTraceGenerator : public ArielTraceGenerator {
 
     private:
         void copy(char* dest, const void* src, const size_t length);
+        void flush();
 
         gzFile traceFile;
         std::string tracePrefix;
         uint32_t coreID;
         char* buffer;
+        size_t bufferUsed;      // Records are batched so gzwrite is called once per buffer, not per record
 
 };
 
@@ -62,6 +62,11 @@ class ArielMemoryManager : public SubComponent {
         /** Return the physical address for the request virtual address */
         virtual uint64_t translateAddress(uint64_t virtAddr) = 0;
 
+        /** Translate on behalf of a core, managers with per-core translation caches override this */
+        virtual uint64_t translateCoreAddress(uint32_t core, uint64_t virtAddr) {
+            return translateAddress(virtAddr);
+        }
+
         /** Request to allocate a malloc, not supported by all memory managers */
         virtual bool allocateMalloc(const uint64_t size, const uint32_t level, const uint64_t virtualAddress, const uint64_t instructionPointer, const uint32_t thread) {
             output->verbose(CALL_INFO, 4, 0, "The instantiated ArielMemoryManager does not support malloc handling.\n");
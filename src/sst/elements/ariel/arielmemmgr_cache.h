@@ -21,11 +21,13 @@
 #include <sst/core/rng/marsaglia.h>
 
 #include <stdint.h>
+#include <algorithm>
 #include <deque>
 #include <vector>
 #include <unordered_map>
 
 #include "arielmemmgr.h"
+#include "arielpagetable.h"
 
 using namespace SST;
 using namespace SST::RNG;
@@ -39,7 +41,16 @@ enum ArielPageMappingPolicy {
     RANDOMIZED
 };
 
-/* Base class for memory managers that cache translation addresses */
+/*
+ * Base class for memory managers that cache translation addresses
+ *
+ * Each core has a direct-mapped software TLB indexed by the virtual
+ * address granule (the smallest page size of the manager).  An entry holds
+ * a virtual range, clipped to its granule, and the physical address of its
+ * start, so a hit is one compare and an add.  Misses go to the manager's
+ * page tables through walkTranslation().  Because an entry never leaves its
+ * granule, a range can be shot down by visiting the granules it covers.
+ */
 class ArielMemoryManagerCache : public ArielMemoryManager{ 
 
     public:
@@ -47,12 +58,12 @@ class ArielMemoryManagerCache : public ArielMemoryManager{
     #define ARIEL_ELI_MEMMGR_CACHE_PARAMS {"verbose", "Verbosity for debugging. Increased numbers for increased verbosity.", "0"},\
         {"vtop_translate",  "Set to yes to perform virt-phys translation (TLB) or no to disable", "yes"},\
         {"pagemappolicy",   "Select the page mapping policy for Ariel [LINEAR|RANDOMIZED]", "LINEAR"},\
-        {"translatecacheentries", "Keep a translation cache of this many entries to improve emulated core performance", "4096"}
+        {"translatecacheentries", "Number of entries in each core's translation cache (rounded up to a power of two), 0 to disable", "4096"}
 
     #define ARIEL_ELI_MEMMGR_CACHE_STATS { "tlb_hits", "Hits in the simple Ariel TLB", "hits", 2 },\
         { "tlb_evicts",           "Number of evictions in the simple Ariel TLB", "evictions", 2 },\
         { "tlb_translate_queries","Number of TLB translations performed", "translations", 2 },\
-        { "tlb_shootdown",        "Number of TLB clears because of page-frees", "shootdowns", 2 },\
+        { "tlb_shootdown",        "Number of TLB range invalidations because of mallocs and frees", "shootdowns", 2 },\
         { "tlb_page_allocs",      "Number of pages allocated by the memory manager", "pages", 2 }
 
         /* Constructor
@@ -82,9 +93,14 @@ class ArielMemoryManagerCache : public ArielMemoryManager{
             output->fatal(CALL_INFO, -8, "Ariel memory manager - unknown page mapping policy \"%s\"\n", mappingPolicy.c_str());
             }
 
-            // Set up translation cache
-            translationCache = new std::unordered_map<uint64_t, uint64_t>();
-            translationCacheEntries = (uint32_t) params.find<uint32_t>("translatecacheentries", 4096);
+            // Set up translation cache, the granule is set by the manager once page sizes are known
+            uint32_t entries = (uint32_t) params.find<uint32_t>("translatecacheentries", 4096);
+            translationCacheEntries = 0;
+            if (entries > 0) {
+                translationCacheEntries = 1;
+                while (translationCacheEntries < entries) translationCacheEntries <<= 1;
+            }
+            tlbGranuleShift = 12;
 
             /* Statistics used by all memory managers; managers may also have their own */
         } // End constructor
@@ -94,15 +110,75 @@ class ArielMemoryManagerCache : public ArielMemoryManager{
 #endif  // inserted by script
         ~ArielMemoryManagerCache() {};
 
+        uint64_t translateAddress(uint64_t virtAddr) {
+            return translateCoreAddress(0, virtAddr);
+        }
+
+        uint64_t translateCoreAddress(uint32_t core, uint64_t virtAddr) {
+            // If translation is disabled, then just return address
+            if ( ! translationEnabled ) {
+                return virtAddr;
+            }
+
+            // Keep track of how many translations we are performing
+            statTranslationQueries->addData(1);
+
+            if (translationCacheEntries == 0) {
+                TranslationExtent extent;
+                walkTranslation(virtAddr, extent);
+                return extent.physStart + (virtAddr - extent.virtStart);
+            }
+
+            if (core >= coreTLBs.size()) {
+                coreTLBs.resize(core + 1, std::vector<TranslationExtent>(translationCacheEntries));
+            }
+
+            const uint64_t granule = virtAddr >> tlbGranuleShift;
+            TranslationExtent& entry = coreTLBs[core][granule & (translationCacheEntries - 1)];
+            if (virtAddr - entry.virtStart < entry.length) {
+                statTranslationCacheHits->addData(1);
+                return entry.physStart + (virtAddr - entry.virtStart);
+            }
+
+            TranslationExtent extent;
+            walkTranslation(virtAddr, extent);
+            const uint64_t physAddr = extent.physStart + (virtAddr - extent.virtStart);
+
+            // Clip to the granule so the entry can be found by a range shootdown
+            const uint64_t granuleStart = granule << tlbGranuleShift;
+            const uint64_t granuleEnd = granuleStart + (UINT64_C(1) << tlbGranuleShift);
+            uint64_t start = extent.virtStart > granuleStart ? extent.virtStart : granuleStart;
+            uint64_t end = extent.virtStart + extent.length;
+            if (end < extent.virtStart || end > granuleEnd) end = granuleEnd;   // Guard wrap-around
+
+            if (entry.length != 0) statTranslationCacheEvict->addData(1);
+            entry.virtStart = start;
+            entry.length = end - start;
+            entry.physStart = extent.physStart + (start - extent.virtStart);
+            return physAddr;
+        }
+
     protected:
+        /* A contiguous virtual range and the physical address it starts at */
+        struct TranslationExtent {
+            TranslationExtent() : virtStart(0), length(0), physStart(0) { }
+            uint64_t virtStart;
+            uint64_t length;
+            uint64_t physStart;
+        };
+
+        /* Find (allocating on a miss) the mapping containing 'virtAddr' */
+        virtual void walkTranslation(uint64_t virtAddr, TranslationExtent& extent) = 0;
+
         Statistic<uint64_t>* statTranslationCacheHits;
         Statistic<uint64_t>* statTranslationCacheEvict;
         Statistic<uint64_t>* statTranslationQueries;
         Statistic<uint64_t>* statTranslationShootdown;
         Statistic<uint64_t>* statPageAllocationCount;
 
-        std::unordered_map<uint64_t, uint64_t>* translationCache;
+        std::vector<std::vector<TranslationExtent> > coreTLBs;
         uint32_t translationCacheEntries;
+        unsigned tlbGranuleShift;
         bool translationEnabled;
         ArielPageMappingPolicy mapPolicy;
 
@@ -148,7 +224,7 @@ class ArielMemoryManagerCache : public ArielMemoryManager{
             }
         }
 
-        void populatePageTable(std::string popFilePath, std::unordered_map<uint64_t, uint64_t> * pageTable, std::deque<uint64_t>* freePagePool, uint64_t pageSize) {
+        void populatePageTable(std::string popFilePath, ArielPageTable* pageTable, std::deque<uint64_t>* freePagePool, uint64_t pageSize) {
             FILE * popFile = fopen(popFilePath.c_str(), "rt");
             uint64_t pinAddr = 0;
 
@@ -172,21 +248,38 @@ class ArielMemoryManagerCache : public ArielMemoryManager{
                 output->verbose(CALL_INFO, 4, 0, "Pinning address %" PRIu64 " (physical=%" PRIu64 "\n",
                             pinAddr, freePhysical);
 
-                pageTable->insert( std::pair<uint64_t, uint64_t>( pinAddr, freePhysical ) );
+                pageTable->insert(pinAddr, freePhysical);
             }
 
             fclose(popFile);
         }
 
-        void cacheTranslation(uint64_t virtualA, uint64_t physicalA) {
-            // Remove the oldest entry if we do not have enough slots TODO is begin() really the oldest...?
-            if(translationCache->size() == translationCacheEntries) {
-            statTranslationCacheEvict->addData(1);
-            translationCache->erase(translationCache->begin());
-            }
+        /* Index the translation caches by the largest power of two that is at most 'pageSize' */
+        void setTranslationGranule(uint64_t pageSize) {
+            tlbGranuleShift = 0;
+            while (tlbGranuleShift < 63 && (UINT64_C(2) << tlbGranuleShift) <= pageSize) tlbGranuleShift++;
+        }
 
-            // Insert the translated entry into the cache
-            translationCache->insert(std::pair<uint64_t, uint64_t>(virtualA, physicalA));
+        /* Invalidate every cached translation that overlaps [virtStart, virtStart + length) */
+        void shootdownTranslations(uint64_t virtStart, uint64_t length) {
+            if (coreTLBs.empty() || length == 0) return;
+            statTranslationShootdown->addData(1);
+
+            const uint64_t first = virtStart >> tlbGranuleShift;
+            const uint64_t last = (virtStart + length - 1) >> tlbGranuleShift;
+            const bool flushAll = (last - first) >= translationCacheEntries || last < first;
+
+            for (std::vector<std::vector<TranslationExtent> >::iterator tlb = coreTLBs.begin(); tlb != coreTLBs.end(); tlb++) {
+                if (flushAll) {
+                    std::fill(tlb->begin(), tlb->end(), TranslationExtent());
+                    continue;
+                }
+                for (uint64_t g = first; g <= last; g++) {
+                    TranslationExtent& entry = (*tlb)[g & (translationCacheEntries - 1)];
+                    if (entry.length != 0 && entry.virtStart < virtStart + length && virtStart < entry.virtStart + entry.length)
+                        entry = TranslationExtent();
+                }
+            }
         }
 
 };
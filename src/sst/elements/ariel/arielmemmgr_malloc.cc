@@ -31,13 +31,8 @@ ArielMemoryManagerMalloc::ArielMemoryManagerMalloc(ComponentId_t id, Params& par
     freePages = (std::deque<uint64_t>**) malloc(sizeof(std::deque<uint64_t>*) * memoryLevels);
     pageSizes = (uint64_t*) malloc(sizeof(uint64_t) * memoryLevels);
 
-    // PageAllocation and PageTable structures
-    pageAllocations = (std::unordered_map<uint64_t, uint64_t>**) malloc(sizeof(std::unordered_map<uint64_t, uint64_t>*) * memoryLevels);
-    pageTables = (std::unordered_map<uint64_t, uint64_t>**) malloc(sizeof(std::unordered_map<uint64_t, uint64_t>*) * memoryLevels);
-    for (uint32_t i = 0; i <memoryLevels; ++i) {
-        pageAllocations[i] = new std::unordered_map<uint64_t, uint64_t>();
-        pageTables[i] = new std::unordered_map<uint64_t, uint64_t>();
-    }
+    // PageTable structures, created once each level's page size is known
+    pageTables = (ArielPageTable**) malloc(sizeof(ArielPageTable*) * memoryLevels);
 
     // Initialize data structures
     char * level_buffer = (char*) malloc(sizeof(char) * 256);
@@ -47,6 +42,7 @@ ArielMemoryManagerMalloc::ArielMemoryManagerMalloc(ComponentId_t id, Params& par
         sprintf(level_buffer, "pagesize%" PRIu32, i);
         pageSizes[i] = (uint64_t) params.find<uint64_t>(level_buffer, 4096);
         output->verbose(CALL_INFO, 2, 0, "Level %" PRIu32 " page size is %" PRIu64 "\n", i, pageSizes[i]);
+        pageTables[i] = new ArielPageTable(pageSizes[i]);
 
         // Page count
         sprintf(level_buffer, "pagecount%" PRIu32, i);
@@ -81,9 +77,20 @@ ArielMemoryManagerMalloc::ArielMemoryManagerMalloc(ComponentId_t id, Params& par
     }
 
     free(level_buffer);
+
+    // Translation caches are indexed by the smallest page size
+    uint64_t minPageSize = pageSizes[0];
+    for (uint32_t i = 1; i < memoryLevels; ++i) {
+        if (pageSizes[i] < minPageSize) minPageSize = pageSizes[i];
+    }
+    setTranslationGranule(minPageSize);
 }
 
 ArielMemoryManagerMalloc::~ArielMemoryManagerMalloc() {
+    for (uint32_t i = 0; i < memoryLevels; ++i) {
+        delete pageTables[i];
+    }
+    free(pageTables);
 }
 
 
@@ -147,7 +154,7 @@ void ArielMemoryManagerMalloc::allocate(const uint64_t size, const uint32_t leve
         const uint64_t nextPhysPage = freePages[level]->front();
         freePages[level]->pop_front();
 
-        pageTables[level]->insert( std::pair<uint64_t, uint64_t>(nextVirtPage, nextPhysPage) );
+        pageTables[level]->insert(nextVirtPage, nextPhysPage);
 
         output->verbose(CALL_INFO, 4, 0, "Allocating memory page, physical page=%" PRIu64 ", virtual page=%" PRIu64 "\n",
                 nextPhysPage, nextVirtPage);
@@ -157,10 +164,6 @@ void ArielMemoryManagerMalloc::allocate(const uint64_t size, const uint32_t leve
 
     output->verbose(CALL_INFO, 4, 0, "Request leaves: %" PRIu32 " free pages at level: %" PRIu32 "\n",
         (uint32_t) freePages[level]->size(), level);
-
-    // Record the complete entry in the allocation table (what we allocated in size against the virtual address)
-    // this means we know how much to free and can translate the address successfully.
-    pageAllocations[level]->insert( std::pair<uint64_t, uint64_t>(virtualAddress, roundedSize) );
 }
 
 /*
@@ -176,21 +179,19 @@ bool ArielMemoryManagerMalloc::allocateMalloc(const uint64_t size, const uint32_
     output->verbose(CALL_INFO, 4, 0, "Allocate malloc received. VA: %" PRIu64 ". Size: %" PRIu64 ". Level: %" PRIu32 ".\n", virtualAddress, size, level);
 
     // Check whether a malloc mapping already exists (i.e., we missed a free)
-    std::map<uint64_t, uint64_t>::iterator it = mallocTranslations.upper_bound(virtualAddress);
-    if (it == mallocTranslations.begin()) it = mallocTranslations.end();
-    else if (!mallocTranslations.empty()) it--;
-
-    if (it != mallocTranslations.end() && it->first <= virtualAddress) {
-        uint64_t primaryAddr = mallocPrimaryVAMap.find(it->first)->second;
-        if (virtualAddress < primaryAddr + (mallocInformation.find(primaryAddr)->second).size) {
-            output->verbose(CALL_INFO, 4, 0, "Found conflicting malloc, freeing address %" PRIu64 "\n", primaryAddr);
-            freeMalloc(primaryAddr);
+    std::map<uint64_t, mallocInfo>::iterator it = mallocInformation.upper_bound(virtualAddress);
+    if (it != mallocInformation.begin()) {
+        it--;
+        if (virtualAddress < it->first + it->second.size) {
+            output->verbose(CALL_INFO, 4, 0, "Found conflicting malloc, freeing address %" PRIu64 "\n", it->first);
+            freeMalloc(it->first);
         }
     }
 
     // Allocate new page(s). Round malloc to nearest whole page TODO fix so we can map partial pages -> needs a local VA->Ariel_VA mapping
-    uint64_t pageCount = size / pageSizes[level];
-    if (size % pageSizes[level] != 0) pageCount++;
+    const uint64_t pageSize = pageSizes[level];
+    uint64_t pageCount = size / pageSize;
+    if (size % pageSize != 0) pageCount++;
 
     // Check whether enough pages are available
     if (freePages[level]->size() < pageCount) {
@@ -198,26 +199,28 @@ bool ArielMemoryManagerMalloc::allocateMalloc(const uint64_t size, const uint32_
         return false;
     }
 
-    // Allocate the pages
-    std::unordered_set<uint64_t>* virtualPages = new std::unordered_set<uint64_t>;
-    uint64_t nextVirtPage = virtualAddress;
-    uint64_t firstPhysAddr, lastPhysAddr;
-    firstPhysAddr = freePages[level]->front();
+    // Allocate the pages, merging physically contiguous pages into a single run
+    mallocInfo info(size, level);
+    uint64_t firstPhysAddr = freePages[level]->front();
+    uint64_t lastPhysAddr = firstPhysAddr;
     for (uint64_t i = 0; i != pageCount; i++) {
-        uint64_t nextPhysPage = freePages[level]->front();
-        mallocTranslations.insert(std::make_pair(nextVirtPage, nextPhysPage));
-        mallocPrimaryVAMap.insert(std::make_pair(nextVirtPage, virtualAddress));
+        const uint64_t nextPhysPage = freePages[level]->front();
         freePages[level]->pop_front();
-        virtualPages->insert(nextVirtPage);
-        nextVirtPage += pageSizes[level];
+        if (!info.runs.empty() && info.runs.back().physStart + info.runs.back().length == nextPhysPage) {
+            info.runs.back().length += pageSize;
+        } else {
+            info.runs.push_back(mallocRun(i * pageSize, pageSize, nextPhysPage));
+        }
         lastPhysAddr = nextPhysPage;
     }
 
-    output->verbose(CALL_INFO, 4, 0, "Malloc mapped %" PRIu64 " to [%" PRIu64 ", %" PRIu64 "] (%" PRIu64 " pages).\n", virtualAddress, firstPhysAddr, lastPhysAddr, pageCount);
+    output->verbose(CALL_INFO, 4, 0, "Malloc mapped %" PRIu64 " to [%" PRIu64 ", %" PRIu64 "] (%" PRIu64 " pages, %" PRIu64 " runs).\n",
+            virtualAddress, firstPhysAddr, lastPhysAddr, pageCount, (uint64_t) info.runs.size());
+
+    // Record malloc; cached translations for the range belong to whatever was mapped there before
+    mallocInformation.insert(std::make_pair(virtualAddress, info));
+    shootdownTranslations(virtualAddress, size);
 
-    // Record malloc
-    mallocInformation.insert(std::make_pair(virtualAddress, mallocInfo(size, level, virtualPages)));
-    
     statBytesAlloc[level]->addData(size);
     return true;
 }
@@ -225,125 +228,140 @@ bool ArielMemoryManagerMalloc::allocateMalloc(const uint64_t size, const uint32_
 
 void ArielMemoryManagerMalloc::freeMalloc(const uint64_t virtualAddress) {
     output->verbose(CALL_INFO, 4, 0, "Freeing %" PRIu64 "\n", virtualAddress);
-    
+
     // Lookup VA in mallocInformation
     std::map<uint64_t, mallocInfo>::iterator it = mallocInformation.find(virtualAddress);
     if (it == mallocInformation.end()) return;
-    
-    statBytesFree[it->second.level]->addData(it->second.size);
-
-    // Free each VA in mallocInformation from mallocTranslations & mallocPrimaryVAMap TODO fix so that mapping stays but address is available for future mallocs
-    std::unordered_set<uint64_t>* myKeys = (it->second.VAKeys);
-    for (std::unordered_set<uint64_t>::iterator vaIt = myKeys->begin(); vaIt != myKeys->end(); vaIt++) {
-        mallocPrimaryVAMap.erase(*vaIt);
-        freePages[(it->second).level]->push_front(mallocTranslations.find(*vaIt)->second);
-        mallocTranslations.erase(*vaIt);
-    }
-
-    // Remove mallocInformation entry
-    delete myKeys;
-    mallocInformation.erase(virtualAddress);
-}
 
+    const mallocInfo& info = it->second;
+    statBytesFree[info.level]->addData(info.size);
 
-uint64_t ArielMemoryManagerMalloc::translateAddress(uint64_t virtAddr) {
-    // If translation is disabled, then just return address
-    if( ! translationEnabled ) {
-        return virtAddr;
+    // Return the pages to the free pool, in order, at the front TODO fix so that mapping stays but address is available for future mallocs
+    const uint64_t pageSize = pageSizes[info.level];
+    for (std::vector<mallocRun>::const_reverse_iterator run = info.runs.rbegin(); run != info.runs.rend(); run++) {
+        for (uint64_t off = run->length; off != 0; off -= pageSize) {
+            freePages[info.level]->push_front(run->physStart + off - pageSize);
+        }
     }
 
-    // Keep track of how many translations we are performing
-    statTranslationQueries->addData(1);
+    shootdownTranslations(virtualAddress, info.size);
 
-    uint64_t physAddr = (uint64_t) -1;
-    bool found = false;
+    // Remove mallocInformation entry
+    mallocInformation.erase(it);
+}
 
-    output->verbose(CALL_INFO, 4, 0, "Page Table: translate virtual address %" PRIu64 "\n", virtAddr);
 
-    // Check the translation cache otherwise carry on
-    auto checkCache = translationCache->find(virtAddr);
-    if(checkCache != translationCache->end()) {
-        statTranslationCacheHits->addData(1);
-        return checkCache->second;
-    }
+/*
+ *  Find an existing mapping for virtAddr: mallocs take precedence over demand-allocated pages
+ */
+bool ArielMemoryManagerMalloc::findTranslation(uint64_t virtAddr, TranslationExtent& extent) {
+    // The extent returned is clipped to the range where this mapping is the one that applies,
+    // i.e., to the gap between mallocs and, for demand pages, to pages of higher-priority levels
+    uint64_t lowBound = 0;
+    uint64_t highBound = ~(uint64_t)0;
 
     // Check malloc mappings
-    if (!mallocTranslations.empty()) {
-        std::map<uint64_t, uint64_t>::iterator it = mallocTranslations.upper_bound(virtAddr);
-        if (it == mallocTranslations.begin()) it = mallocTranslations.end();
-        else it--;
-
-        if (it != mallocTranslations.end() && (it->first <= virtAddr)) {
-            uint64_t primaryAddr = mallocPrimaryVAMap.find(it->first)->second;
-            if (virtAddr < (primaryAddr + (mallocInformation.find(primaryAddr)->second).size)) {
-                uint64_t offset = virtAddr - it->first;
-                physAddr = offset + it->second;
-                found = true;
+    std::map<uint64_t, mallocInfo>::iterator next = mallocInformation.upper_bound(virtAddr);
+    if (next != mallocInformation.end()) highBound = next->first;
+    if (next != mallocInformation.begin()) {
+        std::map<uint64_t, mallocInfo>::iterator it = next;
+        it--;
+        const mallocInfo& info = it->second;
+        const uint64_t offset = virtAddr - it->first;
+        if (offset < info.size) {
+            // Find the run holding offset
+            std::vector<mallocRun>::const_iterator run = info.runs.begin();
+            if (info.runs.size() > 1) {
+                size_t lo = 0, hi = info.runs.size();
+                while (hi - lo > 1) {
+                    size_t mid = (lo + hi) / 2;
+                    if (info.runs[mid].offset <= offset) lo = mid;
+                    else hi = mid;
+                }
+                run += lo;
             }
+            extent.virtStart = it->first + run->offset;
+            extent.length = std::min(run->length, info.size - run->offset);
+            extent.physStart = run->physStart;
+            clipExtent(extent, lowBound, highBound);
+            return true;
         }
+        lowBound = it->first + info.size;
     }
 
     // We will have to search every memory level to find where the address lies
-    for(uint32_t i = 0; i < memoryLevels; ++i) {
-        if (!found) {
-        std::unordered_map<uint64_t, uint64_t>::iterator page_itr;
+    for (uint32_t i = 0; i < memoryLevels; ++i) {
         const uint64_t pageSize = pageSizes[i];
-            const uint64_t page_offset = virtAddr % pageSize;
+        const uint64_t page_offset = virtAddr % pageSize;
         const uint64_t page_start = virtAddr - page_offset;
+        uint64_t phys_page;
 
-        page_itr = pageTables[i]->find(page_start);
+        if (pageTables[i]->find(page_start, &phys_page)) {
+            output->verbose(CALL_INFO, 4, 0, "Page table hit: virtual address=%" PRIu64 " hit in level: %" PRIu32 ", virtual page start=%" PRIu64 ", virtual end=%" PRIu64 ", translates to phys page start=%" PRIu64 " translates to: phys address: %" PRIu64 " (offset added to phys start=%" PRIu64 ")\n",
+                virtAddr, i, page_start, page_start + pageSize, phys_page, phys_page + page_offset, page_offset);
 
-            if (page_itr != pageTables[i]->end()) {
-                // Located
-            physAddr = page_itr->second + page_offset;
+            extent.virtStart = page_start;
+            extent.length = pageSize;
+            extent.physStart = phys_page;
+            clipExtent(extent, lowBound, highBound);
+            return true;
+        }
 
-                output->verbose(CALL_INFO, 4, 0, "Page table hit: virtual address=%" PRIu64 " hit in level: %" PRIu32 ", virtual page start=%" PRIu64 ", virtual end=%" PRIu64 ", translates to phys page start=%" PRIu64 " translates to: phys address: %" PRIu64 " (offset added to phys start=%" PRIu64 ")\n",
-                    virtAddr, i, page_itr->first, page_itr->first + pageSize, page_itr->second, physAddr, page_offset);
+        // Nothing in this level's page, so a lower level's mapping applies within it at most
+        if (page_start > lowBound) lowBound = page_start;
+        if (page_start + pageSize - 1 < highBound - 1) highBound = page_start + pageSize;
+    }
+    return false;
+}
 
-            found = true;
-            break;
-        }
-        } else {
-            break;
-        }
+
+void ArielMemoryManagerMalloc::clipExtent(TranslationExtent& extent, uint64_t lowBound, uint64_t highBound) {
+    if (extent.virtStart < lowBound) {
+        const uint64_t skip = lowBound - extent.virtStart;
+        extent.virtStart = lowBound;
+        extent.physStart += skip;
+        extent.length -= skip;
+    }
+    if (extent.length > highBound - extent.virtStart) {
+        extent.length = highBound - extent.virtStart;
     }
+}
 
-    if(found) {
-        cacheTranslation(virtAddr, physAddr);
-        return physAddr;
-    } else {
-        output->verbose(CALL_INFO, 4, 0, "Page table miss for virtual address: %" PRIu64 "\n", virtAddr);
-
-        // We did not find the address in memory, that means we should allocate it one from our default pool
-        uint64_t offset = virtAddr % pageSizes[defaultLevel];
-
-        output->verbose(CALL_INFO, 4, 0, "Page offset calculation (generating a new page allocation request) for address %" PRIu64 ", offset=%" PRIu64 ", requesting virtual map to address: %" PRIu64 "\n",
-                virtAddr, offset, (virtAddr - offset));
-
-        // Perform an allocation so we can then re-find the address
-        // Attempt defaultLevel but fall through to other levels if needed/available
-            if (canAllocateInLevel(8, defaultLevel)) {
-                allocate(8, defaultLevel, virtAddr - offset);
-            } else {
-                bool allocated = false;
-                for (uint32_t i = 0; i < memoryLevels; i++) {
-                    if (canAllocateInLevel(8, i)) {
-                        offset = virtAddr % pageSizes[i];
-                        allocate(8, i, virtAddr - offset);
-                        allocated = true;
-                        break;
-                    }
-                }
-                if (!allocated) output->fatal(CALL_INFO, -1, "Attempted to allocate page for address %" PRIu64 " but no free pages are available\n", virtAddr);
-            }
 
-        // Now attempt to refind it
-        const uint64_t newPhysAddr = translateAddress(virtAddr);
+void ArielMemoryManagerMalloc::walkTranslation(uint64_t virtAddr, TranslationExtent& extent) {
+    output->verbose(CALL_INFO, 4, 0, "Page Table: translate virtual address %" PRIu64 "\n", virtAddr);
+
+    if (findTranslation(virtAddr, extent)) return;
+
+    output->verbose(CALL_INFO, 4, 0, "Page table miss for virtual address: %" PRIu64 "\n", virtAddr);
 
-        output->verbose(CALL_INFO, 4, 0, "Page allocation routine mapped to address: %" PRIu64 "\n", newPhysAddr );
+    // We did not find the address in memory, that means we should allocate it one from our default pool
+    uint64_t offset = virtAddr % pageSizes[defaultLevel];
 
-        return newPhysAddr;
+    output->verbose(CALL_INFO, 4, 0, "Page offset calculation (generating a new page allocation request) for address %" PRIu64 ", offset=%" PRIu64 ", requesting virtual map to address: %" PRIu64 "\n",
+            virtAddr, offset, (virtAddr - offset));
+
+    // Perform an allocation so we can then re-find the address
+    // Attempt defaultLevel but fall through to other levels if needed/available
+    if (canAllocateInLevel(8, defaultLevel)) {
+        allocate(8, defaultLevel, virtAddr - offset);
+    } else {
+        bool allocated = false;
+        for (uint32_t i = 0; i < memoryLevels; i++) {
+            if (canAllocateInLevel(8, i)) {
+                offset = virtAddr % pageSizes[i];
+                allocate(8, i, virtAddr - offset);
+                allocated = true;
+                break;
+            }
+        }
+        if (!allocated) output->fatal(CALL_INFO, -1, "Attempted to allocate page for address %" PRIu64 " but no free pages are available\n", virtAddr);
     }
+
+    // Now attempt to refind it
+    findTranslation(virtAddr, extent);
+
+    output->verbose(CALL_INFO, 4, 0, "Page allocation routine mapped to address: %" PRIu64 "\n", extent.physStart + (virtAddr - extent.virtStart));
 }
 
 void ArielMemoryManagerMalloc::printStats() {
@@ -24,8 +24,8 @@
 
 #include <stdint.h>
 #include <deque>
+#include <map>
 #include <vector>
-#include <unordered_map>
 
 using namespace SST;
 
@@ -63,34 +63,44 @@ class ArielMemoryManagerMalloc : public ArielMemoryManagerCache {
         void setDefaultPool(uint32_t pool);
         uint32_t getDefaultPool();
 
-        uint64_t translateAddress(uint64_t virtAddr);
         void printStats();
 
         void freeMalloc(const uint64_t vAddr);
         bool allocateMalloc(const uint64_t size, const uint32_t level, const uint64_t virtualAddress, const uint64_t instructionPointer, const uint32_t thread);
         
+    protected:
+        void walkTranslation(uint64_t virtAddr, TranslationExtent& extent);
+
     private:
         void allocate(const uint64_t size, const uint32_t level, const uint64_t virtualAddress);
         bool canAllocateInLevel(const uint64_t size, const uint32_t level);
+        bool findTranslation(uint64_t virtAddr, TranslationExtent& extent);
+        void clipExtent(TranslationExtent& extent, uint64_t lowBound, uint64_t highBound);
+
+        /* Physically contiguous run of pages within a malloc */
+        struct mallocRun {
+            uint64_t offset;    // from the malloc's virtual address
+            uint64_t length;
+            uint64_t physStart;
+            mallocRun(uint64_t offset, uint64_t length, uint64_t physStart) : offset(offset), length(length), physStart(physStart) {};
+        };
 
+        /* A malloc is a single virtual interval backed by one or more physical runs */
         struct mallocInfo {
             uint64_t size;
             uint32_t level;
-            std::unordered_set<uint64_t>* VAKeys;
-            mallocInfo(uint64_t size, uint32_t level, std::unordered_set<uint64_t>* VAKeys) : size(size), level(level), VAKeys(VAKeys) {};
+            std::vector<mallocRun> runs;
+            mallocInfo(uint64_t size, uint32_t level) : size(size), level(level) {};
         };
 
-        std::map<uint64_t, uint64_t> mallocPrimaryVAMap;    // Map VA of each PA to the primary VA of the malloc -> used to find the mallocInfo
-        std::map<uint64_t, uint64_t> mallocTranslations;    // Map VA to PA for mallocs -> primary lookup
-        std::map<uint64_t, mallocInfo> mallocInformation;   // Map mallocID to information about the malloc -> use for frees/allocs
+        std::map<uint64_t, mallocInfo> mallocInformation;   // Map malloc VA to its interval -> used for translation, frees and allocs
 
         uint32_t defaultLevel;
         uint32_t memoryLevels;
         uint64_t* pageSizes;
 
         std::deque<uint64_t>** freePages;
-        std::unordered_map<uint64_t, uint64_t>** pageAllocations;
-        std::unordered_map<uint64_t, uint64_t>** pageTables;
+        ArielPageTable** pageTables;
 
         std::vector<Statistic<uint64_t>* > statBytesAlloc;
         std::vector<Statistic<uint64_t>* > statBytesFree;
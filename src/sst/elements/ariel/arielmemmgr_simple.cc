@@ -29,6 +29,9 @@ ArielMemoryManagerSimple::ArielMemoryManagerSimple(ComponentId_t id, Params& par
     uint64_t pageCount = (uint64_t) params.find<uint64_t>("pagecount0", 131072);
     output->verbose(CALL_INFO, 2, 0, "Page count is %" PRIu64 "\n", pageCount);
 
+    pageTable = new ArielPageTable(pageSize);
+    setTranslationGranule(pageSize);
+
     if (mapPolicy == ArielPageMappingPolicy::LINEAR) {
         mapPagesLinear(pageCount, pageSize, 0, &freePages);
     } else {
@@ -40,12 +43,13 @@ ArielMemoryManagerSimple::ArielMemoryManagerSimple(ComponentId_t id, Params& par
     std::string popFilePath = params.find<std::string>("page_populate_0", "");
     if (popFilePath != "") {
         output->verbose(CALL_INFO, 1, 0, "Populating page table from %s...\n", popFilePath.c_str());
-        populatePageTable(popFilePath, &pageTable, &freePages, pageSize);
+        populatePageTable(popFilePath, pageTable, &freePages, pageSize);
     }
     
 }
 
 ArielMemoryManagerSimple::~ArielMemoryManagerSimple() {
+    delete pageTable;
 }
 
 
@@ -77,7 +81,7 @@ void ArielMemoryManagerSimple::allocate(const uint64_t size, const uint32_t leve
         const uint64_t nextPhysPage = freePages.front();
         freePages.pop_front();
 
-        pageTable.insert( std::pair<uint64_t, uint64_t>(nextVirtPage, nextPhysPage) );
+        pageTable->insert(nextVirtPage, nextPhysPage);
 
         output->verbose(CALL_INFO, 4, 0, "Allocating memory page, physical page=%" PRIu64 ", virtual page=%" PRIu64 "\n",
                 nextPhysPage, nextVirtPage);
@@ -90,59 +94,32 @@ void ArielMemoryManagerSimple::allocate(const uint64_t size, const uint32_t leve
 
 }
 
-uint64_t ArielMemoryManagerSimple::translateAddress(uint64_t virtAddr) {
-    // If translation is disabled, then just return address
-    if( ! translationEnabled ) {
-        return virtAddr;
-    }
-
-    // Keep track of how many translations we are performing
-    statTranslationQueries->addData(1);
-
+void ArielMemoryManagerSimple::walkTranslation(uint64_t virtAddr, TranslationExtent& extent) {
     output->verbose(CALL_INFO, 4, 0, "Page Table: translate virtual address %" PRIu64 "\n", virtAddr);
 
-    // Check the translation cache otherwise carry on
-    auto checkCache = translationCache->find(virtAddr);
-    if(checkCache != translationCache->end()) {
-        statTranslationCacheHits->addData(1);
-        return checkCache->second;
-    }
-
-    std::unordered_map<uint64_t, uint64_t>::iterator page_itr;
     const uint64_t page_offset = virtAddr % pageSize;
     const uint64_t page_start = virtAddr - page_offset;
+    uint64_t phys_page;
 
-    page_itr = pageTable.find(page_start);
-
-    if(page_itr != pageTable.end()) {
-        // Located
-        uint64_t physAddr = page_itr->second + page_offset;
-
-        output->verbose(CALL_INFO, 4, 0, "Page table hit: virtual address=%" PRIu64 " hit, virtual page start=%" PRIu64 ", virtual end=%" PRIu64 ", translates to phys page start=%" PRIu64 " translates to: phys address: %" PRIu64 " (offset added to phys start=%" PRIu64 ")\n",
-                virtAddr, page_itr->first, page_itr->first + pageSize, page_itr->second, physAddr, page_offset);
-
-        cacheTranslation(virtAddr, physAddr);
-        return physAddr;
-
-    } else {
+    if (!pageTable->find(page_start, &phys_page)) {
         output->verbose(CALL_INFO, 4, 0, "Page table miss for virtual address: %" PRIu64 "\n", virtAddr);
 
         // We did not find the address in memory, that means we should allocate it one from our default pool
-        uint64_t offset = virtAddr % pageSize;
-
         output->verbose(CALL_INFO, 4, 0, "Page offset calculation (generating a new page allocation request) for address %" PRIu64 ", offset=%" PRIu64 ", requesting virtual map to address: %" PRIu64 "\n",
-                virtAddr, offset, (virtAddr - offset));
-
-        // Perform an allocation so we can then re-find the address
-        allocate(8, 0, virtAddr - offset);
+                virtAddr, page_offset, page_start);
 
-        // Now attempt to refind it
-        const uint64_t newPhysAddr = translateAddress(virtAddr);
+        allocate(8, 0, page_start);
+        pageTable->find(page_start, &phys_page);
 
-        output->verbose(CALL_INFO, 4, 0, "Page allocation routine mapped to address: %" PRIu64 "\n", newPhysAddr );
-
-        return newPhysAddr;
+        output->verbose(CALL_INFO, 4, 0, "Page allocation routine mapped to address: %" PRIu64 "\n", phys_page + page_offset);
+    } else {
+        output->verbose(CALL_INFO, 4, 0, "Page table hit: virtual address=%" PRIu64 " hit, virtual page start=%" PRIu64 ", virtual end=%" PRIu64 ", translates to phys page start=%" PRIu64 " translates to: phys address: %" PRIu64 " (offset added to phys start=%" PRIu64 ")\n",
+                virtAddr, page_start, page_start + pageSize, phys_page, phys_page + page_offset, page_offset);
     }
+
+    extent.virtStart = page_start;
+    extent.length = pageSize;
+    extent.physStart = phys_page;
 }
 
 void ArielMemoryManagerSimple::printStats() {
@@ -152,10 +129,10 @@ void ArielMemoryManagerSimple::printStats() {
     output->output("Page Table Sizes:\n");
 
     output->output("- Map entries         %" PRIu32 "\n",
-        (uint32_t) pageTable.size());
+        (uint32_t) pageTable->size());
 
     output->output("Page Table Coverages:\n");
 
     output->output("- Bytes               %" PRIu64 "\n",
-        ((uint64_t) pageTable.size()) * ((uint64_t) pageSize));
+        pageTable->size() * ((uint64_t) pageSize));
 }
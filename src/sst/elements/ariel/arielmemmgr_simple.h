@@ -22,7 +22,6 @@
 #include <stdint.h>
 #include <deque>
 #include <vector>
-#include <unordered_map>
 
 #include "arielmemmgr_cache.h"
 
@@ -53,16 +52,18 @@ class ArielMemoryManagerSimple : public ArielMemoryManagerCache {
 #endif  // inserted by script
         ~ArielMemoryManagerSimple();
 
-        uint64_t translateAddress(uint64_t virtAddr);
         void printStats();
 
+    protected:
+        void walkTranslation(uint64_t virtAddr, TranslationExtent& extent);
+
     private:
         void allocate(const uint64_t size, const uint32_t level, const uint64_t virtualAddress);
 
         uint64_t pageSize;
         std::deque<uint64_t> freePages;
 
-        std::unordered_map<uint64_t, uint64_t> pageTable;
+        ArielPageTable* pageTable;
 };
 
 }
@@ -0,0 +1,114 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_ARIEL_PAGE_TABLE
+#define _H_ARIEL_PAGE_TABLE
+
+#include <stdint.h>
+#include <deque>
+
+namespace SST {
+namespace ArielComponent {
+
+/*
+ * Page-granular virtual to physical map used by the Ariel memory managers.
+ *
+ * A radix tree over the virtual page number with 512 entries per node, so
+ * a lookup is a fixed number of array reads.  Nodes are 4KiB and are only
+ * allocated, so memory use depends on how the mapped pages are spread: a
+ * densely mapped range costs about 8 bytes per page, but an isolated page
+ * costs a whole leaf plus any inner nodes on its path (up to 20KiB with
+ * 4KiB pages).  Pages are never unmapped.  Page sizes do not need to be
+ * powers of two.
+ */
+class ArielPageTable {
+
+    public:
+        ArielPageTable(uint64_t pageSize) : pageSize(pageSize), mappedPages(0) {
+            // Enough levels to cover every virtual page number
+            unsigned pageBits = 0;
+            while (pageBits < 63 && (UINT64_C(2) << pageBits) <= pageSize) pageBits++;
+            levels = (64 - pageBits + BITS_PER_LEVEL - 1) / BITS_PER_LEVEL;
+            nodes.push_back(Node());    // Root
+        }
+
+        uint64_t getPageSize() const { return pageSize; }
+
+        /* Number of mapped pages */
+        uint64_t size() const { return mappedPages; }
+
+        /* Look up the physical page for the page-aligned virtual address 'virtPage' */
+        bool find(uint64_t virtPage, uint64_t* physPage) const {
+            const uint64_t vpn = virtPage / pageSize;
+            uint64_t node = 0;
+            for (unsigned level = levels - 1; level > 0; level--) {
+                node = nodes[node].entry[index(vpn, level)];
+                if (node == 0) return false;
+            }
+            const uint64_t leaf = nodes[node].entry[index(vpn, 0)];
+            if (leaf == 0) return false;
+            *physPage = leaf - 1;
+            return true;
+        }
+
+        /* Map 'virtPage' to 'physPage'; an existing mapping is kept and false is returned */
+        bool insert(uint64_t virtPage, uint64_t physPage) {
+            const uint64_t vpn = virtPage / pageSize;
+            uint64_t node = 0;
+            for (unsigned level = levels - 1; level > 0; level--) {
+                const unsigned idx = index(vpn, level);
+                uint64_t next = nodes[node].entry[idx];
+                if (next == 0) {
+                    next = nodes.size();
+                    nodes.push_back(Node());
+                    nodes[node].entry[idx] = next;
+                }
+                node = next;
+            }
+            uint64_t& leaf = nodes[node].entry[index(vpn, 0)];
+            if (leaf != 0) return false;
+            leaf = physPage + 1;    // 0 marks an unmapped entry
+            mappedPages++;
+            return true;
+        }
+
+    private:
+        static const unsigned BITS_PER_LEVEL = 9;
+        static const unsigned ENTRIES = 1 << BITS_PER_LEVEL;
+
+        /* Inner nodes hold child node indices (the root is never a child), leaves hold physical page + 1 */
+        struct Node {
+            Node() {
+                for (unsigned i = 0; i < ENTRIES; i++) entry[i] = 0;
+            }
+            uint64_t entry[ENTRIES];
+        };
+
+        static unsigned index(uint64_t vpn, unsigned level) {
+            const unsigned shift = level * BITS_PER_LEVEL;
+            return shift >= 64 ? 0 : (vpn >> shift) & (ENTRIES - 1);
+        }
+
+        const uint64_t pageSize;
+        unsigned levels;
+        uint64_t mappedPages;
+        std::deque<Node> nodes;     // deque so growing never copies existing nodes
+};
+
+}
+}
+
+#endif
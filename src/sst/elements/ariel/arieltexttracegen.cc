@@ -24,10 +24,12 @@ ArielTextTraceGenerator::ArielTextTraceGenerator(Params& params) :
         
     tracePrefix = params.find<std::string>("trace_prefix", "ariel-core");
     coreID = 0;
+    fileBuffer = NULL;
 }
 
 ArielTextTraceGenerator::~ArielTextTraceGenerator() {
     fclose(textFile);
+    free(fileBuffer);
 }
 
 void ArielTextTraceGenerator::publishEntry(const uint64_t picoS,
@@ -49,6 +51,10 @@ void ArielTextTraceGenerator::setCoreID(const uint32_t core) {
 
     textFile = fopen(tracePath, "wt");
 
+    // Fully buffer the trace, the default stdio buffer forces a write every few dozen records
+    fileBuffer = (char*) malloc(1024 * 1024);
+    setvbuf(textFile, fileBuffer, _IOFBF, 1024 * 1024);
+
     free(tracePath);
 }
 
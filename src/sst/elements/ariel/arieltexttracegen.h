@@ -45,6 +45,7 @@ class ArielTextTraceGenerator : public ArielTraceGenerator {
 
     private:
         FILE* textFile;
+        char* fileBuffer;
         std::string tracePrefix;
         uint32_t coreID;
 
@@ -0,0 +1,104 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_ARIEL_TRACE_CHUNK
+#define _H_SST_ARIEL_TRACE_CHUNK
+
+#include <stdint.h>
+#include <string.h>
+
+namespace SST {
+namespace ArielComponent {
+
+/*
+ * On-disk layout of the chunked trace written by ariel.ChunkedTraceGenerator
+ * and read by prospero.ProsperoChunkedTraceReader.
+ *
+ *   FileHeader
+ *   { ChunkHeader, payload } * chunks
+ *   IndexEntry * chunks
+ *   Footer
+ *
+ * A payload holds ChunkHeader::records fixed-size records, the same
+ * records as the compressed binary trace (picoseconds, 'R'/'W', address,
+ * length), either stored raw or compressed with zlib.  The index at the end
+ * gives the file offset, first record number and first timestamp of every
+ * chunk so a reader can seek; a file without a footer (e.g., an interrupted
+ * run) can still be read by walking the chunk headers.  All fields are in
+ * host byte order.
+ */
+namespace TraceChunk {
+
+static const char FILE_MAGIC[8]  = { 'A', 'R', 'I', 'E', 'L', 'C', 'H', 'K' };
+static const char INDEX_MAGIC[8] = { 'A', 'R', 'I', 'E', 'L', 'I', 'D', 'X' };
+static const uint32_t VERSION = 1;
+static const uint32_t RECORD_SIZE = sizeof(uint64_t) + sizeof(char) + sizeof(uint64_t) + sizeof(uint32_t);
+
+enum Codec {
+    CODEC_NONE = 0,
+    CODEC_ZLIB = 1
+};
+
+struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t recordSize;
+};
+
+struct ChunkHeader {
+    uint32_t codec;
+    uint32_t reserved;
+    uint64_t storedSize;    // Bytes of payload following this header
+    uint64_t rawSize;       // Bytes once decompressed (records * RECORD_SIZE)
+    uint64_t records;
+    uint64_t firstPicoS;
+    uint64_t lastPicoS;
+};
+
+struct IndexEntry {
+    uint64_t offset;        // File offset of the ChunkHeader
+    uint64_t firstRecord;
+    uint64_t records;
+    uint64_t firstPicoS;
+};
+
+struct Footer {
+    uint64_t indexOffset;
+    uint64_t chunks;
+    uint64_t records;
+    char magic[8];
+};
+
+inline void encodeRecord(char* dest, const uint64_t picoS, const char op, const uint64_t addr, const uint32_t length) {
+    memcpy(dest, &picoS, sizeof(uint64_t));
+    dest[sizeof(uint64_t)] = op;
+    memcpy(dest + sizeof(uint64_t) + sizeof(char), &addr, sizeof(uint64_t));
+    memcpy(dest + sizeof(uint64_t) + sizeof(char) + sizeof(uint64_t), &length, sizeof(uint32_t));
+}
+
+inline void decodeRecord(const char* src, uint64_t* picoS, char* op, uint64_t* addr, uint32_t* length) {
+    memcpy(picoS, src, sizeof(uint64_t));
+    *op = src[sizeof(uint64_t)];
+    memcpy(addr, src + sizeof(uint64_t) + sizeof(char), sizeof(uint64_t));
+    memcpy(length, src + sizeof(uint64_t) + sizeof(char) + sizeof(uint64_t), sizeof(uint32_t));
+}
+
+}
+
+}
+}
+
+#endif
@@ -0,0 +1,94 @@
+# Checks a trace written by ariel.ChunkedTraceGenerator (see
+# arieltracechunk.h for the layout):
+#   - every chunk decodes to the record count in its header,
+#   - chunks are in order: the index matches the chunk headers, record
+#     numbers are contiguous and timestamps never go backwards,
+#   - the footer's totals match what was read.
+#
+# Usage: python checkchunktrace.py <chunked trace> [minimum records]
+# Prints the record and chunk counts and exits 0 if the trace is good.
+import struct
+import sys
+import zlib
+
+RECORD_SIZE = 8 + 1 + 8 + 4
+CODEC_NONE = 0
+CODEC_ZLIB = 1
+
+FILE_HEADER = "=8sII"
+CHUNK_HEADER = "=IIQQQQQ"
+INDEX_ENTRY = "=QQQQ"
+FOOTER = "=QQQ8s"
+
+def fail(msg):
+    sys.stderr.write("FAILED: %s\n" % msg)
+    sys.exit(1)
+
+def check(path, minRecords):
+    with open(path, "rb") as f:
+        data = f.read()
+
+    magic, version, recordSize = struct.unpack_from(FILE_HEADER, data, 0)
+    if magic != b"ARIELCHK" or version != 1 or recordSize != RECORD_SIZE:
+        fail("bad file header")
+
+    footerSize = struct.calcsize(FOOTER)
+    indexOffset, numChunks, numRecords, idxMagic = struct.unpack_from(FOOTER, data, len(data) - footerSize)
+    if idxMagic != b"ARIELIDX":
+        fail("no index footer, the run did not finish")
+
+    offset = struct.calcsize(FILE_HEADER)
+    records = 0
+    lastPicoS = 0
+    for chunk in range(numChunks):
+        entry = struct.unpack_from(INDEX_ENTRY, data, indexOffset + chunk * struct.calcsize(INDEX_ENTRY))
+        codec, reserved, storedSize, rawSize, chunkRecords, firstPicoS, chunkLastPicoS = \
+            struct.unpack_from(CHUNK_HEADER, data, offset)
+        if entry != (offset, records, chunkRecords, firstPicoS):
+            fail("chunk %d: index entry %s does not match the chunk at offset %d" % (chunk, entry, offset))
+        if chunkRecords == 0 or rawSize != chunkRecords * RECORD_SIZE:
+            fail("chunk %d: %d records in %d bytes" % (chunk, chunkRecords, rawSize))
+
+        start = offset + struct.calcsize(CHUNK_HEADER)
+        payload = data[start : start + storedSize]
+        if codec == CODEC_ZLIB:
+            try:
+                raw = zlib.decompress(payload)
+            except zlib.error as err:
+                fail("chunk %d: %s" % (chunk, err))
+        elif codec == CODEC_NONE:
+            raw = payload
+        else:
+            fail("chunk %d: unknown codec %d" % (chunk, codec))
+        if len(raw) != rawSize:
+            fail("chunk %d: decodes to %d bytes, expected %d" % (chunk, len(raw), rawSize))
+
+        for r in range(chunkRecords):
+            picoS, op = struct.unpack_from("=Qc", raw, r * RECORD_SIZE)
+            if op not in (b"R", b"W"):
+                fail("chunk %d record %d: bad operation %r" % (chunk, r, op))
+            if picoS < lastPicoS:
+                fail("chunk %d record %d: time goes back from %d to %d" % (chunk, r, lastPicoS, picoS))
+            if r == 0 and picoS != firstPicoS:
+                fail("chunk %d: first record time %d, header says %d" % (chunk, picoS, firstPicoS))
+            lastPicoS = picoS
+        if lastPicoS != chunkLastPicoS:
+            fail("chunk %d: last record time %d, header says %d" % (chunk, lastPicoS, chunkLastPicoS))
+
+        records += chunkRecords
+        offset = start + storedSize
+
+    if offset != indexOffset:
+        fail("index at offset %d, chunks end at %d" % (indexOffset, offset))
+    if records != numRecords:
+        fail("footer says %d records, chunks hold %d" % (numRecords, records))
+    if records < minRecords:
+        fail("%d records, expected at least %d" % (records, minRecords))
+
+    print("%d records in %d chunks" % (records, numChunks))
+
+if __name__ == "__main__":
+    if len(sys.argv) < 2:
+        sys.stderr.write("Usage: %s <chunked trace> [minimum records]\n" % sys.argv[0])
+        sys.exit(1)
+    check(sys.argv[1], int(sys.argv[2]) if len(sys.argv) > 2 else 1)
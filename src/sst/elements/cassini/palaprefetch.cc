@@ -16,9 +16,7 @@
 #include "sst_config.h"
 #include "palaprefetch.h"
 
-#include <unordered_map>
 #include <vector>
-#include <deque>
 
 #include "stdlib.h"
 
@@ -37,77 +35,54 @@ void PalaPrefetcher::notifyAccess(const CacheListenerNotification& notify)
     const NotifyResultType notifyResType = notify.getResultType();
     const Addr addr = notify.getPhysicalAddress();
 
-    // Insert address into the history table using the tag as the index
+    // Look up the address in the table using the tag as the index; a hit becomes
+    // the most recently used entry in its set
     uint64_t tag = addr >> (addressSize - tagSize);
-    StrideFilter filterEntry;
-    filterEntry.lastAddress = addr;
-    filterEntry.stride = blockSize;
-    filterEntry.lastStride = 0;
-    filterEntry.state = P_INVALID;
+    StrideFilter* entry = recentAddrList->find(tag, true);
 
     // If the value is already present, then we need to check its state information
     // and update the values in the table. If the stride values match for two addresses
     // in a row, then we update the stride value in the table. Otherwise, the value
     // remains unchanged.
-    int32_t tempStride = 0;
-    std::pair < std::unordered_map< uint64_t, StrideFilter >::iterator, bool >  retVal;
-    retVal = recentAddrList->insert ( std::pair< uint64_t, StrideFilter >(tag, filterEntry) );
-    if( retVal.second == false )
+    if( entry != NULL )
     {
-        tempStride = int32_t( addr - (*recentAddrList)[tag].lastAddress );
-        if( (*recentAddrList)[tag].state == P_INVALID )
+        int32_t tempStride = int32_t( addr - entry->lastAddress );
+        if( entry->state == P_INVALID )
         {
-            if( (*recentAddrList)[tag].lastStride == tempStride )
+            if( entry->lastStride == tempStride )
             {
-                (*recentAddrList)[tag].state = P_PENDING;
+                entry->state = P_PENDING;
             }
         }
-        else if( (*recentAddrList)[tag].state == P_PENDING )
+        else if( entry->state == P_PENDING )
         {
-            if( (*recentAddrList)[tag].lastStride == tempStride )
+            if( entry->lastStride == tempStride )
             {
-                (*recentAddrList)[tag].state = P_VALID;
-                (*recentAddrList)[tag].stride = tempStride;
+                entry->state = P_VALID;
+                entry->stride = tempStride;
             }
 
         }
         else
         {
-            if( (*recentAddrList)[tag].lastStride != tempStride )
+            if( entry->lastStride != tempStride )
             {
-                (*recentAddrList)[tag].state = P_PENDING;
+                entry->state = P_PENDING;
             }
         }
 
-        (*recentAddrList)[tag].lastStride = tempStride;
-        (*recentAddrList)[tag].lastAddress = addr;
-
-        // Insert a reference to the new element at the front of the queue
-        // and remove any other references to the element. Requires traversal
-        // of the list (max n - 1), but need to keep it lru.
-        if( recentAddrListQueue->front() != retVal.first )
-        {
-            for( it = recentAddrListQueue->begin(); it != recentAddrListQueue->end(); it++ )
-            {
-                if( *it == retVal.first )
-                {
-                    recentAddrListQueue->erase(it);
-                    recentAddrListQueue->push_front(retVal.first);
-                    break;
-                }
-            }
-        }
+        entry->lastStride = tempStride;
+        entry->lastAddress = addr;
     }
     else
     {
-        // Insert a reference to the new element at the front of the queue
-        recentAddrListQueue->push_front(retVal.first);
-    }
-
-    if( recentAddrList->size() >= recentAddrListCount )
-    {
-        recentAddrList->erase(recentAddrListQueue->back());
-        recentAddrListQueue->pop_back();
+        // Insert the address, replacing the least recently used entry in the set if it is full
+        StrideFilter filterEntry;
+        filterEntry.lastAddress = addr;
+        filterEntry.stride = blockSize;
+        filterEntry.lastStride = 0;
+        filterEntry.state = P_INVALID;
+        entry = recentAddrList->insert(tag, filterEntry);
     }
 
     recheckCountdown = (recheckCountdown + 1) % strideDetectionRange;
@@ -115,119 +90,113 @@ void PalaPrefetcher::notifyAccess(const CacheListenerNotification& notify)
     notifyResType == MISS ? missEventsProcessed++ : hitEventsProcessed++;
 
     if(recheckCountdown == 0)
-        DispatchRequest(addr);
+        DispatchRequest(addr, entry->stride);
 }
 
-void PalaPrefetcher::DispatchRequest(Addr targetAddress)
+void PalaPrefetcher::DispatchRequest(Addr targetAddress, int32_t stride)
 {
-    /*  TODO Needs to be updated with current MemHierarchy Commands/States, MemHierarchyInterface */
-    MemEvent* ev = NULL;
+    // Prefetch 'degree' consecutive strides starting at the reach, stopping at a page boundary
+    for(uint32_t d = 0; d < prefetchDegree; ++d)
+    {
+        if(! IssuePrefetch(targetAddress, stride, strideReach + d))
+            break;
+    }
 
-    uint64_t tag = targetAddress >> (addressSize - tagSize);
-    int32_t stride = (*recentAddrList)[tag].stride;
+    SendPrefetches();
+}
 
-    Addr targetPrefetchAddress = targetAddress + (strideReach * stride);
+/*
+ * Check one prefetch candidate against the page boundary and the prefetch history and add it to the
+ * batch if it should be issued. Returns false if the candidate was canceled by the page boundary.
+ */
+bool PalaPrefetcher::IssuePrefetch(Addr targetAddress, int32_t stride, uint32_t reach)
+{
+    Addr targetPrefetchAddress = targetAddress + (reach * stride);
     targetPrefetchAddress = targetPrefetchAddress - (targetPrefetchAddress % blockSize);
 
     if(overrunPageBoundary)
     {
         output->verbose(CALL_INFO, 2, 0,
                 "Issue prefetch, target address: %" PRIx64 ", prefetch address: %" PRIx64 " (reach out: %" PRIu32 ", stride=%" PRIu32 "), prefetchAddress=%" PRIu64 "\n",
-                targetAddress, targetAddress + (strideReach * stride),
-                (strideReach * stride), stride, targetPrefetchAddress);
-
-        statPrefetchOpportunities->addData(1);
+                targetAddress, targetAddress + (reach * stride),
+                (reach * stride), stride, targetPrefetchAddress);
 
         // Check next address is aligned to a cache line boundary
-        assert((targetAddress + (strideReach * stride)) % blockSize == 0);
+        assert((targetAddress + (reach * stride)) % blockSize == 0);
 
-        ev = new MemEvent(getName(), targetAddress + (strideReach * stride), targetAddress + (strideReach * stride), Command::GetS);
+        statPrefetchOpportunities->addData(1);
     }
     else
     {
         const Addr targetAddressPhysPage = targetAddress / pageSize;
         const Addr targetPrefetchAddressPage = targetPrefetchAddress / pageSize;
 
-        // Check next address is aligned to a cache line boundary
-        assert(targetPrefetchAddress % blockSize == 0);
-
         // if the address we found and the next prefetch address are on the same
         // we can safely prefetch without causing a page fault, otherwise we
         // choose to not prefetch the address
-        if(targetAddressPhysPage == targetPrefetchAddressPage)
-        {
-            output->verbose(CALL_INFO, 2, 0, "Issue prefetch, target address: %" PRIx64 ", prefetch address: %" PRIx64 " (reach out: %" PRIu32 ", stride=%" PRIu32 ")\n",
-                        targetAddress, targetPrefetchAddress, (strideReach * stride), stride);
-            ev = new MemEvent(getName(), targetPrefetchAddress, targetPrefetchAddress, Command::GetS);
-            statPrefetchOpportunities->addData(1);
-        }
-        else
+        if(targetAddressPhysPage != targetPrefetchAddressPage)
         {
             output->verbose(CALL_INFO, 2, 0, "Cancel prefetch issue, request exceeds physical page limit\n");
             output->verbose(CALL_INFO, 4, 0, "Target address: %" PRIx64 ", page=%" PRIx64 ", Prefetch address: %" PRIx64 ", page=%" PRIx64 "\n", targetAddress,
                             targetAddressPhysPage, targetPrefetchAddress, targetPrefetchAddressPage);
 
             statPrefetchIssueCanceledByPageBoundary->addData(1);
-            ev = NULL;
+            return false;
         }
+
+        output->verbose(CALL_INFO, 2, 0, "Issue prefetch, target address: %" PRIx64 ", prefetch address: %" PRIx64 " (reach out: %" PRIu32 ", stride=%" PRIu32 ")\n",
+                    targetAddress, targetPrefetchAddress, (reach * stride), stride);
+        statPrefetchOpportunities->addData(1);
     }
 
-    if(ev != NULL)
+    output->verbose(CALL_INFO, 2, 0, "Checking prefetch history for cache line at base %" PRIx64 "\n", targetPrefetchAddress);
+
+    if(NULL != prefetchHistory->find(targetPrefetchAddress / blockSize, false))
     {
-        std::vector<Event::HandlerBase*>::iterator callbackItr;
+        statPrefetchIssueCanceledByHistory->addData(1);
+        output->verbose(CALL_INFO, 2, 0, "Prefetch canceled - same cache line is found in the recent prefetch history.\n");
+        return true;
+    }
 
-        Addr prefetchCacheLineBase = ev->getAddr() - (ev->getAddr() % blockSize);
-        bool inHistory = false;
-        const uint32_t currentHistCount = prefetchHistory->size();
+    statPrefetchEventsIssued->addData(1);
 
-        output->verbose(CALL_INFO, 2, 0, "Checking prefetch history for cache line at base %" PRIx64 ", valid prefetch history entries=%" PRIu32 "\n", prefetchCacheLineBase,
-                        currentHistCount);
+    // Replaces the oldest cache line in the history set
+    prefetchHistory->insert(targetPrefetchAddress / blockSize, true);
+    prefetchBatch.push_back(targetPrefetchAddress);
+    return true;
+}
 
-        for(uint32_t i = 0; i < currentHistCount; ++i)
+void PalaPrefetcher::SendPrefetches()
+{
+    if(prefetchBatch.empty())
+        return;
+
+    if(! registeredBatchCallbacks.empty())
+    {
+        for(std::vector<PrefetchBatchHandlerBase*>::iterator callbackItr = registeredBatchCallbacks.begin(); callbackItr != registeredBatchCallbacks.end(); callbackItr++)
         {
-            if(prefetchHistory->at(i) == prefetchCacheLineBase)
-            {
-                inHistory = true;
-                break;
-            }
+            (*(*callbackItr))(prefetchBatch);
         }
-
-        if(! inHistory)
+    }
+    else
+    {
+        for(std::vector<Addr>::iterator addrItr = prefetchBatch.begin(); addrItr != prefetchBatch.end(); addrItr++)
         {
-            statPrefetchEventsIssued->addData(1);
-
-            // Remove the oldest cache line
-            if(currentHistCount == prefetchHistoryCount)
-            {
-                    prefetchHistory->pop_front();
-            }
-
-            // Put the cache line at the back of the queue
-            prefetchHistory->push_back(prefetchCacheLineBase);
-
-            assert((ev->getAddr() % blockSize) == 0);
-
-            // Cycle over each registered call back and notify them that we want to issue a prefet$
-            for(callbackItr = registeredCallbacks.begin(); callbackItr != registeredCallbacks.end(); callbackItr++)
+            // Cycle over each registered call back and notify them that we want to issue a prefetch
+            for(std::vector<Event::HandlerBase*>::iterator callbackItr = registeredCallbacks.begin(); callbackItr != registeredCallbacks.end(); callbackItr++)
             {
                 // Create a new read request, we cannot issue a write because the data will get
                 // overwritten and corrupt memory (even if we really do want to do a write)
-                MemEvent* newEv = new MemEvent(getName(), ev->getAddr(), ev->getAddr(), Command::GetS);
+                MemEvent* newEv = new MemEvent(getName(), *addrItr, *addrItr, Command::GetS);
                 newEv->setSize(blockSize);
                 newEv->setPrefetchFlag(true);
 
                 (*(*callbackItr))(newEv);
             }
-
-            delete ev;
-        }
-        else
-        {
-            statPrefetchIssueCanceledByHistory->addData(1);
-            output->verbose(CALL_INFO, 2, 0, "Prefetch canceled - same cache line is found in the recent prefetch history.\n");
-            delete ev;
         }
     }
+
+    prefetchBatch.clear();
 }
 
 #ifndef SST_ENABLE_PREVIEW_BUILD  // inserted by script
@@ -254,20 +223,17 @@ PalaPrefetcher::PalaPrefetcher(ComponentId_t id, Params& params) : CacheListener
     tagSize = params.find<uint64_t>("tag_size", 48);
     addressSize = params.find<uint64_t>("addr_size", 64);
 
-    prefetchHistoryCount = params.find<uint32_t>("history", 16);
-    prefetchHistory = new std::deque<uint64_t>();
+    prefetchHistory = new SetAssocTable<bool>(params.find<uint32_t>("history", 16), params.find<uint32_t>("history_associativity", 0));
 
     strideReach = params.find<uint32_t>("reach", 2);
+    prefetchDegree = params.find<uint32_t>("degree", 1);
     strideDetectionRange = params.find<uint64_t>("detect_range", 4);
-    recentAddrListCount = params.find<uint32_t>("address_count", 64);
     pageSize = params.find<uint64_t>("page_size", 4096);
 
     uint32_t overrunPB = params.find<uint32_t>("overrun_page_boundaries", 0);
     overrunPageBoundary = (overrunPB == 0) ? false : true;
 
-    nextRecentAddressIndex = 0;
-    recentAddrList = new std::unordered_map< uint64_t, StrideFilter >;
-    recentAddrListQueue = new std::deque< std::unordered_map< uint64_t, StrideFilter >::iterator >;
+    recentAddrList = new SetAssocTable<StrideFilter>(params.find<uint32_t>("address_count", 64), params.find<uint32_t>("address_associativity", 0));
 
     output->verbose(CALL_INFO, 1, 0, "PalaPrefetcher created, cache line: %" PRIu64 ", page size: %" PRIu64 "\n",
             blockSize, pageSize);
@@ -285,7 +251,6 @@ PalaPrefetcher::~PalaPrefetcher()
 {
     delete prefetchHistory;
     delete recentAddrList;
-    delete recentAddrListQueue;
 }
 
 void PalaPrefetcher::registerResponseCallback(Event::HandlerBase* handler)
@@ -293,6 +258,11 @@ void PalaPrefetcher::registerResponseCallback(Event::HandlerBase* handler)
     registeredCallbacks.push_back(handler);
 }
 
+void PalaPrefetcher::registerPrefetchBatchCallback(PrefetchBatchHandlerBase* handler)
+{
+    registeredBatchCallbacks.push_back(handler);
+}
+
 void PalaPrefetcher::printStats(Output &out)
 {
 }
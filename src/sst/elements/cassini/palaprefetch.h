@@ -17,9 +17,7 @@
 #ifndef _H_SST_STRIDE_PREFETCH_PALA
 #define _H_SST_STRIDE_PREFETCH_PALA
 
-#include <unordered_map>
 #include <vector>
-#include <deque>
 
 #include <sst/core/event.h>
 #include <sst/core/sst_types.h>
@@ -28,6 +26,7 @@
 #include <sst/core/timeConverter.h>
 #include <sst/elements/memHierarchy/memEvent.h>
 #include <sst/elements/memHierarchy/cacheListener.h>
+#include "setAssocTable.h"
 
 #include <sst/core/output.h>
 
@@ -60,6 +59,7 @@ public:
 
     void notifyAccess(const CacheListenerNotification& notify);
     void registerResponseCallback(Event::HandlerBase *handler);
+    void registerPrefetchBatchCallback(PrefetchBatchHandlerBase *handler);
     void printStats(Output &out);
 
     SST_ELI_REGISTER_SUBCOMPONENT_DERIVED(
@@ -75,9 +75,12 @@ public:
         { "verbose",                     "Controls the verbosity of the cassini components", ""},
             { "cache_line_size",             "Controls the cache line size of the cache the prefetcher is attached too", "64"},
             { "history",                     "Start of Address Range, for this controller.", "16"},
+            { "history_associativity",       "Associativity of the prefetch history table, 0 for fully associative", "0"},
             { "reach",                       "Reach of the prefetcher (ie how far forward to make requests)", "2"},
+            { "degree",                      "Number of consecutive strides to prefetch, starting at the reach, on each request", "1"},
             { "detect_range",                "Range to detact addresses over in request-counts, default is 4.", "4"},
             { "address_count",               "Number of addresses to keep in the prefetch table", "64"},
+            { "address_associativity",       "Associativity of the prefetch table, 0 for fully associative", "0"},
             { "page_size",                   "Start of Address Range, for this controller.", "4096"},
             { "overrun_page_boundaries",     "Allow prefetcher to run over page alignment boundaries, default is 0 (false)", "0"},
             { "tag_size",                    "Number of bits used for address matching in table", "48"},
@@ -92,14 +95,16 @@ public:
     )
 
 private:
-    void     DispatchRequest(Addr targetAddress);
+    void     DispatchRequest(Addr targetAddress, int32_t stride);
+    bool     IssuePrefetch(Addr targetAddress, int32_t stride, uint32_t reach);
+    void     SendPrefetches();
 
     Output* output;
     std::vector<Event::HandlerBase*> registeredCallbacks;
-    std::deque<uint64_t>* prefetchHistory;
-    std::unordered_map< uint64_t, StrideFilter >* recentAddrList;
-    std::deque< std::unordered_map< uint64_t, StrideFilter >::iterator >* recentAddrListQueue;
-    std::deque< std::unordered_map< uint64_t, StrideFilter >::iterator >::iterator it;
+    std::vector<PrefetchBatchHandlerBase*> registeredBatchCallbacks;
+    std::vector<Addr> prefetchBatch;
+    SetAssocTable<bool>* prefetchHistory;
+    SetAssocTable<StrideFilter>* recentAddrList;
 
     uint64_t pageSize;
     uint64_t blockSize;
@@ -107,11 +112,9 @@ private:
     uint32_t addressSize;
 
     bool     overrunPageBoundary;
-    uint32_t prefetchHistoryCount;
-    uint32_t recentAddrListCount;
-    uint32_t nextRecentAddressIndex;
     uint32_t strideDetectionRange;
     uint32_t strideReach;
+    uint32_t prefetchDegree;
     uint32_t recheckCountdown;
     uint64_t missEventsProcessed;
     uint64_t hitEventsProcessed;
@@ -0,0 +1,90 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_CASSINI_SET_ASSOC_TABLE
+#define _H_SST_CASSINI_SET_ASSOC_TABLE
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace SST {
+namespace Cassini {
+
+/*
+ * Fixed-size, set-associative table with LRU replacement within a set, used
+ * for prefetcher history and stride tables.  All entries are allocated up
+ * front; a lookup only scans the ways of one set.  With associativity equal
+ * to the number of entries (or 0) the table is fully associative.
+ */
+template<typename T>
+class SetAssocTable {
+public:
+    SetAssocTable(uint32_t entries, uint32_t assoc) : stamp(0) {
+        if (0 == entries) entries = 1;
+        if (0 == assoc || assoc > entries) assoc = entries;
+        ways = assoc;
+        sets = entries / assoc;
+        slots.resize(sets * ways);
+    }
+
+    /* Entry for key, or NULL; if touch is set a hit becomes the most recently used way */
+    T* find(const uint64_t key, const bool touch) {
+        Slot* set = &slots[(key % sets) * ways];
+        for (uint32_t i = 0; i < ways; i++) {
+            if (set[i].valid && set[i].key == key) {
+                if (touch) set[i].lastUse = ++stamp;
+                return &set[i].value;
+            }
+        }
+        return NULL;
+    }
+
+    /* Add key as the most recently used way of its set, replacing the least recently used way if the set is full */
+    T* insert(const uint64_t key, const T& value) {
+        Slot* set = &slots[(key % sets) * ways];
+        Slot* victim = &set[0];
+        for (uint32_t i = 0; i < ways && victim->valid; i++) {
+            if (!set[i].valid || set[i].lastUse < victim->lastUse) victim = &set[i];
+        }
+        victim->valid = true;
+        victim->key = key;
+        victim->lastUse = ++stamp;
+        victim->value = value;
+        return &victim->value;
+    }
+
+    uint32_t getEntries() const { return sets * ways; }
+
+private:
+    struct Slot {
+        Slot() : key(0), lastUse(0), valid(false) {}
+        uint64_t key;
+        uint64_t lastUse;
+        bool valid;
+        T value;
+    };
+
+    std::vector<Slot> slots;
+    uint32_t sets;
+    uint32_t ways;
+    uint64_t stamp;
+};
+
+}
+}
+
+#endif
@@ -52,8 +52,6 @@ Addr StridePrefetcher::getAddressByIndex(uint32_t index) {
 }
 
 void StridePrefetcher::DetectStride() {
-    /*  Needs to be updated with current MemHierarchy Commands/States, MemHierarchyInterface */
-    MemEvent* ev = NULL;
     uint32_t stride;
     bool foundStride = true;
     Addr targetAddress = 0;
@@ -75,102 +73,102 @@ void StridePrefetcher::DetectStride() {
             }
 
             if(foundStride) {
-                Addr targetPrefetchAddress = targetAddress + (strideReach * stride);
-                targetPrefetchAddress = targetPrefetchAddress - (targetPrefetchAddress % blockSize);
-
-                if(overrunPageBoundary) {
-                        output->verbose(CALL_INFO, 2, 0,
-                            "Issue prefetch, target address: %" PRIx64 ", prefetch address: %" PRIx64 " (reach out: %" PRIu32 ", stride=%" PRIu32 "), prefetchAddress=%" PRIu64 "\n",
-                            targetAddress, targetAddress + (strideReach * stride),
-                            (strideReach * stride), stride, targetPrefetchAddress);
-
-                        statPrefetchOpportunities->addData(1);
-
-                        // Check next address is aligned to a cache line boundary
-                        assert((targetAddress + (strideReach * stride)) % blockSize == 0);
-
-                        ev = new MemEvent(getName(), targetAddress + (strideReach * stride), targetAddress + (strideReach * stride), Command::GetS);
-                } else {
-                        const Addr targetAddressPhysPage = targetAddress / pageSize;
-                        const Addr targetPrefetchAddressPage = targetPrefetchAddress / pageSize;
-
-                        // Check next address is aligned to a cache line boundary
-                        assert(targetPrefetchAddress % blockSize == 0);
-
-                        // if the address we found and the next prefetch address are on the same
-                        // we can safely prefetch without causing a page fault, otherwise we
-                        // choose to not prefetch the address
-                        if(targetAddressPhysPage == targetPrefetchAddressPage) {
-                            output->verbose(CALL_INFO, 2, 0, "Issue prefetch, target address: %" PRIx64 ", prefetch address: %" PRIx64 " (reach out: %" PRIu32 ", stride=%" PRIu32 ")\n",
-                                    targetAddress, targetPrefetchAddress, (strideReach * stride), stride);
-                            ev = new MemEvent(getName(), targetPrefetchAddress, targetPrefetchAddress, Command::GetS);
-                            statPrefetchOpportunities->addData(1);
-                        } else {
-                            output->verbose(CALL_INFO, 2, 0, "Cancel prefetch issue, request exceeds physical page limit\n");
-                            output->verbose(CALL_INFO, 4, 0, "Target address: %" PRIx64 ", page=%" PRIx64 ", Prefetch address: %" PRIx64 ", page=%" PRIx64 "\n", targetAddress, targetAddressPhysPage, targetPrefetchAddress, targetPrefetchAddressPage);
-
-                            statPrefetchIssueCanceledByPageBoundary->addData(1);
-                            ev = NULL;
-                        }
+                // Prefetch 'degree' consecutive strides starting at the reach, stopping at a page boundary
+                uint32_t candidates = 0;
+                for(uint32_t d = 0; d < prefetchDegree; ++d, ++candidates) {
+                    if(! IssuePrefetch(targetAddress, stride, strideReach + d))
+                        break;
                 }
 
-                break;
-            }
-        }
+                if(candidates > 0) {
+                    SendPrefetches();
+                    return;
+                }
 
-        if(ev != NULL) {
                 break;
+            }
         }
     }
+}
 
-    if(ev != NULL) {
-        std::vector<Event::HandlerBase*>::iterator callbackItr;
-
-        Addr prefetchCacheLineBase = ev->getAddr() - (ev->getAddr() % blockSize);
-        bool inHistory = false;
-        const uint32_t currentHistCount = prefetchHistory->size();
+/*
+ * Check one prefetch candidate against the page boundary and the prefetch history and add it to the
+ * batch if it should be issued. Returns false if the candidate was canceled by the page boundary.
+ */
+bool StridePrefetcher::IssuePrefetch(Addr targetAddress, uint32_t stride, uint32_t reach) {
+    Addr targetPrefetchAddress = targetAddress + (reach * stride);
+    targetPrefetchAddress = targetPrefetchAddress - (targetPrefetchAddress % blockSize);
+
+    if(overrunPageBoundary) {
+        output->verbose(CALL_INFO, 2, 0,
+            "Issue prefetch, target address: %" PRIx64 ", prefetch address: %" PRIx64 " (reach out: %" PRIu32 ", stride=%" PRIu32 "), prefetchAddress=%" PRIu64 "\n",
+            targetAddress, targetAddress + (reach * stride),
+            (reach * stride), stride, targetPrefetchAddress);
+
+        // Check next address is aligned to a cache line boundary
+        assert((targetAddress + (reach * stride)) % blockSize == 0);
+
+        statPrefetchOpportunities->addData(1);
+    } else {
+        const Addr targetAddressPhysPage = targetAddress / pageSize;
+        const Addr targetPrefetchAddressPage = targetPrefetchAddress / pageSize;
+
+        // if the address we found and the next prefetch address are on the same
+        // we can safely prefetch without causing a page fault, otherwise we
+        // choose to not prefetch the address
+        if(targetAddressPhysPage != targetPrefetchAddressPage) {
+            output->verbose(CALL_INFO, 2, 0, "Cancel prefetch issue, request exceeds physical page limit\n");
+            output->verbose(CALL_INFO, 4, 0, "Target address: %" PRIx64 ", page=%" PRIx64 ", Prefetch address: %" PRIx64 ", page=%" PRIx64 "\n", targetAddress, targetAddressPhysPage, targetPrefetchAddress, targetPrefetchAddressPage);
+
+            statPrefetchIssueCanceledByPageBoundary->addData(1);
+            return false;
+        }
 
-        output->verbose(CALL_INFO, 2, 0, "Checking prefetch history for cache line at base %" PRIx64 ", valid prefetch history entries=%" PRIu32 "\n", prefetchCacheLineBase,
-            currentHistCount);
+        output->verbose(CALL_INFO, 2, 0, "Issue prefetch, target address: %" PRIx64 ", prefetch address: %" PRIx64 " (reach out: %" PRIu32 ", stride=%" PRIu32 ")\n",
+                targetAddress, targetPrefetchAddress, (reach * stride), stride);
+        statPrefetchOpportunities->addData(1);
+    }
 
-        for(uint32_t i = 0; i < currentHistCount; ++i) {
-            if(prefetchHistory->at(i) == prefetchCacheLineBase) {
-                    inHistory = true;
-                    break;
-            }
-        }
+    output->verbose(CALL_INFO, 2, 0, "Checking prefetch history for cache line at base %" PRIx64 "\n", targetPrefetchAddress);
 
-        if(! inHistory) {
-            statPrefetchEventsIssued->addData(1);
+    if(NULL != prefetchHistory->find(targetPrefetchAddress / blockSize, false)) {
+        statPrefetchIssueCanceledByHistory->addData(1);
+        output->verbose(CALL_INFO, 2, 0, "Prefetch canceled - same cache line is found in the recent prefetch history.\n");
+        return true;
+    }
 
-            // Remove the oldest cache line
-            if(currentHistCount == prefetchHistoryCount) {
-                    prefetchHistory->pop_front();
-            }
+    statPrefetchEventsIssued->addData(1);
 
-            // Put the cache line at the back of the queue
-            prefetchHistory->push_back(prefetchCacheLineBase);
+    // Replaces the oldest cache line in the history set
+    prefetchHistory->insert(targetPrefetchAddress / blockSize, true);
+    prefetchBatch.push_back(targetPrefetchAddress);
+    return true;
+}
 
-            assert((ev->getAddr() % blockSize) == 0);
+void StridePrefetcher::SendPrefetches() {
+    if(prefetchBatch.empty())
+        return;
 
-                // Cycle over each registered call back and notify them that we want to issue a prefet$
-                for(callbackItr = registeredCallbacks.begin(); callbackItr != registeredCallbacks.end(); callbackItr++) {
-                    // Create a new read request, we cannot issue a write because the data will get
-                    // overwritten and corrupt memory (even if we really do want to do a write)
-                    MemEvent* newEv = new MemEvent(getName(), ev->getAddr(), ev->getAddr(), Command::GetS);
-                        newEv->setSize(blockSize);
-                        newEv->setPrefetchFlag(true);
+    if(! registeredBatchCallbacks.empty()) {
+        for(std::vector<PrefetchBatchHandlerBase*>::iterator callbackItr = registeredBatchCallbacks.begin(); callbackItr != registeredBatchCallbacks.end(); callbackItr++) {
+            (*(*callbackItr))(prefetchBatch);
+        }
+    } else {
+        for(std::vector<Addr>::iterator addrItr = prefetchBatch.begin(); addrItr != prefetchBatch.end(); addrItr++) {
+            // Cycle over each registered call back and notify them that we want to issue a prefetch
+            for(std::vector<Event::HandlerBase*>::iterator callbackItr = registeredCallbacks.begin(); callbackItr != registeredCallbacks.end(); callbackItr++) {
+                // Create a new read request, we cannot issue a write because the data will get
+                // overwritten and corrupt memory (even if we really do want to do a write)
+                MemEvent* newEv = new MemEvent(getName(), *addrItr, *addrItr, Command::GetS);
+                newEv->setSize(blockSize);
+                newEv->setPrefetchFlag(true);
 
                 (*(*callbackItr))(newEv);
-                }
-
-            delete ev;
-        } else {
-            statPrefetchIssueCanceledByHistory->addData(1);
-            output->verbose(CALL_INFO, 2, 0, "Prefetch canceled - same cache line is found in the recent prefetch history.\n");
-                delete ev;
+            }
         }
     }
+
+    prefetchBatch.clear();
 }
 
 #ifndef SST_ENABLE_PREVIEW_BUILD  // inserted by script
@@ -193,10 +191,10 @@ StridePrefetcher::StridePrefetcher(ComponentId_t id, Params& params) : CacheList
     recheckCountdown = 0;
     blockSize = params.find<uint64_t>("cache_line_size", 64);
 
-    prefetchHistoryCount = params.find<uint32_t>("history", 16);
-    prefetchHistory = new std::deque<uint64_t>();
+    prefetchHistory = new SetAssocTable<bool>(params.find<uint32_t>("history", 16), params.find<uint32_t>("history_associativity", 0));
 
     strideReach = params.find<uint32_t>("reach", 2);
+    prefetchDegree = params.find<uint32_t>("degree", 1);
     strideDetectionRange = params.find<uint64_t>("detect_range", 4);
     recentAddrListCount = params.find<uint32_t>("address_count", 64);
     pageSize = params.find<uint64_t>("page_size", 4096);
@@ -225,11 +223,16 @@ StridePrefetcher::StridePrefetcher(ComponentId_t id, Params& params) : CacheList
 
 StridePrefetcher::~StridePrefetcher() {
     free(recentAddrList);
+    delete prefetchHistory;
 }
 
 void StridePrefetcher::registerResponseCallback(Event::HandlerBase* handler) {
     registeredCallbacks.push_back(handler);
 }
 
+void StridePrefetcher::registerPrefetchBatchCallback(PrefetchBatchHandlerBase* handler) {
+    registeredBatchCallbacks.push_back(handler);
+}
+
 void StridePrefetcher::printStats(Output &out) {
 }
@@ -26,6 +26,7 @@
 #include <sst/core/timeConverter.h>
 #include <sst/elements/memHierarchy/memEvent.h>
 #include <sst/elements/memHierarchy/cacheListener.h>
+#include "setAssocTable.h"
 
 #include <sst/core/output.h>
 
@@ -46,6 +47,7 @@ public:
 
     void notifyAccess(const CacheListenerNotification& notify);
     void registerResponseCallback(Event::HandlerBase *handler);
+    void registerPrefetchBatchCallback(PrefetchBatchHandlerBase *handler);
     void printStats(Output &out);
 
     SST_ELI_REGISTER_SUBCOMPONENT_DERIVED(
@@ -61,7 +63,9 @@ public:
         { "verbose", "Controls the verbosity of the Cassini component", "0" },
             { "cache_line_size", "Size of the cache line the prefetcher is attached to", "64" },
         { "history", "Number of entries to keep for historical comparison", "16" },
+        { "history_associativity", "Associativity of the history table, 0 for fully associative", "0" },
         { "reach", "Reach (how far forward the prefetcher should fetch lines)", "2" },
+        { "degree", "Number of consecutive strides to prefetch, starting at the reach, each time a stride is detected", "1" },
         { "detect_range", "Range to detect addresses over in request counts", "4" },
         { "address_count", "Number of addresses to keep in prefetch table", "64" },
         { "page_size", "Page size for this controller", "4096" },
@@ -80,8 +84,9 @@ public:
 private:
     Output* output;
     std::vector<Event::HandlerBase*> registeredCallbacks;
-    std::deque<uint64_t>* prefetchHistory;
-    uint32_t prefetchHistoryCount;
+    std::vector<PrefetchBatchHandlerBase*> registeredBatchCallbacks;
+    std::vector<Addr> prefetchBatch;
+    SetAssocTable<bool>* prefetchHistory;
     uint64_t blockSize;
     bool overrunPageBoundary;
     uint64_t pageSize;
@@ -89,8 +94,11 @@ private:
     uint32_t recentAddrListCount;
     uint32_t nextRecentAddressIndex;
     void DetectStride();
+    bool IssuePrefetch(Addr targetAddress, uint32_t stride, uint32_t reach);
+    void SendPrefetches();
     uint32_t strideDetectionRange;
     uint32_t strideReach;
+    uint32_t prefetchDegree;
     Addr getAddressByIndex(uint32_t index);
     uint32_t recheckCountdown;
     uint64_t missEventsProcessed;
@@ -32,8 +32,19 @@ public:
                         Params& params, std::function<int()> fini ) :
         EmberEvent(output),
         m_api(api),
-        m_name(name),
-        m_params(params),
+        m_phase( Thornhill::DetailedCompute::makePhase( name, params ) ),
+        m_fini(fini)
+    {
+        m_state = IssueFunctor;
+    }  
+
+	EmberDetailedComputeEvent( Output* output,
+                        Thornhill::DetailedCompute& api,
+                        const Thornhill::DetailedCompute::Phase& phase,
+                        std::function<int()> fini ) :
+        EmberEvent(output),
+        m_api(api),
+        m_phase(phase),
         m_fini(fini)
     {
         m_state = IssueFunctor;
@@ -52,15 +63,12 @@ public:
             return 0;
         }; 
 
-        std::deque< std::pair< std::string, SST::Params> > tmp;
-        tmp.push_back( std::make_pair( m_name, m_params ) );
-        m_api.start( tmp, foo, m_fini );
+        m_api.start( m_phase, foo, m_fini );
     }
 
 protected:
     Thornhill::DetailedCompute&  m_api;
-    std::string     m_name;
-    Params          m_params;
+    Thornhill::DetailedCompute::Phase m_phase;
     std::function<int()> m_fini;
 };
 
@@ -128,6 +128,7 @@ class EmberGenerator : public SubComponent {
     inline void enQ_compute( Queue&, uint64_t nanoSecondDelay );
     inline void enQ_compute( Queue& q, std::function<uint64_t()> func );
     inline void enQ_detailedCompute( Queue& q, std::string, Params&, std::function<int()> func );
+    inline void enQ_detailedCompute( Queue& q, const Thornhill::DetailedCompute::Phase&, std::function<int()> func );
 
   private:
     EmberEngine*            m_ee;
@@ -164,6 +165,13 @@ void EmberGenerator::enQ_detailedCompute( Queue& q, std::string name,
     q.push( new EmberDetailedComputeEvent( &getOutput(), *m_detailedCompute, name, params, fini ) );
 }
 
+void EmberGenerator::enQ_detailedCompute( Queue& q,
+        const Thornhill::DetailedCompute::Phase& phase, std::function<int()> fini = NULL )
+{
+    assert( m_detailedCompute );
+    q.push( new EmberDetailedComputeEvent( &getOutput(), *m_detailedCompute, phase, fini ) );
+}
+
 void EmberGenerator::enQ_memAlloc( Queue& q, Hermes::MemAddr* addr, size_t length )
 {
     if ( m_memHeapLink ) {
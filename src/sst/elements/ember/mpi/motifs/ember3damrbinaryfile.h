@@ -20,47 +20,69 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "ember3damrfile.h"
 #include "ember3damrblock.h"
 
-// To clean up warnings on not using return results on freads() below
-#if ((__GNUC__ > 4) || (__GNUC__ == 4 && __GNUC_MINOR__ >= 6))
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wunused-result"
-#endif
-
 namespace SST {
     namespace Ember {
         
+        // Reads the rank-indexed mesh written by sst-meshconvert:
+        //
+        //   uint32 ranks, uint32 blocks, uint8 max level, uint32 blocks X/Y/Z
+        //   uint64 file offset of each rank's entries
+        //   per rank: uint32 block count, then per block
+        //             uint32 block ID, int8 level, int8 X-/X+/Y-/Y+/Z-/Z+
+        //
+        // The file is mapped read-only, so every rank in a process shares the
+        // same pages and a rank reads its own entries without touching the rest.
         class EmberAMRBinaryFile : public EmberAMRFile {
             
         public:
             EmberAMRBinaryFile(char* amrPath, Output* out) :
-                EmberAMRFile(amrPath, out) {
+                EmberAMRFile(amrPath, out), mesh(NULL), meshSize(0), cursor(0) {
                 
-                amrFile = fopen(amrFilePath, "rb");
+                int fd = open(amrFilePath, O_RDONLY);
                 
-                if(NULL == amrFile) {
+                if(fd < 0) {
                     output->fatal(CALL_INFO, -1, "Unable to open file: %s\n", amrPath);
                 }
+
+                struct stat meshStat;
+                if(fstat(fd, &meshStat) != 0 || meshStat.st_size <= 0) {
+                    output->fatal(CALL_INFO, -1, "Unable to read size of mesh file: %s\n", amrPath);
+                }
+
+                meshSize = (uint64_t) meshStat.st_size;
+                void* mapped = mmap(NULL, meshSize, PROT_READ, MAP_SHARED, fd, 0);
+                close(fd);
+
+                if(MAP_FAILED == mapped) {
+                    output->fatal(CALL_INFO, -1, "Unable to map mesh file: %s\n", amrPath);
+                }
+
+                mesh = (const char*) mapped;
                 
                 rankCount = 0;
-                fread(&rankCount, sizeof(rankCount), 1, amrFile);
+                read(&rankCount, sizeof(rankCount));
                 
                     uint32_t meshBlockCount = 0;
-                    fread(&meshBlockCount, sizeof(meshBlockCount), 1, amrFile);
+                    read(&meshBlockCount, sizeof(meshBlockCount));
                     
                     uint8_t meshMaxRefineLevel = 0;
-                    fread(&meshMaxRefineLevel, sizeof(meshMaxRefineLevel), 1, amrFile);
+                    read(&meshMaxRefineLevel, sizeof(meshMaxRefineLevel));
                     
                     uint32_t meshBlocksX = 0;
-                    fread(&meshBlocksX, sizeof(meshBlocksX), 1, amrFile);
+                    read(&meshBlocksX, sizeof(meshBlocksX));
                     
                     uint32_t meshBlocksY = 0;
-                    fread(&meshBlocksY, sizeof(meshBlocksY), 1, amrFile);
+                    read(&meshBlocksY, sizeof(meshBlocksY));
                     
                     uint32_t meshBlocksZ = 0;
-                    fread(&meshBlocksZ, sizeof(meshBlocksZ), 1, amrFile);
+                    read(&meshBlocksZ, sizeof(meshBlocksZ));
                     
                     blocksX = (int) meshBlocksX;
                     blocksY = (int) meshBlocksY;
@@ -72,21 +94,21 @@ namespace SST {
                     out->verbose(CALL_INFO, 8, 0, "Read mesh header info: blocks=%" PRIu32 ", max-lev: %" PRIu32 " bkX=%" PRIu32 ", blkY=%" PRIu32 ", blkZ=%" PRIu32 "\n",
                              totalBlockCount, maxRefinementLevel, blocksX, blocksY, blocksZ);
 
-		    rankIndexOffset = ftell(amrFile);
+		    rankIndexOffset = cursor;
 
 		    const uint64_t meshStartIndex = rankIndexOffset + (rankCount * sizeof(uint64_t));
 
 		    out->verbose(CALL_INFO, 8, 0, "Set mesh file seek to: %" PRIu64 "\n", meshStartIndex);
-		    fseek(amrFile, (long)(meshStartIndex), SEEK_SET);
+		    seek(meshStartIndex);
 
             }
             
             ~EmberAMRBinaryFile() {
-        	fclose(amrFile);        
+        	munmap((void*) mesh, meshSize);
             }
 
 	    void populateGlobalBlocks(std::map<uint32_t, int32_t>* globalBlockMap) {
-		fseek(amrFile, rankIndexOffset + (rankCount * sizeof(uint64_t)), SEEK_SET);
+		seek(rankIndexOffset + (rankCount * sizeof(uint64_t)));
 
 		for(uint32_t i = 0; i < rankCount; ++i) {
 			uint32_t blocksOnNode = 0;
@@ -105,31 +127,24 @@ namespace SST {
 				readNextMeshLine(&blockID, &refineLevel,
 					&xDown, &xUp, &yDown, &yUp, &zDown, &zUp);
 
-				auto block_present = globalBlockMap->find(blockID);
+				// block IDs mostly ascend through the file, so try the end first
+				const size_t mapped = globalBlockMap->size();
+				globalBlockMap->emplace_hint(globalBlockMap->end(), blockID, (int32_t) i);
 
-				if(block_present != globalBlockMap->end()) {
+				if(globalBlockMap->size() == mapped) {
 					output->fatal(CALL_INFO, -1, "Block ID: %" PRIu32 " already in map.\n", blockID);
 				}
-
-				globalBlockMap->insert(std::pair<uint32_t, int32_t>(blockID, (int32_t) i));
 			}
 		}
             }
 
 	    void populateLocalBlocks(std::vector<Ember3DAMRBlock*>* localBlocks, uint32_t rank) {
-		const uint64_t seekOffset = rankIndexOffset + (rank * sizeof(uint64_t));
-
 		output->verbose(CALL_INFO, 16, 0, "Seek file offet: Base=%" PRIu64 ", Rank=%" PRIu32 ", Offset=%" PRIu64 ", File Seek=%" PRIu64 "\n",
-			rankIndexOffset, rank, (uint64_t)(rank * sizeof(uint64_t)), seekOffset);
-
-		fseek(amrFile, seekOffset, SEEK_SET);
-
-		uint64_t rankBlocksIndex = 0;
-		fread(&rankBlocksIndex, sizeof(rankBlocksIndex), 1, amrFile);
+			rankIndexOffset, rank, (uint64_t)(rank * sizeof(uint64_t)), rankIndexOffset + (rank * sizeof(uint64_t)));
 
-		output->verbose(CALL_INFO, 16, 0, "Rank Offset: %" PRIu64 ", seeking in file...\n", rankBlocksIndex);
+		locateRankEntries(rank);
 
-		fseek(amrFile, rankBlocksIndex, SEEK_SET);
+		output->verbose(CALL_INFO, 16, 0, "Rank Offset: %" PRIu64 "\n", cursor);
 
 		uint32_t blocksOnNode = 0;
 		readNodeMeshLine(&blocksOnNode);
@@ -145,6 +160,8 @@ namespace SST {
                        	int32_t  zDown;
                        	int32_t  zUp;
 
+		localBlocks->reserve(localBlocks->size() + blocksOnNode);
+
 		for(uint32_t i = 0; i < blocksOnNode; ++i) {
 			readNextMeshLine(&blockID, &refineLevel,
                              	&xDown, &xUp, &yDown, &yUp, &zDown, &zUp);
@@ -160,46 +177,39 @@ namespace SST {
 	    }
 
             void readNodeMeshLine(uint32_t* blockCount) {
-                fread(blockCount, sizeof(uint32_t), 1, amrFile);
+                read(blockCount, sizeof(uint32_t));
             }
 
 	    void locateRankEntries(uint32_t rank) {
-		fseek(amrFile, (long) (rankIndexOffset + (rank * sizeof(uint64_t))), SEEK_SET);
+		if(rank >= rankCount) {
+			output->fatal(CALL_INFO, -1, "Rank %" PRIu32 " is not in mesh file %s, which has %" PRIu32 " ranks.\n",
+				rank, amrFilePath, rankCount);
+		}
+
+		seek(rankIndexOffset + (rank * sizeof(uint64_t)));
 
 		uint64_t rankStart = 0;
-		fread(&rankStart, sizeof(rankStart), 1, amrFile);
+		read(&rankStart, sizeof(rankStart));
 
-		fseek(amrFile, (long) (rankStart), SEEK_SET);
+		seek(rankStart);
 	    }
 
             void readNextMeshLine(uint32_t* blockID, uint32_t* refineLev,
                                   int32_t* xDown, int32_t* xUp,
                                   int32_t* yDown, int32_t* yUp,
                                   int32_t* zDown, int32_t* zUp) {
-                int8_t temp = 0;
-
-                fread(blockID, sizeof(uint32_t), 1, amrFile);
-
-		fread(&temp, sizeof(temp), 1, amrFile);
-		*refineLev = (uint32_t) temp;
-
-                fread(&temp, sizeof(temp), 1, amrFile);
-                *xDown = (int32_t) temp;
-
-                fread(&temp, sizeof(temp), 1, amrFile);
-                *xUp = (int32_t) temp;
-
-                fread(&temp, sizeof(temp), 1, amrFile);
-                *yDown = (int32_t) temp;
-
-                fread(&temp, sizeof(temp), 1, amrFile);
-                *yUp = (int32_t) temp;
-
-                fread(&temp, sizeof(temp), 1, amrFile);
-                *zDown = (int32_t) temp;
-                
-                fread(&temp, sizeof(temp), 1, amrFile);
-                *zUp = (int32_t) temp;
+                int8_t entry[7];
+
+                read(blockID, sizeof(uint32_t));
+                read(entry, sizeof(entry));
+
+		*refineLev = (uint32_t) entry[0];
+                *xDown = (int32_t) entry[1];
+                *xUp   = (int32_t) entry[2];
+                *yDown = (int32_t) entry[3];
+                *yUp   = (int32_t) entry[4];
+                *zDown = (int32_t) entry[5];
+                *zUp   = (int32_t) entry[6];
             }
 
 	    virtual bool isBinary() {
@@ -207,16 +217,31 @@ namespace SST {
 	    }
 
         private:
+            void seek(uint64_t offset) {
+                if(offset > meshSize) {
+                    output->fatal(CALL_INFO, -1, "Seek to %" PRIu64 " is past the end of mesh file %s (%" PRIu64 " bytes).\n",
+                        offset, amrFilePath, meshSize);
+                }
+                cursor = offset;
+            }
+
+            void read(void* dest, size_t bytes) {
+                if(cursor + bytes > meshSize) {
+                    output->fatal(CALL_INFO, -1, "Mesh file %s is truncated at offset %" PRIu64 ".\n",
+                        amrFilePath, cursor);
+                }
+                memcpy(dest, mesh + cursor, bytes);
+                cursor += bytes;
+            }
+
             uint32_t rankCount;
 	    uint64_t rankIndexOffset;
-            FILE* amrFile;
+            const char* mesh;
+            uint64_t meshSize;
+            uint64_t cursor;
         };
         
     }
 }
 
-#if ((__GNUC__ > 4) || (__GNUC__ == 4 && __GNUC_MINOR__ >= 6))
-#pragma GCC diagnostic pop
-#endif
-
 #endif
@@ -150,29 +150,34 @@ void EmberDetailedRingGenerator::computeDetailed( std::queue<EmberEvent*>& evQ)
 {
     verbose( CALL_INFO, 1, 0, "\n");
 
-	Params params;
+    // the stream buffer does not move, build the phase once
+    if ( ! m_detailedPhase ) {
+		Params params;
 
-    std::string motif;
+        std::string motif;
 
-	std::stringstream tmp;	
+		std::stringstream tmp;	
 
-    motif = "miranda.STREAMBenchGenerator";
+        motif = "miranda.STREAMBenchGenerator";
 
-	tmp.str( std::string() ); tmp.clear();
-	tmp << m_stream_n;
-    params.insert("n", tmp.str() );
+		tmp.str( std::string() ); tmp.clear();
+		tmp << m_stream_n;
+        params.insert("n", tmp.str() );
 
-	tmp.str( std::string() ); tmp.clear();
-	tmp << m_streamBuf.getSimVAddr();
-    params.insert("start_a", tmp.str() );
+		tmp.str( std::string() ); tmp.clear();
+		tmp << m_streamBuf.getSimVAddr();
+        params.insert("start_a", tmp.str() );
 
-    params.insert("operandwidth", "8",true);
+        params.insert("operandwidth", "8",true);
 
-    params.insert( "generatorParams.verbose", "0" );
-    params.insert( "verbose", "0" );
+        params.insert( "generatorParams.verbose", "0" );
+        params.insert( "verbose", "0" );
+
+        m_detailedPhase = Thornhill::DetailedCompute::makePhase( motif, params );
+    }
 
 	for ( int i = 0; i < 10; i++ ) {
-    	enQ_detailedCompute( evQ, motif, params );
+    	enQ_detailedCompute( evQ, m_detailedPhase );
 		enQ_makeProgress(evQ);
 	}
 }
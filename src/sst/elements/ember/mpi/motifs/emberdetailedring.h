@@ -95,6 +95,7 @@ private:
     uint64_t m_startCompute;
     uint64_t m_stopCompute;
     uint32_t m_doCompute;
+    Thornhill::DetailedCompute::Phase m_detailedPhase;
 };
 
 }
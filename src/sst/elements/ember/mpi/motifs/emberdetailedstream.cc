@@ -92,66 +92,74 @@ void EmberDetailedStreamGenerator::computeDetailedCopy( std::queue<EmberEvent*>&
 {
     verbose( CALL_INFO, 1, 0, "\n");
 
-	Params params;
+    if ( ! m_copyPhase ) {
+		Params params;
 
-    std::string motif;
+        std::string motif;
 
-	std::stringstream tmp;	
+		std::stringstream tmp;	
 
-    motif = "miranda.CopyGenerator";
+        motif = "miranda.CopyGenerator";
 
-	tmp.str( std::string() ); tmp.clear();
-	tmp << m_stream_n/(m_operandwidth/8);
-    params.insert("request_count", tmp.str() );
+		tmp.str( std::string() ); tmp.clear();
+		tmp << m_stream_n/(m_operandwidth/8);
+        params.insert("request_count", tmp.str() );
 
-	tmp.str( std::string() ); tmp.clear();
-	tmp << m_streamBuf.getSimVAddr();
-    params.insert("read_start_address", tmp.str() );
+		tmp.str( std::string() ); tmp.clear();
+		tmp << m_streamBuf.getSimVAddr();
+        params.insert("read_start_address", tmp.str() );
 
-	tmp.str( std::string() ); tmp.clear();
-	tmp << m_operandwidth;
-    params.insert("operandwidth", tmp.str(),true);
+		tmp.str( std::string() ); tmp.clear();
+		tmp << m_operandwidth;
+        params.insert("operandwidth", tmp.str(),true);
 
-	tmp.str( std::string() ); tmp.clear();
-	tmp << m_n_per_call_copy;
-    params.insert("n_per_call", tmp.str());
+		tmp.str( std::string() ); tmp.clear();
+		tmp << m_n_per_call_copy;
+        params.insert("n_per_call", tmp.str());
 
-    params.insert( "generatorParams.verbose", "1" );
-    params.insert( "verbose", "1" );
+        params.insert( "generatorParams.verbose", "1" );
+        params.insert( "verbose", "1" );
 
-  	enQ_detailedCompute( evQ, motif, params );
+        m_copyPhase = Thornhill::DetailedCompute::makePhase( motif, params );
+    }
+
+  	enQ_detailedCompute( evQ, m_copyPhase );
 }
 void EmberDetailedStreamGenerator::computeDetailedTriad( std::queue<EmberEvent*>& evQ) 
 {
     verbose( CALL_INFO, 1, 0, "\n");
 
-	Params params;
+    if ( ! m_triadPhase ) {
+		Params params;
 
-    std::string motif;
+        std::string motif;
 
-	std::stringstream tmp;	
+		std::stringstream tmp;	
 
-    motif = "miranda.STREAMBenchGenerator";
+        motif = "miranda.STREAMBenchGenerator";
 
-	tmp.str( std::string() ); tmp.clear();
-	tmp << m_stream_n/(m_operandwidth/8);
-    params.insert("n", tmp.str() );
+		tmp.str( std::string() ); tmp.clear();
+		tmp << m_stream_n/(m_operandwidth/8);
+        params.insert("n", tmp.str() );
 
-	tmp.str( std::string() ); tmp.clear();
-	tmp << m_streamBuf.getSimVAddr();
-    params.insert("start_a", tmp.str() );
+		tmp.str( std::string() ); tmp.clear();
+		tmp << m_streamBuf.getSimVAddr();
+        params.insert("start_a", tmp.str() );
 
-	tmp.str( std::string() ); tmp.clear();
-	tmp << m_operandwidth;
-    params.insert("operandwidth", tmp.str(),true);
+		tmp.str( std::string() ); tmp.clear();
+		tmp << m_operandwidth;
+        params.insert("operandwidth", tmp.str(),true);
 
-	tmp.str( std::string() ); tmp.clear();
-	tmp << m_n_per_call_triad;
-    params.insert("n_per_call", tmp.str());
+		tmp.str( std::string() ); tmp.clear();
+		tmp << m_n_per_call_triad;
+        params.insert("n_per_call", tmp.str());
 
-    params.insert( "generatorParams.verbose", "1" );
-    params.insert( "verbose", "1" );
+        params.insert( "generatorParams.verbose", "1" );
+        params.insert( "verbose", "1" );
+
+        m_triadPhase = Thornhill::DetailedCompute::makePhase( motif, params );
+    }
 
-  	enQ_detailedCompute( evQ, motif, params );
+  	enQ_detailedCompute( evQ, m_triadPhase );
 }
 
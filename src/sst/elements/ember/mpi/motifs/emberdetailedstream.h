@@ -88,7 +88,8 @@ private:
     std::vector<uint64_t> 		m_startTime;
     std::vector<uint64_t> 		m_stopTime;
     Hermes::MemAddr    			m_streamBuf;
-
+    Thornhill::DetailedCompute::Phase m_copyPhase;
+    Thornhill::DetailedCompute::Phase m_triadPhase;
 };
 
 }
@@ -196,28 +196,32 @@ public:
     {
         verbose( CALL_INFO, 1, 0, "\n");
 
-        Params params;
+        if ( ! m_detailedPhase ) {
+            Params params;
 
-        std::string motif;
+            std::string motif;
 
-        std::stringstream tmp;
+            std::stringstream tmp;
 
-        motif = "miranda.STREAMBenchGenerator";
+            motif = "miranda.STREAMBenchGenerator";
 
-        tmp.str( std::string() ); tmp.clear();
-        tmp << m_stream_n;
-        params.insert("n", tmp.str() );
+            tmp.str( std::string() ); tmp.clear();
+            tmp << m_stream_n;
+            params.insert("n", tmp.str() );
 
-        tmp.str( std::string() ); tmp.clear();
-        tmp << m_streamBuf.getSimVAddr();
-        params.insert("start_a", tmp.str() );
+            tmp.str( std::string() ); tmp.clear();
+            tmp << m_streamBuf.getSimVAddr();
+            params.insert("start_a", tmp.str() );
 
-        params.insert("operandwidth", "8",true);
+            params.insert("operandwidth", "8",true);
 
-        params.insert( "generatorParams.verbose", "0" );
-        params.insert( "verbose", "0" );
+            params.insert( "generatorParams.verbose", "0" );
+            params.insert( "verbose", "0" );
 
-        enQ_detailedCompute( evQ, motif, params );
+            m_detailedPhase = Thornhill::DetailedCompute::makePhase( motif, params );
+        }
+
+        enQ_detailedCompute( evQ, m_detailedPhase );
     }
 
     bool findNid( int nid, std::string nidList ) {
@@ -264,6 +268,7 @@ public:
 	std::string m_detailedComputeList;
 
 	Hermes::MemAddr m_streamBuf;
+	Thornhill::DetailedCompute::Phase m_detailedPhase;
     Hermes::MemAddr m_mem;
 
 	uint64_t m_regionSize;
@@ -0,0 +1,42 @@
+#!/bin/bash
+
+# Runs the nightly Sweep3D config with the firefly NIC's packetTrainLength
+# set explicitly.
+#
+# packetTrainLength=1 must reproduce test_embernightly.out exactly.
+# packetTrainLength=4 (8KB trains in the default 14KB link buffers) only
+# coarsens how a message moves through the network, so it must run the same
+# motifs to completion; only the simulated time may change.
+
+export PYTHONPATH="../test"
+
+SST=${SST:-sst}
+REF=refFiles/test_embernightly.out
+
+run() {
+    $SST \
+    --model-options=" \
+    --simConfig=defaultSim \
+    --param=nic:packetTrainLength=$1 \
+    " \
+    ../test/emberLoad.py | grep -v "set nicParams packetTrainLength"
+}
+
+run 1 > packetTrain_1.out || exit 1
+if ! diff $REF packetTrain_1.out; then
+    echo "packetTrainLength=1 does not match $REF"
+    exit 1
+fi
+
+run 4 > packetTrain_4.out || exit 1
+if ! diff <(grep -v "simulated time" $REF) <(grep -v "simulated time" packetTrain_4.out); then
+    echo "packetTrainLength=4 ran a different simulation"
+    exit 1
+fi
+if ! grep -q "Simulation is complete" packetTrain_4.out; then
+    echo "packetTrainLength=4 did not complete"
+    exit 1
+fi
+
+grep "simulated time" $REF packetTrain_4.out
+rm -f packetTrain_1.out packetTrain_4.out
@@ -0,0 +1,118 @@
+// Copyright 2013-2018 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2013-2018, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef COMPONENTS_FIREFLY_INTERVALINDEX_H
+#define COMPONENTS_FIREFLY_INTERVALINDEX_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <deque>
+#include <vector>
+
+namespace SST {
+namespace Firefly {
+
+// Maps keys to the value of the interval [first,last] holding them, for
+// lookups on every operation (shmem regions, latency size ranges, address
+// maps).  Intervals are kept sorted by their first key and found with a
+// branch-free binary search, after checking the interval of the last hit.
+//
+// Intervals may overlap; a key belongs to the earliest inserted interval
+// holding it, as with a linear search in insertion order.  Inserting is
+// linear in the number of intervals.
+
+template< class T >
+class IntervalIndex {
+  public:
+    IntervalIndex() : m_last(0) {}
+
+    void insert( uint64_t first, uint64_t last, const T& value ) {
+        if ( last < first ) {
+            return;
+        }
+        m_values.push_back( value );
+        size_t valueIndex = m_values.size() - 1;
+
+        // add the parts of [first,last] not already covered
+        size_t pos = 0;
+        while ( pos < m_pieces.size() && m_pieces[pos].last < first ) {
+            ++pos;
+        }
+        uint64_t next = first;
+        while ( true ) {
+            if ( pos == m_pieces.size() || m_pieces[pos].first > last ) {
+                m_pieces.insert( m_pieces.begin() + pos, Piece( next, last, valueIndex ) );
+                break;
+            }
+            if ( m_pieces[pos].first > next ) {
+                m_pieces.insert( m_pieces.begin() + pos, Piece( next, m_pieces[pos].first - 1, valueIndex ) );
+                ++pos;
+            }
+            if ( m_pieces[pos].last >= last ) {
+                break;
+            }
+            next = m_pieces[pos].last + 1;
+            ++pos;
+        }
+        m_last = 0;
+    }
+
+    // value of the interval holding key, NULL if there is none
+    T* find( uint64_t key ) {
+        size_t num = m_pieces.size();
+        if ( 0 == num ) {
+            return NULL;
+        }
+        if ( m_last < num && key >= m_pieces[m_last].first && key <= m_pieces[m_last].last ) {
+            return &m_values[ m_pieces[m_last].value ];
+        }
+
+        // last piece starting at or before key
+        const Piece* base = &m_pieces[0];
+        while ( num > 1 ) {
+            size_t half = num / 2;
+            base = ( base[half].first <= key ) ? base + half : base;
+            num -= half;
+        }
+        if ( key < base->first || key > base->last ) {
+            return NULL;
+        }
+        m_last = base - &m_pieces[0];
+        return &m_values[ base->value ];
+    }
+
+    // number of inserted intervals
+    size_t size() const { return m_values.size(); }
+
+  private:
+    struct Piece {
+        Piece( uint64_t first, uint64_t last, size_t value ) :
+            first(first), last(last), value(value) {}
+        uint64_t first;
+        uint64_t last;
+        size_t value;
+    };
+
+    // disjoint and sorted by first
+    std::vector<Piece> m_pieces;
+    // references stay valid as values are added
+    std::deque<T> m_values;
+    size_t m_last;
+};
+
+}
+}
+
+#endif
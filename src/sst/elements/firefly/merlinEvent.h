@@ -28,13 +28,13 @@ class FireflyNetworkEvent : public Event {
 
   public:
 
-    FireflyNetworkEvent( ) : offset(0), bufLen(0), m_isHdr(false), m_isCtrl(false), pktOverhead(0) {
+    FireflyNetworkEvent( ) : offset(0), bufLen(0), m_isHdr(false), m_isCtrl(false), pktOverhead(0), numPkts(1) {
         buf.reserve( 1000 );
         assert( 0 == buf.size() );
     }
 
     FireflyNetworkEvent( int pktOverhead, size_t reserve = 1000 ) : offset(0), bufLen(0), 
-            m_isHdr(false), m_isTail(false), m_isCtrl(false), pktOverhead(pktOverhead) {
+            m_isHdr(false), m_isTail(false), m_isCtrl(false), pktOverhead(pktOverhead), numPkts(1) {
         buf.reserve( reserve );
         assert( 0 == buf.size() );
     }
@@ -47,7 +47,12 @@ class FireflyNetworkEvent : public Event {
     void setTail() { m_isTail = true; }
     bool isTail() { return m_isTail; }
     int calcPayloadSizeInBits() { return payloadSize() * 8; }
-    int payloadSize() { return pktOverhead + bufSize(); }
+    int payloadSize() { return pktOverhead * numPkts + bufSize(); }
+
+    // a packet train carries the payload of several consecutive packets
+    // of one stream; each packet still pays the packet overhead
+    void setNumPkts( int num ) { numPkts = num; }
+    int getNumPkts() { return numPkts; }
     void setSrcNode(int node ) { srcNode = node; }
     void setSrcPid( int pid ) { srcPid = pid; }
     void setSrcStream( int stream ) { srcStream = stream; }
@@ -101,6 +106,7 @@ class FireflyNetworkEvent : public Event {
         m_isCtrl = me->m_isCtrl;
         offset = me->offset;
         pktOverhead = me->pktOverhead;
+        numPkts = me->numPkts;
     }
 
     FireflyNetworkEvent(const FireflyNetworkEvent &me) :
@@ -117,6 +123,7 @@ class FireflyNetworkEvent : public Event {
         m_isCtrl = me.m_isCtrl;
         offset = me.offset;
         pktOverhead = me.pktOverhead;
+        numPkts = me.numPkts;
     }
 
     virtual Event* clone(void) override
@@ -146,6 +153,7 @@ class FireflyNetworkEvent : public Event {
     bool            m_isTail;
     bool            m_isCtrl;
     int             pktOverhead;
+    int             numPkts;
     
     size_t          offset;
     size_t          bufLen;
@@ -163,6 +171,7 @@ class FireflyNetworkEvent : public Event {
         ser & srcStream;
         ser & destPid;
         ser & pktOverhead;
+        ser & numPkts;
         ser & m_isHdr;
         ser & m_isTail;
         ser & m_isCtrl;
@@ -43,6 +43,7 @@ Nic::Nic(ComponentId_t id, Params &params) :
     m_respKey(1),
 	m_predNetIdleTime(0),
     m_linkBytesPerSec(0),
+    m_packetTrainBits(0),
 	m_detailedInterface(NULL)
 {
     m_myNodeId = params.find<int>("nid", -1);
@@ -122,6 +123,15 @@ Nic::Nic(ComponentId_t id, Params &params) :
     int minPktPayload = 32;
     assert( ( packetSizeInBytes - packetOverhead ) >= minPktPayload );
 
+    int packetTrainLength = params.find<int>( "packetTrainLength", 1 );
+    if ( packetTrainLength < 1 ) {
+        m_dbg.fatal(CALL_INFO,-1,"Error: packetTrainLength must be at least 1, requested %d\n",packetTrainLength);
+    }
+
+    if ( packetTrainLength > 1 ) {
+        m_packetTrainBits = packetTrainLength * packetSizeInBytes * 8;
+    }
+
     // Set up the linkcontrol
     m_linkControl = loadUserSubComponent<Interfaces::SimpleNetwork>( "rtrLink", ComponentInfo::SHARE_NONE, 2 );
     assert( m_linkControl );
@@ -249,7 +259,7 @@ Nic::Nic(ComponentId_t id, Params &params) :
         SendMachine* sm = new SendMachine( *this,  m_myNodeId, 
                 params.find<uint32_t>("verboseLevel",0),
                 params.find<uint32_t>("verboseMask",-1), 
-                i, packetSizeInBytes, packetOverhead, maxSendMachineQsize, allocNicSendUnit(), false );
+                i, packetSizeInBytes, packetOverhead, maxSendMachineQsize, allocNicSendUnit(), false, packetTrainLength );
         m_sendMachineQ.push( sm  ); 
         m_sendMachineV[i] = sm;
     }
@@ -257,7 +267,7 @@ Nic::Nic(ComponentId_t id, Params &params) :
     m_sendMachineV[ numSendMachines - 1] = new SendMachine( *this,  m_myNodeId, 
                 params.find<uint32_t>("verboseLevel",0),
                 params.find<uint32_t>("verboseMask",-1), 
-                m_sendMachineV.size()-1, packetSizeInBytes, packetOverhead, maxSendMachineQsize, allocNicSendUnit(), true ); 
+                m_sendMachineV.size()-1, packetSizeInBytes, packetOverhead, maxSendMachineQsize, allocNicSendUnit(), true, packetTrainLength ); 
 
     float dmaBW  = params.find<float>( "dmaBW_GBs", 0.0 ); 
     float dmaContentionMult = params.find<float>( "dmaContentionMult", 0.0 );
@@ -348,6 +358,13 @@ void Nic::init( unsigned int phase )
 	}
     if ( m_linkBytesPerSec == 0 && m_linkControl->isNetworkInitialized() ) {
         m_linkBytesPerSec = m_linkControl->getLinkBW().getRoundedValue()/8;
+
+        // a train is sent as one network packet, if the rtrLink buffer can't
+        // hold a full train spaceToSend() never succeeds and the send stalls
+        if ( m_packetTrainBits && ! m_linkControl->spaceToSend( 0, m_packetTrainBits ) ) {
+            m_dbg.fatal(CALL_INFO,-1,"Error: a train of packetTrainLength packets (%d bits) does not fit the rtrLink output buffer\n",
+                    m_packetTrainBits );
+        }
     }
 }
 
@@ -602,7 +619,7 @@ void Nic::sendPkt( FireflyNetworkEvent* ev, int dest, int vc )
 {
     assert( ev->bufSize() );
 
-    m_sentPkts->addData(1);
+    m_sentPkts->addDataNTimes( ev->getNumPkts(), 1 );
 
 
     SimpleNetwork::Request* req = new SimpleNetwork::Request();
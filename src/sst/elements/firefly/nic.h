@@ -32,6 +32,7 @@
 //#include "memoryModel/trivialMemoryModel.h"
 #include "memoryModel/simpleMemoryModel.h"
 #include "memoryModel/detailedInterface.h"
+#include "intervalIndex.h"
 
 #define CALL_INFO_LAMBDA     __LINE__, __FILE__
 
@@ -85,6 +86,7 @@ class Nic : public SST::Component  {
         { "numRecvNicUnits", "Sets the number of receive units", "1"},
         { "packetOverhead", "Sets the overhead of a network packet", "0"},
         { "packetSize", "Sets the size of the network packet in bytes", "64"},
+        { "packetTrainLength", "Sets the max number of consecutive packets of a message sent as one network event; packetTrainLength * packetSize must fit the rtrLink output buffer (checked at init) and the router input buffer", "1"},
         { "input_buf_size", "Sets the buffer size of the link connected to the router", "128"},
         { "output_buf_size", "Sets the buffer size of the link connected to the router", "128"},
         { "link_bw", "Sets the bandwidth of link connected to the router", "500Mhz"},
@@ -490,6 +492,7 @@ struct X {
     LinkControlWidget* m_linkSendWidget;
 
 	uint64_t m_linkBytesPerSec;
+    int      m_packetTrainBits;     // size of a full packet train, 0 without trains
 
 	std::vector< int >		m_sendStreamNum;
 
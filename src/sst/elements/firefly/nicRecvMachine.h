@@ -182,6 +182,9 @@ class RecvMachine {
 
                 FireflyNetworkEvent* event =
                     static_cast<FireflyNetworkEvent*>(payload);
+                if ( event->getNumPkts() > 1 ) {
+                    m_nic.m_rcvdPkts->addDataNTimes( event->getNumPkts() - 1, 1 );
+                }
                 event->setSrcNode( m_nic.NetToId( req->src ) );
 				m_nic.m_rcvdByteCount->addData( event->payloadSize() );
                 delete req;
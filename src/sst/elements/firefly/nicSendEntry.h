@@ -34,6 +34,8 @@ class SendEntryBase {
     virtual void copyOut( Output& dbg, int numBytes,
             FireflyNetworkEvent& event, std::vector<MemOp>& vec ) = 0; 
     virtual bool shouldDelete() { return true; }
+    // can consecutive packets be sent as one packet train
+    virtual bool canTrain() { return false; }
     bool isCtrl() { return m_isCtrl; }
     bool isAck() { return m_isAck; }
     int txDelay() { return m_txDelay; }
@@ -75,6 +77,8 @@ class CmdSendEntry: public SendEntryBase, public EntryBase {
         EntryBase::copyOut(dbg,numBytes, event, vec );
     }
 
+    bool canTrain()     { return true; }
+
     MsgHdr::Op getOp()  { return MsgHdr::Msg; }
     int dst_vNic( )     { return m_cmd->dst_vNic; }
     int dest()          { return m_cmd->node; }
@@ -160,6 +164,7 @@ class PutOrgnEntry : public MsgSendEntry, public EntryBase {
 
     size_t totalBytes() { return m_totalBytes; }
     bool isDone()       { return EntryBase::isDone(); }
+    bool canTrain()     { return true; }
     MsgHdr::Op getOp()  { return MsgHdr::Rdma; }
     void* hdr()         { return &m_hdr; }
     size_t hdrSize()    { return sizeof(m_hdr); }
@@ -59,7 +59,21 @@ void Nic::SendMachine::getPayload( SendEntryBase* entry, FireflyNetworkEvent* ev
     if ( ! m_inQ->isFull() ) {
 	    std::vector< MemOp >* vec = new std::vector< MemOp >; 
         entry->copyOut( m_dbg, m_packetSizeInBytes, *ev, *vec ); 
-        m_dbg.debug(CALL_INFO,2,NIC_DBG_SEND_MACHINE, "enque load from host, %lu bytes\n",ev->bufSize());
+
+        // fill the following packets of the stream into the same event,
+        // each packet still holds at most m_packetSizeInBytes
+        int numPkts = 1;
+        while ( numPkts < m_trainLength && entry->canTrain() && ! entry->isDone() ) {
+            size_t len = ev->bufSize();
+            entry->copyOut( m_dbg, ( numPkts + 1 ) * m_packetSizeInBytes, *ev, *vec );
+            if ( ev->bufSize() == len ) {
+                break;
+            }
+            ++numPkts;
+        }
+        ev->setNumPkts( numPkts );
+
+        m_dbg.debug(CALL_INFO,2,NIC_DBG_SEND_MACHINE, "enque load from host, %lu bytes in %d packets\n",ev->bufSize(),numPkts);
         if ( entry->isDone() ) {
             ev->setTail();
             m_inQ->enque( m_unit, pid, vec, ev, entry->dest(), std::bind( &Nic::SendMachine::streamFini, this, entry ) );
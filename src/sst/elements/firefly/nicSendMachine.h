@@ -133,9 +133,10 @@ class SendMachine {
       public:
 
         SendMachine( Nic& nic, int nodeId, int verboseLevel, int verboseMask, int myId,
-              int packetSizeInBytes, int pktOverhead, int maxQsize, int unit, bool flag = false ) :
+              int packetSizeInBytes, int pktOverhead, int maxQsize, int unit, bool flag = false, int trainLength = 1 ) :
             m_nic(nic), m_id(myId), m_packetSizeInBytes( packetSizeInBytes - pktOverhead ), 
-            m_unit(unit), m_pktOverhead(pktOverhead), m_activeEntry(NULL), m_I_manage( flag ), m_numSent(0)
+            m_unit(unit), m_pktOverhead(pktOverhead), m_trainLength( trainLength ), m_I_manage( flag ),
+            m_activeEntry(NULL), m_numSent(0)
         {
             char buffer[100];
             snprintf(buffer,100,"@t:%d:Nic::SendMachine%d::@p():@l ",nodeId,myId);
@@ -188,6 +189,7 @@ class SendMachine {
         int     m_packetSizeInBytes;
         int     m_unit;
         int     m_pktOverhead;
+        int     m_trainLength;
         bool    m_I_manage;
         SendEntryBase* m_activeEntry;
         std::queue< SendEntryBase* > m_sendQ;
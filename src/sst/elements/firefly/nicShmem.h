@@ -95,6 +95,13 @@ class Shmem {
 		m_pendingGets.resize( numVnics );
 		m_nicCmdLatency =    params.find<int>( "nicCmdLatency", 10 );
 		m_hostCmdLatency =   params.find<int>( "hostCmdLatency", 10 );
+
+		// also keep the registrations in a list and check every lookup
+		// against a linear search in registration order
+		m_checkRegions =     params.find<bool>( "checkRegions", false );
+		if ( m_checkRegions ) {
+			m_regMemList.resize( numVnics );
+		}
 	}
     ~Shmem() {
         m_regMem.clear();
@@ -142,15 +149,14 @@ class Shmem {
 	}	
 
     std::pair<Hermes::MemAddr, size_t>& findRegion( int core, uint64_t addr ) { 
-        for ( int i = 0; i < m_regMem[core].size(); i++ ) {
-            if ( addr >= m_regMem[core][i].first.getSimVAddr() &&
-                addr < m_regMem[core][i].first.getSimVAddr() + m_regMem[core][i].second ) {
-                return m_regMem[core][i]; 
-            } 
-        } 
-		m_dbg.fatal(CALL_INFO,0," core %d Unable to find for for addr %" PRIx64 "\n", core, addr);
-		// quiet compiler warning
-		assert(0);
+        std::pair<Hermes::MemAddr, size_t>* region = m_regMem[core].find( addr );
+        if ( m_checkRegions ) {
+            checkRegion( core, addr, region );
+        }
+        if ( NULL == region ) {
+		    m_dbg.fatal(CALL_INFO,0," core %d Unable to find for for addr %" PRIx64 "\n", core, addr);
+        }
+        return *region;
     }
 	
 	void regMem( int id, uint64_t simAddr, size_t length, void* backing ) {
@@ -159,7 +165,33 @@ class Shmem {
 	    m_dbg.verbosePrefix( prefix(),CALL_INFO,1,NIC_DBG_SHMEM,"core=%d simVAddr=%" PRIx64 " backing=%p len=%lu\n",
             id, addr.getSimVAddr(), addr.getBacking(), length );
 
-    	m_regMem[id].push_back( std::make_pair(addr, length) );
+    	addRegion( id, addr, length );
+	}
+
+	void addRegion( int id, const Hermes::MemAddr& addr, size_t length ) {
+		if ( length ) {
+			m_regMem[id].insert( addr.getSimVAddr(), addr.getSimVAddr() + length - 1, std::make_pair(addr, length) );
+			if ( m_checkRegions ) {
+				m_regMemList[id].push_back( std::make_pair(addr, length) );
+			}
+		}
+	}
+
+	void checkRegion( int core, uint64_t addr, std::pair<Hermes::MemAddr, size_t>* region ) {
+		std::pair<Hermes::MemAddr, size_t>* expected = NULL;
+		for ( size_t i = 0; i < m_regMemList[core].size(); i++ ) {
+			if ( addr >= m_regMemList[core][i].first.getSimVAddr() &&
+					addr < m_regMemList[core][i].first.getSimVAddr() + m_regMemList[core][i].second ) {
+				expected = &m_regMemList[core][i];
+				break;
+			}
+		}
+		if ( ( NULL == expected ) != ( NULL == region ) || ( expected &&
+				( expected->first.getSimVAddr() != region->first.getSimVAddr() ||
+				  expected->first.getBacking() != region->first.getBacking() ||
+				  expected->second != region->second ) ) ) {
+			m_dbg.fatal(CALL_INFO,0," core %d region lookup for addr %" PRIx64 " differs from the linear search\n", core, addr);
+		}
 	}
 
     void checkWaitOps( int core, Hermes::Vaddr addr, size_t length );
@@ -204,7 +236,9 @@ private:
     Nic& m_nic;
     Output& m_dbg;
     std::vector< std::list<Op*> > m_pendingOps;
-    std::vector<std::vector< std::pair<Hermes::MemAddr, size_t> > > m_regMem;
+    std::vector< IntervalIndex< std::pair<Hermes::MemAddr, size_t> > > m_regMem;
+    bool m_checkRegions;
+    std::vector< std::vector< std::pair<Hermes::MemAddr, size_t> > > m_regMemList;
 	SimTime_t m_nic2HostDelay_ns;
 	SimTime_t m_host2NicDelay_ns;
 
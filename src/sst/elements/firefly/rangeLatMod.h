@@ -24,6 +24,7 @@
 #include <sst/core/unitAlgebra.h>
 
 #include "ioVec.h"
+#include "intervalIndex.h"
 
 #define RANGELATMOD_DBG  0
 #define LINEAR_X         0.25
@@ -106,6 +107,7 @@ class RangeLatMod : public LatencyMod {
                         entry.stop, entry.latency * 1000000000.0 );
 #endif
             map.push_back( entry );
+            index.insert( entry.start, entry.stop, map.size() - 1 );
         }
     }
     ~RangeLatMod(){};
@@ -118,26 +120,21 @@ class RangeLatMod : public LatencyMod {
 #if RANGELATMOD_DBG 
         printf("\n%s() value=%lu op=%d\n",__func__,value,op);
 #endif
-        std::deque<Entry>::iterator iter = map.begin(); 
+        size_t* pos = index.find( value );
 
-        for ( ; iter != map.end(); ++iter ) {
-
-        //    printf("%s() %p\n",__func__,&*(iter));
-            if ( value >= iter->start && 
-                        ( -1 == (signed)iter->stop || value <= iter->stop ) ) {
+        if ( pos ) {
+            std::deque<Entry>::iterator iter = map.begin() + *pos;
 #if RANGELATMOD_DBG 
-                printf("%s() found, start %lu, stop %lu, value %.3f ns\n",
-                    __func__, iter->start, iter->stop,
-                    iter->latency * 1000000000.0);
+            printf("%s() found, start %lu, stop %lu, value %.3f ns\n",
+                __func__, iter->start, iter->stop,
+                iter->latency * 1000000000.0);
 #endif
-                mid = &*iter;
-                if ( (iter+1) != map.end() ) {
-                    next = &*(iter+1);
-                }
-                if ( iter != map.begin() ) {
-                    prev = &*(iter-1);
-                }
-                break; 
+            mid = &*iter;
+            if ( (iter+1) != map.end() ) {
+                next = &*(iter+1);
+            }
+            if ( iter != map.begin() ) {
+                prev = &*(iter-1);
             }
         } 
 
@@ -193,6 +190,8 @@ class RangeLatMod : public LatencyMod {
   private:
     double base;
     std::deque< Entry > map;
+    // position in map of the range holding a size
+    IntervalIndex< size_t > index;
 };
 
 }
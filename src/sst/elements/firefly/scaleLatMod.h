@@ -22,6 +22,8 @@
 #include <sst/core/params.h>
 #include <sst/core/unitAlgebra.h>
 
+#include "intervalIndex.h"
+
 namespace SST {
 namespace Firefly {
 
@@ -79,19 +81,19 @@ class ScaleLatMod : public LatencyMod {
             entry.valueStop = stop.getValue().convert_to<double>();
 
             m_deque.push_back( entry );
+            if ( entry.stop > 0 ) {
+                m_index.insert( entry.start, entry.stop - 1, m_deque.size() - 1 );
+            }
         }
     }
     ~ScaleLatMod(){};
 
     size_t getLatency( size_t value ) {
         double mult = 0;
-        std::deque<Entry>::iterator iter = m_deque.begin(); 
         Entry* entry = NULL;
-        for ( ; iter != m_deque.end(); ++ iter ) {
-            if ( value >= iter->start && value < iter->stop ) {
-                entry = &(*iter);
-                break; 
-            }
+        size_t* pos = m_index.find( value );
+        if ( pos ) {
+            entry = &m_deque[ *pos ];
         }
 #if SCALELATMOD_DBG 
         printf("value=%lu\n",value);
@@ -133,6 +135,7 @@ class ScaleLatMod : public LatencyMod {
     }
   private:
     std::deque<Entry> m_deque;
+    IntervalIndex<size_t> m_index;
 };
 
 }
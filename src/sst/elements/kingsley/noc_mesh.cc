@@ -37,6 +37,8 @@ using namespace std;
 // Start class functions
 noc_mesh::~noc_mesh()
 {
+    for ( auto ev : event_pool ) delete ev;
+    for ( auto ev : credit_pool ) delete ev;
 }
 
 noc_mesh::noc_mesh(ComponentId_t cid, Params& params) :
@@ -47,6 +49,8 @@ noc_mesh::noc_mesh(ComponentId_t cid, Params& params) :
     total_endpoints(0),
     edge_status(0),
     endpoint_locations(0),
+    credit_pending_mask(0),
+    credit_forwarded_mask(0),
     use_dense_map(false),
     dense_map(NULL),
     output(Simulation::getSimulation()->getSimulationOutput())
@@ -57,6 +61,8 @@ noc_mesh::noc_mesh(ComponentId_t cid, Params& params) :
     use_dense_map = params.find<bool>("use_dense_map",false);
 
     port_priority_equal = params.find<bool>("port_priority_equal",false);
+
+    credit_return_threshold = params.find<int>("credit_return_threshold",0);
     
     // Parse all the timing parameters
 
@@ -111,6 +117,7 @@ noc_mesh::noc_mesh(ComponentId_t cid, Params& params) :
     send_bit_count = new Statistic<uint64_t>*[local_ports + 4];
     output_port_stalls = new Statistic<uint64_t>*[local_ports + 4];
     xbar_stalls = new Statistic<uint64_t>*[local_ports + 4];
+    credit_events_sent = new Statistic<uint64_t>*[local_ports + 4];
 
 
     // North port
@@ -119,6 +126,7 @@ noc_mesh::noc_mesh(ComponentId_t cid, Params& params) :
     send_bit_count[north_port] = registerStatistic<uint64_t>("send_bit_count","north");
     output_port_stalls[north_port] = registerStatistic<uint64_t>("output_port_stalls","north");
     xbar_stalls[north_port] = registerStatistic<uint64_t>("xbar_stalls","north");
+    credit_events_sent[north_port] = registerStatistic<uint64_t>("credit_events_sent","north");
 
     // South port
     ports[south_port] = configureLink("south", dummy_handler);
@@ -126,6 +134,7 @@ noc_mesh::noc_mesh(ComponentId_t cid, Params& params) :
     send_bit_count[south_port] = registerStatistic<uint64_t>("send_bit_count","south");
     output_port_stalls[south_port] = registerStatistic<uint64_t>("output_port_stalls","south");
     xbar_stalls[south_port] = registerStatistic<uint64_t>("xbar_stalls","south");
+    credit_events_sent[south_port] = registerStatistic<uint64_t>("credit_events_sent","south");
 
     // East port
     ports[east_port] = configureLink("east", dummy_handler);
@@ -133,6 +142,7 @@ noc_mesh::noc_mesh(ComponentId_t cid, Params& params) :
     send_bit_count[east_port] = registerStatistic<uint64_t>("send_bit_count","east");
     output_port_stalls[east_port] = registerStatistic<uint64_t>("output_port_stalls","east");
     xbar_stalls[east_port] = registerStatistic<uint64_t>("xbar_stalls","east");
+    credit_events_sent[east_port] = registerStatistic<uint64_t>("credit_events_sent","east");
 
     // West port
     ports[west_port] = configureLink("west", dummy_handler);
@@ -140,6 +150,7 @@ noc_mesh::noc_mesh(ComponentId_t cid, Params& params) :
     send_bit_count[west_port] = registerStatistic<uint64_t>("send_bit_count","west");
     output_port_stalls[west_port] = registerStatistic<uint64_t>("output_port_stalls","west");
     xbar_stalls[west_port] = registerStatistic<uint64_t>("xbar_stalls","west");
+    credit_events_sent[west_port] = registerStatistic<uint64_t>("credit_events_sent","west");
 
     // Configure local ports
     for ( int i = 0; i < local_ports; ++i ) {
@@ -155,20 +166,86 @@ noc_mesh::noc_mesh(ComponentId_t cid, Params& params) :
         send_bit_count[local_port_start + i] = registerStatistic<uint64_t>("send_bit_count",port_name.str());
         output_port_stalls[local_port_start + i] = registerStatistic<uint64_t>("output_port_stalls",port_name.str());
         xbar_stalls[local_port_start + i] = registerStatistic<uint64_t>("xbar_stalls",port_name.str());
+        credit_events_sent[local_port_start + i] = registerStatistic<uint64_t>("credit_events_sent",port_name.str());
     }
 
     
     // Allocate space for all the input buffers
     port_queues = new port_queue_t[local_port_start + local_ports];
-    port_busy = new int[local_port_start + local_ports];
+    port_busy_until = new Cycle_t[local_port_start + local_ports];
     for ( int i = 0; i < local_port_start + local_ports; ++i ) {
-        port_busy[i] = 0;
+        port_busy_until[i] = 0;
     }
 
     port_credits = new int[local_port_start + local_ports];
+    pending_credits = new int[local_port_start + local_ports];
     for ( int i = 0; i < local_port_start + local_ports; ++i ) {
         port_credits[i] = 0;
+        pending_credits[i] = 0;
     }
+
+    // Each input buffer can hold at most input_buf_size/flit_size
+    // packets, so that bounds the number of events we can ever have
+    // in flight towards us.
+    max_pool_size = (local_port_start + local_ports) * std::max(1, input_buf_size / flit_size);
+    event_pool.reserve(max_pool_size);
+    credit_pool.reserve(max_pool_size);
+}
+
+void
+noc_mesh::recycle_event(noc_mesh_event* event)
+{
+    if ( event_pool.size() < max_pool_size ) {
+        event->encap_ev = NULL;
+        event_pool.push_back(event);
+    }
+    else {
+        delete event;
+    }
+}
+
+void
+noc_mesh::recycle_credit_event(credit_event* ev)
+{
+    if ( credit_pool.size() < max_pool_size ) credit_pool.push_back(ev);
+    else delete ev;
+}
+
+credit_event*
+noc_mesh::alloc_credit_event(int credits)
+{
+    if ( credit_pool.empty() ) return new credit_event(0, credits);
+    credit_event* ev = credit_pool.back();
+    credit_pool.pop_back();
+    ev->vn = 0;
+    ev->credits = credits;
+    return ev;
+}
+
+void
+noc_mesh::return_credits()
+{
+    unsigned int mask = credit_pending_mask;
+    while ( mask != 0 ) {
+        int port = __builtin_ctz(mask);
+        mask &= mask - 1;
+
+        // Hold on to the credits while the port is still streaming
+        // packets and hasn't reached the threshold.  As soon as the
+        // port stops forwarding they are returned, so the upstream
+        // router can never wait on credits we are sitting on.
+        if ( credit_return_threshold > 0 &&
+             pending_credits[port] < credit_return_threshold &&
+             (credit_forwarded_mask & (1 << port)) ) {
+            continue;
+        }
+
+        ports[port]->send(alloc_credit_event(pending_credits[port]));
+        credit_events_sent[port]->addData(1);
+        pending_credits[port] = 0;
+        credit_pending_mask &= ~(1 << port);
+    }
+    credit_forwarded_mask = 0;
 }
 
 void
@@ -230,7 +307,7 @@ noc_mesh::handle_input_r2r(Event* ev, int port)
         credit_event* credit_ret = static_cast<credit_event*>(ev);
         port_credits[port] += credit_ret->credits;
         // output.output("(%d,%d): Got credit event for VN %d with %d credits\n",my_x,my_y,credit_ret->vn,credit_ret->credits);
-        delete ev;
+        recycle_credit_event(credit_ret);
         break;
     }
     case BaseNocEvent::INTERNAL:
@@ -253,8 +330,17 @@ noc_mesh::handle_input_r2r(Event* ev, int port)
 
 noc_mesh_event*
 noc_mesh::wrap_incoming_packet(NocPacket* packet) {
-    // Wrap the incoming NocPacket in a noc_mesh_event
-    noc_mesh_event* event = new noc_mesh_event(packet);
+    // Wrap the incoming NocPacket in a noc_mesh_event, reusing a
+    // wrapper from a packet that already left the mesh if we can
+    noc_mesh_event* event;
+    if ( event_pool.empty() ) {
+        event = new noc_mesh_event(packet);
+    }
+    else {
+        event = event_pool.back();
+        event_pool.pop_back();
+        event->encap_ev = packet;
+    }
     
     // Compute the destination router
     int dest = packet->request->dest;
@@ -321,7 +407,7 @@ noc_mesh::handle_input_ep2r(Event* ev, int port)
     {
         credit_event* credit_ret = static_cast<credit_event*>(ev);
         port_credits[port] += credit_ret->credits;
-        delete ev;
+        recycle_credit_event(credit_ret);
         break;
     }
     case BaseNocEvent::PACKET:
@@ -355,12 +441,9 @@ noc_mesh::handle_input_ep2r(Event* ev, int port)
 // }
 
 void noc_mesh::clock_wakeup() {
-    Cycle_t time = reregisterClock(clock_tc, my_clock_handler);
-    Cycle_t cyclesOff = time - last_time - 1;
-    // Update busy values
-    for ( int i = 0; i < local_port_start + local_ports; ++i) {
-        port_busy[i] = (port_busy[i] < cyclesOff) ? 0 : port_busy[i] - cyclesOff;
-    }
+    // Busy values are kept as absolute cycles, so nothing needs
+    // to be caught up for the cycles we were off
+    reregisterClock(clock_tc, my_clock_handler);
 
     // unsigned int local_progress = (cyclesOff * local_lru.size()) % (local_lru.size() * 2);
     // unsigned int mesh_progress = (cyclesOff * mesh_lru.size()) % (mesh_lru.size() * 2);
@@ -378,11 +461,6 @@ noc_mesh::clock_handler(Cycle_t cycle)
 {
     last_time = cycle;
     // TraceFunction trace(CALL_INFO);
-    // Decrement all the busy values
-    for ( int i = 0; i < local_port_start + local_ports; ++i ) {
-        port_busy[i]--;
-        if (port_busy[i] < 0) port_busy[i] = 0;
-    }
 
     bool keepClockOn = false;
     // Progress all the messages
@@ -401,7 +479,7 @@ noc_mesh::clock_handler(Cycle_t cycle)
                 int port = event->next_port;
 
                 // Check to see if the port is busy
-                if ( port_busy[port] > 0 ) {
+                if ( port_busy_until[port] > cycle ) {
                     xbar_stalls[port]->addData(1);
                     lru.satisfied(false);
                     keepClockOn = true;
@@ -422,12 +500,11 @@ noc_mesh::clock_handler(Cycle_t cycle)
                     // port_queues[local_port_start + i].pop();
                     port_queues[lru_port].pop();
                     port_credits[port] -= event->encap_ev->getSizeInFlits();
-                    port_busy[port] = event->encap_ev->getSizeInFlits();
+                    port_busy_until[port] = cycle + event->encap_ev->getSizeInFlits();
                     if ( edge_status & ( 1 << port) ) {
                         ports[port]->send(event->encap_ev);
                         send_bit_count[port]->addData(event->encap_ev->request->size_in_bits);
-                        event->encap_ev = NULL;
-                        delete event;
+                        recycle_event(event);
                     }
                     else {
                         ports[port]->send(event);
@@ -444,10 +521,12 @@ noc_mesh::clock_handler(Cycle_t cycle)
                                       src,
                                       dest);
                     }
-                    // Need to send credit event back to last router
-                    credit_event* cr_ev = new credit_event(0, flits);
-                    // ports[local_port_start + i]->send(cr_ev);
-                    ports[lru_port]->send(cr_ev);
+                    // Need to return credits to last router.  These
+                    // are sent in return_credits() at the end of the
+                    // clock.
+                    pending_credits[lru_port] += flits;
+                    credit_pending_mask |= (1 << lru_port);
+                    credit_forwarded_mask |= (1 << lru_port);
                     lru.satisfied(true);
                 }
                 else {
@@ -464,6 +543,10 @@ noc_mesh::clock_handler(Cycle_t cycle)
     }
     
     // }
+    if ( credit_pending_mask ) return_credits();
+    // Credits held back by the threshold need a later clock to be
+    // returned
+    if ( credit_pending_mask ) keepClockOn = true;
     clock_is_off = !keepClockOn;
 
     // Stay on clock list
@@ -1353,7 +1436,9 @@ noc_mesh::printStatus(Output& out)
     for ( auto& pinfo : vec ) {
         out.output("  %s port:\n", pinfo.first.c_str());
         if ( ports[pinfo.second] != NULL ) {
-            out.output("    Port busy = %d\n",port_busy[pinfo.second]);
+            out.output("    Port busy = %" PRIu64 "\n",
+                       port_busy_until[pinfo.second] > last_time ? port_busy_until[pinfo.second] - last_time : 0);
+            out.output("    Pending credits = %d\n",pending_credits[pinfo.second]);
             out.output("    Port credits = %d\n",port_credits[pinfo.second]);
             out.output("    Input queue total packets = %lu, head packet info:\n",port_queues[pinfo.second].size());
             if ( port_queues[pinfo.second].empty() ) {
@@ -27,6 +27,7 @@
 #include <sst/core/statapi/stataccumulator.h>
 
 #include <queue>
+#include <vector>
 
 #include "sst/elements/kingsley/nocEvents.h"
 #include "sst/elements/kingsley/lru_unit.h"
@@ -59,6 +60,8 @@ public:
         {"port_priority_equal","Set to true to have all port have equal priority (usually endpoint ports have higher priority).","false"},
         {"route_y_first",      "Set to true to rout Y-dimension first.","false"},
         {"use_dense_map",      "Set to true to have a dense network id map instead of the sparse map normally used.","false"},
+        {"credit_return_threshold","Number of flits of credit to accumulate on an input port before returning them upstream while the port keeps forwarding.  "
+         "0 returns credits every cycle, which is cycle-identical to per-packet credit return.","0"},
         // {"network_inspectors", "Comma separated list of network inspectors to put on output ports.", ""},
     )
 
@@ -75,6 +78,7 @@ public:
         // { "send_packet_count",  "Count number of packets sent on link", "packets", 1},
         { "output_port_stalls", "Time output port is stalled (in units of core timebase)", "time in stalls", 1},
         { "xbar_stalls",        "Count number of cycles the xbar is stalled", "cycles", 1},
+        { "credit_events_sent", "Count number of credit events sent upstream on link", "events", 1},
         // { "idle_time",          "Amount of time spent idle for a given port", "units of core timebase", 1},
     )
 
@@ -120,8 +124,25 @@ private:
 
     Link** ports;
     port_queue_t* port_queues;
-    int* port_busy;
+    // Cycle at which each output port is free again.  Kept as an
+    // absolute cycle so that nothing has to be decremented per clock.
+    Cycle_t* port_busy_until;
     int* port_credits;
+
+    // Credits owed to the upstream side of each input port.  They
+    // are accumulated during the clock and returned once at the end
+    // of it (or once credit_return_threshold is reached).
+    int* pending_credits;
+    int credit_return_threshold;
+    unsigned int credit_pending_mask;
+    unsigned int credit_forwarded_mask;
+
+    // Recycled events.  Wrappers that leave the mesh and credit
+    // events that arrive are kept here and reused instead of being
+    // deleted and reallocated.
+    std::vector<noc_mesh_event*> event_pool;
+    std::vector<credit_event*> credit_pool;
+    size_t max_pool_size;
     int local_ports;
     bool use_dense_map;
     bool port_priority_equal;
@@ -137,6 +158,10 @@ private:
     Output& output;
 
     noc_mesh_event* wrap_incoming_packet(NocPacket* packet);
+    void recycle_event(noc_mesh_event* event);
+    void recycle_credit_event(credit_event* ev);
+    credit_event* alloc_credit_event(int credits);
+    void return_credits();
     void handle_input_r2r(Event* ev, int port);
     void handle_input_ep2r(Event* ev, int port);
 
@@ -146,6 +171,7 @@ private:
     Statistic<uint64_t>** send_bit_count;
     Statistic<uint64_t>** output_port_stalls;
     Statistic<uint64_t>** xbar_stalls;
+    Statistic<uint64_t>** credit_events_sent;
     // Statistic<uint64_t>** xbar_stalls_prioirty;
     // Statistic<uint64_t>** xbar_stalls_normal;
     // Statistic<uint64_t>** output_idle;
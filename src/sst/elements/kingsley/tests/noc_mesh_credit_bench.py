@@ -0,0 +1,103 @@
+# Benchmark for credit return in kingsley.noc_mesh
+#
+# Builds an x_size by y_size mesh of routers with one merlin.test_nic
+# per router and writes the per-port statistics to a csv file.  Sum the
+# credit_events_sent column to get the number of credit events the
+# mesh generated.  Run once with the default credit_return_threshold
+# (cycle-identical to per-packet credit return) and once with a
+# threshold to see the reduction in events, e.g.:
+#
+#   sst noc_mesh_credit_bench.py --model-options="16 16 0"
+#   sst noc_mesh_credit_bench.py --model-options="16 16 4"
+#
+import sst
+import sys
+
+x_size = 16
+y_size = 16
+credit_return_threshold = 0
+
+if len(sys.argv) > 1: x_size = int(sys.argv[1])
+if len(sys.argv) > 2: y_size = int(sys.argv[2])
+if len(sys.argv) > 3: credit_return_threshold = int(sys.argv[3])
+
+sst.setProgramOption("timebase", "1ps")
+
+num_messages = 50
+msg_size = "256B"
+link_bw = "32GB/s"
+flit_size = "32B"
+input_buf_size = "256B"
+
+links = dict()
+def getLink(name1, name2):
+    name = "link.%s:%s"%(name1, name2)
+    if name not in links:
+        links[name] = sst.Link(name)
+    return links[name]
+
+# Endpoints hang off every local port and off the edge ports of the
+# mesh, the same way as in noc_mesh_32_test.py
+num_peers = (x_size * y_size) + (2*x_size) + (2*y_size)
+
+def addEndpoint(name, link):
+    ep = sst.Component(name, "merlin.test_nic")
+    ep.addParams({
+        "num_peers" : num_peers,
+        "link_bw" : "16GB/s",
+        "linkcontrol_type" : "kingsley.linkcontrol",
+        "message_size" : msg_size,
+        "num_messages" : num_messages
+    })
+    ep.addLink(link, "rtr", "800ps")
+
+def connect(rtr, port, name1, name2, ep_name):
+    link = getLink(name1, name2)
+    rtr.addLink(link, port, "800ps")
+    if ep_name is not None:
+        addEndpoint(ep_name, link)
+
+for y in range(y_size):
+    for x in range(x_size):
+        name = "rtr.%d.%d"%(x,y)
+        rtr = sst.Component(name, "kingsley.noc_mesh")
+        rtr.addParams({
+            "local_ports" : 1,
+            "link_bw" : link_bw,
+            "input_buf_size" : input_buf_size,
+            "flit_size" : flit_size,
+            "use_dense_map" : "true",
+            "credit_return_threshold" : credit_return_threshold
+        })
+
+        if y != y_size - 1:
+            connect(rtr, "north", name, "rtr.%d.%d"%(x,y+1), None)
+        else:
+            connect(rtr, "north", name, "ep0.%d.%d"%(x,y+1), "ep0.%d.%d"%(x,y+1))
+
+        if y != 0:
+            connect(rtr, "south", "rtr.%d.%d"%(x,y-1), name, None)
+        else:
+            connect(rtr, "south", "rtr.%d.%d"%(x,y-1), "ep0.%d.%d"%(x,y), "ep0.%d.%d"%(x,y-1))
+
+        if x != x_size - 1:
+            connect(rtr, "east", name, "rtr.%d.%d"%(x+1,y), None)
+        else:
+            connect(rtr, "east", name, "ep0.%d.%d"%(x+1,y), "ep0.%d.%d"%(x+1,y))
+
+        if x != 0:
+            connect(rtr, "west", "rtr.%d.%d"%(x-1,y), name, None)
+        else:
+            connect(rtr, "west", "rtr.%d.%d"%(x-1,y), "ep0.%d.%d"%(x,y), "ep0.%d.%d"%(x-1,y))
+
+        connect(rtr, "local0", name, "ep0.%d.%d"%(x,y), "ep0.%d.%d"%(x,y))
+
+sst.setStatisticLoadLevel(9)
+
+sst.setStatisticOutput("sst.statOutputCSV");
+sst.setStatisticOutputOptions({
+    "filepath" : "credit_bench_%dx%d_%d.csv"%(x_size, y_size, credit_return_threshold),
+    "separator" : ", "
+})
+
+sst.enableAllStatisticsForComponentType("kingsley.noc_mesh", {"type":"sst.AccumulatorStatistic","rate":"0ns"})
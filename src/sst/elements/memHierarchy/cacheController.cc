@@ -14,6 +14,7 @@
 // distribution.
 
 #include <sst_config.h>
+#include <algorithm>
 #include <sst/core/params.h>
 #include <sst/core/simulation.h>
 #include <sst/core/interfaces/stringEvent.h>
@@ -31,7 +32,7 @@ using namespace SST::MemHierarchy;
 /**************************************************************************
  * Handlers for various links
  * linkUp/down -> handleEvent()
- * prefetcher -> handlePrefetchEvent()
+ * prefetcher -> handlePrefetchEvent() or handlePrefetchBatch()
  * prefetch self link -> processPrefetchEvent()
  **************************************************************************/
 
@@ -53,6 +54,30 @@ void Cache::handlePrefetchEvent(SST::Event * ev) {
     prefetchSelfLink_->send(prefetchDelay_, ev);
 }
 
+/* 
+ * Handle a batch of line addresses from a cache listener (prefetcher)
+ * Lines that are already cached, already in the MSHR, or repeated in the batch are
+ * dropped here so that only useful prefetches become events
+ */
+void Cache::handlePrefetchBatch(const std::vector<Addr>& addrs) {
+    prefetchBatch_.clear();
+    for (std::vector<Addr>::const_iterator it = addrs.begin(); it != addrs.end(); it++) {
+        Addr addr = toBaseAddr(*it);
+        if (std::find(prefetchBatch_.begin(), prefetchBatch_.end(), addr) != prefetchBatch_.end() || mshr_->exists(addr) || coherenceMgr_->isCached(addr)) {
+            statPrefetchFiltered->addData(1);
+            continue;
+        }
+        prefetchBatch_.push_back(addr);
+    }
+
+    for (std::vector<Addr>::iterator it = prefetchBatch_.begin(); it != prefetchBatch_.end(); it++) {
+        MemEvent * event = new MemEvent(getName(), *it, *it, Command::GetS);
+        event->setSize(lineSize_);
+        event->setPrefetchFlag(true);
+        prefetchSelfLink_->send(prefetchDelay_, event);
+    }
+}
+
 /* Handle event from prefetch self link */
 void Cache::processPrefetchEvent(SST::Event * ev) {
     MemEvent * event = static_cast<MemEvent*>(ev);
@@ -66,6 +91,13 @@ void Cache::processPrefetchEvent(SST::Event * ev) {
 
     // Record received prefetch
     statPrefetchRequest->addData(1);
+
+    // Prefetches wait for a later cycle only when they have their own budget, so bound the wait
+    if (maxPrefetchesPerCycle_ != 0 && prefetchBuffer_.size() >= prefetchBufferEntries_) {
+        statPrefetchDrop->addData(1);
+        delete event;
+        return;
+    }
     prefetchBuffer_.push(event);
 }
 
@@ -90,6 +122,12 @@ bool Cache::clockTick(Cycle_t time) {
     // MSHR occupancy
     statMSHROccupancy->addData(mshr_->getSize());
 
+    // Periodically hand the deferred event counts to their statistics
+    if (statFlushPeriod_ != 0 && timestamp_ >= nextStatFlush_) {
+        coherenceMgr_->flushStatistics();
+        nextStatFlush_ = timestamp_ + statFlushPeriod_;
+    }
+
     // Clear bank status to prepare for event handling
     for (unsigned int bank = 0; bank < bankStatus_.size(); bank++)
         bankStatus_[bank] = false;
@@ -144,13 +182,23 @@ bool Cache::clockTick(Cycle_t time) {
             it++;
         }
     }
+    // Prefetches either share the request limit with other events, and any not handled this cycle are dropped,
+    // or have their own per-cycle budget, and any over the budget wait for the next cycle
+    int prefetchesHandled = 0;
     while (!prefetchBuffer_.empty()) {
+        if (maxPrefetchesPerCycle_ != 0 && prefetchesHandled == maxPrefetchesPerCycle_)
+            break;
         if (is_debug_event(prefetchBuffer_.front())) {
             dbg_->debug(_L3_, "E: %-20" PRIu64 " %-20" PRIu64 " %-20s Event:Pref    (%s)\n",
                     Simulation::getSimulation()->getCurrentSimCycle(), timestamp_, getName().c_str(), prefetchBuffer_.front()->getVerboseString().c_str());
             fflush(stdout);
         }
-        if (accepted != maxRequestsPerCycle_ && processEvent(prefetchBuffer_.front(), false)) {
+        prefetchesHandled++;
+        if (maxPrefetchesPerCycle_ != 0) {
+            if (!processEvent(prefetchBuffer_.front(), false))
+                statPrefetchDrop->addData(1);
+            // Accepted prefetches are profiled in the coherence manager
+        } else if (accepted != maxRequestsPerCycle_ && processEvent(prefetchBuffer_.front(), false)) {
             accepted++;
             // Accepted prefetches are profiled in the coherence manager
         } else {
@@ -167,7 +215,7 @@ bool Cache::clockTick(Cycle_t time) {
     idle &= coherenceMgr_->checkIdle();
 
     // Disable lower-level cache clocks if they're idle
-    if (eventBuffer_.empty() && retryBuffer_.empty() && idle) {
+    if (eventBuffer_.empty() && retryBuffer_.empty() && prefetchBuffer_.empty() && idle) {
         turnClockOff();
         return true;
     }
@@ -181,9 +229,8 @@ void Cache::turnClockOn() {
     timestamp_ = time - 1;
     coherenceMgr_->updateTimestamp(timestamp_);
     int64_t cyclesOff = timestamp_ - lastActiveClockCycle_;
-    for (int64_t i = 0; i < cyclesOff; i++) {           // TODO more efficient way to do this? Don't want to add in one-shot or we get weird averages/sum sq.
-        statMSHROccupancy->addData(mshr_->getSize());
-    }
+    if (cyclesOff > 0)  // Same as adding the occupancy once per cycle, keeps averages/sum sq. correct
+        statMSHROccupancy->addDataNTimes(cyclesOff, mshr_->getSize());
     //d_->debug(_L3_, "%s turning clock ON at cycle %" PRIu64 ", timestamp %" PRIu64 ", ns %" PRIu64 "\n", this->getName().c_str(), time, timestamp_, getCurrentSimTimeNano());
     clockIsOn_ = true;
 }
@@ -191,6 +238,8 @@ void Cache::turnClockOn() {
 void Cache::turnClockOff() {
     clockIsOn_ = false;
     lastActiveClockCycle_ = timestamp_;
+    if (aggregateStats_)
+        coherenceMgr_->flushStatistics();
 }
 
 /**************************************************************************
@@ -496,6 +545,8 @@ void Cache::finish() {
     if (!clockIsOn_) { // Correct statistics
         turnClockOn();
     }
+    if (aggregateStats_)
+        coherenceMgr_->flushStatistics();
     for (int i = 0; i < listeners_.size(); i++)
         listeners_[i]->printStats(*out_);
     linkDown_->finish();
@@ -76,6 +76,9 @@ public:
             {"prefetch_delay_cycles",   "(uint) Delay prefetches from prefetcher by this number of cycles.", "1"},
             {"max_outstanding_prefetch","(uint) Maximum number of prefetch misses that can be outstanding, additional prefetches will be dropped/NACKed. Default is 1/2 of MSHR entries.", "0.5*mshr_num_entries"},
             {"drop_prefetch_mshr_level","(uint) Drop/NACK prefetches if the number of in-use mshrs is greater than or equal to this number. Default is mshr_num_entries - 2.", "mshr_num_entries-2"},
+            {"max_prefetches_per_cycle","(uint) Prefetches handled per cycle, separately from max_requests_per_cycle. Prefetches over the limit wait for a later cycle instead of being dropped. 0 counts prefetches against max_requests_per_cycle and drops any not handled in the cycle they arrive.", "0"},
+            {"prefetch_buffer_entries", "(uint) With max_prefetches_per_cycle, maximum number of prefetches waiting to be handled. Prefetches arriving at a full buffer are dropped.", "32"},
+            {"prefetch_batch_filter",   "(bool) Let prefetchers that support it send batches of lines, and drop lines that are already cached, in the MSHR, or repeated in the batch before issuing them.", "false"},
             {"num_cache_slices",        "(uint) For a distributed, shared cache, total number of cache slices", "1"},
             {"slice_id",                "(uint) For distributed, shared caches, unique ID for this cache slice", "0"},
             {"slice_allocation_policy", "(string) Policy for allocating addresses among distributed shared cache. Options: rr[round-robin]", "rr"},
@@ -89,6 +92,8 @@ public:
             {"force_noncacheable_reqs", "(bool) Used for verification purposes. All requests are considered to be 'noncacheable'. Options: 0[off], 1[on]", "false"},
             {"min_packet_size",         "(string) Number of bytes in a request/response not including payload (e.g., addr + cmd). Specify in B.", "8B"},
             {"banks",                   "(uint) Number of cache banks: One access per bank per cycle. Use '0' to simulate no bank limits (only limits on bandwidth then are max_requests_per_cycle and *_link_width", "0"},
+            {"aggregate_stats",         "(bool) Count coherence events locally and pass the counts to the statistics in bulk. Counting statistics are only up to date after a flush.", "false"},
+            {"aggregate_stats_period",  "(uint) With aggregate_stats, flush the counts every this many cycles; use with periodic statistic output. 0 flushes only when the cache goes idle and at the end of simulation.", "0"},
             /* Old parameters - deprecated or moved */
             {"network_address",             "DEPRECATED - Now auto-detected by link control."}, // Remove 9.0
             {"network_bw",                  "MOVED - Now a member of the MemNIC subcomponent.", "80GiB/s"}, // Remove 9.0
@@ -119,6 +124,7 @@ public:
             {"Bank_conflicts",          "Total number of bank conflicts detected", "count", 1},
             {"Prefetch_requests",       "Number of prefetches received from prefetcher at this cache", "events", 1},
             {"Prefetch_drops",          "Number of prefetches that were cancelled. Reasons: too many prefetches outstanding, cache can't handle prefetch this cycle, currently handling another event for the address.", "events", 1},
+            {"Prefetch_filtered",       "With prefetch_batch_filter, number of lines in prefetch batches that were not issued because they were already cached, in the MSHR, or repeated in the batch", "events", 1},
             /*Event receives */
             {"GetS_recv",               "Event received: GetS", "count", 2},
             {"GetX_recv",               "Event received: GetX", "count", 2},
@@ -220,6 +226,9 @@ private:
     // Handle incoming prefetching events -> prepare to process
     void handlePrefetchEvent(SST::Event *event);
 
+    // Handle a batch of prefetch addresses -> filter and prepare to process
+    void handlePrefetchBatch(const std::vector<Addr>& addrs);
+
     // Process events
     bool processEvent(MemEventBase * ev, bool inMSHR);
 
@@ -259,6 +268,9 @@ private:
     
     /** Latencies **************************************************************/
     SimTime_t   prefetchDelay_;
+    int         maxPrefetchesPerCycle_;     // 0: prefetches share maxRequestsPerCycle_
+    size_t      prefetchBufferEntries_;
+    std::vector<Addr> prefetchBatch_;       // Filtered lines of the batch being handled
 
     /** Cache configuration ****************************************************/
     uint64_t            lineSize_;
@@ -276,6 +288,9 @@ private:
     bool                    clockUpLink_;   // Whether link actually needs clock() called or not
     bool                    clockDownLink_; // Whether link actually needs clock() called or not
     SimTime_t               lastActiveClockCycle_;  // Cycle we turned the clock off at - for re-syncing stats
+    bool                    aggregateStats_;        // Whether the coherence manager defers its event counts
+    uint64_t                statFlushPeriod_;       // Cycles between flushes of deferred counts, 0 for none
+    uint64_t                nextStatFlush_;
 
     /** Cache state ************************************************************/
     uint64_t                    timestamp_;
@@ -300,6 +315,7 @@ private:
     // Prefetch statistics
     Statistic<uint64_t>* statPrefetchRequest;
     Statistic<uint64_t>* statPrefetchDrop;
+    Statistic<uint64_t>* statPrefetchFiltered;
 
     // Event counts
     Statistic<uint64_t>* statRecvEvents;
@@ -208,6 +208,12 @@ void Cache::createCoherenceManager(Params &params) {
     coherenceMgr_->setName(getName());
     coherenceMgr_->setSliceAware(region_.interleaveSize, region_.interleaveStep);
 
+    aggregateStats_ = params.find<bool>("aggregate_stats", false);
+    statFlushPeriod_ = aggregateStats_ ? params.find<uint64_t>("aggregate_stats_period", 0) : 0;
+    nextStatFlush_ = statFlushPeriod_;
+    if (aggregateStats_)
+        coherenceMgr_->setStatisticsDeferred(true);
+
 }
 
 
@@ -588,6 +594,7 @@ void Cache::createListeners(Params &params) {
     uint64_t mshrSize = mshr_->getMaxSize(); // Either negative (unlimited) or 2+ (limited but can't be 0 or 1)
     /* Configure prefetcher(s) */
     bool found;
+    bool batchFilter = params.find<bool>("prefetch_batch_filter", false);
 
     SubComponentSlotInfo * lists = getSubComponentSlotInfo("prefetcher");
     if (lists) {
@@ -596,6 +603,8 @@ void Cache::createListeners(Params &params) {
             if (lists->isPopulated(i)) {
                 listeners_.push_back(lists->create<CacheListener>(i, ComponentInfo::SHARE_NONE));
                 listeners_[k]->registerResponseCallback(new Event::Handler<Cache>(this, &Cache::handlePrefetchEvent));
+                if (batchFilter)
+                    listeners_[k]->registerPrefetchBatchCallback(new PrefetchBatchHandler<Cache>(this, &Cache::handlePrefetchBatch));
                 k++;
             }
         }
@@ -606,14 +615,18 @@ void Cache::createListeners(Params &params) {
             prefParams = params.find_prefix_params("prefetcher.");
             listeners_.push_back(loadAnonymousSubComponent<CacheListener>(prefetcher, "prefetcher", 0, ComponentInfo::INSERT_STATS, prefParams));
             listeners_[0]->registerResponseCallback(new Event::Handler<Cache>(this, &Cache::handlePrefetchEvent));
+            if (batchFilter)
+                listeners_[0]->registerPrefetchBatchCallback(new PrefetchBatchHandler<Cache>(this, &Cache::handlePrefetchBatch));
         }
     }
     if (!listeners_.empty()) {
         statPrefetchRequest = registerStatistic<uint64_t>("Prefetch_requests");
         statPrefetchDrop = registerStatistic<uint64_t>("Prefetch_drops");
+        statPrefetchFiltered = batchFilter ? registerStatistic<uint64_t>("Prefetch_filtered") : nullptr;
     } else {
         statPrefetchRequest = nullptr;
         statPrefetchDrop = nullptr;
+        statPrefetchFiltered = nullptr;
     }
     
     if (!listeners_.empty()) { // Have at least one prefetcher
@@ -621,6 +634,12 @@ void Cache::createListeners(Params &params) {
         // Delay prefetches by a cycle TODO parameterize - let user specify prefetch delay
         std::string frequency = params.find<std::string>("cache_frequency", "", found);
         prefetchDelay_ = params.find<SimTime_t>("prefetch_delay_cycles", 1);
+        maxPrefetchesPerCycle_ = params.find<int>("max_prefetches_per_cycle", 0);
+        prefetchBufferEntries_ = params.find<size_t>("prefetch_buffer_entries", 32);
+        if (maxPrefetchesPerCycle_ < 0)
+            out_->fatal(CALL_INFO, -1, "%s, Invalid param: max_prefetches_per_cycle - must be 0 or greater. You specified %d\n", getName().c_str(), maxPrefetchesPerCycle_);
+        if (maxPrefetchesPerCycle_ > 0 && prefetchBufferEntries_ == 0)
+            out_->fatal(CALL_INFO, -1, "%s, Invalid param: prefetch_buffer_entries - must be at least 1 when max_prefetches_per_cycle is set\n", getName().c_str());
 
         prefetchSelfLink_ = configureSelfLink("prefetchlink", frequency, new Event::Handler<Cache>(this, &Cache::processPrefetchEvent));
     }
@@ -27,6 +27,8 @@
 #include <sst/core/subcomponent.h>
 #include <sst/core/warnmacros.h>
 
+#include <vector>
+
 #include "sst/elements/memHierarchy/memEvent.h"
 
 using namespace SST;
@@ -68,6 +70,24 @@ private:
 	NotifyResultType result;
 };
 
+/* Callback for prefetchers that hand the cache several line addresses at once */
+class PrefetchBatchHandlerBase {
+public:
+    virtual ~PrefetchBatchHandlerBase() {}
+    virtual void operator()(const std::vector<Addr>& addrs) = 0;
+};
+
+template <typename classT>
+class PrefetchBatchHandler : public PrefetchBatchHandlerBase {
+private:
+    typedef void (classT::*PtrMember)(const std::vector<Addr>&);
+    classT* object;
+    const PtrMember member;
+public:
+    PrefetchBatchHandler(classT* const object, PtrMember member) : object(object), member(member) {}
+    void operator()(const std::vector<Addr>& addrs) { (object->*member)(addrs); }
+};
+
 class CacheListener : public SubComponent {
 public:
     
@@ -85,6 +105,11 @@ public:
     virtual void printStats(Output &UNUSED(out)) {}
     virtual void notifyAccess(const CacheListenerNotification& UNUSED(notify)) {}
     virtual void registerResponseCallback(Event::HandlerBase *handler) { delete handler; }
+
+    /* Prefetchers that support it send batches of line addresses through this callback instead of
+     * one MemEvent per line through the response callback. The cache filters each batch against its
+     * MSHR and tags before creating any events. */
+    virtual void registerPrefetchBatchCallback(PrefetchBatchHandlerBase *handler) { delete handler; }
 };
 
 }}
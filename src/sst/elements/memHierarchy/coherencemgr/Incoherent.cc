@@ -51,7 +51,7 @@ bool Incoherent::handleGetS(MemEvent * event, bool inMSHR) {
                 status = inMSHR ? MemEventStatus::OK : allocateMSHR(event, false);
             if (status == MemEventStatus::OK) {
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::GetS][I]->addData(1);
+                    stat_eventState[(int)Command::GetS][I].addData(1);
                     notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::MISS);
                     mshr_->setProfiled(addr);
                 }
@@ -70,17 +70,17 @@ bool Incoherent::handleGetS(MemEvent * event, bool inMSHR) {
         case M:
             if (!inMSHR || mshr_->getProfiled(addr)) {
                 notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT);
-                stat_eventState[(int)Command::GetS][state]->addData(1);
+                stat_eventState[(int)Command::GetS][state].addData(1);
             }
             if (localPrefetch) {
-                statPrefetchRedundant->addData(1);
+                statPrefetchRedundant.addData(1);
                 recordPrefetchLatency(event->getID(), LatType::HIT);
                 return DONE;
             }
             recordPrefetchResult(line, statPrefetchHit);
             recordLatencyType(event->getID(), LatType::HIT);
 
-            sendTime = sendResponseUp(event, line->getData(), inMSHR, line->getTimestamp());
+            sendTime = sendResponseUp(event, line->getDataBuffer(), inMSHR, line->getTimestamp());
             line->setTimestamp(sendTime);
             if (is_debug_event(event))
                 eventDI.reason = "hit";
@@ -123,7 +123,7 @@ bool Incoherent::handleGetX(MemEvent * event, bool inMSHR) {
             status = inMSHR ? MemEventStatus::OK : allocateMSHR(event, false);
             if (status == MemEventStatus::OK) {
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)event->getCmd()][I]->addData(1);
+                    stat_eventState[(int)event->getCmd()][I].addData(1);
                     notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::MISS);
                     mshr_->setProfiled(addr);
                 }
@@ -138,10 +138,10 @@ bool Incoherent::handleGetX(MemEvent * event, bool inMSHR) {
         case M:
             if (!inMSHR || !mshr_->getProfiled(addr)) {
                 notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::HIT);
-                stat_eventState[(int)event->getCmd()][I]->addData(1);
+                stat_eventState[(int)event->getCmd()][I].addData(1);
             }
             recordPrefetchResult(line, statPrefetchHit);
-            sendTime = sendResponseUp(event, line->getData(), inMSHR, line->getTimestamp());
+            sendTime = sendResponseUp(event, line->getDataBuffer(), inMSHR, line->getTimestamp());
             line->setTimestamp(sendTime);
             recordLatencyType(event->getID(), LatType::HIT);
                 
@@ -184,7 +184,7 @@ bool Incoherent::handleFlushLine(MemEvent * event, bool inMSHR) {
 
     MemEventStatus status = inMSHR ? MemEventStatus::OK : allocateMSHR(event, false);
     if (!inMSHR)
-        stat_eventState[(int)Command::FlushLine][state]->addData(1);
+        stat_eventState[(int)Command::FlushLine][state].addData(1);
 
     recordLatencyType(event->getID(), LatType::HIT);
 
@@ -196,14 +196,14 @@ bool Incoherent::handleFlushLine(MemEvent * event, bool inMSHR) {
     switch (state) {
         case I:
             if (status == MemEventStatus::OK) {
-                forwardFlush(event, event->getEvict(), &(event->getPayload()), event->getDirty(), 0);
+                forwardFlush(event, event->getEvict(), &(event->getPayloadBuffer()), event->getDirty(), 0);
                 mshr_->setInProgress(addr);
             }
             break;
         case E:
         case M:
             if (status == MemEventStatus::OK) {
-                forwardFlush(event, state == M, line->getData(), state == M, 0);
+                forwardFlush(event, state == M, line->getDataBuffer(), state == M, 0);
                 line->setState(S_B);
                 mshr_->setInProgress(addr);
             }
@@ -234,7 +234,7 @@ bool Incoherent::handleFlushLineInv(MemEvent * event, bool inMSHR) {
     
     MemEventStatus status = inMSHR ? MemEventStatus::OK : allocateMSHR(event, false);
     if (!inMSHR)
-        stat_eventState[(int)Command::FlushLineInv][state]->addData(1);
+        stat_eventState[(int)Command::FlushLineInv][state].addData(1);
 
     recordLatencyType(event->getID(), LatType::HIT);
 
@@ -246,7 +246,7 @@ bool Incoherent::handleFlushLineInv(MemEvent * event, bool inMSHR) {
     switch (state) {
         case I:
             if (status == MemEventStatus::OK) {
-                forwardFlush(event, event->getEvict(), &(event->getPayload()), event->getDirty(), 0);
+                forwardFlush(event, event->getEvict(), &(event->getPayloadBuffer()), event->getDirty(), 0);
                 mshr_->setInProgress(addr);
             }
             break;
@@ -254,7 +254,7 @@ bool Incoherent::handleFlushLineInv(MemEvent * event, bool inMSHR) {
         case M:
             if (status == MemEventStatus::OK) {
                 recordPrefetchResult(line, statPrefetchEvict);
-                forwardFlush(event, true, line->getData(), state == M, line->getTimestamp());
+                forwardFlush(event, true, line->getDataBuffer(), state == M, line->getTimestamp());
                 line->setState(I_B);
                 mshr_->setInProgress(addr);
             }
@@ -283,13 +283,13 @@ bool Incoherent::handlePutE(MemEvent * event, bool inMSHR) {
     MemEventStatus status = MemEventStatus::OK;
 
     if (!inMSHR)
-        stat_eventState[(int)Command::PutE][state]->addData(1);
+        stat_eventState[(int)Command::PutE][state].addData(1);
 
     switch (state) {
         case I:
             status = allocateLine(event, line, inMSHR);
             if (status == MemEventStatus::OK) {
-                line->setData(event->getPayload(), 0);
+                line->setData(event->getPayloadBuffer(), 0);
                 line->setState(E);
                 if (sendWritebackAck_)
                     sendWritebackAck(event);
@@ -326,13 +326,13 @@ bool Incoherent::handlePutM(MemEvent * event, bool inMSHR) {
     MemEventStatus status = MemEventStatus::OK;
 
     if (!inMSHR)
-        stat_eventState[(int)Command::PutM][state]->addData(1);
+        stat_eventState[(int)Command::PutM][state].addData(1);
 
     switch (state) {
         case I:
             status = allocateLine(event, line, inMSHR);
             if (status == MemEventStatus::OK) {
-                line->setData(event->getPayload(), 0);
+                line->setData(event->getPayloadBuffer(), 0);
                 line->setState(M);
                 if (sendWritebackAck_)
                     sendWritebackAck(event);
@@ -342,7 +342,7 @@ bool Incoherent::handlePutM(MemEvent * event, bool inMSHR) {
         case E:
             line->setState(M);
         case M:
-            line->setData(event->getPayload(), 0);
+            line->setData(event->getPayloadBuffer(), 0);
             if (sendWritebackAck_)
                 sendWritebackAck(event);
             cleanUpAfterRequest(event, inMSHR);
@@ -372,16 +372,16 @@ bool Incoherent::handleGetSResp(MemEvent * event, bool inMSHR) {
     if (is_debug_event(event))
         eventDI.prefill(event->getID(), Command::GetSResp, false, addr, state);
 
-    stat_eventState[(int)Command::GetSResp][state]->addData(1);
+    stat_eventState[(int)Command::GetSResp][state].addData(1);
 
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
     req->setFlags(event->getMemFlags());
     
-    sendResponseUp(req, &event->getPayload(), true, 0);
+    sendResponseUp(req, &event->getPayloadBuffer(), true, 0);
 
     if (line) {
         line->setState(E);
-        line->setData(event->getPayload(), 0);
+        line->setData(event->getPayloadBuffer(), 0);
         // Has to be a local prefetch
         line->setPrefetch(true);
         recordPrefetchLatency(req->getID(), LatType::MISS);
@@ -406,12 +406,12 @@ bool Incoherent::handleGetXResp(MemEvent * event, bool inMSHR) {
     if (is_debug_event(event))
         eventDI.prefill(event->getID(), Command::GetXResp, false, addr, state);
 
-    stat_eventState[(int)Command::GetXResp][state]->addData(1);
+    stat_eventState[(int)Command::GetXResp][state].addData(1);
 
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
     req->setFlags(event->getMemFlags());
 
-    sendResponseUp(req, &event->getPayload(), true, 0);
+    sendResponseUp(req, &event->getPayloadBuffer(), true, 0);
     
     cleanUpAfterResponse(event);
 
@@ -427,7 +427,7 @@ bool Incoherent::handleFlushLineResp(MemEvent * event, bool inMSHR) {
     if (is_debug_event(event))
         eventDI.prefill(event->getID(), Command::FlushLineResp, false, addr, state);
 
-    stat_eventState[(int)Command::FlushLineResp][state]->addData(1);
+    stat_eventState[(int)Command::FlushLineResp][state].addData(1);
 
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
 
@@ -573,7 +573,7 @@ bool Incoherent::handleEviction(Addr addr, PrivateCacheLine* &line, dbgin &diStr
         diStruct.addr = line->getAddr();
     }
 
-    stat_evict[state]->addData(1);
+    stat_evict[state].addData(1);
 
     switch (state) {
         case I:
@@ -664,7 +664,7 @@ void Incoherent::doEvict(MemEvent * event, PrivateCacheLine * line) {
     if (state == E || state == M) {
         if (event->getDirty()) {
             line->setState(M);
-            line->setData(event->getPayload(), 0);
+            line->setData(event->getPayloadBuffer(), 0);
         }
 
         event->setEvict(false);
@@ -675,7 +675,7 @@ void Incoherent::doEvict(MemEvent * event, PrivateCacheLine * line) {
  * Event creation and send
  ***********************************************************************************************************/
 
-SimTime_t Incoherent::sendResponseUp(MemEvent * event, vector<uint8_t> * data, bool inMSHR, SimTime_t time, Command cmd, bool success) {
+SimTime_t Incoherent::sendResponseUp(MemEvent * event, const PayloadBuffer* data, bool inMSHR, SimTime_t time, Command cmd, bool success) {
     MemEvent * responseEvent = event->makeResponse();
     if (cmd != Command::NULLCMD)
         responseEvent->setCmd(cmd);
@@ -708,7 +708,7 @@ void Incoherent::sendWriteback(Command cmd, PrivateCacheLine * line, bool dirty)
     uint64_t latency = tagLatency_;
 
     if (dirty) {
-        writeback->setPayload(*(line->getData()));
+        writeback->setPayload(*line->getDataBuffer());
         writeback->setDirty(dirty);
 
         latency = accessLatency_;
@@ -724,7 +724,7 @@ void Incoherent::sendWriteback(Command cmd, PrivateCacheLine * line, bool dirty)
 }
 
 
-void Incoherent::forwardFlush(MemEvent * event, bool evict, std::vector<uint8_t>* data, bool dirty, uint64_t time) {
+void Incoherent::forwardFlush(MemEvent * event, bool evict, const PayloadBuffer* data, bool dirty, uint64_t time) {
     MemEvent * flush = new MemEvent(*event);
     flush->setSrc(cachename_);
     flush->setDst(getDestination(event->getBaseAddr()));
@@ -767,12 +767,12 @@ void Incoherent::sendWritebackAck(MemEvent * event) {
  *  Override message send functions with versions that record statistics & call parent class
  *---------------------------------------------------------------------------------------------------------------------*/
 void Incoherent::addToOutgoingQueue(Response& resp) {
-    stat_eventSent[(int)resp.event->getCmd()]->addData(1);
+    stat_eventSent[(int)resp.event->getCmd()].addData(1);
     CoherenceController::addToOutgoingQueue(resp);
 }
 
 void Incoherent::addToOutgoingQueueUp(Response& resp) {
-    stat_eventSent[(int)resp.event->getCmd()]->addData(1);
+    stat_eventSent[(int)resp.event->getCmd()].addData(1);
     CoherenceController::addToOutgoingQueueUp(resp);
 }
 
@@ -785,13 +785,19 @@ MemEventInitCoherence * Incoherent::getInitCoherenceEvent() {
     return new MemEventInitCoherence(cachename_, Endpoint::Cache, false, false, false, lineSize_, true);
 }
 
-void Incoherent::recordPrefetchResult(PrivateCacheLine * line, Statistic<uint64_t>* stat) { 
+void Incoherent::recordPrefetchResult(PrivateCacheLine * line, StatCounter& stat) { 
     if (line->getPrefetch()) {
-        stat->addData(1);
+        stat.addData(1);
         line->setPrefetch(false);
     }
 }
 
+void Incoherent::visitStatCounters(const StatCounterVisitor& visit) {
+    CoherenceController::visitStatCounters(visit);
+    SST::MemHierarchy::visitStatCounters(stat_hit, visit);
+    SST::MemHierarchy::visitStatCounters(stat_miss, visit);
+}
+
 void Incoherent::recordLatency(Command cmd, int type, uint64_t latency) {
     if (type == -1)
         return;
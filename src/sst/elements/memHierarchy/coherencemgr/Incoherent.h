@@ -254,12 +254,15 @@ public:
     virtual bool handleNACK(MemEvent * event, bool inMSHR);
 
     Addr getBank(Addr addr) { return cacheArray_->getBank(addr); }
+    bool isCached(Addr addr) { PrivateCacheLine* line = cacheArray_->lookup(addr, false); return line && line->getState() != I; }
     void setSliceAware(uint64_t interleaveSize, uint64_t interleaveStep) { cacheArray_->setSliceAware(interleaveSize, interleaveStep); }
 
     MemEventInitCoherence * getInitCoherenceEvent();
 
     void recordLatency(Command cmd, int type, uint64_t latency);
 
+    void visitStatCounters(const StatCounterVisitor& visit);
+
     virtual std::set<Command> getValidReceiveEvents() {
         std::set<Command> cmds = { Command::GetS,
             Command::GetX,
@@ -292,18 +295,18 @@ private:
 
     void doEvict(MemEvent * event, PrivateCacheLine * line);
 
-    SimTime_t sendResponseUp(MemEvent * event, vector<uint8_t> * data, bool inMSHR, SimTime_t time, Command cmd = Command::NULLCMD, bool success = false);
+    SimTime_t sendResponseUp(MemEvent * event, const PayloadBuffer* data, bool inMSHR, SimTime_t time, Command cmd = Command::NULLCMD, bool success = false);
 
     void sendWriteback(Command cmd, PrivateCacheLine * line, bool dirty);
 
-    void forwardFlush(MemEvent * event, bool evict, std::vector<uint8_t> * data, bool dirty, uint64_t time);
+    void forwardFlush(MemEvent * event, bool evict, const PayloadBuffer* data, bool dirty, uint64_t time);
 
     void sendWritebackAck(MemEvent * event);
 
     void addToOutgoingQueue(Response& resp);
     void addToOutgoingQueueUp(Response& resp);
     
-    void recordPrefetchResult(PrivateCacheLine * line, Statistic<uint64_t> * stat);
+    void recordPrefetchResult(PrivateCacheLine * line, StatCounter& stat);
 
     void printLine(Addr addr);
 
@@ -317,8 +320,8 @@ private:
     Statistic<uint64_t>* stat_latencyGetSX[2];
     Statistic<uint64_t>* stat_latencyFlushLine;
     Statistic<uint64_t>* stat_latencyFlushLineInv;
-    Statistic<uint64_t>* stat_hit[3][2];
-    Statistic<uint64_t>* stat_miss[3][2];
+    StatCounter stat_hit[3][2];
+    StatCounter stat_miss[3][2];
 };
 
 
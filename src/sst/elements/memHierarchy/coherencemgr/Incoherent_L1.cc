@@ -75,7 +75,7 @@ bool IncoherentL1::handleGetS(MemEvent* event, bool inMSHR){
             if (event->isLoadLink())
                 line->atomicStart();
 
-            data.assign(line->getData()->begin() + (event->getAddr() - event->getBaseAddr()), line->getData()->begin() + (event->getAddr() - event->getBaseAddr() + event->getSize()));
+            data.assign(line->getDataBuffer()->read().begin() + (event->getAddr() - event->getBaseAddr()), line->getDataBuffer()->read().begin() + (event->getAddr() - event->getBaseAddr() + event->getSize()));
             sendTime = sendResponseUp(event, &data, inMSHR, line->getTimestamp());
             line->setTimestamp(sendTime-1);
             cleanUpAfterRequest(event, inMSHR);
@@ -140,7 +140,7 @@ bool IncoherentL1::handleGetX(MemEvent* event, bool inMSHR){
             recordLatencyType(event->getID(), LatType::HIT);
             // Handle
             if (!event->isStoreConditional() || line->isAtomic()) { /* Don't write on a non-atomic SC */
-                line->setData(event->getPayload(), event->getAddr() - event->getBaseAddr());
+                line->setData(event->getPayloadBuffer(), event->getAddr() - event->getBaseAddr());
                 atomic = line->isAtomic();
                 line->atomicEnd();
             }
@@ -200,7 +200,7 @@ bool IncoherentL1::handleGetSX(MemEvent* event, bool inMSHR) {
             recordLatencyType(event->getID(), LatType::HIT);
             // Handle
             line->incLock(); 
-            std::copy(line->getData()->begin() + (event->getAddr() - event->getBaseAddr()), line->getData()->begin() + (event->getAddr() - event->getBaseAddr())  + event->getSize(), data.begin());
+            std::copy(line->getDataBuffer()->read().begin() + (event->getAddr() - event->getBaseAddr()), line->getDataBuffer()->read().begin() + (event->getAddr() - event->getBaseAddr())  + event->getSize(), data.begin());
             sendTime = sendResponseUp(event, &data, inMSHR, line->getTimestamp());
             line->setTimestamp(sendTime-1);
             cleanUpAfterRequest(event, inMSHR);
@@ -234,7 +234,7 @@ bool IncoherentL1::handleFlushLine(MemEvent* event, bool inMSHR) {
     /* Flush fails if line is locked */
     if (state != I && line->isLocked()) {
         if (!inMSHR || !mshr_->getProfiled(addr)) { 
-            stat_eventState[(int)Command::FlushLine][state]->addData(1);
+            stat_eventState[(int)Command::FlushLine][state].addData(1);
         }
         sendResponseUp(event, nullptr, inMSHR, line->getTimestamp());
         recordLatencyType(event->getID(), LatType::MISS);
@@ -247,7 +247,7 @@ bool IncoherentL1::handleFlushLine(MemEvent* event, bool inMSHR) {
         return false;
 
     if (!mshr_->getProfiled(addr)) {
-        stat_eventState[(int)Command::FlushLine][state]->addData(1);
+        stat_eventState[(int)Command::FlushLine][state].addData(1);
         mshr_->setProfiled(addr);
     }
 
@@ -279,7 +279,7 @@ bool IncoherentL1::handleFlushLineInv(MemEvent* event, bool inMSHR) {
     
     /* Flush fails if line is locked */
     if (state != I && line->isLocked()) {
-        stat_eventState[(int)Command::FlushLineInv][state]->addData(1);
+        stat_eventState[(int)Command::FlushLineInv][state].addData(1);
         sendResponseUp(event, nullptr, inMSHR, line->getTimestamp());
         recordLatencyType(event->getID(), LatType::MISS);
         cleanUpAfterRequest(event, inMSHR);
@@ -293,7 +293,7 @@ bool IncoherentL1::handleFlushLineInv(MemEvent* event, bool inMSHR) {
     mshr_->setInProgress(addr);
     recordLatencyType(event->getID(), LatType::HIT);
     if (!mshr_->getProfiled(addr)) {
-        stat_eventState[(int)Command::FlushLineInv][state]->addData(1);
+        stat_eventState[(int)Command::FlushLineInv][state].addData(1);
         if (line)
             recordPrefetchResult(line, statPrefetchEvict);
         mshr_->setProfiled(addr);
@@ -314,16 +314,16 @@ bool IncoherentL1::handleGetSResp(MemEvent * event, bool inMSHR) {
     State state = line ? line->getState() : I;
     printLine(event->getBaseAddr());
 
-    stat_eventState[(int)(event->getCmd())][state]->addData(1);
+    stat_eventState[(int)(event->getCmd())][state].addData(1);
 
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(event->getBaseAddr()));
     bool localPrefetch = req->isPrefetch() && (req->getRqstr() == cachename_);   
    
     // Update line
-    line->setData(event->getPayload(), 0);
+    line->setData(event->getPayloadBuffer(), 0);
     line->setState(E);
     if (is_debug_addr(line->getAddr())) 
-        printData(line->getData(), true);
+        printData(&line->getDataBuffer()->read(), true);
     if (req->isLoadLink())
         line->atomicStart();
    
@@ -333,7 +333,7 @@ bool IncoherentL1::handleGetSResp(MemEvent * event, bool inMSHR) {
     } else {
         req->setMemFlags(event->getMemFlags());
         Addr offset = req->getAddr() - req->getBaseAddr();
-        vector<uint8_t> data(line->getData()->begin() + offset, line->getData()->begin() + offset + req->getSize());
+        vector<uint8_t> data(line->getDataBuffer()->read().begin() + offset, line->getDataBuffer()->read().begin() + offset + req->getSize());
         uint64_t sendTime = sendResponseUp(req, &data, true, line->getTimestamp());
         line->setTimestamp(sendTime-1);
     }
@@ -361,9 +361,9 @@ bool IncoherentL1::handleGetXResp(MemEvent * event, bool inMSHR) {
     req->setMemFlags(event->getMemFlags());
     
     // Set line data
-    line->setData(event->getPayload(), 0);
+    line->setData(event->getPayloadBuffer(), 0);
     if (is_debug_addr(line->getAddr()))
-        printData(line->getData(), true);
+        printData(&line->getDataBuffer()->read(), true);
 
 
     line->setState(M);
@@ -373,9 +373,9 @@ bool IncoherentL1::handleGetXResp(MemEvent * event, bool inMSHR) {
     std::vector<uint8_t> data;
     if (req->getCmd() == Command::GetX) {
         if (!req->isStoreConditional() || line->isAtomic()) {
-            line->setData(req->getPayload(), offset);
+            line->setData(req->getPayloadBuffer(), offset);
             if (is_debug_addr(line->getAddr())) 
-                printData(line->getData(), true);
+                printData(&line->getDataBuffer()->read(), true);
             line->atomicEnd();
         }
 
@@ -388,11 +388,11 @@ bool IncoherentL1::handleGetXResp(MemEvent * event, bool inMSHR) {
     }
 
     // Return response
-    data.assign(line->getData()->begin() + offset, line->getData()->begin() + offset + req->getSize());
+    data.assign(line->getDataBuffer()->read().begin() + offset, line->getDataBuffer()->read().begin() + offset + req->getSize());
     uint64_t sendTime = sendResponseUp(req, &data, true, line->getTimestamp(), false);
     line->setTimestamp(sendTime-1);
 
-    stat_eventState[(int)Command::GetXResp][state]->addData(1);
+    stat_eventState[(int)Command::GetXResp][state].addData(1);
     printLine(event->getBaseAddr());
     cleanUpAfterResponse(event, inMSHR);
     return true;
@@ -404,7 +404,7 @@ bool IncoherentL1::handleFlushLineResp(MemEvent * event, bool inMSHR) {
     State state = line ? line->getState() : I;
     printLine(event->getBaseAddr());
 
-    stat_eventState[(int)Command::FlushLineResp][state]->addData(1);
+    stat_eventState[(int)Command::FlushLineResp][state].addData(1);
 
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(event->getBaseAddr()));
 
@@ -540,7 +540,7 @@ bool IncoherentL1::handleEviction(Addr addr, L1CacheLine*& line) {
         return false;
     }
 
-    stat_evict[state]->addData(1);
+    stat_evict[state].addData(1);
 
     switch (state) {
         case I:
@@ -697,7 +697,7 @@ void IncoherentL1::sendResponseDown(MemEvent * event, L1CacheLine * line, bool d
     MemEvent * responseEvent = event->makeResponse();
 
     if (data) {
-        responseEvent->setPayload(*line->getData());
+        responseEvent->setPayload(*line->getDataBuffer());
         if (line->getState() == M)
             responseEvent->setDirty(true);
     }
@@ -725,7 +725,7 @@ void IncoherentL1::forwardFlush(MemEvent * event, L1CacheLine * line, bool evict
     if (evict) {
         flush->setEvict(true);
         // TODO only send payload when needed
-        flush->setPayload(*(line->getData()));
+        flush->setPayload(*line->getDataBuffer());
         flush->setDirty(line->getState() == M);
         latency = accessLatency_;
     } else {
@@ -767,11 +767,11 @@ void IncoherentL1::sendWriteback(Command cmd, L1CacheLine* line, bool dirty) {
 
     /* Writeback data */
     if (dirty || writebackCleanBlocks_) {
-        writeback->setPayload(*line->getData());
+        writeback->setPayload(*line->getDataBuffer());
         writeback->setDirty(dirty);
 
         if (is_debug_addr(line->getAddr())) {
-            printData(line->getData(), false);
+            printData(&line->getDataBuffer()->read(), false);
         }
         
         latency = accessLatency_;
@@ -793,12 +793,12 @@ void IncoherentL1::sendWriteback(Command cmd, L1CacheLine* line, bool dirty) {
  *  Override message send functions with versions that record statistics & call parent class
  *---------------------------------------------------------------------------------------------------------------------*/
 void IncoherentL1::addToOutgoingQueue(Response& resp) {
-    stat_eventSent[(int)resp.event->getCmd()]->addData(1);
+    stat_eventSent[(int)resp.event->getCmd()].addData(1);
     CoherenceController::addToOutgoingQueue(resp);
 }
 
 void IncoherentL1::addToOutgoingQueueUp(Response& resp) {
-    stat_eventSent[(int)resp.event->getCmd()]->addData(1);
+    stat_eventSent[(int)resp.event->getCmd()].addData(1);
     CoherenceController::addToOutgoingQueueUp(resp);
 }
 
@@ -818,7 +818,7 @@ void IncoherentL1::printLine(Addr addr) {
     debug->debug(_L8_, "  Line 0x%" PRIx64 ": %s\n", addr, state.c_str());
 }
 
-void IncoherentL1::printData(vector<uint8_t> * data, bool set) {
+void IncoherentL1::printData(const vector<uint8_t> * data, bool set) {
 /*    if (set)    printf("Setting data (%zu): 0x", data->size());
     else        printf("Getting data (%zu): 0x", data->size());
     
@@ -829,22 +829,28 @@ void IncoherentL1::printData(vector<uint8_t> * data, bool set) {
 }
 
 /* Record the result of a prefetch. important: assumes line is not null */
-void IncoherentL1::recordPrefetchResult(L1CacheLine * line, Statistic<uint64_t> * stat) {
+void IncoherentL1::recordPrefetchResult(L1CacheLine * line, StatCounter& stat) {
     if (line->getPrefetch()) {
-        stat->addData(1);
+        stat.addData(1);
         line->setPrefetch(false);
     }
 }
 
 void IncoherentL1::eventProfileAndNotify(MemEvent * event, State state, NotifyAccessType type, NotifyResultType result, bool inMSHR) {
     if (!inMSHR || !mshr_->getProfiled(event->getBaseAddr())) {
-        stat_eventState[(int)event->getCmd()][state]->addData(1); // profile
+        stat_eventState[(int)event->getCmd()][state].addData(1); // profile
         notifyListenerOfAccess(event, type, result);
         if (inMSHR)
             mshr_->setProfiled(event->getBaseAddr());
     }
 }
 
+void IncoherentL1::visitStatCounters(const StatCounterVisitor& visit) {
+    CoherenceController::visitStatCounters(visit);
+    SST::MemHierarchy::visitStatCounters(stat_hit, visit);
+    SST::MemHierarchy::visitStatCounters(stat_miss, visit);
+}
+
 void IncoherentL1::recordLatency(Command cmd, int type, uint64_t latency) {
     if (type == -1)
         return;
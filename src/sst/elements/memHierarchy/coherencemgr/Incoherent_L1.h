@@ -232,6 +232,7 @@ public:
     bool handleNACK(MemEvent * event, bool inMSHR);
 
     virtual Addr getBank(Addr addr) { return cacheArray_->getBank(addr); }
+    virtual bool isCached(Addr addr) { L1CacheLine* line = cacheArray_->lookup(addr, false); return line && line->getState() != I; }
     virtual void setSliceAware(uint64_t size, uint64_t step) { cacheArray_->setSliceAware(size, step); }
 
     MemEventInitCoherence * getInitCoherenceEvent();
@@ -279,12 +280,13 @@ private:
 /* Miscellaneous */
    
     /* Statistics recording */
-    void recordPrefetchResult(L1CacheLine * line, Statistic<uint64_t> * stat);
+    void recordPrefetchResult(L1CacheLine * line, StatCounter& stat);
     void recordLatency(Command cmd, int type, uint64_t timestamp);
+    void visitStatCounters(const StatCounterVisitor& visit);
     void eventProfileAndNotify(MemEvent * event, State state, NotifyAccessType type, NotifyResultType result, bool inMSHR);
 
     /* Debug output */
-    void printData(vector<uint8_t> * data, bool set);
+    void printData(const vector<uint8_t> * data, bool set);
     void printLine(Addr addr);
 
     CacheArray<L1CacheLine>* cacheArray_;
@@ -295,8 +297,8 @@ private:
     Statistic<uint64_t>* stat_latencyGetSX[2];
     Statistic<uint64_t>* stat_latencyFlushLine[2];
     Statistic<uint64_t>* stat_latencyFlushLineInv[2];
-    Statistic<uint64_t>* stat_hit[3][2];
-    Statistic<uint64_t>* stat_miss[3][2];
+    StatCounter stat_hit[3][2];
+    StatCounter stat_miss[3][2];
 
 };
 
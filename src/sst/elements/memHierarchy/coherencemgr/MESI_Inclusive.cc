@@ -58,8 +58,8 @@ bool MESIInclusive::handleGetS(MemEvent * event, bool inMSHR) {
             if (status == MemEventStatus::OK) { // Both MSHR insert and cache line allocation succeeded and there's no MSHR conflict
                 line = cacheArray_->lookup(addr, false);
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::GetS][I]->addData(1);
-                    stat_miss[0][inMSHR]->addData(1);
+                    stat_eventState[(int)Command::GetS][I].addData(1);
+                    stat_miss[0][inMSHR].addData(1);
                     notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::MISS);
                     recordLatencyType(event->getID(), LatType::MISS);
                     mshr_->setProfiled(addr);
@@ -75,11 +75,11 @@ bool MESIInclusive::handleGetS(MemEvent * event, bool inMSHR) {
             break;
         case S:
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::GetS][S]->addData(1);
-                stat_hit[0][inMSHR]->addData(1);
+                stat_eventState[(int)Command::GetS][S].addData(1);
+                stat_hit[0][inMSHR].addData(1);
                 notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT);
                 if (localPrefetch) {
-                    statPrefetchRedundant->addData(1);
+                    statPrefetchRedundant.addData(1);
                     recordPrefetchLatency(event->getID(), LatType::HIT);
                 } else {
                     recordLatencyType(event->getID(), LatType::HIT);
@@ -99,7 +99,7 @@ bool MESIInclusive::handleGetS(MemEvent * event, bool inMSHR) {
             recordPrefetchResult(line, statPrefetchHit);
             line->addSharer(event->getSrc());
 
-            sendTime = sendResponseUp(event, line->getData(), inMSHR, line->getTimestamp());
+            sendTime = sendResponseUp(event, line->getDataBuffer(), inMSHR, line->getTimestamp());
             line->setTimestamp(sendTime - 1);
             cleanUpAfterRequest(event, inMSHR);
 
@@ -112,10 +112,10 @@ bool MESIInclusive::handleGetS(MemEvent * event, bool inMSHR) {
             // Local prefetch -> drop
             if (localPrefetch) {
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::GetS][state]->addData(1);
-                    stat_hit[0][inMSHR]->addData(1);
+                    stat_eventState[(int)Command::GetS][state].addData(1);
+                    stat_hit[0][inMSHR].addData(1);
                     notifyListenerOfAccess(event, NotifyAccessType::PREFETCH, NotifyResultType::HIT);
-                    statPrefetchRedundant->addData(1);
+                    statPrefetchRedundant.addData(1);
                     recordPrefetchLatency(event->getID(), LatType::HIT);
                 }
                 if (is_debug_event(event))
@@ -132,8 +132,8 @@ bool MESIInclusive::handleGetS(MemEvent * event, bool inMSHR) {
 
                 if (status == MemEventStatus::OK) {
                     if (!mshr_->getProfiled(addr)) {
-                        stat_eventState[(int)Command::GetS][state]->addData(1);
-                        stat_hit[0][inMSHR]->addData(1);
+                        stat_eventState[(int)Command::GetS][state].addData(1);
+                        stat_hit[0][inMSHR].addData(1);
                         notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT);
                         recordLatencyType(event->getID(), LatType::INV);
                         mshr_->setProfiled(addr);
@@ -148,8 +148,8 @@ bool MESIInclusive::handleGetS(MemEvent * event, bool inMSHR) {
                 break;
             } else {
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::GetS][state]->addData(1);
-                    stat_hit[0][inMSHR]->addData(1);
+                    stat_eventState[(int)Command::GetS][state].addData(1);
+                    stat_hit[0][inMSHR].addData(1);
                     notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT);
                     recordLatencyType(event->getID(), LatType::HIT);
                     if (inMSHR) mshr_->setProfiled(addr);
@@ -163,7 +163,7 @@ bool MESIInclusive::handleGetS(MemEvent * event, bool inMSHR) {
                 }
             }
 
-            sendTime = sendResponseUp(event, line->getData(), inMSHR, line->getTimestamp(), respcmd);
+            sendTime = sendResponseUp(event, line->getDataBuffer(), inMSHR, line->getTimestamp(), respcmd);
             line->setTimestamp(sendTime);
             cleanUpAfterRequest(event, inMSHR);
 
@@ -212,8 +212,8 @@ bool MESIInclusive::handleGetX(MemEvent * event, bool inMSHR) {
                 if (!mshr_->getProfiled(addr)) {
                     recordMiss(event->getID());
                     recordLatencyType(event->getID(), LatType::MISS);
-                    stat_eventState[(int)event->getCmd()][I]->addData(1);
-                    stat_miss[(event->getCmd() == Command::GetX ? 1 : 2)][inMSHR]->addData(1);
+                    stat_eventState[(int)event->getCmd()][I].addData(1);
+                    stat_miss[(event->getCmd() == Command::GetX ? 1 : 2)][inMSHR].addData(1);
                     notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::MISS);
                     mshr_->setProfiled(addr);
                 }
@@ -230,8 +230,8 @@ bool MESIInclusive::handleGetX(MemEvent * event, bool inMSHR) {
                 status = inMSHR ? MemEventStatus::OK : allocateMSHR(event, false);
                 if (status == MemEventStatus::OK) {
                     if (!mshr_->getProfiled(addr)) {
-                        stat_eventState[(int)event->getCmd()][state]->addData(1);
-                        stat_miss[(event->getCmd() == Command::GetX ? 1 : 2)][inMSHR]->addData(1);
+                        stat_eventState[(int)event->getCmd()][state].addData(1);
+                        stat_miss[(event->getCmd() == Command::GetX ? 1 : 2)][inMSHR].addData(1);
                         notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::MISS);
                         mshr_->setProfiled(addr);
                     }
@@ -257,8 +257,8 @@ bool MESIInclusive::handleGetX(MemEvent * event, bool inMSHR) {
         case M:
             if (!inMSHR || !mshr_->getProfiled(addr)) {
                 notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::HIT);
-                stat_eventState[(int)event->getCmd()][state]->addData(1);
-                stat_hit[(event->getCmd() == Command::GetX ? 1 : 2)][inMSHR]->addData(1);
+                stat_eventState[(int)event->getCmd()][state].addData(1);
+                stat_hit[(event->getCmd() == Command::GetX ? 1 : 2)][inMSHR].addData(1);
                 if (inMSHR)
                     mshr_->setProfiled(addr);
             }
@@ -292,7 +292,7 @@ bool MESIInclusive::handleGetX(MemEvent * event, bool inMSHR) {
             line->setOwner(event->getSrc());
             if (line->isSharer(event->getSrc()))
                 line->removeSharer(event->getSrc());
-            sendTime = sendResponseUp(event, line->getData(), inMSHR, line->getTimestamp());
+            sendTime = sendResponseUp(event, line->getDataBuffer(), inMSHR, line->getTimestamp());
             line->setTimestamp(sendTime);
 
             if (is_debug_event(event))
@@ -365,7 +365,7 @@ bool MESIInclusive::handleFlushLine(MemEvent * event, bool inMSHR) {
         case M:
             if (status == MemEventStatus::OK && line->hasOwner()) {
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::FlushLine][state]->addData(1);
+                    stat_eventState[(int)Command::FlushLine][state].addData(1);
                     mshr_->setProfiled(addr);
                 }
                 downgradeOwner(event, line, inMSHR);
@@ -404,7 +404,7 @@ bool MESIInclusive::handleFlushLine(MemEvent * event, bool inMSHR) {
    
     if (status == MemEventStatus::OK) {
         if (!mshr_->getProfiled(addr)) {
-            stat_eventState[(int)Command::FlushLine][state]->addData(1);
+            stat_eventState[(int)Command::FlushLine][state].addData(1);
             mshr_->setProfiled(addr);
         }
         bool downgrade = (state == E || state == M);
@@ -531,7 +531,7 @@ bool MESIInclusive::handleFlushLineInv(MemEvent * event, bool inMSHR) {
 
     if (status == MemEventStatus::OK) {
         if (!mshr_->getProfiled(addr)) {
-            stat_eventState[(int)Command::FlushLineInv][state]->addData(1);
+            stat_eventState[(int)Command::FlushLineInv][state].addData(1);
             mshr_->setProfiled(addr);
         }
         mshr_->setInProgress(addr);
@@ -570,7 +570,7 @@ bool MESIInclusive::handlePutS(MemEvent * event, bool inMSHR) {
         mshr_->removePendingRetry(addr);
 
     state = doEviction(event, line, state);
-    stat_eventState[(int)Command::PutS][state]->addData(1);
+    stat_eventState[(int)Command::PutS][state].addData(1);
 
     if (responses.find(addr) != responses.end() && responses.find(addr)->second.find(event->getSrc()) != responses.find(addr)->second.end()) {
         responses.find(addr)->second.erase(event->getSrc());
@@ -652,7 +652,7 @@ bool MESIInclusive::handlePutE(MemEvent * event, bool inMSHR) {
     if (inMSHR)
         mshr_->removePendingRetry(addr);
     
-    stat_eventState[(int)Command::PutE][state]->addData(1);
+    stat_eventState[(int)Command::PutE][state].addData(1);
 
     state = doEviction(event, line, state);
     if (responses.find(addr) != responses.end() && responses.find(addr)->second.find(event->getSrc()) != responses.find(addr)->second.end()) {
@@ -716,7 +716,7 @@ bool MESIInclusive::handlePutM(MemEvent * event, bool inMSHR) {
     if (inMSHR)
         mshr_->removePendingRetry(addr);
     
-    stat_eventState[(int)Command::PutM][state]->addData(1);
+    stat_eventState[(int)Command::PutM][state].addData(1);
     
     state = doEviction(event, line, state);
     if (responses.find(addr) != responses.end() && responses.find(addr)->second.find(event->getSrc()) != responses.find(addr)->second.end()) {
@@ -776,7 +776,7 @@ bool MESIInclusive::handlePutX(MemEvent * event, bool inMSHR) {
     if (inMSHR)
         mshr_->removePendingRetry(addr);
     
-    stat_eventState[(int)Command::PutX][state]->addData(1);
+    stat_eventState[(int)Command::PutX][state].addData(1);
     
     state = doEviction(event, line, state);
     line->addSharer(event->getSrc());
@@ -839,7 +839,7 @@ bool MESIInclusive::handleFetch(MemEvent * event, bool inMSHR) {
     if (inMSHR)
         mshr_->removePendingRetry(addr);
    
-    stat_eventState[(int)Command::Fetch][state]->addData(1);
+    stat_eventState[(int)Command::Fetch][state].addData(1);
 
     switch (state) {
         case S:
@@ -911,7 +911,7 @@ bool MESIInclusive::handleInv(MemEvent * event, bool inMSHR) {
             if (is_debug_event(event))
                 eventDI.action = "Drop";
             cleanUpEvent(event, inMSHR); // No replay since state doesn't change
-            stat_eventState[(int)Command::Inv][state]->addData(1);
+            stat_eventState[(int)Command::Inv][state].addData(1);
             break;
         default:
             debug->fatal(CALL_INFO,-1,"%s, Error: Received Inv in unhandled state '%s'. Event: %s. Time = %" PRIu64 "ns\n",
@@ -920,7 +920,7 @@ bool MESIInclusive::handleInv(MemEvent * event, bool inMSHR) {
 
     if (handle) {
         if (!inMSHR || mshr_->getProfiled(addr)) {
-            stat_eventState[(int)Command::Inv][state]->addData(1);
+            stat_eventState[(int)Command::Inv][state].addData(1);
             recordPrefetchResult(line, statPrefetchInv);
             if (inMSHR) mshr_->setProfiled(addr);
         }
@@ -1018,7 +1018,7 @@ bool MESIInclusive::handleForceInv(MemEvent * event, bool inMSHR) {
         case IS:
         case IM:
         case I:
-            stat_eventState[(int)Command::ForceInv][state]->addData(1);
+            stat_eventState[(int)Command::ForceInv][state].addData(1);
             cleanUpEvent(event, inMSHR); // No replay since state doesn't change
             break;
         case SM_Inv: { // ForceInv if there's an un-inv'd sharer, else in mshr & stall
@@ -1039,7 +1039,7 @@ bool MESIInclusive::handleForceInv(MemEvent * event, bool inMSHR) {
     }
    
     if ((handle || profile) && (!inMSHR || !mshr_->getProfiled(addr))) {
-        stat_eventState[(int)Command::ForceInv][state]->addData(1);
+        stat_eventState[(int)Command::ForceInv][state].addData(1);
         recordPrefetchResult(line, statPrefetchInv);
         if (inMSHR || profile) mshr_->setProfiled(addr);
     }
@@ -1097,7 +1097,7 @@ bool MESIInclusive::handleFetchInv(MemEvent * event, bool inMSHR) {
             if (is_debug_event(event))
                 eventDI.action = "Drop";
             cleanUpEvent(event, inMSHR); // No replay since state doesn't change
-            stat_eventState[(int)Command::FetchInv][state]->addData(1);
+            stat_eventState[(int)Command::FetchInv][state].addData(1);
             break;
         case S:
             state1 = S_Inv;
@@ -1161,7 +1161,7 @@ bool MESIInclusive::handleFetchInv(MemEvent * event, bool inMSHR) {
     }
 
     if ((handle || profile) && (!inMSHR || !mshr_->getProfiled(addr))) {
-        stat_eventState[(int)Command::FetchInv][state]->addData(1);
+        stat_eventState[(int)Command::FetchInv][state].addData(1);
         recordPrefetchResult(line, statPrefetchInv);
         if (inMSHR || profile) mshr_->setProfiled(addr);
     }
@@ -1217,14 +1217,14 @@ bool MESIInclusive::handleFetchInvX(MemEvent * event, bool inMSHR) {
                     state == E ? line->setState(E_InvX) : line->setState(M_InvX);
                     status = MemEventStatus::Stall;
                     mshr_->setProfiled(addr);
-                    stat_eventState[(int)Command::FetchInvX][state]->addData(1);
+                    stat_eventState[(int)Command::FetchInvX][state].addData(1);
                 }
                 break;
             }
             sendResponseDown(event, line, true, true);
             line->setState(S);
             cleanUpAfterRequest(event, inMSHR);
-            stat_eventState[(int)Command::FetchInvX][state]->addData(1);
+            stat_eventState[(int)Command::FetchInvX][state].addData(1);
             break;
         case M_Inv:
         case E_Inv:
@@ -1236,7 +1236,7 @@ bool MESIInclusive::handleFetchInvX(MemEvent * event, bool inMSHR) {
                 status = inMSHR ? MemEventStatus::Stall : allocateMSHR(event, true, 1);
             } else if (line->hasOwner()) {
                 status = inMSHR ? MemEventStatus::OK : allocateMSHR(event, true, 0);
-                stat_eventState[(int)Command::FetchInvX][state]->addData(1);
+                stat_eventState[(int)Command::FetchInvX][state].addData(1);
                 mshr_->setProfiled(addr);
                 if (status != MemEventStatus::Reject)
                     status = MemEventStatus::Stall;
@@ -1244,7 +1244,7 @@ bool MESIInclusive::handleFetchInvX(MemEvent * event, bool inMSHR) {
                 line->setState(S_Inv);
                 sendResponseDown(event, line, true, true);
                 cleanUpAfterRequest(event, inMSHR);
-                stat_eventState[(int)Command::FetchInvX][state]->addData(1);
+                stat_eventState[(int)Command::FetchInvX][state].addData(1);
             }
             break;
         case S_B:
@@ -1255,7 +1255,7 @@ bool MESIInclusive::handleFetchInvX(MemEvent * event, bool inMSHR) {
             if (is_debug_event(event))
                 eventDI.action = "Drop";
             cleanUpEvent(event, inMSHR); // No replay since state doesn't change
-            stat_eventState[(int)Command::FetchInvX][state]->addData(1);
+            stat_eventState[(int)Command::FetchInvX][state].addData(1);
             break;
         default:
             debug->fatal(CALL_INFO,-1,"%s, Error: Received FetchInvX in unhandled state '%s'. Event: %s. Time = %" PRIu64 "ns\n",
@@ -1281,7 +1281,7 @@ bool MESIInclusive::handleGetSResp(MemEvent * event, bool inMSHR) {
     if (is_debug_event(event))
         eventDI.prefill(event->getID(), Command::GetSResp, false, addr, state);
 
-    stat_eventState[(int)Command::GetSResp][state]->addData(1);
+    stat_eventState[(int)Command::GetSResp][state].addData(1);
 
     // Find matching request in MSHR
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(event->getBaseAddr()));
@@ -1297,23 +1297,23 @@ bool MESIInclusive::handleGetSResp(MemEvent * event, bool inMSHR) {
     }
     
     if (is_debug_addr(line->getAddr())) 
-        printData(line->getData(), true);
+        printData(&line->getDataBuffer()->read(), true);
 
     // Update line
-    line->setData(event->getPayload(), 0);
+    line->setData(event->getPayloadBuffer(), 0);
     line->setState(S);
     if (localPrefetch) {
         line->setPrefetch(true);
     } else {
         line->addSharer(req->getSrc());
         Addr offset = req->getAddr() - req->getBaseAddr();
-        uint64_t sendTime = sendResponseUp(req, line->getData(), true, line->getTimestamp());
+        uint64_t sendTime = sendResponseUp(req, line->getDataBuffer(), true, line->getTimestamp());
         line->setTimestamp(sendTime-1);
 
     }
     
     if (is_debug_addr(line->getAddr())) 
-        printData(line->getData(), true);
+        printData(&line->getDataBuffer()->read(), true);
    
     cleanUpAfterResponse(event, inMSHR);
     
@@ -1334,7 +1334,7 @@ bool MESIInclusive::handleGetXResp(MemEvent * event, bool inMSHR) {
     if (is_debug_event(event))
         eventDI.prefill(event->getID(), Command::GetXResp, false, addr, state);
 
-    stat_eventState[(int)Command::GetXResp][state]->addData(1);
+    stat_eventState[(int)Command::GetXResp][state].addData(1);
 
     // Get matching request
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(event->getBaseAddr()));
@@ -1347,9 +1347,9 @@ bool MESIInclusive::handleGetXResp(MemEvent * event, bool inMSHR) {
     switch (state) {
         case IS:
         {
-            line->setData(event->getPayload(), 0);
+            line->setData(event->getPayloadBuffer(), 0);
             if (is_debug_addr(line->getAddr()))
-                printData(line->getData(), true);
+                printData(&line->getDataBuffer()->read(), true);
 
             if (event->getDirty())  {
                 line->setState(M); // Sometimes get dirty data from a noninclusive cache
@@ -1364,11 +1364,11 @@ bool MESIInclusive::handleGetXResp(MemEvent * event, bool inMSHR) {
             } else {
                 if (protocol_ && line->getState() != S && mshr_->getSize(addr) == 1) {
                     line->setOwner(req->getSrc());
-                    uint64_t sendTime = sendResponseUp(req, line->getData(), true, line->getTimestamp(), Command::GetXResp);
+                    uint64_t sendTime = sendResponseUp(req, line->getDataBuffer(), true, line->getTimestamp(), Command::GetXResp);
                     line->setTimestamp(sendTime - 1);
                 } else {
                     line->addSharer(req->getSrc());
-                    uint64_t sendTime = sendResponseUp(req, line->getData(), true, line->getTimestamp(), Command::GetSResp);
+                    uint64_t sendTime = sendResponseUp(req, line->getDataBuffer(), true, line->getTimestamp(), Command::GetSResp);
                     line->setTimestamp(sendTime - 1);
                 }
             }
@@ -1376,9 +1376,9 @@ bool MESIInclusive::handleGetXResp(MemEvent * event, bool inMSHR) {
             break;
         }
         case IM:
-            line->setData(event->getPayload(), 0);
+            line->setData(event->getPayloadBuffer(), 0);
             if (is_debug_addr(line->getAddr()))
-                printData(line->getData(), true);
+                printData(&line->getDataBuffer()->read(), true);
         case SM: 
         {
             line->setState(M);
@@ -1386,7 +1386,7 @@ bool MESIInclusive::handleGetXResp(MemEvent * event, bool inMSHR) {
             if (line->isSharer(req->getSrc()))
                 line->removeSharer(req->getSrc());
 
-            uint64_t sendTime = sendResponseUp(req, line->getData(), true, line->getTimestamp());
+            uint64_t sendTime = sendResponseUp(req, line->getDataBuffer(), true, line->getTimestamp());
             line->setTimestamp(sendTime-1);
             cleanUpAfterResponse(event, inMSHR);
             break;
@@ -1418,7 +1418,7 @@ bool MESIInclusive::handleFlushLineResp(MemEvent * event, bool inMSHR) {
     if (is_debug_event(event))
         eventDI.prefill(event->getID(), Command::FlushLineResp, false, addr, state);
 
-    stat_eventState[(int)Command::FlushLineResp][state]->addData(1);
+    stat_eventState[(int)Command::FlushLineResp][state].addData(1);
 
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
 
@@ -1455,7 +1455,7 @@ bool MESIInclusive::handleFetchResp(MemEvent * event, bool inMSHR) {
     if (is_debug_event(event))
         eventDI.prefill(event->getID(), Command::FetchResp, false, addr, state);
 
-    stat_eventState[(int)Command::FetchResp][state]->addData(1);
+    stat_eventState[(int)Command::FetchResp][state].addData(1);
     
     // Check acks needed
     mshr_->decrementAcksNeeded(addr);
@@ -1497,7 +1497,7 @@ bool MESIInclusive::handleFetchXResp(MemEvent * event, bool inMSHR) {
     if (is_debug_event(event))
         eventDI.prefill(event->getID(), Command::FetchXResp, false, addr, state);
 
-    stat_eventState[(int)Command::FetchXResp][state]->addData(1);
+    stat_eventState[(int)Command::FetchXResp][state].addData(1);
     
     mshr_->decrementAcksNeeded(addr);
 
@@ -1534,7 +1534,7 @@ bool MESIInclusive::handleAckInv(MemEvent * event, bool inMSHR) {
     if (is_debug_event(event))
         eventDI.prefill(event->getID(), Command::AckInv, false, addr, state);
     
-    stat_eventState[(int)Command::AckInv][state]->addData(1);
+    stat_eventState[(int)Command::AckInv][state].addData(1);
     
     if (line->isSharer(event->getSrc()))
         line->removeSharer(event->getSrc());
@@ -1602,7 +1602,7 @@ bool MESIInclusive::handleAckPut(MemEvent * event, bool inMSHR) {
         eventDI.action = "Done";
     }
    
-    stat_eventState[(int)Command::AckPut][state]->addData(1);
+    stat_eventState[(int)Command::AckPut][state].addData(1);
 
     cleanUpAfterResponse(event, inMSHR);
     return true;
@@ -1758,7 +1758,7 @@ bool MESIInclusive::handleEviction(Addr addr, SharedCacheLine *& line) {
     if (is_debug_addr(addr) || (line && is_debug_addr(line->getAddr())))
         evictDI.oldst = state;
     
-    stat_evict[state]->addData(1);
+    stat_evict[state].addData(1);
 
     bool evict = false;
     bool wbSent = false;
@@ -1933,7 +1933,7 @@ State MESIInclusive::doEviction(MemEvent * event, SharedCacheLine * line, State
     recordPrefetchResult(line, statPrefetchEvict);
 
     if (event->getDirty()) {
-        line->setData(event->getPayload(), 0);
+        line->setData(event->getPayloadBuffer(), 0);
         switch (state) {
             case E:         
                 nState = M;         
@@ -1963,7 +1963,7 @@ State MESIInclusive::doEviction(MemEvent * event, SharedCacheLine * line, State
  * Event creation and send
  ***********************************************************************************************************/
 
-SimTime_t MESIInclusive::sendResponseUp(MemEvent * event, vector<uint8_t>* data, bool inMSHR, uint64_t time, Command cmd, bool success) {
+SimTime_t MESIInclusive::sendResponseUp(MemEvent * event, const PayloadBuffer* data, bool inMSHR, uint64_t time, Command cmd, bool success) {
     MemEvent * responseEvent = event->makeResponse();
     if (cmd != Command::NULLCMD)
         responseEvent->setCmd(cmd);
@@ -1973,7 +1973,7 @@ SimTime_t MESIInclusive::sendResponseUp(MemEvent * event, vector<uint8_t>* data,
         responseEvent->setPayload(*data);
         responseEvent->setSize(data->size()); // Return size that was written
         if (is_debug_event(event)) {
-            printData(data, false);
+            printData(&data->read(), false);
         }
     }
 
@@ -2000,7 +2000,7 @@ void MESIInclusive::sendResponseDown(MemEvent * event, SharedCacheLine * line, b
     MemEvent * responseEvent = event->makeResponse();
 
     if (data) {
-        responseEvent->setPayload(*line->getData());
+        responseEvent->setPayload(*line->getDataBuffer());
         if (line->getState() == M)
             responseEvent->setDirty(true);
     }
@@ -2029,7 +2029,7 @@ void MESIInclusive::forwardFlush(MemEvent * event, SharedCacheLine * line, bool
     if (evict) {
         flush->setEvict(true);
         // TODO only send payload when needed
-        flush->setPayload(*(line->getData()));
+        flush->setPayload(*line->getDataBuffer());
         flush->setDirty(line->getState() == M);
         latency = accessLatency_;
     } else {
@@ -2064,11 +2064,11 @@ void MESIInclusive::sendWriteback(Command cmd, SharedCacheLine* line, bool dirty
 
     /* Writeback data */
     if (dirty || writebackCleanBlocks_) {
-        writeback->setPayload(*line->getData());
+        writeback->setPayload(*line->getDataBuffer());
         writeback->setDirty(dirty);
 
         if (is_debug_addr(line->getAddr())) {
-            printData(line->getData(), false);
+            printData(&line->getDataBuffer()->read(), false);
         }
         
         latency = accessLatency_;
@@ -2253,13 +2253,13 @@ bool MESIInclusive::invalidateOwner(MemEvent * event, SharedCacheLine * line, bo
  *---------------------------------------------------------------------------------------------------------------------*/	    
 
 void MESIInclusive::addToOutgoingQueue(Response& resp) {
-    stat_eventSent[(int)resp.event->getCmd()]->addData(1);
+    stat_eventSent[(int)resp.event->getCmd()].addData(1);
     CoherenceController::addToOutgoingQueue(resp);
 }
 
 
 void MESIInclusive::addToOutgoingQueueUp(Response& resp) {
-    stat_eventSent[(int)resp.event->getCmd()]->addData(1);
+    stat_eventSent[(int)resp.event->getCmd()].addData(1);
     CoherenceController::addToOutgoingQueueUp(resp);
 }
 
@@ -2268,14 +2268,20 @@ void MESIInclusive::addToOutgoingQueueUp(Response& resp) {
  * Statistics and listeners
  ***********************************************************************************************************/
     
-void MESIInclusive::recordPrefetchResult(SharedCacheLine * line, Statistic<uint64_t> * stat) {
+void MESIInclusive::recordPrefetchResult(SharedCacheLine * line, StatCounter& stat) {
     if (line->getPrefetch()) {
-        stat->addData(1);
+        stat.addData(1);
         line->setPrefetch(false);
     }
 }
 
 
+void MESIInclusive::visitStatCounters(const StatCounterVisitor& visit) {
+    CoherenceController::visitStatCounters(visit);
+    SST::MemHierarchy::visitStatCounters(stat_hit, visit);
+    SST::MemHierarchy::visitStatCounters(stat_miss, visit);
+}
+
 void MESIInclusive::recordLatency(Command cmd, int type, uint64_t latency) {
     if (type == -1)
         return;
@@ -2311,7 +2317,7 @@ MemEventInitCoherence * MESIInclusive::getInitCoherenceEvent() {
 }
 
 
-void MESIInclusive::printData(vector<uint8_t> * data, bool set) {
+void MESIInclusive::printData(const vector<uint8_t> * data, bool set) {
 /*    if (set)    printf("Setting data (%zu): 0x", data->size());
     else        printf("Getting data (%zu): 0x", data->size());
     
@@ -496,6 +496,7 @@ public:
 
     /** Cache interface **/
     virtual Addr getBank(Addr addr) { return cacheArray_->getBank(addr); }
+    virtual bool isCached(Addr addr) { SharedCacheLine* line = cacheArray_->lookup(addr, false); return line && line->getState() != I; }
     virtual void setSliceAware(uint64_t size, uint64_t step) { cacheArray_->setSliceAware(size, step); }
 
     /** Initialization **/
@@ -550,7 +551,7 @@ private:
     void forwardFlush(MemEvent * event, SharedCacheLine * line, bool data);
 
     /** Send response up (towards processor) */
-    SimTime_t sendResponseUp(MemEvent * event, vector<uint8_t>* data, bool inMSHR, uint64_t time, Command cmd = Command::NULLCMD, bool success = false);
+    SimTime_t sendResponseUp(MemEvent * event, const PayloadBuffer* data, bool inMSHR, uint64_t time, Command cmd = Command::NULLCMD, bool success = false);
 
     /** Send response down (towards memory) */
     void sendResponseDown(MemEvent * event, SharedCacheLine * line, bool data, bool evict);
@@ -573,12 +574,13 @@ private:
 
 /* Miscellaneous functions */
     /* Record prefetch statistics. Line cannot be null. */
-    void recordPrefetchResult(SharedCacheLine * line, Statistic<uint64_t> * stat);
+    void recordPrefetchResult(SharedCacheLine * line, StatCounter& stat);
     
     /* Record latency */
     void recordLatency(Command cmd, int type, uint64_t latency);
+    void visitStatCounters(const StatCounterVisitor& visit);
 
-    void printData(vector<uint8_t> * data, bool set);
+    void printData(const vector<uint8_t> * data, bool set);
     void printLine(Addr addr);
 
 /* Variables */
@@ -594,8 +596,8 @@ private:
     Statistic<uint64_t>* stat_latencyGetSX[4];
     Statistic<uint64_t>* stat_latencyFlushLine;
     Statistic<uint64_t>* stat_latencyFlushLineInv;
-    Statistic<uint64_t>* stat_hit[3][2];
-    Statistic<uint64_t>* stat_miss[3][2];
+    StatCounter stat_hit[3][2];
+    StatCounter stat_miss[3][2];
 };
 
 
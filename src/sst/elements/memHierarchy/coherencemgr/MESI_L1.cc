@@ -67,8 +67,8 @@ bool MESIL1::handleGetS(MemEvent * event, bool inMSHR) {
                 //eventProfileAndNotify(event, I, NotifyAccessType::READ, NotifyResultType::MISS, true, LatType::MISS);
                 if (!mshr_->getProfiled(addr)) {
                     recordLatencyType(event->getID(), LatType::MISS);
-                    stat_eventState[(int)Command::GetS][I]->addData(1);
-                    stat_miss[0][inMSHR]->addData(1);
+                    stat_eventState[(int)Command::GetS][I].addData(1);
+                    stat_miss[0][inMSHR].addData(1);
                     notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::MISS);
                     mshr_->setProfiled(addr);
                 }
@@ -87,13 +87,13 @@ bool MESIL1::handleGetS(MemEvent * event, bool inMSHR) {
         case M:
             if (!inMSHR || !mshr_->getProfiled(addr)) {
                 recordLatencyType(event->getID(), LatType::HIT);
-                stat_eventState[(int)Command::GetS][state]->addData(1);
-                stat_hit[0][inMSHR]->addData(1);
+                stat_eventState[(int)Command::GetS][state].addData(1);
+                stat_hit[0][inMSHR].addData(1);
                 notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT);
             }
 
             if (localPrefetch) {
-                statPrefetchRedundant->addData(1); // Unneccessary prefetch
+                statPrefetchRedundant.addData(1); // Unneccessary prefetch
                 recordPrefetchLatency(event->getID(), LatType::HIT);
                 cleanUpAfterRequest(event, inMSHR);
                 break;
@@ -103,7 +103,7 @@ bool MESIL1::handleGetS(MemEvent * event, bool inMSHR) {
 
             if (event->isLoadLink())
                 line->atomicStart();
-            data.assign(line->getData()->begin() + (event->getAddr() - event->getBaseAddr()), line->getData()->begin() + (event->getAddr() - event->getBaseAddr() + event->getSize()));
+            data.assign(line->getDataBuffer()->read().begin() + (event->getAddr() - event->getBaseAddr()), line->getDataBuffer()->read().begin() + (event->getAddr() - event->getBaseAddr() + event->getSize()));
             sendTime = sendResponseUp(event, &data, inMSHR, line->getTimestamp());
             line->setTimestamp(sendTime - 1);
             cleanUpAfterRequest(event, inMSHR);
@@ -160,8 +160,8 @@ bool MESIL1::handleGetX(MemEvent* event, bool inMSHR) {
                 line = cacheArray_->lookup(addr, false);
                 if (!mshr_->getProfiled(addr)) {
                     notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::MISS);
-                    stat_eventState[(int)Command::GetX][I]->addData(1);
-                    stat_miss[1][inMSHR]->addData(1);
+                    stat_eventState[(int)Command::GetX][I].addData(1);
+                    stat_miss[1][inMSHR].addData(1);
                     recordLatencyType(event->getID(), LatType::MISS);
                     mshr_->setProfiled(addr);
                 }
@@ -182,8 +182,8 @@ bool MESIL1::handleGetX(MemEvent* event, bool inMSHR) {
                 if (!mshr_->getProfiled(addr)) {
                     notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::MISS);
                     recordLatencyType(event->getID(), LatType::UPGRADE);
-                    stat_eventState[(int)Command::GetX][S]->addData(1);
-                    stat_miss[1][inMSHR]->addData(1);
+                    stat_eventState[(int)Command::GetX][S].addData(1);
+                    stat_miss[1][inMSHR].addData(1);
                     mshr_->setProfiled(addr);
                 }
                 recordPrefetchResult(line, statPrefetchUpgradeMiss);
@@ -203,12 +203,12 @@ bool MESIL1::handleGetX(MemEvent* event, bool inMSHR) {
             if (!inMSHR || !mshr_->getProfiled(addr)) {
                 notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::HIT);
                 recordLatencyType(event->getID(), LatType::HIT);
-                stat_eventState[(int)Command::GetX][state]->addData(1);
-                stat_hit[1][inMSHR]->addData(1);
+                stat_eventState[(int)Command::GetX][state].addData(1);
+                stat_hit[1][inMSHR].addData(1);
             }
             
             if (!event->isStoreConditional() || line->isAtomic()) { // Don't write on a non-atomic SC
-                line->setData(event->getPayload(), event->getAddr() - event->getBaseAddr());
+                line->setData(event->getPayloadBuffer(), event->getAddr() - event->getBaseAddr());
                 atomic = line->isAtomic();
                 line->atomicEnd();
             }
@@ -273,8 +273,8 @@ bool MESIL1::handleGetSX(MemEvent* event, bool inMSHR) {
             if (status == MemEventStatus::OK) {
                 if (!mshr_->getProfiled(addr)) {
                     notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::MISS);
-                    stat_eventState[(int)Command::GetSX][I]->addData(1);
-                    stat_miss[2][inMSHR]->addData(1);
+                    stat_eventState[(int)Command::GetSX][I].addData(1);
+                    stat_miss[2][inMSHR].addData(1);
                     recordLatencyType(event->getID(), LatType::MISS);
                     mshr_->setProfiled(addr);
                 }
@@ -295,8 +295,8 @@ bool MESIL1::handleGetSX(MemEvent* event, bool inMSHR) {
                 if (!mshr_->getProfiled(addr)) {
                     notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::MISS);
                     recordLatencyType(event->getID(), LatType::UPGRADE);
-                    stat_eventState[(int)Command::GetSX][S]->addData(1);
-                    stat_miss[2][inMSHR]->addData(1);
+                    stat_eventState[(int)Command::GetSX][S].addData(1);
+                    stat_miss[2][inMSHR].addData(1);
                     mshr_->setProfiled(addr);
                 }
                 recordPrefetchResult(line, statPrefetchUpgradeMiss);
@@ -316,11 +316,11 @@ bool MESIL1::handleGetSX(MemEvent* event, bool inMSHR) {
             if (!inMSHR || !mshr_->getProfiled(addr)) {
                 notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT);
                 recordLatencyType(event->getID(), LatType::HIT);
-                stat_eventState[(int)Command::GetSX][state]->addData(1);
-                stat_hit[2][inMSHR]->addData(1);
+                stat_eventState[(int)Command::GetSX][state].addData(1);
+                stat_hit[2][inMSHR].addData(1);
             }
             line->incLock();
-            std::copy(line->getData()->begin() + (event->getAddr() - event->getBaseAddr()), line->getData()->begin() + (event->getAddr() - event->getBaseAddr()) + event->getSize(), data.begin());
+            std::copy(line->getDataBuffer()->read().begin() + (event->getAddr() - event->getBaseAddr()), line->getDataBuffer()->read().begin() + (event->getAddr() - event->getBaseAddr()) + event->getSize(), data.begin());
             sendTime = sendResponseUp(event, &data, inMSHR, line->getTimestamp());
             line->setTimestamp(sendTime-1);
             cleanUpAfterRequest(event, inMSHR);
@@ -365,7 +365,7 @@ bool MESIL1::handleFlushLine(MemEvent* event, bool inMSHR) {
     /* Flush fails if line is locked */
     if (state != I && line->isLocked()) {
         if (!inMSHR || !mshr_->getProfiled(addr)) { 
-            stat_eventState[(int)Command::FlushLine][state]->addData(1);
+            stat_eventState[(int)Command::FlushLine][state].addData(1);
             recordLatencyType(event->getID(), LatType::MISS);
         }
         sendResponseUp(event, nullptr, inMSHR, line->getTimestamp());
@@ -385,7 +385,7 @@ bool MESIL1::handleFlushLine(MemEvent* event, bool inMSHR) {
         return false;
 
     if (!mshr_->getProfiled(addr)) {
-        stat_eventState[(int)Command::FlushLine][state]->addData(1);
+        stat_eventState[(int)Command::FlushLine][state].addData(1);
         recordLatencyType(event->getID(), LatType::HIT);
         mshr_->setProfiled(addr);
     }
@@ -430,7 +430,7 @@ bool MESIL1::handleFlushLineInv(MemEvent* event, bool inMSHR) {
     /* Flush fails if line is locked */
     if (state != I && line->isLocked()) {
         if (!inMSHR || !mshr_->getProfiled(addr)) { 
-            stat_eventState[(int)Command::FlushLineInv][state]->addData(1);
+            stat_eventState[(int)Command::FlushLineInv][state].addData(1);
             recordLatencyType(event->getID(), LatType::MISS);
         }
         sendResponseUp(event, nullptr, inMSHR, line->getTimestamp());
@@ -451,7 +451,7 @@ bool MESIL1::handleFlushLineInv(MemEvent* event, bool inMSHR) {
 
     mshr_->setInProgress(addr);
     if (!mshr_->getProfiled(addr)) {
-        stat_eventState[(int)Command::FlushLineInv][state]->addData(1);
+        stat_eventState[(int)Command::FlushLineInv][state].addData(1);
         if (line)
             recordPrefetchResult(line, statPrefetchEvict);
         mshr_->setProfiled(addr);
@@ -502,7 +502,7 @@ bool MESIL1::handleFetch(MemEvent* event, bool inMSHR) {
                     cachename_.c_str(), StateString[state], event->getVerboseString().c_str(), getCurrentSimTimeNano());
     }
 
-    stat_eventState[(int)Command::Fetch][state]->addData(1);
+    stat_eventState[(int)Command::Fetch][state].addData(1);
 
     delete event;
     return true;
@@ -523,7 +523,7 @@ bool MESIL1::handleInv(MemEvent* event, bool inMSHR) {
 
     /* Note - not possible to receive an inv when the line is locked (locked implies state = E or M) */
 
-    stat_eventState[(int)Command::Inv][state]->addData(1);
+    stat_eventState[(int)Command::Inv][state].addData(1);
     if (line)
         recordPrefetchResult(line, statPrefetchInv);
 
@@ -584,7 +584,7 @@ bool MESIL1::handleForceInv(MemEvent* event, bool inMSHR) {
                 if (!inMSHR && allocateMSHR(event, true, 0) == MemEventStatus::Reject)
                     return false;
                 else {
-                    stat_eventStalledForLock->addData(1);
+                    stat_eventStalledForLock.addData(1);
                     if (is_debug_event(event)) {
                         eventDI.action = "Stall";
                         eventDI.reason = "line locked";
@@ -614,7 +614,7 @@ bool MESIL1::handleForceInv(MemEvent* event, bool inMSHR) {
                     getName().c_str(), StateString[state], event->getVerboseString().c_str(), getCurrentSimTimeNano());
     }
 
-    stat_eventState[(int)Command::ForceInv][state]->addData(1);
+    stat_eventState[(int)Command::ForceInv][state].addData(1);
     if (line) {
         recordPrefetchResult(line, statPrefetchInv);
 
@@ -646,7 +646,7 @@ bool MESIL1::handleFetchInv(MemEvent* event, bool inMSHR) {
         case IM:
             if (is_debug_event(event))
                 eventDI.action = "Ignore";
-            stat_eventState[(int)Command::FetchInv][state]->addData(1);
+            stat_eventState[(int)Command::FetchInv][state].addData(1);
             delete event;
             return true;
         case M:
@@ -654,7 +654,7 @@ bool MESIL1::handleFetchInv(MemEvent* event, bool inMSHR) {
                 if (!inMSHR && (allocateMSHR(event, true, 0) == MemEventStatus::Reject))
                     return false;
                 else {
-                    stat_eventStalledForLock->addData(1);
+                    stat_eventStalledForLock.addData(1);
                     if (is_debug_event(event)) {
                         eventDI.action = "Stall";
                         eventDI.reason = "line locked";
@@ -684,7 +684,7 @@ bool MESIL1::handleFetchInv(MemEvent* event, bool inMSHR) {
                     getName().c_str(), StateString[state], event->getVerboseString().c_str(), getCurrentSimTimeNano());
     }
 
-    stat_eventState[(int)Command::FetchInv][state]->addData(1);
+    stat_eventState[(int)Command::FetchInv][state].addData(1);
 
     if (line) {
         recordPrefetchResult(line, statPrefetchInv);
@@ -719,7 +719,7 @@ bool MESIL1::handleFetchInvX(MemEvent* event, bool inMSHR) {
                 if (!inMSHR && (allocateMSHR(event, true, 0) == MemEventStatus::Reject)) {
                     return false;
                 } else {
-                    stat_eventStalledForLock->addData(1);
+                    stat_eventStalledForLock.addData(1);
                     if (is_debug_event(event)) {
                         eventDI.action = "Stall";
                         eventDI.reason = "line locked";
@@ -744,7 +744,7 @@ bool MESIL1::handleFetchInvX(MemEvent* event, bool inMSHR) {
                     getName().c_str(), StateString[state], event->getVerboseString().c_str(), getCurrentSimTimeNano());
     }
 
-    stat_eventState[(int)Command::FetchInvX][state]->addData(1);
+    stat_eventState[(int)Command::FetchInvX][state].addData(1);
     
     if (is_debug_addr(event->getBaseAddr()) && line) {
         eventDI.newst = line->getState();
@@ -759,7 +759,7 @@ bool MESIL1::handleGetSResp(MemEvent* event, bool inMSHR) {
     L1CacheLine * line = cacheArray_->lookup(addr, false);
     State state = line ? line->getState() : I;
     
-    stat_eventState[(int)Command::GetSResp][state]->addData(1);
+    stat_eventState[(int)Command::GetSResp][state].addData(1);
     
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
     bool localPrefetch = req->isPrefetch() && (req->getRqstr() == cachename_);
@@ -770,11 +770,11 @@ bool MESIL1::handleGetSResp(MemEvent* event, bool inMSHR) {
     req->setMemFlags(event->getMemFlags()); // Copy MemFlags through
 
     // Update line
-    line->setData(event->getPayload(), 0);
+    line->setData(event->getPayloadBuffer(), 0);
     line->setState(S);
     
     if (is_debug_addr(addr))
-        printData(line->getData(), true);
+        printData(&line->getDataBuffer()->read(), true);
     
     if (localPrefetch) {
         line->setPrefetch(true);
@@ -784,7 +784,7 @@ bool MESIL1::handleGetSResp(MemEvent* event, bool inMSHR) {
     } else {
         req->setMemFlags(event->getMemFlags());
         Addr offset = req->getAddr() - addr;
-        vector<uint8_t> data(line->getData()->begin() + offset, line->getData()->begin() + offset + req->getSize());
+        vector<uint8_t> data(line->getDataBuffer()->read().begin() + offset, line->getDataBuffer()->read().begin() + offset + req->getSize());
         uint64_t sendTime = sendResponseUp(req, &data, true, line->getTimestamp());
         line->setTimestamp(sendTime-1);
     }
@@ -804,7 +804,7 @@ bool MESIL1::handleGetXResp(MemEvent* event, bool inMSHR) {
     L1CacheLine * line = cacheArray_->lookup(addr, false);
     State state = line ? line->getState() : I;
     
-    stat_eventState[(int)Command::GetXResp][state]->addData(1);
+    stat_eventState[(int)Command::GetXResp][state].addData(1);
     
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
     bool localPrefetch = req->isPrefetch() && (req->getRqstr() == cachename_);
@@ -820,9 +820,9 @@ bool MESIL1::handleGetXResp(MemEvent* event, bool inMSHR) {
     switch (state) {
         case IS:
             {
-                line->setData(event->getPayload(), 0);
+                line->setData(event->getPayloadBuffer(), 0);
                 if (is_debug_addr(addr))
-                    printData(line->getData(), true);
+                    printData(&line->getDataBuffer()->read(), true);
 
                 if (event->getDirty()) {
                     line->setState(M); // Sometimes get dirty data from a noninclusive cache
@@ -837,26 +837,26 @@ bool MESIL1::handleGetXResp(MemEvent* event, bool inMSHR) {
                     line->setPrefetch(true);
                     recordPrefetchLatency(req->getID(), LatType::MISS);
                 } else {
-                    data.assign(line->getData()->begin() + offset, line->getData()->begin() + offset + req->getSize());
+                    data.assign(line->getDataBuffer()->read().begin() + offset, line->getDataBuffer()->read().begin() + offset + req->getSize());
                     uint64_t sendTime = sendResponseUp(req, &data, true, line->getTimestamp());
                     line->setTimestamp(sendTime - 1);
                 }
                 break;
             }
         case IM:
-            line->setData(event->getPayload(), 0);
+            line->setData(event->getPayloadBuffer(), 0);
             if (is_debug_addr(addr)) 
-                printData(line->getData(), true);
+                printData(&line->getDataBuffer()->read(), true);
         case SM:
             {
                 line->setState(M);
 
                 if (req->getCmd() == Command::GetX) {
                     if (!req->isStoreConditional() || line->isAtomic()) { // Normal or successful store-conditional
-                        line->setData(req->getPayload(), offset);
+                        line->setData(req->getPayloadBuffer(), offset);
 
                         if (is_debug_addr(addr))
-                            printData(line->getData(), true);
+                            printData(&line->getDataBuffer()->read(), true);
                         
                         line->atomicEnd();
                     }
@@ -867,7 +867,7 @@ bool MESIL1::handleGetXResp(MemEvent* event, bool inMSHR) {
                 } else { // Read lock/GetSX
                     line->incLock();
                 }
-                data.assign(line->getData()->begin() + offset, line->getData()->begin() + offset + req->getSize());
+                data.assign(line->getDataBuffer()->read().begin() + offset, line->getDataBuffer()->read().begin() + offset + req->getSize());
                 uint64_t sendTime = sendResponseUp(req, &data, true, line->getTimestamp(), false);
                 line->setTimestamp(sendTime-1);
                 break;
@@ -893,7 +893,7 @@ bool MESIL1::handleFlushLineResp(MemEvent * event, bool inMSHR) {
     L1CacheLine * line = cacheArray_->lookup(addr, false);
     State state = line ? line->getState() : I;
 
-    stat_eventState[(int)Command::FlushLineResp][state]->addData(1);
+    stat_eventState[(int)Command::FlushLineResp][state].addData(1);
 
     if (is_debug_addr(addr))
         eventDI.prefill(event->getID(), Command::FlushLineResp, false, addr, state);
@@ -935,7 +935,7 @@ bool MESIL1::handleAckPut(MemEvent * event, bool inMSHR) {
     L1CacheLine * line = cacheArray_->lookup(addr, false);
     State state = line ? line->getState() : I;
 
-    stat_eventState[(int)Command::AckPut][state]->addData(1);
+    stat_eventState[(int)Command::AckPut][state].addData(1);
 
     if (is_debug_addr(addr)) {
         eventDI.prefill(event->getID(), Command::AckPut, false, addr, state);
@@ -1082,13 +1082,13 @@ bool MESIL1::handleEviction(Addr addr, L1CacheLine*& line) {
 
     /* L1s can have locked cache lines which prevents replacement */
     if (line->isLocked()) {
-        stat_eventStalledForLock->addData(1);
+        stat_eventStalledForLock.addData(1);
         if (is_debug_addr(line->getAddr()))
             printDebugAlloc(false, line->getAddr(), "InProg, line locked");
         return false;
     }
 
-    stat_evict[state]->addData(1);
+    stat_evict[state].addData(1);
 
     switch (state) {
         case I:
@@ -1288,7 +1288,7 @@ void MESIL1::sendResponseDown(MemEvent * event, L1CacheLine * line, bool data) {
     MemEvent * responseEvent = event->makeResponse();
 
     if (data) {
-        responseEvent->setPayload(*line->getData());
+        responseEvent->setPayload(*line->getDataBuffer());
         if (line->getState() == M)
             responseEvent->setDirty(true);
     }
@@ -1315,7 +1315,7 @@ void MESIL1::forwardFlush(MemEvent* event, L1CacheLine* line, bool evict) {
     uint64_t latency = tagLatency_; // Check coherence state/hitVmiss
     if (evict) {
         flush->setEvict(true);
-        flush->setPayload(*(line->getData()));
+        flush->setPayload(*line->getDataBuffer());
         flush->setDirty(line->getState() == M);
         latency = accessLatency_; // Time to check coherence & access data (in parallel)
     } else {
@@ -1348,11 +1348,11 @@ void MESIL1::sendWriteback(Command cmd, L1CacheLine * line, bool dirty) {
     uint64_t latency = tagLatency_;
     
     if (dirty || writebackCleanBlocks_) {
-        writeback->setPayload(*line->getData());
+        writeback->setPayload(*line->getDataBuffer());
         writeback->setDirty(dirty);
         
         if (is_debug_addr(line->getAddr())) {
-            printData(line->getData(), false);
+            printData(&line->getDataBuffer()->read(), false);
         }
         
         latency = accessLatency_;
@@ -1384,12 +1384,12 @@ void MESIL1::snoopInvalidation(MemEvent * event, L1CacheLine * line) {
  *  Override message send functions with versions that record statistics & call parent class
  *---------------------------------------------------------------------------------------------------------------------*/
 void MESIL1::addToOutgoingQueue(Response& resp) {
-    stat_eventSent[(int)resp.event->getCmd()]->addData(1);
+    stat_eventSent[(int)resp.event->getCmd()].addData(1);
     CoherenceController::addToOutgoingQueue(resp);
 }
 
 void MESIL1::addToOutgoingQueueUp(Response& resp) {
-    stat_eventSent[(int)resp.event->getCmd()]->addData(1);
+    stat_eventSent[(int)resp.event->getCmd()].addData(1);
     CoherenceController::addToOutgoingQueueUp(resp);
 }
 
@@ -1399,14 +1399,21 @@ void MESIL1::addToOutgoingQueueUp(Response& resp) {
  ***********************************************************************************************************/
 
 /* Record result of a prefetch. Important: assumes line is not null */
-void MESIL1::recordPrefetchResult(L1CacheLine* line, Statistic<uint64_t>* stat) {
+void MESIL1::recordPrefetchResult(L1CacheLine* line, StatCounter& stat) {
     if (line->getPrefetch()) {
-        stat->addData(1);
+        stat.addData(1);
         line->setPrefetch(false);
     }
 }
 
 
+void MESIL1::visitStatCounters(const StatCounterVisitor& visit) {
+    CoherenceController::visitStatCounters(visit);
+    SST::MemHierarchy::visitStatCounters(stat_hit, visit);
+    SST::MemHierarchy::visitStatCounters(stat_miss, visit);
+    SST::MemHierarchy::visitStatCounters(stat_eventStalledForLock, visit);
+}
+
 void MESIL1::recordLatency(Command cmd, int type, uint64_t latency) {
     if (type == -1)
         return; // Never set a hit/miss status
@@ -1434,7 +1441,7 @@ void MESIL1::recordLatency(Command cmd, int type, uint64_t latency) {
 
 void MESIL1::eventProfileAndNotify(MemEvent * event, State state, NotifyAccessType type, NotifyResultType result, bool inMSHR) {
     if (!inMSHR || !mshr_->getProfiled(event->getBaseAddr())) {
-        stat_eventState[(int)event->getCmd()][state]->addData(1); // Profile event receive
+        stat_eventState[(int)event->getCmd()][state].addData(1); // Profile event receive
         notifyListenerOfAccess(event, type, result);
         if (inMSHR)
             mshr_->setProfiled(event->getBaseAddr());
@@ -1481,7 +1488,7 @@ Addr MESIL1::getBank(Addr addr) {
 
 void MESIL1::printLine(Addr addr) { }
 void MESIL1::printData(Addr addr) { }
-void MESIL1::printData(vector<uint8_t>* data, bool set) { }
+void MESIL1::printData(const vector<uint8_t> * data, bool set) { }
 
 void MESIL1::printStatus(Output &out) {
     cacheArray_->printCacheArray(out);
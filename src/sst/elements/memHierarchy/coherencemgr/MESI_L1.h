@@ -377,6 +377,7 @@ public:
     void printStatus(Output& out);
 
     Addr getBank(Addr addr);
+    bool isCached(Addr addr) { L1CacheLine* line = cacheArray_->lookup(addr, false); return line && line->getState() != I; }
 
 private:
 
@@ -398,14 +399,15 @@ private:
     void addToOutgoingQueueUp(Response& resp);
 
     /** Statistics/Listeners */
-    inline void recordPrefetchResult(L1CacheLine * line, Statistic<uint64_t>* stat);
+    inline void recordPrefetchResult(L1CacheLine * line, StatCounter& stat);
     void recordLatency(Command cmd, int type, uint64_t latency);
+    void visitStatCounters(const StatCounterVisitor& visit);
     void eventProfileAndNotify(MemEvent * event, State state, NotifyAccessType type, NotifyResultType result, bool inMSHR);
 
     /** Miscellaneous */
     void printLine(Addr addr);
     void printData(Addr addr);
-    void printData(vector<uint8_t> * data, bool set);
+    void printData(const vector<uint8_t> * data, bool set);
 
     bool snoopL1Invs_;
     State protocolState_; // E for MESI, S for MSI
@@ -413,14 +415,14 @@ private:
     CacheArray<L1CacheLine>* cacheArray_;
 
     /** Statistics */
-    Statistic<uint64_t>* stat_eventStalledForLock;
+    StatCounter stat_eventStalledForLock;
     Statistic<uint64_t>* stat_latencyGetS[2];
     Statistic<uint64_t>* stat_latencyGetX[4];
     Statistic<uint64_t>* stat_latencyGetSX[4];
     Statistic<uint64_t>* stat_latencyFlushLine[2];
     Statistic<uint64_t>* stat_latencyFlushLineInv[2];
-    Statistic<uint64_t>* stat_hit[3][2];
-    Statistic<uint64_t>* stat_miss[3][2];
+    StatCounter stat_hit[3][2];
+    StatCounter stat_miss[3][2];
 };
 
 
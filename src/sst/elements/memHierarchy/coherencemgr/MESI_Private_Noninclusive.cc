@@ -57,8 +57,8 @@ bool MESIPrivNoninclusive::handleGetS(MemEvent* event, bool inMSHR) {
 
             if (status == MemEventStatus::OK) {
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::GetS][I]->addData(1);
-                    stat_miss[0][inMSHR]->addData(1);
+                    stat_eventState[(int)Command::GetS][I].addData(1);
+                    stat_miss[0][inMSHR].addData(1);
                     notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::MISS);
                     mshr_->setProfiled(addr);
                 }
@@ -72,12 +72,12 @@ bool MESIPrivNoninclusive::handleGetS(MemEvent* event, bool inMSHR) {
             break;
         case S:
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::GetS][S]->addData(1);
-                stat_hit[0][inMSHR]->addData(1);
+                stat_eventState[(int)Command::GetS][S].addData(1);
+                stat_hit[0][inMSHR].addData(1);
                 notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT);
             }
             line->setShared(true);
-            sendTime = sendResponseUp(event, line->getData(), inMSHR, line->getTimestamp());
+            sendTime = sendResponseUp(event, line->getDataBuffer(), inMSHR, line->getTimestamp());
             recordLatencyType(event->getID(), LatType::HIT);
             line->setTimestamp(sendTime);
             if (is_debug_event(event))
@@ -87,18 +87,18 @@ bool MESIPrivNoninclusive::handleGetS(MemEvent* event, bool inMSHR) {
         case E:
         case M:
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::GetS][state]->addData(1);
-                stat_hit[0][inMSHR]->addData(1);
+                stat_eventState[(int)Command::GetS][state].addData(1);
+                stat_hit[0][inMSHR].addData(1);
                 notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT);
             }
             if (is_debug_event(event))
                 eventDI.reason = "hit";
             if (protocol_) { // Transfer ownership of dirty block
                 line->setOwned(true);
-                sendTime = sendExclusiveResponse(event, line->getData(), inMSHR, line->getTimestamp(), state == M);
+                sendTime = sendExclusiveResponse(event, line->getDataBuffer(), inMSHR, line->getTimestamp(), state == M);
             } else { // Will writeback dirty block if we evict
                 line->setShared(true);
-                sendTime = sendResponseUp(event, line->getData(), inMSHR, line->getTimestamp(), Command::GetSResp);
+                sendTime = sendResponseUp(event, line->getDataBuffer(), inMSHR, line->getTimestamp(), Command::GetSResp);
             }
             recordLatencyType(event->getID(), LatType::HIT);
             line->setTimestamp(sendTime);
@@ -149,8 +149,8 @@ bool MESIPrivNoninclusive::handleGetX(MemEvent* event, bool inMSHR) {
             status = inMSHR ? MemEventStatus::OK : allocateMSHR(event, false);
             if (status == MemEventStatus::OK) {
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)event->getCmd()][state]->addData(1);
-                    stat_miss[(event->getCmd() == Command::GetX ? 1 : 2)][inMSHR]->addData(1);
+                    stat_eventState[(int)event->getCmd()][state].addData(1);
+                    stat_miss[(event->getCmd() == Command::GetX ? 1 : 2)][inMSHR].addData(1);
                     notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::MISS);
                     mshr_->setProfiled(addr);
                 }
@@ -171,13 +171,13 @@ bool MESIPrivNoninclusive::handleGetX(MemEvent* event, bool inMSHR) {
             line->setState(M);
         case M:
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)event->getCmd()][state]->addData(1);
-                stat_hit[(event->getCmd() == Command::GetX ? 1 : 2)][inMSHR]->addData(1);
+                stat_eventState[(int)event->getCmd()][state].addData(1);
+                stat_hit[(event->getCmd() == Command::GetX ? 1 : 2)][inMSHR].addData(1);
                 notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::HIT);
             }
             line->setOwned(true);
             line->setShared(false);
-            sendTime = sendExclusiveResponse(event, line->getData(), inMSHR, line->getTimestamp(), true);
+            sendTime = sendExclusiveResponse(event, line->getDataBuffer(), inMSHR, line->getTimestamp(), true);
             line->setTimestamp(sendTime);
             recordLatencyType(event->getID(), LatType::HIT);
             if (is_debug_event(event))
@@ -228,15 +228,15 @@ bool MESIPrivNoninclusive::handleFlushLine(MemEvent * event, bool inMSHR) {
     switch (state) {
         case I:
             if (status == MemEventStatus::OK) {
-                forwardFlush(event, event->getEvict(), &(event->getPayload()), event->getDirty(), 0);
+                forwardFlush(event, event->getEvict(), &(event->getPayloadBuffer()), event->getDirty(), 0);
                 event->setEvict(false);
                 mshr_->setInProgress(addr);
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::FlushLine][I]->addData(1);
+                    stat_eventState[(int)Command::FlushLine][I].addData(1);
                     mshr_->setProfiled(addr);
                 }
             } else if (mshr_->getAcksNeeded(addr) != 0 && event->getEvict()) {
-                mshr_->setData(addr, event->getPayload(), event->getDirty());
+                mshr_->setData(addr, event->getPayloadBuffer(), event->getDirty());
                 event->setEvict(false);
                 if ((static_cast<MemEvent*>(mshr_->getFrontEvent(addr)))->getCmd() == Command::FetchInvX) {
                     responses.erase(addr);
@@ -252,7 +252,7 @@ bool MESIPrivNoninclusive::handleFlushLine(MemEvent * event, bool inMSHR) {
                 line->setState(S_B);
                 mshr_->setInProgress(addr);
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::FlushLine][S]->addData(1);
+                    stat_eventState[(int)Command::FlushLine][S].addData(1);
                     mshr_->setProfiled(addr);
                 }
             }
@@ -264,15 +264,15 @@ bool MESIPrivNoninclusive::handleFlushLine(MemEvent * event, bool inMSHR) {
                     line->setOwned(false);
                     line->setShared(true);
                     if (event->getDirty()) {
-                        line->setData(event->getPayload(), 0);
+                        line->setData(event->getPayloadBuffer(), 0);
                     }
                     event->setEvict(false);
                 }
-                forwardFlush(event, true, line->getData(), (state == M || event->getDirty()), line->getTimestamp());
+                forwardFlush(event, true, line->getDataBuffer(), (state == M || event->getDirty()), line->getTimestamp());
                 line->setState(S_B);
                 mshr_->setInProgress(addr);
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::FlushLine][state]->addData(1);
+                    stat_eventState[(int)Command::FlushLine][state].addData(1);
                     mshr_->setProfiled(addr);
                 }
             }
@@ -283,7 +283,7 @@ bool MESIPrivNoninclusive::handleFlushLine(MemEvent * event, bool inMSHR) {
                 line->setOwned(false);
                 line->setShared(true);
                 if (event->getDirty()) {
-                    line->setData(event->getPayload(), 0);
+                    line->setData(event->getPayloadBuffer(), 0);
                     line->setState(M_Inv);
                 }
                 event->setEvict(false);
@@ -295,7 +295,7 @@ bool MESIPrivNoninclusive::handleFlushLine(MemEvent * event, bool inMSHR) {
             line->setOwned(false);
             line->setShared(true);
             if (event->getDirty()) {
-                line->setData(event->getPayload(), 0);
+                line->setData(event->getPayloadBuffer(), 0);
                 line->setState(M_Inv);
             }
             event->setEvict(false);
@@ -341,10 +341,10 @@ bool MESIPrivNoninclusive::handleFlushLineInv(MemEvent * event, bool inMSHR) {
             if (inMSHR && mshr_->getInProgress(addr))
                 break; // Triggered an unneccessary retry
             if (status == MemEventStatus::OK) {
-                forwardFlush(event, event->getEvict(), &(event->getPayload()), event->getDirty(), 0); // No need to evict since we didn't race
+                forwardFlush(event, event->getEvict(), &(event->getPayloadBuffer()), event->getDirty(), 0); // No need to evict since we didn't race
                 mshr_->setInProgress(addr);
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::FlushLineInv][I]->addData(1);
+                    stat_eventState[(int)Command::FlushLineInv][I].addData(1);
                     mshr_->setProfiled(addr);
                 }
             } else if (event->getEvict()) {
@@ -364,7 +364,7 @@ bool MESIPrivNoninclusive::handleFlushLineInv(MemEvent * event, bool inMSHR) {
                     break;
 
                 // Copy data in and update state to resolve race with conflicting event
-                mshr_->setData(addr, event->getPayload(), event->getDirty());
+                mshr_->setData(addr, event->getPayloadBuffer(), event->getDirty());
                 if (race->getCmd() == Command::FetchInvX) {
                     event->setDirty(false);
                 } else if (race->getCmd() != Command::Fetch) { // FetchInv, ForceInv, or Inv
@@ -381,10 +381,10 @@ bool MESIPrivNoninclusive::handleFlushLineInv(MemEvent * event, bool inMSHR) {
                 if (event->getEvict())
                     line->setShared(false);
                 line->setState(I_B);
-                forwardFlush(event, true, line->getData(), false, line->getTimestamp());
+                forwardFlush(event, true, line->getDataBuffer(), false, line->getTimestamp());
                 mshr_->setInProgress(addr);
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::FlushLineInv][S]->addData(1);
+                    stat_eventState[(int)Command::FlushLineInv][S].addData(1);
                     mshr_->setProfiled(addr);
                 }
             }
@@ -396,15 +396,15 @@ bool MESIPrivNoninclusive::handleFlushLineInv(MemEvent * event, bool inMSHR) {
                     line->setOwned(false);
                     line->setShared(false);
                     if (event->getDirty()) {
-                        line->setData(event->getPayload(), 0);
+                        line->setData(event->getPayloadBuffer(), 0);
                         line->setState(M);
                     }
                 }
-                forwardFlush(event, true, line->getData(), line->getState() == M, line->getTimestamp());
+                forwardFlush(event, true, line->getDataBuffer(), line->getState() == M, line->getTimestamp());
                 line->setState(I_B);
                 mshr_->setInProgress(addr);
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::FlushLineInv][state]->addData(1);
+                    stat_eventState[(int)Command::FlushLineInv][state].addData(1);
                     mshr_->setProfiled(addr);
                 }
             }
@@ -424,7 +424,7 @@ bool MESIPrivNoninclusive::handleFlushLineInv(MemEvent * event, bool inMSHR) {
             line->setOwned(false);
             line->setShared(false);
             if (event->getDirty()) {
-                line->setData(event->getPayload(), 0);
+                line->setData(event->getPayloadBuffer(), 0);
                 line->setState(M);
             } else {
                 line->setState(E);
@@ -441,7 +441,7 @@ bool MESIPrivNoninclusive::handleFlushLineInv(MemEvent * event, bool inMSHR) {
             line->setOwned(false);
             line->setShared(false);
             if (event->getDirty()) 
-                line->setData(event->getPayload(), 0);
+                line->setData(event->getPayloadBuffer(), 0);
             event->setEvict(false);
             mshr_->decrementAcksNeeded(addr);
             responses.erase(addr);
@@ -477,21 +477,21 @@ bool MESIPrivNoninclusive::handlePutS(MemEvent * event, bool inMSHR) {
         eventDI.prefill(event->getID(), Command::PutS, false, addr, state);
     
     if (!inMSHR)
-        stat_eventState[(int)Command::PutS][state]->addData(1);
+        stat_eventState[(int)Command::PutS][state].addData(1);
     else
         mshr_->removePendingRetry(addr);
 
     switch (state) {
         case I:
             if (!inMSHR && mshr_->exists(addr)) { // Raced with something; must be an Inv/Fetch since there can only be one cache above us
-                mshr_->setData(addr, event->getPayload(), false);
+                mshr_->setData(addr, event->getPayloadBuffer(), false);
                 responses.erase(addr);
                 mshr_->decrementAcksNeeded(addr);
                 if (mshr_->getFrontType(addr) == MSHREntryType::Event && mshr_->getFrontEvent(addr)->getCmd() == Command::Fetch) {
                     status = allocateLine(event, line, false);
                     if (status == MemEventStatus::OK) {
                         line->setState(S);
-                        line->setData(event->getPayload(), 0);
+                        line->setData(event->getPayloadBuffer(), 0);
                         mshr_->clearData(addr);
                         sendWritebackAck(event);
                         cleanUpAfterRequest(event, inMSHR);
@@ -506,7 +506,7 @@ bool MESIPrivNoninclusive::handlePutS(MemEvent * event, bool inMSHR) {
                 status = allocateLine(event, line, inMSHR);
                 if (status == MemEventStatus::OK) {
                     line->setState(S);
-                    line->setData(event->getPayload(), 0);
+                    line->setData(event->getPayloadBuffer(), 0);
                     if (mshr_->hasData(addr)) mshr_->clearData(addr);
                     sendWritebackAck(event);
                     cleanUpAfterRequest(event, inMSHR);
@@ -576,7 +576,7 @@ bool MESIPrivNoninclusive::handlePutE(MemEvent * event, bool inMSHR) {
         eventDI.prefill(event->getID(), Command::PutE, false, addr, state);
     
     if (!inMSHR)
-        stat_eventState[(int)Command::PutE][state]->addData(1);
+        stat_eventState[(int)Command::PutE][state].addData(1);
     else
         mshr_->removePendingRetry(addr);
 
@@ -586,13 +586,13 @@ bool MESIPrivNoninclusive::handlePutE(MemEvent * event, bool inMSHR) {
                 if (mshr_->getFrontType(addr) == MSHREntryType::Event && mshr_->getFrontEvent(addr)->getCmd() == Command::FetchInvX) {
                     mshr_->decrementAcksNeeded(addr);
                     responses.erase(addr);
-                    mshr_->setData(addr, event->getPayload(), false);
+                    mshr_->setData(addr, event->getPayloadBuffer(), false);
                     event->setCmd(Command::PutS);
                     event->setDirty(false);
                     retry(addr);
                     status = allocateMSHR(event, false, 1, true);
                 } else {
-                    mshr_->setData(addr, event->getPayload(), false);
+                    mshr_->setData(addr, event->getPayloadBuffer(), false);
                     mshr_->decrementAcksNeeded(addr);
                     responses.erase(addr);
                     sendWritebackAck(event);
@@ -603,7 +603,7 @@ bool MESIPrivNoninclusive::handlePutE(MemEvent * event, bool inMSHR) {
                 status = allocateLine(event, line, inMSHR);
                 if (status == MemEventStatus::OK) {
                     event->getDirty() ? line->setState(M) : line->setState(E);
-                    line->setData(event->getPayload(), 0);
+                    line->setData(event->getPayloadBuffer(), 0);
                     sendWritebackAck(event);
                     if (mshr_->hasData(addr)) mshr_->clearData(addr);
                     cleanUpAfterRequest(event, inMSHR);
@@ -664,7 +664,7 @@ bool MESIPrivNoninclusive::handlePutM(MemEvent * event, bool inMSHR) {
         eventDI.prefill(event->getID(), Command::PutM, false, addr, state);
     
     if (!inMSHR)
-        stat_eventState[(int)Command::PutM][state]->addData(1);
+        stat_eventState[(int)Command::PutM][state].addData(1);
     else
         mshr_->removePendingRetry(addr);
     
@@ -674,13 +674,13 @@ bool MESIPrivNoninclusive::handlePutM(MemEvent * event, bool inMSHR) {
                 if (mshr_->getFrontType(addr) == MSHREntryType::Event && mshr_->getFrontEvent(addr)->getCmd() == Command::FetchInvX) {
                     mshr_->decrementAcksNeeded(addr);
                     responses.erase(addr);
-                    mshr_->setData(addr, event->getPayload(), true);
+                    mshr_->setData(addr, event->getPayloadBuffer(), true);
                     event->setCmd(Command::PutS);
                     event->setDirty(false);
                     retry(addr);
                     status = allocateMSHR(event, false, 1);
                 } else { // Eviction or invalidation -> we won't need a line
-                    mshr_->setData(addr, event->getPayload(), true);
+                    mshr_->setData(addr, event->getPayloadBuffer(), true);
                     mshr_->decrementAcksNeeded(addr);
                     responses.erase(addr);
                     sendWritebackAck(event);
@@ -691,7 +691,7 @@ bool MESIPrivNoninclusive::handlePutM(MemEvent * event, bool inMSHR) {
                 status = allocateLine(event, line, inMSHR);
                 if (status == MemEventStatus::OK) {
                     line->setState(M);
-                    line->setData(event->getPayload(), 0);
+                    line->setData(event->getPayloadBuffer(), 0);
                     if (mshr_->hasData(addr)) mshr_->clearData(addr);
                     sendWritebackAck(event);
                     cleanUpAfterRequest(event, inMSHR);
@@ -702,7 +702,7 @@ bool MESIPrivNoninclusive::handlePutM(MemEvent * event, bool inMSHR) {
         case M:
             line->setOwned(false);
             line->setState(M);
-            line->setData(event->getPayload(), 0);
+            line->setData(event->getPayloadBuffer(), 0);
             sendWritebackAck(event);
             cleanUpAfterRequest(event, inMSHR);
             break;
@@ -748,14 +748,14 @@ bool MESIPrivNoninclusive::handlePutX(MemEvent * event, bool inMSHR) {
         eventDI.prefill(event->getID(), Command::PutX, false, addr, state);
     
     if (!inMSHR)
-        stat_eventState[(int)Command::PutX][state]->addData(1);
+        stat_eventState[(int)Command::PutX][state].addData(1);
     else
         mshr_->removePendingRetry(addr);
     
     switch (state) {
         case I:
             if (mshr_->getAcksNeeded(addr)) {
-                mshr_->setData(addr, event->getPayload(), event->getDirty());
+                mshr_->setData(addr, event->getPayloadBuffer(), event->getDirty());
                 sendWritebackAck(event);
                 delete event;
 
@@ -768,7 +768,7 @@ bool MESIPrivNoninclusive::handlePutX(MemEvent * event, bool inMSHR) {
                 status = allocateLine(event, line, inMSHR);
                 if (status == MemEventStatus::OK) {
                     event->getDirty() ? line->setState(M) : line->setState(E);
-                    line->setData(event->getPayload(), 0);
+                    line->setData(event->getPayloadBuffer(), 0);
                     sendWritebackAck(event);
                     if (mshr_->hasData(addr)) mshr_->clearData(addr);
                     cleanUpAfterRequest(event, inMSHR);
@@ -781,7 +781,7 @@ bool MESIPrivNoninclusive::handlePutX(MemEvent * event, bool inMSHR) {
             line->setShared(true);
             if (event->getDirty()) {
                 line->setState(M);
-                line->setData(event->getPayload(), 0);
+                line->setData(event->getPayloadBuffer(), 0);
             }
             sendWritebackAck(event);
             cleanUpAfterRequest(event, inMSHR);
@@ -792,7 +792,7 @@ bool MESIPrivNoninclusive::handlePutX(MemEvent * event, bool inMSHR) {
             line->setShared(true);
             if (event->getDirty()) {
                 line->setState(M_Inv);
-                line->setData(event->getPayload(), 0);
+                line->setData(event->getPayloadBuffer(), 0);
             }
             sendWritebackAck(event);
             delete event;
@@ -805,7 +805,7 @@ bool MESIPrivNoninclusive::handlePutX(MemEvent * event, bool inMSHR) {
             line->setShared(true);
             if (event->getDirty()) {
                 line->setState(M);
-                line->setData(event->getPayload(), 0);
+                line->setData(event->getPayloadBuffer(), 0);
             } else {
                 line->setState(E);
             }
@@ -842,7 +842,7 @@ bool MESIPrivNoninclusive::handleFetch(MemEvent * event, bool inMSHR) {
         eventDI.prefill(event->getID(), Command::Fetch, false, addr, state);
     
     if (!inMSHR)
-        stat_eventState[(int)Command::Fetch][state]->addData(1);
+        stat_eventState[(int)Command::Fetch][state].addData(1);
     else
         mshr_->removePendingRetry(addr);
     
@@ -860,7 +860,7 @@ bool MESIPrivNoninclusive::handleFetch(MemEvent * event, bool inMSHR) {
                     delete event;
                 } else if (mshr_->getFrontEvent(addr)->getCmd() == Command::PutS) { // Raced with replacement
                     MemEvent* put = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
-                    sendResponseDown(event, event->getSize(), &(put->getPayload()), false);
+                    sendResponseDown(event, event->getSize(), &(put->getPayloadBuffer()), false);
                     delete event;
                 } else { // Raced with GetX or FlushLine
                     status = allocateMSHR(event, true, 0);
@@ -877,7 +877,7 @@ bool MESIPrivNoninclusive::handleFetch(MemEvent * event, bool inMSHR) {
         case SM:
         case S_B:
         case S_Inv:
-            sendResponseDown(event, event->getSize(), line->getData(), false);
+            sendResponseDown(event, event->getSize(), line->getDataBuffer(), false);
             cleanUpAfterRequest(event, inMSHR);
             break;
         case I_B:
@@ -920,7 +920,7 @@ bool MESIPrivNoninclusive::handleInv(MemEvent * event, bool inMSHR) {
     MemEventBase * req;
 
     if (!inMSHR)
-        stat_eventState[(int)Command::Inv][state]->addData(1);
+        stat_eventState[(int)Command::Inv][state].addData(1);
     else
         mshr_->removePendingRetry(addr);
 
@@ -996,7 +996,7 @@ bool MESIPrivNoninclusive::handleInv(MemEvent * event, bool inMSHR) {
                 line->setTimestamp(sendTime);
             }
         } else {
-            sendResponseDown(event, event->getSize(), line->getData(), false);
+            sendResponseDown(event, event->getSize(), line->getDataBuffer(), false);
             line->setState(state2);
             if (mshr_->hasData(addr))
                 mshr_->clearData(addr);
@@ -1026,7 +1026,7 @@ bool MESIPrivNoninclusive::handleForceInv(MemEvent * event, bool inMSHR) {
         eventDI.prefill(event->getID(), Command::ForceInv, false, addr, state);
     
     if (!inMSHR)
-        stat_eventState[(int)Command::ForceInv][state]->addData(1);
+        stat_eventState[(int)Command::ForceInv][state].addData(1);
     else
         mshr_->removePendingRetry(addr);
     
@@ -1069,7 +1069,7 @@ bool MESIPrivNoninclusive::handleForceInv(MemEvent * event, bool inMSHR) {
             } else if (mshr_->exists(addr) && mshr_->getFrontEvent(addr)->getCmd() == Command::PutX) { // Drop PutX, Ack it, forward request up
                 MemEvent * put = static_cast<MemEvent*>(mshr_->swapFrontEvent(addr, event));
                 sendWritebackAck(put);
-                mshr_->setData(addr, put->getPayload(), put->getDirty());
+                mshr_->setData(addr, put->getPayloadBuffer(), put->getDirty());
                 delete put;
                 sendFwdRequest(event, Command::ForceInv, upperCacheName_, event->getSize(), 0, inMSHR);
             } else if (mshr_->exists(addr) && (CommandWriteback[(int)mshr_->getFrontEvent(addr)->getCmd()])) {
@@ -1176,7 +1176,7 @@ bool MESIPrivNoninclusive::handleFetchInv(MemEvent * event, bool inMSHR){
         eventDI.prefill(event->getID(), Command::FetchInv, false, addr, state);
 
     if (!inMSHR)
-        stat_eventState[(int)Command::FetchInv][state]->addData(1);
+        stat_eventState[(int)Command::FetchInv][state].addData(1);
     else
         mshr_->removePendingRetry(addr);
     
@@ -1200,7 +1200,7 @@ bool MESIPrivNoninclusive::handleFetchInv(MemEvent * event, bool inMSHR){
                 if (entry) {
                     if (entry->getCmd() == Command::PutS) {
                         // Return AckInv
-                        sendResponseDown(event, event->getSize(), &(static_cast<MemEvent*>(entry)->getPayload()), false);
+                        sendResponseDown(event, event->getSize(), &(static_cast<MemEvent*>(entry)->getPayloadBuffer()), false);
                         delete event;
                         // Drop PutS
                         if (mshr_->hasData(addr)) mshr_->clearData(addr);
@@ -1210,7 +1210,7 @@ bool MESIPrivNoninclusive::handleFetchInv(MemEvent * event, bool inMSHR){
                         break;
                     } else if (entry->getCmd() == Command::FlushLineInv) {
                         // Handle FetchInv
-                        sendResponseDown(event, event->getSize(), &(static_cast<MemEvent*>(entry)->getPayload()), false);
+                        sendResponseDown(event, event->getSize(), &(static_cast<MemEvent*>(entry)->getPayloadBuffer()), false);
                         if (mshr_->hasData(addr)) mshr_->clearData(addr);
                         // Drop evict part of Flush if needed
                         MemEvent* flush = static_cast<MemEvent*>(entry);
@@ -1232,13 +1232,13 @@ bool MESIPrivNoninclusive::handleFetchInv(MemEvent * event, bool inMSHR){
             } else if (mshr_->exists(addr) && mshr_->getFrontEvent(addr)->getCmd() == Command::PutX) { // Drop PutX, Ack it, forward request up
                 MemEvent * put = static_cast<MemEvent*>(mshr_->swapFrontEvent(addr, event));
                 sendWritebackAck(put);
-                mshr_->setData(addr, put->getPayload(), put->getDirty());
+                mshr_->setData(addr, put->getPayloadBuffer(), put->getDirty());
                 delete put;
                 sendFwdRequest(event, Command::FetchInv, upperCacheName_, event->getSize(), 0, inMSHR);
             } else if (mshr_->exists(addr) && (CommandWriteback[(int)mshr_->getFrontEvent(addr)->getCmd()])) {
                 MemEvent * put = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
                 sendWritebackAck(put);
-                sendResponseDown(event, put->getSize(), &(put->getPayload()), put->getDirty());
+                sendResponseDown(event, put->getSize(), &(put->getPayloadBuffer()), put->getDirty());
                 mshr_->removeFront(addr);
                 delete put;
                 cleanUpAfterRequest(event, inMSHR);
@@ -1296,7 +1296,7 @@ bool MESIPrivNoninclusive::handleFetchInv(MemEvent * event, bool inMSHR){
                 line->setState(state1);
             }
         } else {
-            sendResponseDown(event, event->getSize(), line->getData(), state == M);
+            sendResponseDown(event, event->getSize(), line->getDataBuffer(), state == M);
             line->setState(state2);
             cleanUpAfterRequest(event, inMSHR);
         }
@@ -1322,7 +1322,7 @@ bool MESIPrivNoninclusive::handleFetchInvX(MemEvent * event, bool inMSHR) {
     MemEventStatus status = MemEventStatus::OK;
 
     if (!inMSHR)
-        stat_eventState[(int)Command::FetchInvX][state]->addData(1);
+        stat_eventState[(int)Command::FetchInvX][state].addData(1);
     else
         mshr_->removePendingRetry(addr);
 
@@ -1354,14 +1354,14 @@ bool MESIPrivNoninclusive::handleFetchInvX(MemEvent * event, bool inMSHR) {
                 } else if (mshr_->getFrontEvent(addr)->getCmd() == Command::PutX) {
                     MemEvent * put = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
                     sendWritebackAck(put);
-                    sendResponseDown(event, put->getSize(), &(put->getPayload()), put->getDirty());
+                    sendResponseDown(event, put->getSize(), &(put->getPayloadBuffer()), put->getDirty());
                     delete put;
                     mshr_->removeFront(addr);
                     cleanUpAfterRequest(event, inMSHR);
                     break;
                 } else if (mshr_->getFrontEvent(addr)->getCmd() == Command::PutE || mshr_->getFrontEvent(addr)->getCmd() == Command::PutM) {
                     MemEvent * put = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
-                    sendResponseDown(event, put->getSize(), &(put->getPayload()), put->getDirty());
+                    sendResponseDown(event, put->getSize(), &(put->getPayloadBuffer()), put->getDirty());
                     put->setCmd(Command::PutS); // Make this a PutS so we only record the block in shared later
                     put->setDirty(false);
                     delete event;
@@ -1387,7 +1387,7 @@ bool MESIPrivNoninclusive::handleFetchInvX(MemEvent * event, bool inMSHR) {
                 }
                 break;
             }
-            sendResponseDown(event, event->getSize(), line->getData(), state == M);
+            sendResponseDown(event, event->getSize(), line->getDataBuffer(), state == M);
             line->setState(S);
             cleanUpAfterRequest(event, inMSHR);
             break;
@@ -1425,7 +1425,7 @@ bool MESIPrivNoninclusive::handleGetSResp(MemEvent * event, bool inMSHR) {
     if (is_debug_event(event))
         eventDI.prefill(event->getID(), Command::GetSResp, false, addr, state);
 
-    stat_eventState[(int)Command::GetSResp][state]->addData(1);
+    stat_eventState[(int)Command::GetSResp][state].addData(1);
 
     // Find matching request in MSHR
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
@@ -1434,11 +1434,11 @@ bool MESIPrivNoninclusive::handleGetSResp(MemEvent * event, bool inMSHR) {
     if (is_debug_event(req))
         printData(&(event->getPayload()), true);
         
-    uint64_t sendTime = sendResponseUp(req, &(event->getPayload()), true, line ? line->getTimestamp() : 0);
+    uint64_t sendTime = sendResponseUp(req, &(event->getPayloadBuffer()), true, line ? line->getTimestamp() : 0);
 
     // Update line
     if (line) {
-        line->setData(event->getPayload(), 0);
+        line->setData(event->getPayloadBuffer(), 0);
         line->setState(S);
         line->setShared(true);
         line->setTimestamp(sendTime-1);
@@ -1473,7 +1473,7 @@ bool MESIPrivNoninclusive::handleGetXResp(MemEvent * event, bool inMSHR) {
     switch (state) {
         case I:
         {
-            sendExclusiveResponse(req, &(event->getPayload()), true, 0, event->getDirty());
+            sendExclusiveResponse(req, &(event->getPayloadBuffer()), true, 0, event->getDirty());
             cleanUpAfterResponse(event, inMSHR);
             break;
         }
@@ -1484,7 +1484,7 @@ bool MESIPrivNoninclusive::handleGetXResp(MemEvent * event, bool inMSHR) {
             if (line->getShared())
                 line->setShared(false);
 
-            uint64_t sendTime = sendExclusiveResponse(req, line->getData(), true, line->getTimestamp(), event->getDirty());
+            uint64_t sendTime = sendExclusiveResponse(req, line->getDataBuffer(), true, line->getTimestamp(), event->getDirty());
             line->setTimestamp(sendTime-1);
             cleanUpAfterResponse(event, inMSHR);
             break;
@@ -1494,7 +1494,7 @@ bool MESIPrivNoninclusive::handleGetXResp(MemEvent * event, bool inMSHR) {
                     getName().c_str(), StateString[state], event->getVerboseString().c_str(), getCurrentSimTimeNano());
     }
 
-    stat_eventState[(int)Command::GetXResp][state]->addData(1);
+    stat_eventState[(int)Command::GetXResp][state].addData(1);
     
     if (is_debug_addr(addr) && line) {
         eventDI.newst = line->getState();
@@ -1514,7 +1514,7 @@ bool MESIPrivNoninclusive::handleFlushLineResp(MemEvent * event, bool inMSHR) {
     if (is_debug_event(event))
         eventDI.prefill(event->getID(), Command::FlushLineResp, false, addr, state);
     
-    stat_eventState[(int)Command::FlushLineResp][state]->addData(1);
+    stat_eventState[(int)Command::FlushLineResp][state].addData(1);
 
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
 
@@ -1556,19 +1556,19 @@ bool MESIPrivNoninclusive::handleFetchResp(MemEvent * event, bool inMSHR) {
     if (is_debug_event(event))
         eventDI.prefill(event->getID(), Command::FetchResp, false, addr, state);
 
-    stat_eventState[(int)Command::FetchResp][state]->addData(1);
+    stat_eventState[(int)Command::FetchResp][state].addData(1);
     
     mshr_->decrementAcksNeeded(addr);
     responses.erase(addr);
 
     if (state == I) { // Fetch or FetchInv
         MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
-        sendResponseDown(req, event->getSize(), &(event->getPayload()), event->getDirty());
+        sendResponseDown(req, event->getSize(), &(event->getPayloadBuffer()), event->getDirty());
         cleanUpAfterResponse(event, inMSHR);
     } else {    // FetchInv only
         if (event->getDirty()) {
             line->setState(M);
-            line->setData(event->getPayload(), 0);
+            line->setData(event->getPayloadBuffer(), 0);
         } else if (state == M_Inv) {
             line->setState(M);
         } else {
@@ -1599,21 +1599,21 @@ bool MESIPrivNoninclusive::handleFetchXResp(MemEvent * event, bool inMSHR) {
     if (is_debug_event(event))
         eventDI.prefill(event->getID(), Command::FetchXResp, false, addr, state);
 
-    stat_eventState[(int)Command::FetchXResp][state]->addData(1);
+    stat_eventState[(int)Command::FetchXResp][state].addData(1);
     
     mshr_->decrementAcksNeeded(addr);
     responses.erase(addr);
 
     if (state == I) {
         MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
-        sendResponseDown(req, event->getSize(), &(event->getPayload()), event->getDirty());
+        sendResponseDown(req, event->getSize(), &(event->getPayloadBuffer()), event->getDirty());
         cleanUpAfterResponse(event, inMSHR);
     } else {
         line->setOwned(false);
         line->setShared(true);
         if (event->getDirty()) {
             line->setState(M);
-            line->setData(event->getPayload(), 0);
+            line->setData(event->getPayloadBuffer(), 0);
         } else if (state == M_InvX) {
             line->setState(M);
         } else {
@@ -1650,7 +1650,7 @@ bool MESIPrivNoninclusive::handleAckInv(MemEvent * event, bool inMSHR) {
    
     mshr_->decrementAcksNeeded(addr);
     
-    stat_eventState[(int)Command::AckInv][state]->addData(1);
+    stat_eventState[(int)Command::AckInv][state].addData(1);
     
     switch (state) {
         case I:
@@ -1701,7 +1701,7 @@ bool MESIPrivNoninclusive::handleAckInv(MemEvent * event, bool inMSHR) {
 
 
 bool MESIPrivNoninclusive::handleAckPut(MemEvent * event, bool inMSHR) {
-    stat_eventState[(int)Command::AckPut][I]->addData(1);
+    stat_eventState[(int)Command::AckPut][I].addData(1);
     
     if (is_debug_event(event)) {
         eventDI.prefill(event->getID(), Command::AckPut, false, event->getBaseAddr(), I);
@@ -1879,7 +1879,7 @@ bool MESIPrivNoninclusive::handleEviction(Addr addr, PrivateCacheLine*& line, db
     //if (is_debug_addr(addr) || is_debug_addr(line->getAddr()))
     //    debug->debug(_L5_, "    Evicting line (0x%" PRIx64 ", %s)\n", line->getAddr(), StateString[state]);
 
-    stat_evict[state]->addData(1);
+    stat_evict[state].addData(1);
 
     bool evict = false;
     bool wbSent = false;
@@ -1893,7 +1893,7 @@ bool MESIPrivNoninclusive::handleEviction(Addr addr, PrivateCacheLine*& line, db
         case S:
             if (!mshr_->getPendingRetries(line->getAddr())) {
                 if (!line->getShared() && !silentEvictClean_) {
-                    uint64_t sendTime = sendWriteback(line->getAddr(), lineSize_, Command::PutS, line->getData(), false, line->getTimestamp());
+                    uint64_t sendTime = sendWriteback(line->getAddr(), lineSize_, Command::PutS, line->getDataBuffer(), false, line->getTimestamp());
                     line->setTimestamp(sendTime-1);
                     mshr_->insertWriteback(line->getAddr(), false);
                     if (is_debug_addr(line->getAddr()))
@@ -1912,7 +1912,7 @@ bool MESIPrivNoninclusive::handleEviction(Addr addr, PrivateCacheLine*& line, db
         case E:
             if (!mshr_->getPendingRetries(line->getAddr())) {
                 if (line->getShared()) {
-                    uint64_t sendTime = sendWriteback(line->getAddr(), lineSize_, Command::PutX, line->getData(), false, line->getTimestamp());
+                    uint64_t sendTime = sendWriteback(line->getAddr(), lineSize_, Command::PutX, line->getDataBuffer(), false, line->getTimestamp());
                     line->setTimestamp(sendTime-1);
                     mshr_->insertWriteback(line->getAddr(), true);
                     if (is_debug_addr(addr) || is_debug_addr(line->getAddr()))
@@ -1920,7 +1920,7 @@ bool MESIPrivNoninclusive::handleEviction(Addr addr, PrivateCacheLine*& line, db
                     if (is_debug_addr(line->getAddr()))
                         printDebugAlloc(false, line->getAddr(), "Writeback");
                 } else if (!line->getOwned() && !silentEvictClean_) {
-                    uint64_t sendTime = sendWriteback(line->getAddr(), lineSize_, Command::PutE, line->getData(), false, line->getTimestamp());
+                    uint64_t sendTime = sendWriteback(line->getAddr(), lineSize_, Command::PutE, line->getDataBuffer(), false, line->getTimestamp());
                     line->setTimestamp(sendTime-1);
                     mshr_->insertWriteback(line->getAddr(), false);
                     if (is_debug_addr(line->getAddr()))
@@ -1938,7 +1938,7 @@ bool MESIPrivNoninclusive::handleEviction(Addr addr, PrivateCacheLine*& line, db
         case M:
             if (!mshr_->getPendingRetries(line->getAddr())) {
                 if (line->getShared()) {
-                    uint64_t sendTime = sendWriteback(line->getAddr(), lineSize_, Command::PutX, line->getData(), true, line->getTimestamp());
+                    uint64_t sendTime = sendWriteback(line->getAddr(), lineSize_, Command::PutX, line->getDataBuffer(), true, line->getTimestamp());
                     line->setTimestamp(sendTime-1);
                     mshr_->insertWriteback(line->getAddr(), true);
                     if (is_debug_addr(addr) || is_debug_addr(line->getAddr()))
@@ -1946,7 +1946,7 @@ bool MESIPrivNoninclusive::handleEviction(Addr addr, PrivateCacheLine*& line, db
                     if (is_debug_addr(line->getAddr()))
                         printDebugAlloc(false, line->getAddr(), "Writeback");
                 } else if (!line->getOwned()) {
-                    uint64_t sendTime = sendWriteback(line->getAddr(), lineSize_, Command::PutM, line->getData(), true, line->getTimestamp());
+                    uint64_t sendTime = sendWriteback(line->getAddr(), lineSize_, Command::PutM, line->getDataBuffer(), true, line->getTimestamp());
                     line->setTimestamp(sendTime-1);
                     mshr_->insertWriteback(line->getAddr(), false);
                     if (is_debug_addr(addr) || is_debug_addr(line->getAddr())) {
@@ -2098,7 +2098,7 @@ void MESIPrivNoninclusive::retry(Addr addr) {
  * Protocol helper functions
  ***********************************************************************************************************/
 
-uint64_t MESIPrivNoninclusive::sendExclusiveResponse(MemEvent * event, vector<uint8_t>* data, bool inMSHR, uint64_t time, bool dirty) {
+uint64_t MESIPrivNoninclusive::sendExclusiveResponse(MemEvent * event, const PayloadBuffer* data, bool inMSHR, uint64_t time, bool dirty) {
     MemEvent * responseEvent = event->makeResponse();
     responseEvent->setCmd(Command::GetXResp);
     
@@ -2106,7 +2106,7 @@ uint64_t MESIPrivNoninclusive::sendExclusiveResponse(MemEvent * event, vector<ui
         responseEvent->setPayload(*data);
         responseEvent->setSize(data->size()); // Return size that was written
         if (is_debug_event(event)) {
-            printData(data, false);
+            printData(&data->read(), false);
         }
         responseEvent->setDirty(dirty);
     }
@@ -2127,7 +2127,7 @@ uint64_t MESIPrivNoninclusive::sendExclusiveResponse(MemEvent * event, vector<ui
     return deliveryTime;
 }
 
-uint64_t MESIPrivNoninclusive::sendResponseUp(MemEvent * event, vector<uint8_t> * data, bool inMSHR, uint64_t time, Command cmd, bool success) {
+uint64_t MESIPrivNoninclusive::sendResponseUp(MemEvent * event, const PayloadBuffer* data, bool inMSHR, uint64_t time, Command cmd, bool success) {
     MemEvent * responseEvent = event->makeResponse();
     if (cmd != Command::NULLCMD)
         responseEvent->setCmd(cmd);
@@ -2136,7 +2136,7 @@ uint64_t MESIPrivNoninclusive::sendResponseUp(MemEvent * event, vector<uint8_t>
         responseEvent->setPayload(*data);
         responseEvent->setSize(data->size()); // Return size that was written
         if (is_debug_event(event)) {
-            printData(data, false);
+            printData(&data->read(), false);
         }
     }
 
@@ -2160,7 +2160,7 @@ uint64_t MESIPrivNoninclusive::sendResponseUp(MemEvent * event, vector<uint8_t>
     return deliveryTime;
 }
 
-void MESIPrivNoninclusive::sendResponseDown(MemEvent * event, uint32_t size, vector<uint8_t>* data, bool dirty) {
+void MESIPrivNoninclusive::sendResponseDown(MemEvent * event, uint32_t size, const PayloadBuffer* data, bool dirty) {
     MemEvent * responseEvent = event->makeResponse();
 
     if (data) {
@@ -2182,7 +2182,7 @@ void MESIPrivNoninclusive::sendResponseDown(MemEvent * event, uint32_t size, vec
 }
 
 
-uint64_t MESIPrivNoninclusive::forwardFlush(MemEvent * event, bool evict, std::vector<uint8_t>* data, bool dirty, uint64_t time) {
+uint64_t MESIPrivNoninclusive::forwardFlush(MemEvent * event, bool evict, const PayloadBuffer* data, bool dirty, uint64_t time) {
     MemEvent * flush = new MemEvent(*event);
 
     flush->setSrc(cachename_);
@@ -2225,7 +2225,7 @@ uint64_t MESIPrivNoninclusive::forwardFlush(MemEvent * event, bool evict, std::v
  *  Latency: cache access + tag to read data that is being written back and update coherence state
  */
 
-uint64_t MESIPrivNoninclusive::sendWriteback(Addr addr, uint32_t size, Command cmd, std::vector<uint8_t>* data, bool dirty, uint64_t startTime) {
+uint64_t MESIPrivNoninclusive::sendWriteback(Addr addr, uint32_t size, Command cmd, const PayloadBuffer* data, bool dirty, uint64_t startTime) {
     MemEvent* writeback = new MemEvent(cachename_, addr, addr, cmd);
     writeback->setDst(getDestination(addr));
     writeback->setSize(size);
@@ -2238,7 +2238,7 @@ uint64_t MESIPrivNoninclusive::sendWriteback(Addr addr, uint32_t size, Command c
         writeback->setDirty(dirty);
 
         if (is_debug_addr(addr)) {
-            printData(data, false);
+            printData(&data->read(), false);
         }
         
         latency = accessLatency_;
@@ -2300,12 +2300,12 @@ void MESIPrivNoninclusive::sendWritebackAck(MemEvent * event) {
  *  Override message send functions with versions that record statistics & call parent class
  *---------------------------------------------------------------------------------------------------------------------*/
 void MESIPrivNoninclusive::addToOutgoingQueue(Response& resp) {
-    stat_eventSent[(int)resp.event->getCmd()]->addData(1);
+    stat_eventSent[(int)resp.event->getCmd()].addData(1);
     CoherenceController::addToOutgoingQueue(resp);
 }
 
 void MESIPrivNoninclusive::addToOutgoingQueueUp(Response& resp) {
-    stat_eventSent[(int)resp.event->getCmd()]->addData(1);
+    stat_eventSent[(int)resp.event->getCmd()].addData(1);
     CoherenceController::addToOutgoingQueueUp(resp);
 }
 
@@ -2329,7 +2329,7 @@ void MESIPrivNoninclusive::printLine(Addr addr) {
     debug->debug(_L8_, "  Line 0x%" PRIx64 ": %s\n", addr, state.c_str());
 }
 
-void MESIPrivNoninclusive::printData(vector<uint8_t> * data, bool set) {
+void MESIPrivNoninclusive::printData(const vector<uint8_t> * data, bool set) {
 /*    if (set)    printf("Setting data (%zu): 0x", data->size());
     else        printf("Getting data (%zu): 0x", data->size());
     
@@ -2339,6 +2339,12 @@ void MESIPrivNoninclusive::printData(vector<uint8_t> * data, bool set) {
     printf("\n");*/
 }
    
+void MESIPrivNoninclusive::visitStatCounters(const StatCounterVisitor& visit) {
+    CoherenceController::visitStatCounters(visit);
+    SST::MemHierarchy::visitStatCounters(stat_hit, visit);
+    SST::MemHierarchy::visitStatCounters(stat_miss, visit);
+}
+
 void MESIPrivNoninclusive::recordLatency(Command cmd, int type, uint64_t latency) {
     if (type == -1)
         return;
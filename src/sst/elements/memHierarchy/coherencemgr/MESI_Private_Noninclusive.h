@@ -438,6 +438,7 @@ public:
     virtual bool handleNACK(MemEvent* event, bool inMSHR);
 
     virtual Addr getBank(Addr addr) { return cacheArray_->getBank(addr); }
+    virtual bool isCached(Addr addr) { PrivateCacheLine* line = cacheArray_->lookup(addr, false); return line && line->getState() != I; }
     virtual void setSliceAware(uint64_t size, uint64_t step) { cacheArray_->setSliceAware(size, step); }
 
     /* Initialization */
@@ -483,20 +484,20 @@ private:
     void retry(Addr addr);
     
     /** Forward a flush line request, with or without data */
-    uint64_t forwardFlush(MemEvent* event, bool evict, std::vector<uint8_t>* data, bool dirty, uint64_t time);
+    uint64_t forwardFlush(MemEvent* event, bool evict, const PayloadBuffer* data, bool dirty, uint64_t time);
 
     /** Forward a request */
     uint64_t sendFwdRequest(MemEvent * event, Command cmd, std::string dst, uint32_t size, uint64_t startTime, bool inMSHR);
 
     /** Send response up (to processor) */
-    uint64_t sendResponseUp(MemEvent * event, vector<uint8_t>* data, bool inMSHR, uint64_t baseTime, Command cmd = Command::GetSResp, bool success = false);
-    uint64_t sendExclusiveResponse(MemEvent * event, vector<uint8_t>* data, bool inMSHR, uint64_t baseTime, bool dirty);
+    uint64_t sendResponseUp(MemEvent * event, const PayloadBuffer* data, bool inMSHR, uint64_t baseTime, Command cmd = Command::GetSResp, bool success = false);
+    uint64_t sendExclusiveResponse(MemEvent * event, const PayloadBuffer* data, bool inMSHR, uint64_t baseTime, bool dirty);
     
     /** Send response down (towards memory) */
-    void sendResponseDown(MemEvent * event, uint32_t size, vector<uint8_t>* data, bool dirty);
+    void sendResponseDown(MemEvent * event, uint32_t size, const PayloadBuffer* data, bool dirty);
     
     /** Send writeback request to lower level caches */
-    uint64_t sendWriteback(Addr addr, uint32_t size, Command cmd, std::vector<uint8_t>* data, bool dirty, uint64_t time = 0);
+    uint64_t sendWriteback(Addr addr, uint32_t size, Command cmd, const PayloadBuffer* data, bool dirty, uint64_t time = 0);
     
     void sendWritebackAck(MemEvent * event);
 
@@ -509,11 +510,12 @@ private:
     void addToOutgoingQueueUp(Response& resp);
 
 /* Miscellaneous */
-    void printData(vector<uint8_t> * data, bool set);
+    void printData(const vector<uint8_t> * data, bool set);
     void printLine(Addr addr);
 
 /* Statistics */
     void recordLatency(Command cmd, int type, uint64_t latency);
+    void visitStatCounters(const StatCounterVisitor& visit);
     
 /* Private data members */
     CacheArray<PrivateCacheLine> * cacheArray_; // Cache array
@@ -530,8 +532,8 @@ private:
     Statistic<uint64_t>* stat_latencyGetSX[4];
     Statistic<uint64_t>* stat_latencyFlushLine;
     Statistic<uint64_t>* stat_latencyFlushLineInv;
-    Statistic<uint64_t>* stat_hit[3][2];
-    Statistic<uint64_t>* stat_miss[3][2];
+    StatCounter stat_hit[3][2];
+    StatCounter stat_miss[3][2];
 
 };
 
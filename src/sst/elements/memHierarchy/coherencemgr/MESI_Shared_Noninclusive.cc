@@ -66,8 +66,8 @@ bool MESISharNoninclusive::handleGetS(MemEvent* event, bool inMSHR) {
                 }
 
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::GetS][state]->addData(1);
-                    stat_miss[0][inMSHR]->addData(1);
+                    stat_eventState[(int)Command::GetS][state].addData(1);
+                    stat_miss[0][inMSHR].addData(1);
                     notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::MISS);
                     mshr_->setProfiled(addr);
                 }
@@ -83,8 +83,8 @@ bool MESISharNoninclusive::handleGetS(MemEvent* event, bool inMSHR) {
             break;
         case S:
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::GetS][S]->addData(1);
-                stat_hit[0][inMSHR]->addData(1);
+                stat_eventState[(int)Command::GetS][S].addData(1);
+                stat_hit[0][inMSHR].addData(1);
                 notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT);
                 if (inMSHR) mshr_->setProfiled(addr);
             }
@@ -93,7 +93,7 @@ bool MESISharNoninclusive::handleGetS(MemEvent* event, bool inMSHR) {
                 eventDI.reason = "hit";
 
             if (localPrefetch) {
-                statPrefetchRedundant->addData(1);
+                statPrefetchRedundant.addData(1);
                 recordPrefetchLatency(event->getID(), LatType::HIT);
                 if (is_debug_event(event))
                     eventDI.action = "Done";
@@ -108,7 +108,7 @@ bool MESISharNoninclusive::handleGetS(MemEvent* event, bool inMSHR) {
                 if (mshr_->hasData(addr))
                     sendTime = sendResponseUp(event, &(mshr_->getData(addr)), inMSHR, tag->getTimestamp());
                 else
-                    sendTime = sendResponseUp(event, data->getData(), inMSHR, tag->getTimestamp());
+                    sendTime = sendResponseUp(event, data->getDataBuffer(), inMSHR, tag->getTimestamp());
                 tag->setTimestamp(sendTime-1);
                 recordLatencyType(event->getID(), LatType::HIT);
                 cleanUpAfterRequest(event, inMSHR);
@@ -132,8 +132,8 @@ bool MESISharNoninclusive::handleGetS(MemEvent* event, bool inMSHR) {
         case E:
         case M:
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::GetS][state]->addData(1);
-                stat_hit[0][inMSHR]->addData(1);
+                stat_eventState[(int)Command::GetS][state].addData(1);
+                stat_hit[0][inMSHR].addData(1);
                 notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT);
                 if (inMSHR) mshr_->setProfiled(addr);
             }
@@ -142,7 +142,7 @@ bool MESISharNoninclusive::handleGetS(MemEvent* event, bool inMSHR) {
                 eventDI.reason = "hit";
 
             if (localPrefetch) {
-                statPrefetchRedundant->addData(1);
+                statPrefetchRedundant.addData(1);
                 recordPrefetchLatency(event->getID(), LatType::HIT);
                 cleanUpAfterRequest(event, inMSHR);
                 break;
@@ -175,7 +175,7 @@ bool MESISharNoninclusive::handleGetS(MemEvent* event, bool inMSHR) {
                 if (mshr_->hasData(addr))
                     sendTime = sendResponseUp(event, &(mshr_->getData(addr)), inMSHR, tag->getTimestamp(), respcmd);
                 else
-                    sendTime = sendResponseUp(event, data->getData(), inMSHR, tag->getTimestamp(), respcmd);
+                    sendTime = sendResponseUp(event, data->getDataBuffer(), inMSHR, tag->getTimestamp(), respcmd);
                 tag->setTimestamp(sendTime - 1);
                 cleanUpAfterRequest(event, inMSHR);
             } else {
@@ -245,8 +245,8 @@ bool MESISharNoninclusive::handleGetX(MemEvent * event, bool inMSHR) {
                 tag = dirArray_->lookup(addr, false);
 
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)event->getCmd()][I]->addData(1);
-                    stat_miss[(event->getCmd() == Command::GetX ? 1 : 2)][inMSHR]->addData(1);
+                    stat_eventState[(int)event->getCmd()][I].addData(1);
+                    stat_miss[(event->getCmd() == Command::GetX ? 1 : 2)][inMSHR].addData(1);
                     notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::MISS);
                     mshr_->setProfiled(addr);
                 }
@@ -264,8 +264,8 @@ bool MESISharNoninclusive::handleGetX(MemEvent * event, bool inMSHR) {
 
                 if (status == MemEventStatus::OK) {
                     if (!mshr_->getProfiled(addr)) {
-                        stat_eventState[(int)event->getCmd()][S]->addData(1);
-                        stat_miss[(event->getCmd() == Command::GetX ? 1 : 2)][inMSHR]->addData(1);
+                        stat_eventState[(int)event->getCmd()][S].addData(1);
+                        stat_miss[(event->getCmd() == Command::GetX ? 1 : 2)][inMSHR].addData(1);
                         notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::MISS);
                         mshr_->setProfiled(addr);
                     }
@@ -294,8 +294,8 @@ bool MESISharNoninclusive::handleGetX(MemEvent * event, bool inMSHR) {
                     eventDI.reason = "hit";
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
                     notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::HIT);
-                    stat_eventState[(int)event->getCmd()][state]->addData(1);
-                    stat_hit[(event->getCmd() == Command::GetX ? 1 : 2)][inMSHR]->addData(1);
+                    stat_eventState[(int)event->getCmd()][state].addData(1);
+                    stat_hit[(event->getCmd() == Command::GetX ? 1 : 2)][inMSHR].addData(1);
                 }
                 tag->setOwner(event->getSrc());
                 if (tag->isSharer(event->getSrc())) {
@@ -304,7 +304,7 @@ bool MESISharNoninclusive::handleGetX(MemEvent * event, bool inMSHR) {
                 } else if (mshr_->hasData(addr))
                     sendTime = sendResponseUp(event, &(mshr_->getData(addr)), inMSHR, tag->getTimestamp(), Command::GetXResp);
                 else
-                    sendTime = sendResponseUp(event, data->getData(), inMSHR, tag->getTimestamp(), Command::GetXResp);
+                    sendTime = sendResponseUp(event, data->getDataBuffer(), inMSHR, tag->getTimestamp(), Command::GetXResp);
                 tag->setTimestamp(sendTime - 1);
                 recordLatencyType(event->getID(), LatType::HIT);
                 cleanUpAfterRequest(event, inMSHR);
@@ -315,8 +315,8 @@ bool MESISharNoninclusive::handleGetX(MemEvent * event, bool inMSHR) {
             if (status == MemEventStatus::OK) {
                 if (!mshr_->getProfiled(addr)) {
                     notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::HIT);
-                    stat_eventState[(int)event->getCmd()][state]->addData(1);
-                    stat_hit[(event->getCmd() == Command::GetX ? 1 : 2)][inMSHR]->addData(1);
+                    stat_eventState[(int)event->getCmd()][state].addData(1);
+                    stat_hit[(event->getCmd() == Command::GetX ? 1 : 2)][inMSHR].addData(1);
                     mshr_->setProfiled(addr);
                 }
                 recordLatencyType(event->getID(), LatType::INV);
@@ -388,7 +388,7 @@ bool MESISharNoninclusive::handleFlushLine(MemEvent* event, bool inMSHR) {
         case I:
             if (status == MemEventStatus::OK) {
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::FlushLine][state]->addData(1);
+                    stat_eventState[(int)Command::FlushLine][state].addData(1);
                     mshr_->setProfiled(addr);
                 }
                 // event, evict, *data, dirty, time)
@@ -399,7 +399,7 @@ bool MESISharNoninclusive::handleFlushLine(MemEvent* event, bool inMSHR) {
         case S:
             if (status == MemEventStatus::OK) {
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::FlushLine][state]->addData(1);
+                    stat_eventState[(int)Command::FlushLine][state].addData(1);
                     mshr_->setProfiled(addr);
                 }
                 forwardFlush(event, false, nullptr, false, tag->getTimestamp());
@@ -411,7 +411,7 @@ bool MESISharNoninclusive::handleFlushLine(MemEvent* event, bool inMSHR) {
         case M:
             if (status == MemEventStatus::OK) {
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::FlushLine][state]->addData(1);
+                    stat_eventState[(int)Command::FlushLine][state].addData(1);
                     mshr_->setProfiled(addr);
                 }
                 if (event->getEvict()) {
@@ -425,7 +425,7 @@ bool MESISharNoninclusive::handleFlushLine(MemEvent* event, bool inMSHR) {
                     break;
                 }
                 if (data)
-                    forwardFlush(event, true, data->getData(), tag->getState() == M, tag->getTimestamp());
+                    forwardFlush(event, true, data->getDataBuffer(), tag->getState() == M, tag->getTimestamp());
                 else
                     forwardFlush(event, true, &(mshr_->getData(addr)), tag->getState() == M, tag->getTimestamp());
                 tag->getState() == E ? tag->setState(E_B) : tag->setState(M_B);
@@ -495,7 +495,7 @@ bool MESISharNoninclusive::handleFlushLineInv(MemEvent* event, bool inMSHR) {
                 forwardFlush(event, false, nullptr, false, 0);
                 mshr_->setInProgress(addr);
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::FlushLineInv][I]->addData(1);
+                    stat_eventState[(int)Command::FlushLineInv][I].addData(1);
                     mshr_->setProfiled(addr);
                 }
             }
@@ -503,7 +503,7 @@ bool MESISharNoninclusive::handleFlushLineInv(MemEvent* event, bool inMSHR) {
         case S:
             if (status == MemEventStatus::OK) {
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::FlushLineInv][S]->addData(1);
+                    stat_eventState[(int)Command::FlushLineInv][S].addData(1);
                     mshr_->setProfiled(addr);
                 }
                 if (event->getEvict()) {
@@ -517,7 +517,7 @@ bool MESISharNoninclusive::handleFlushLineInv(MemEvent* event, bool inMSHR) {
                 }
 
                 if (data)
-                    forwardFlush(event, true, data->getData(), false, tag->getTimestamp());
+                    forwardFlush(event, true, data->getDataBuffer(), false, tag->getTimestamp());
                 else
                     forwardFlush(event, true, &(mshr_->getData(addr)), false, tag->getTimestamp());
                 mshr_->setInProgress(addr);
@@ -528,7 +528,7 @@ bool MESISharNoninclusive::handleFlushLineInv(MemEvent* event, bool inMSHR) {
         case M:
             if (status == MemEventStatus::OK) {
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::FlushLineInv][state]->addData(1);
+                    stat_eventState[(int)Command::FlushLineInv][state].addData(1);
                     mshr_->setProfiled(addr);
                 }
                 if (event->getEvict()) {
@@ -547,7 +547,7 @@ bool MESISharNoninclusive::handleFlushLineInv(MemEvent* event, bool inMSHR) {
                     tag->getState() == E ? tag->setState(E_Inv) : tag->setState(M_Inv);
                 } else {
                     if (data)
-                        forwardFlush(event, true, data->getData(), tag->getState() == M, tag->getTimestamp());
+                        forwardFlush(event, true, data->getDataBuffer(), tag->getState() == M, tag->getTimestamp());
                     else
                         forwardFlush(event, true, &(mshr_->getData(addr)), tag->getState() == M, tag->getTimestamp());
                     mshr_->setInProgress(addr);
@@ -636,7 +636,7 @@ bool MESISharNoninclusive::handlePutS(MemEvent * event, bool inMSHR) {
                 status = processDataMiss(event, tag, data, true);
                 if (status != MemEventStatus::OK) {
                     if (!mshr_->getProfiled(addr)) {
-                        stat_eventState[(int)Command::PutS][I]->addData(1);
+                        stat_eventState[(int)Command::PutS][I].addData(1);
                         mshr_->setProfiled(addr);
                     }
                     if (state == S) tag->setState(SA);
@@ -645,11 +645,11 @@ bool MESISharNoninclusive::handlePutS(MemEvent * event, bool inMSHR) {
                     break;
                 }
                 data = dataArray_->lookup(addr, true);
-                data->setData(event->getPayload(), 0);
+                data->setData(event->getPayloadBuffer(), 0);
                 inMSHR = true;
             }
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::PutS][I]->addData(1);
+                stat_eventState[(int)Command::PutS][I].addData(1);
             }
             tag->removeSharer(event->getSrc());
             sendWritebackAck(event);
@@ -664,7 +664,7 @@ bool MESISharNoninclusive::handlePutS(MemEvent * event, bool inMSHR) {
                 tag->setState(NextState[state]);
             sendWritebackAck(event);
             if (inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::PutS][state]->addData(1);
+                stat_eventState[(int)Command::PutS][state].addData(1);
             }
             cleanUpAfterRequest(event, inMSHR);
             break;
@@ -678,7 +678,7 @@ bool MESISharNoninclusive::handlePutS(MemEvent * event, bool inMSHR) {
             tag->removeSharer(event->getSrc());
             sendWritebackAck(event);
             if (inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::PutS][state]->addData(1);
+                stat_eventState[(int)Command::PutS][state].addData(1);
             }
             cleanUpEvent(event, inMSHR);
             break;
@@ -689,7 +689,7 @@ bool MESISharNoninclusive::handlePutS(MemEvent * event, bool inMSHR) {
             if (event->getSrc() == *(tag->getSharers()->begin())) { // Sent fetch to this requestor
                 // Retry the pending fetch
                 mshr_->decrementAcksNeeded(addr);
-                mshr_->setData(addr, event->getPayload());
+                mshr_->setData(addr, event->getPayloadBuffer());
                 responses.find(addr)->second.erase(event->getSrc());
                 if (responses.find(addr)->second.empty())
                     responses.erase(addr);
@@ -701,7 +701,7 @@ bool MESISharNoninclusive::handlePutS(MemEvent * event, bool inMSHR) {
                     tag->removeSharer(event->getSrc());
                     sendWritebackAck(event);
                     if (inMSHR || !mshr_->getProfiled(addr)) {
-                        stat_eventState[(int)Command::PutS][state]->addData(1);
+                        stat_eventState[(int)Command::PutS][state].addData(1);
                     }
                     cleanUpEvent(event, inMSHR);
                 } else {
@@ -718,7 +718,7 @@ bool MESISharNoninclusive::handlePutS(MemEvent * event, bool inMSHR) {
             tag->removeSharer(event->getSrc());
             sendWritebackAck(event);
             if (inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::PutS][state]->addData(1);
+                stat_eventState[(int)Command::PutS][state].addData(1);
             }
             cleanUpEvent(event, inMSHR);
             break;
@@ -765,20 +765,20 @@ bool MESISharNoninclusive::handlePutE(MemEvent * event, bool inMSHR) {
                 status = processDataMiss(event, tag, data, true);
                 if (status != MemEventStatus::OK) {
                     if (!inMSHR || !mshr_->getProfiled(addr)) {
-                        stat_eventState[(int)Command::PutE][state]->addData(1);
+                        stat_eventState[(int)Command::PutE][state].addData(1);
                         mshr_->setProfiled(addr);
                     }
                     state == E ? tag->setState(EA) : tag->setState(MA);
                     break;
                 }
                 data = dataArray_->lookup(addr, true);
-                data->setData(event->getPayload(), 0);
+                data->setData(event->getPayloadBuffer(), 0);
                 inMSHR = true;
             }
             tag->removeOwner();
             sendWritebackAck(event);
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::PutE][state]->addData(1);
+                stat_eventState[(int)Command::PutE][state].addData(1);
             }
             cleanUpAfterRequest(event, inMSHR);
             break;
@@ -787,7 +787,7 @@ bool MESISharNoninclusive::handlePutE(MemEvent * event, bool inMSHR) {
             tag->removeOwner();
             mshr_->decrementAcksNeeded(addr);
             if (!data && !mshr_->hasData(addr))
-                mshr_->setData(addr, event->getPayload());
+                mshr_->setData(addr, event->getPayloadBuffer());
             responses.find(addr)->second.erase(event->getSrc());
             if (responses.find(addr)->second.empty())
                 responses.erase(addr);
@@ -797,7 +797,7 @@ bool MESISharNoninclusive::handlePutE(MemEvent * event, bool inMSHR) {
                 sendWritebackAck(event);
                 cleanUpEvent(event, inMSHR);
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::PutE][state]->addData(1);
+                    stat_eventState[(int)Command::PutE][state].addData(1);
                 }
             } else {
                 tag->addSharer(event->getSrc());
@@ -817,7 +817,7 @@ bool MESISharNoninclusive::handlePutE(MemEvent * event, bool inMSHR) {
             tag->removeOwner();
             mshr_->decrementAcksNeeded(addr);
             if (!data && !mshr_->hasData(addr))
-                mshr_->setData(addr, event->getPayload());
+                mshr_->setData(addr, event->getPayloadBuffer());
             responses.find(addr)->second.erase(event->getSrc());
             if (responses.find(addr)->second.empty())
                 responses.erase(addr);
@@ -825,7 +825,7 @@ bool MESISharNoninclusive::handlePutE(MemEvent * event, bool inMSHR) {
             tag->setState(NextState[state]);
             cleanUpAfterRequest(event, inMSHR);
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::PutE][state]->addData(1);
+                stat_eventState[(int)Command::PutE][state].addData(1);
             }
             break;
         default:
@@ -867,7 +867,7 @@ bool MESISharNoninclusive::handlePutM(MemEvent * event, bool inMSHR) {
                 if (status != MemEventStatus::OK)
                     break;
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::PutM][state]->addData(1);
+                    stat_eventState[(int)Command::PutM][state].addData(1);
                     mshr_->setProfiled(addr);
                 }
                 status = processDataMiss(event, tag, data, true);
@@ -876,10 +876,10 @@ bool MESISharNoninclusive::handlePutM(MemEvent * event, bool inMSHR) {
                     break;
                 }
                 data = dataArray_->lookup(addr, true);
-                data->setData(event->getPayload(), 0);
+                data->setData(event->getPayloadBuffer(), 0);
                 inMSHR = true;
             } else if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::PutM][state]->addData(1);
+                stat_eventState[(int)Command::PutM][state].addData(1);
             }
             if (is_debug_event(event))
                 eventDI.reason = "hit";
@@ -901,15 +901,15 @@ bool MESISharNoninclusive::handlePutM(MemEvent * event, bool inMSHR) {
             // Handle PutM now if possible, later if not
             if (data) {
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::PutM][state]->addData(1);
+                    stat_eventState[(int)Command::PutM][state].addData(1);
                 }
-                data->setData(event->getPayload(), 0);
+                data->setData(event->getPayloadBuffer(), 0);
                 sendWritebackAck(event);
                 cleanUpEvent(event, inMSHR);
             } else {
                 tag->addSharer(event->getSrc());
                 event->setCmd(Command::PutS);
-                mshr_->setData(addr, event->getPayload());
+                mshr_->setData(addr, event->getPayloadBuffer());
                 if (inMSHR)
                     mshr_->removeFront(addr); // Need to reinsert after the conflicting request
                 MemEventBase* entry = mshr_->getEntryEvent(addr, 1);
@@ -924,13 +924,13 @@ bool MESISharNoninclusive::handlePutM(MemEvent * event, bool inMSHR) {
         case E_Inv:
         case M_Inv:
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::PutM][state]->addData(1);
+                stat_eventState[(int)Command::PutM][state].addData(1);
             }
             // Handle the coherence state part and buffer the data in the MSHR, we won't need a line because we're either losing the data or one of our children wants it
             tag->removeOwner();
             mshr_->decrementAcksNeeded(addr);
             if (!data && !mshr_->hasData(addr))
-                mshr_->setData(addr, event->getPayload());
+                mshr_->setData(addr, event->getPayloadBuffer());
             responses.find(addr)->second.erase(event->getSrc());
             if (responses.find(addr)->second.empty())
                 responses.erase(addr);
@@ -974,7 +974,7 @@ bool MESISharNoninclusive::handlePutX(MemEvent * event, bool inMSHR) {
     sendWritebackAck(event);
             
     if (!inMSHR || !mshr_->getProfiled(addr)) {
-        stat_eventState[(int)Command::PutX][state]->addData(1);
+        stat_eventState[(int)Command::PutX][state].addData(1);
     }
 
     switch (state) {
@@ -984,7 +984,7 @@ bool MESISharNoninclusive::handlePutX(MemEvent * event, bool inMSHR) {
                 tag->setState(M);
             
             if (data)
-                data->setData(event->getPayload(), 0);
+                data->setData(event->getPayloadBuffer(), 0);
     
             cleanUpAfterRequest(event, inMSHR);
             break;
@@ -996,9 +996,9 @@ bool MESISharNoninclusive::handlePutX(MemEvent * event, bool inMSHR) {
                 tag->setState(E);
             
             if (data)
-                data->setData(event->getPayload(), 0);
+                data->setData(event->getPayloadBuffer(), 0);
             else
-                mshr_->setData(addr, event->getPayload());
+                mshr_->setData(addr, event->getPayloadBuffer());
             
             mshr_->decrementAcksNeeded(addr);
             
@@ -1010,9 +1010,9 @@ bool MESISharNoninclusive::handlePutX(MemEvent * event, bool inMSHR) {
                 tag->setState(M_Inv);
             
             if (data)
-                data->setData(event->getPayload(), 0);
+                data->setData(event->getPayloadBuffer(), 0);
             else 
-                mshr_->setData(addr, event->getPayload());
+                mshr_->setData(addr, event->getPayloadBuffer());
             
             cleanUpEvent(event, inMSHR);
             break;
@@ -1053,15 +1053,15 @@ bool MESISharNoninclusive::handleFetch(MemEvent * event, bool inMSHR) {
         case I_B: // Happens if we sent a FlushLineInv and it raced with a Fetch
         case E_B: // Happens if we sent a FlushLine and it raced with Fetch
         case M_B: // Happens if we sent a FlushLine and it raced with Fetch
-            stat_eventState[(int)Command::Fetch][state]->addData(1);
+            stat_eventState[(int)Command::Fetch][state].addData(1);
             delete event;
             break;
         case S:
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::Fetch][state]->addData(1);
+                stat_eventState[(int)Command::Fetch][state].addData(1);
             }
             if (data) {
-                sendResponseDown(event, data->getData(), false, false);
+                sendResponseDown(event, data->getDataBuffer(), false, false);
                 cleanUpEvent(event, inMSHR);
             } else if (mshr_->hasData(addr)) {
                 sendResponseDown(event, &(mshr_->getData(addr)), false, false);
@@ -1079,16 +1079,16 @@ bool MESISharNoninclusive::handleFetch(MemEvent * event, bool inMSHR) {
         case SA:
             //Look for a PutS in the MSHR
             put = static_cast<MemEvent*>(mshr_->getFirstEventEntry(addr, Command::PutS)); 
-            sendResponseDown(event, &(put->getPayload()), false, false);
-            stat_eventState[(int)Command::Fetch][state]->addData(1);
+            sendResponseDown(event, &(put->getPayloadBuffer()), false, false);
+            stat_eventState[(int)Command::Fetch][state].addData(1);
             cleanUpEvent(event, inMSHR);
             break;
         case SM:
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::Fetch][state]->addData(1);
+                stat_eventState[(int)Command::Fetch][state].addData(1);
             }
             if (data) {
-                sendResponseDown(event, data->getData(), false, false);
+                sendResponseDown(event, data->getDataBuffer(), false, false);
                 cleanUpEvent(event, inMSHR);
             } else if (mshr_->hasData(addr)) {
                 sendResponseDown(event, &(mshr_->getData(addr)), false, false);
@@ -1109,10 +1109,10 @@ bool MESISharNoninclusive::handleFetch(MemEvent * event, bool inMSHR) {
             break;
         case S_B:
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::Fetch][state]->addData(1);
+                stat_eventState[(int)Command::Fetch][state].addData(1);
             }
             if (data) {
-                sendResponseDown(event, data->getData(), false, false);
+                sendResponseDown(event, data->getDataBuffer(), false, false);
                 cleanUpEvent(event, inMSHR);
             } else if (mshr_->hasData(addr)) {
                 sendResponseDown(event, &(mshr_->getData(addr)), false, false);
@@ -1166,7 +1166,7 @@ bool MESISharNoninclusive::handleInv(MemEvent * event, bool inMSHR) {
             if (data)
                 dataArray_->deallocate(data);
         case I:
-            stat_eventState[(int)Command::Inv][state]->addData(1);
+            stat_eventState[(int)Command::Inv][state].addData(1);
             delete event;
             break;
         case S:
@@ -1176,7 +1176,7 @@ bool MESISharNoninclusive::handleInv(MemEvent * event, bool inMSHR) {
             if (status == MemEventStatus::OK) {
                 if (!mshr_->getProfiled(addr)) {
                     recordPrefetchResult(tag, statPrefetchInv);
-                    stat_eventState[(int)Command::Inv][state]->addData(1);
+                    stat_eventState[(int)Command::Inv][state].addData(1);
                     mshr_->setProfiled(addr);
                 }
 
@@ -1204,7 +1204,7 @@ bool MESISharNoninclusive::handleInv(MemEvent * event, bool inMSHR) {
             if (mshr_->hasData(addr))
                 mshr_->clearData(addr);
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::Inv][state]->addData(1);
+                stat_eventState[(int)Command::Inv][state].addData(1);
             }
             cleanUpEvent(event, inMSHR);
             cleanUpAfterRequest(put, true);
@@ -1218,7 +1218,7 @@ bool MESISharNoninclusive::handleInv(MemEvent * event, bool inMSHR) {
                 status = allocateMSHR(event, true, 0);
                 if (status == MemEventStatus::OK) {
                     mshr_->setProfiled(addr);
-                    stat_eventState[(int)Command::Inv][state]->addData(1);
+                    stat_eventState[(int)Command::Inv][state].addData(1);
                 }
             }
             break;
@@ -1228,7 +1228,7 @@ bool MESISharNoninclusive::handleInv(MemEvent * event, bool inMSHR) {
 
             if (status == MemEventStatus::OK) {
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::Inv][state]->addData(1);
+                    stat_eventState[(int)Command::Inv][state].addData(1);
                 }
                 if (tag->hasSharers()) {
                     invalidateSharers(event, tag, inMSHR, false, Command::Inv);
@@ -1248,7 +1248,7 @@ bool MESISharNoninclusive::handleInv(MemEvent * event, bool inMSHR) {
                 status = allocateMSHR(event, true, 0);
                 if (status == MemEventStatus::OK) {
                     mshr_->setProfiled(addr);
-                    stat_eventState[(int)Command::Inv][state]->addData(1);
+                    stat_eventState[(int)Command::Inv][state].addData(1);
                 }
             }
             break;
@@ -1258,7 +1258,7 @@ bool MESISharNoninclusive::handleInv(MemEvent * event, bool inMSHR) {
 
             if (status == MemEventStatus::OK) {
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::Inv][state]->addData(1);
+                    stat_eventState[(int)Command::Inv][state].addData(1);
                 }
                 if (tag->hasSharers()) {
                     invalidateSharers(event, tag, inMSHR, false, Command::Inv);
@@ -1315,7 +1315,7 @@ bool MESISharNoninclusive::handleForceInv(MemEvent * event, bool inMSHR) {
             if (data)
                 dataArray_->deallocate(data);
         case I:
-            stat_eventState[(int)Command::ForceInv][state]->addData(1);
+            stat_eventState[(int)Command::ForceInv][state].addData(1);
             delete event;
             break;
         case S:
@@ -1325,7 +1325,7 @@ bool MESISharNoninclusive::handleForceInv(MemEvent * event, bool inMSHR) {
             if (status == MemEventStatus::OK) {
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
                     recordPrefetchResult(tag, statPrefetchInv);
-                    stat_eventState[(int)Command::ForceInv][state]->addData(1);
+                    stat_eventState[(int)Command::ForceInv][state].addData(1);
                     if (tag->hasSharers()) mshr_->setProfiled(addr);
                 }
                 if (tag->hasSharers()) {
@@ -1351,7 +1351,7 @@ bool MESISharNoninclusive::handleForceInv(MemEvent * event, bool inMSHR) {
 
             if (status == MemEventStatus::OK) {
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::ForceInv][state]->addData(1);
+                    stat_eventState[(int)Command::ForceInv][state].addData(1);
                     recordPrefetchResult(tag, statPrefetchInv);
                 }
                 if (tag->hasSharers()) {
@@ -1384,7 +1384,7 @@ bool MESISharNoninclusive::handleForceInv(MemEvent * event, bool inMSHR) {
 
             if (status == MemEventStatus::OK) {
                 if (!inMSHR || !mshr_->getProfiled(addr))  {
-                    stat_eventState[(int)Command::ForceInv][state]->addData(1);
+                    stat_eventState[(int)Command::ForceInv][state].addData(1);
                 }
                 if (tag->hasSharers()) {
                     invalidateSharers(event, tag, inMSHR, false, Command::ForceInv);
@@ -1417,7 +1417,7 @@ bool MESISharNoninclusive::handleForceInv(MemEvent * event, bool inMSHR) {
                     status = allocateMSHR(event, true, 0);
                     if (status == MemEventStatus::OK) {
                         mshr_->setProfiled(addr);
-                        stat_eventState[(int)Command::ForceInv][state]->addData(1);
+                        stat_eventState[(int)Command::ForceInv][state].addData(1);
                     }
                 } else { // In a race with GetX/GetSX, let the other event complete first since it always can and this will avoid repeatedly losing the block before the Get* can complete
                     status = allocateMSHR(event, true, 1);
@@ -1426,7 +1426,7 @@ bool MESISharNoninclusive::handleForceInv(MemEvent * event, bool inMSHR) {
             break;
         case SM:
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::ForceInv][state]->addData(1);
+                stat_eventState[(int)Command::ForceInv][state].addData(1);
             }
             if (!tag->hasSharers()) {
                 sendResponseDown(event, nullptr, false, true);
@@ -1446,7 +1446,7 @@ bool MESISharNoninclusive::handleForceInv(MemEvent * event, bool inMSHR) {
             if (!inMSHR)
                 status = allocateMSHR(event, true, 0);
             if (status == MemEventStatus::OK) {
-                stat_eventState[(int)Command::ForceInv][state]->addData(1);
+                stat_eventState[(int)Command::ForceInv][state].addData(1);
                 mshr_->setProfiled(addr);
             }
             break;
@@ -1454,7 +1454,7 @@ bool MESISharNoninclusive::handleForceInv(MemEvent * event, bool inMSHR) {
         case EA:
         case MA:
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::ForceInv][state]->addData(1);
+                stat_eventState[(int)Command::ForceInv][state].addData(1);
             }
             // TODO make sure the pending eviction won't mess anything up when it tries to replay
             put = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
@@ -1502,7 +1502,7 @@ bool MESISharNoninclusive::handleFetchInv(MemEvent * event, bool inMSHR){
     MemEvent * put;
     switch (state) {
         case I:
-            stat_eventState[(int)Command::FetchInv][state]->addData(1);
+            stat_eventState[(int)Command::FetchInv][state].addData(1);
             delete event;
             break;
         case S:
@@ -1512,7 +1512,7 @@ bool MESISharNoninclusive::handleFetchInv(MemEvent * event, bool inMSHR){
             if (status == MemEventStatus::OK) {
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
                     recordPrefetchResult(tag, statPrefetchInv);
-                    stat_eventState[(int)Command::FetchInv][state]->addData(1);
+                    stat_eventState[(int)Command::FetchInv][state].addData(1);
                     if (tag->hasSharers()) mshr_->setProfiled(addr);
                 }
                 if (tag->hasSharers()) {
@@ -1521,7 +1521,7 @@ bool MESISharNoninclusive::handleFetchInv(MemEvent * event, bool inMSHR){
                         invalidateSharers(event, tag, inMSHR, !(data || mshr_->hasData(addr)), Command::Inv);
                 } else {
                     if (data)
-                        sendResponseDown(event, data->getData(), false, true);
+                        sendResponseDown(event, data->getDataBuffer(), false, true);
                     else {
                         sendResponseDown(event, &(mshr_->getData(addr)), false, true);
                         mshr_->clearData(addr);
@@ -1541,7 +1541,7 @@ bool MESISharNoninclusive::handleFetchInv(MemEvent * event, bool inMSHR){
 
             if (status == MemEventStatus::OK) {
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::FetchInv][state]->addData(1);
+                    stat_eventState[(int)Command::FetchInv][state].addData(1);
                     if (tag->hasOwner() || tag->hasSharers()) mshr_->setProfiled(addr);
                     recordPrefetchResult(tag, statPrefetchInv);
                 }
@@ -1555,7 +1555,7 @@ bool MESISharNoninclusive::handleFetchInv(MemEvent * event, bool inMSHR){
                     state == E ? tag->setState(E_Inv) : tag->setState(M_Inv);
                 } else {
                     if (data)
-                        sendResponseDown(event, data->getData(), state == M, true);
+                        sendResponseDown(event, data->getDataBuffer(), state == M, true);
                     else {
                         sendResponseDown(event, &(mshr_->getData(addr)), state == M, true);
                         mshr_->clearData(addr);
@@ -1576,7 +1576,7 @@ bool MESISharNoninclusive::handleFetchInv(MemEvent * event, bool inMSHR){
 
             if (status == MemEventStatus::OK) {
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::FetchInv][state]->addData(1);
+                    stat_eventState[(int)Command::FetchInv][state].addData(1);
                     if (tag->hasSharers()) mshr_->setProfiled(addr);
                 }
                 if (tag->hasSharers()) {
@@ -1584,7 +1584,7 @@ bool MESISharNoninclusive::handleFetchInv(MemEvent * event, bool inMSHR){
                     tag->setState(SB_Inv);
                 } else {
                     if (data) {
-                        sendResponseDown(event, data->getData(), false, true);
+                        sendResponseDown(event, data->getDataBuffer(), false, true);
                         dataArray_->deallocate(data);
                     } else {
                         sendResponseDown(event, &(mshr_->getData(addr)), false, true);
@@ -1605,12 +1605,12 @@ bool MESISharNoninclusive::handleFetchInv(MemEvent * event, bool inMSHR){
         case EA:
         case MA:
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::FetchInv][state]->addData(1);
+                stat_eventState[(int)Command::FetchInv][state].addData(1);
             }
             // TODO make sure the pending eviction won't mess anything up when it tries to replay
             put = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
             sendWritebackAck(put);
-            sendResponseDown(event, &(put->getPayload()), state == MA, true);
+            sendResponseDown(event, &(put->getPayloadBuffer()), state == MA, true);
             dirArray_->deallocate(tag);
             if (mshr_->hasData(addr))
                 mshr_->clearData(addr);
@@ -1620,11 +1620,11 @@ bool MESISharNoninclusive::handleFetchInv(MemEvent * event, bool inMSHR){
         case SM:
             if (!tag->hasSharers()) {
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::FetchInv][state]->addData(1);
+                    stat_eventState[(int)Command::FetchInv][state].addData(1);
                 }
                 tag->setState(IM);
                 if (data)
-                    sendResponseDown(event, data->getData(), false, true);
+                    sendResponseDown(event, data->getDataBuffer(), false, true);
                 else
                     sendResponseDown(event, &(mshr_->getData(addr)), false, true);
                 tag->setState(IM);
@@ -1638,7 +1638,7 @@ bool MESISharNoninclusive::handleFetchInv(MemEvent * event, bool inMSHR){
             if (status == MemEventStatus::OK) {
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
                     mshr_->setProfiled(addr);
-                    stat_eventState[(int)Command::FetchInv][state]->addData(1);
+                    stat_eventState[(int)Command::FetchInv][state].addData(1);
                 }
                 if (tag->hasSharers()) {
                     invalidateSharers(event, tag, inMSHR, !data && !mshr_->hasData(addr), Command::Inv);
@@ -1652,7 +1652,7 @@ bool MESISharNoninclusive::handleFetchInv(MemEvent * event, bool inMSHR){
                 status = allocateMSHR(event, true, 0);
                 if (status == MemEventStatus::OK) {
                     mshr_->setProfiled(addr);
-                    stat_eventState[(int)Command::FetchInv][state]->addData(1);
+                    stat_eventState[(int)Command::FetchInv][state].addData(1);
                 }
             }
             break;
@@ -1663,7 +1663,7 @@ bool MESISharNoninclusive::handleFetchInv(MemEvent * event, bool inMSHR){
                 status = allocateMSHR(event, true, 0);
                 if (status == MemEventStatus::OK) {
                     mshr_->setProfiled(addr);
-                    stat_eventState[(int)Command::FetchInv][state]->addData(1);
+                    stat_eventState[(int)Command::FetchInv][state].addData(1);
                 }
             } else if (!inMSHR) {
                 status = allocateMSHR(event, true, 1);
@@ -1717,7 +1717,7 @@ bool MESISharNoninclusive::handleFetchInvX(MemEvent * event, bool inMSHR) {
             if (data) dataArray_->deallocate(data);
         case I:
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::FetchInvX][state]->addData(1);
+                stat_eventState[(int)Command::FetchInvX][state].addData(1);
             }
             delete event;
             break;
@@ -1725,7 +1725,7 @@ bool MESISharNoninclusive::handleFetchInvX(MemEvent * event, bool inMSHR) {
         case M_B:
             tag->setState(S_B);
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::FetchInvX][state]->addData(1);
+                stat_eventState[(int)Command::FetchInvX][state].addData(1);
             }
             delete event;
             break;
@@ -1736,7 +1736,7 @@ bool MESISharNoninclusive::handleFetchInvX(MemEvent * event, bool inMSHR) {
             if (status != MemEventStatus::OK)
                 break;
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::FetchInvX][state]->addData(1);
+                stat_eventState[(int)Command::FetchInvX][state].addData(1);
             }
             if (tag->hasOwner()) { // Get data from owner
                 if (!applyPendingReplacement(addr)) {
@@ -1755,7 +1755,7 @@ bool MESISharNoninclusive::handleFetchInvX(MemEvent * event, bool inMSHR) {
             } else {
                 tag->setState(S);
                 if (data)
-                    sendResponseDown(event, data->getData(), state == M, true); // TODO Double check that a downgrade counts as an evict
+                    sendResponseDown(event, data->getDataBuffer(), state == M, true); // TODO Double check that a downgrade counts as an evict
                 else {
                     sendResponseDown(event, &(mshr_->getData(addr)), state == M, true);
                 }
@@ -1765,10 +1765,10 @@ bool MESISharNoninclusive::handleFetchInvX(MemEvent * event, bool inMSHR) {
         case EA:
         case MA:
             if (!inMSHR || mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::FetchInvX][state]->addData(1);
+                stat_eventState[(int)Command::FetchInvX][state].addData(1);
             }
             req = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
-            sendResponseDown(event, &(req->getPayload()), state == M, true); // TODO Double check that a downgrade counts as an evict
+            sendResponseDown(event, &(req->getPayloadBuffer()), state == M, true); // TODO Double check that a downgrade counts as an evict
             // Clean up so that when we replay the replacement we get the right downgraded state
             req->setCmd(Command::PutS);
             tag->removeOwner();
@@ -1819,11 +1819,11 @@ bool MESISharNoninclusive::handleGetSResp(MemEvent * event, bool inMSHR) {
     if (is_debug_event(event))
         eventDI.prefill(event->getID(), Command::GetSResp, localPrefetch, addr, state);
 
-    stat_eventState[(int)Command::GetSResp][state]->addData(1);
+    stat_eventState[(int)Command::GetSResp][state].addData(1);
    
     tag->setState(S);
     if (data)
-        data->setData(event->getPayload(), 0);
+        data->setData(event->getPayloadBuffer(), 0);
     
     if (localPrefetch) {
         tag->setPrefetch(true);
@@ -1831,7 +1831,7 @@ bool MESISharNoninclusive::handleGetSResp(MemEvent * event, bool inMSHR) {
             eventDI.action = "Done";
     } else {
         tag->addSharer(req->getSrc());
-        uint64_t sendTime = sendResponseUp(req, &(event->getPayload()), true, tag->getTimestamp(), Command::GetSResp);
+        uint64_t sendTime = sendResponseUp(req, &(event->getPayloadBuffer()), true, tag->getTimestamp(), Command::GetSResp);
         tag->setTimestamp(sendTime-1);
     }
     
@@ -1865,9 +1865,9 @@ bool MESISharNoninclusive::handleGetXResp(MemEvent * event, bool inMSHR) {
         eventDI.prefill(event->getID(), Command::GetXResp, localPrefetch, addr, state);
             
     if (data)
-        data->setData(event->getPayload(), 0);
+        data->setData(event->getPayloadBuffer(), 0);
    
-    stat_eventState[(int)Command::GetXResp][state]->addData(1);
+    stat_eventState[(int)Command::GetXResp][state].addData(1);
     
     switch (state) {
         case IS:
@@ -1885,11 +1885,11 @@ bool MESISharNoninclusive::handleGetXResp(MemEvent * event, bool inMSHR) {
             } else {
                 if (tag->getState() == S || !protocol_ || mshr_->getSize(addr) > 1) {
                     tag->addSharer(req->getSrc());
-                    uint64_t sendTime = sendResponseUp(req, &(event->getPayload()), true, tag->getTimestamp(), Command::GetSResp);
+                    uint64_t sendTime = sendResponseUp(req, &(event->getPayloadBuffer()), true, tag->getTimestamp(), Command::GetSResp);
                     tag->setTimestamp(sendTime - 1);
                 } else {
                     tag->setOwner(req->getSrc());
-                    uint64_t sendTime = sendResponseUp(req, &(event->getPayload()), true, tag->getTimestamp(), Command::GetXResp);
+                    uint64_t sendTime = sendResponseUp(req, &(event->getPayloadBuffer()), true, tag->getTimestamp(), Command::GetXResp);
                     tag->setTimestamp(sendTime - 1);
                 }
             }
@@ -1907,7 +1907,7 @@ bool MESISharNoninclusive::handleGetXResp(MemEvent * event, bool inMSHR) {
                 tag->removeSharer(req->getSrc());
                 sendTime = sendResponseUp(req, nullptr, true, tag->getTimestamp(), Command::GetXResp); 
             } else if (event->getPayloadSize() != 0) {
-                sendTime = sendResponseUp(req, &(event->getPayload()), true, tag->getTimestamp(), Command::GetXResp);
+                sendTime = sendResponseUp(req, &(event->getPayloadBuffer()), true, tag->getTimestamp(), Command::GetXResp);
             } else {
                 sendTime = sendResponseUp(req, &(mshr_->getData(addr)), true, tag->getTimestamp(), Command::GetXResp);
             }
@@ -1923,7 +1923,7 @@ bool MESISharNoninclusive::handleGetXResp(MemEvent * event, bool inMSHR) {
             tag->setState(M_Inv);
             mshr_->setInProgress(addr, false);
             if (!data && event->getPayloadSize() != 0)
-                mshr_->setData(addr, event->getPayload());
+                mshr_->setData(addr, event->getPayloadBuffer());
             if (is_debug_event(event)) {
                 eventDI.action = "Stall";
                 eventDI.reason = "Acks needed";
@@ -1955,7 +1955,7 @@ bool MESISharNoninclusive::handleFlushLineResp(MemEvent * event, bool inMSHR) {
     if (is_debug_event(event))
         eventDI.prefill(event->getID(), Command::FlushLineResp, false, addr, state);
 
-    stat_eventState[(int)Command::FlushLineResp][state]->addData(1);
+    stat_eventState[(int)Command::FlushLineResp][state].addData(1);
 
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(event->getBaseAddr()));
 
@@ -2010,11 +2010,11 @@ bool MESISharNoninclusive::handleFetchResp(MemEvent * event, bool inMSHR) {
         responses.erase(addr);
     
     if (data)
-        data->setData(event->getPayload(), 0);
+        data->setData(event->getPayloadBuffer(), 0);
     else
-        mshr_->setData(addr, event->getPayload());
+        mshr_->setData(addr, event->getPayloadBuffer());
 
-    stat_eventState[(int)Command::FetchResp][state]->addData(1);
+    stat_eventState[(int)Command::FetchResp][state].addData(1);
     
     switch (state) {
         case S_D:
@@ -2090,7 +2090,7 @@ bool MESISharNoninclusive::handleFetchXResp(MemEvent * event, bool inMSHR) {
         eventDI.action = "Retry";
     }
     
-    stat_eventState[(int)Command::FetchXResp][state]->addData(1);
+    stat_eventState[(int)Command::FetchXResp][state].addData(1);
     
     mshr_->decrementAcksNeeded(addr);
 
@@ -2109,9 +2109,9 @@ bool MESISharNoninclusive::handleFetchXResp(MemEvent * event, bool inMSHR) {
     
     // Save data
     if (data) 
-        data->setData(event->getPayload(), 0);
+        data->setData(event->getPayloadBuffer(), 0);
     else
-        mshr_->setData(addr, event->getPayload());
+        mshr_->setData(addr, event->getPayloadBuffer());
 
     // Clean up and retry
     retry(addr);
@@ -2136,7 +2136,7 @@ bool MESISharNoninclusive::handleAckInv(MemEvent * event, bool inMSHR) {
     if (is_debug_event(event))
         eventDI.prefill(event->getID(), Command::AckInv, false, addr, state);
    
-    stat_eventState[(int)Command::AckInv][state]->addData(1);
+    stat_eventState[(int)Command::AckInv][state].addData(1);
 
     if (tag->isSharer(event->getSrc()))
         tag->removeSharer(event->getSrc());
@@ -2171,7 +2171,7 @@ bool MESISharNoninclusive::handleAckInv(MemEvent * event, bool inMSHR) {
 bool MESISharNoninclusive::handleAckPut(MemEvent * event, bool inMSHR) {
     DirectoryLine * tag = dirArray_->lookup(event->getBaseAddr(), false);
     State state = tag ? tag->getState() : I;
-    stat_eventState[(int)Command::AckPut][state]->addData(1);
+    stat_eventState[(int)Command::AckPut][state].addData(1);
     if (is_debug_event(event)) {
         eventDI.prefill(event->getID(), Command::AckPut, false, event->getBaseAddr(), state);
         eventDI.action = "Done";
@@ -2439,7 +2439,7 @@ bool MESISharNoninclusive::handleDirEviction(Addr addr, DirectoryLine*& tag) {
     if (is_debug_addr(tag->getAddr()))
         evictDI.oldst = tag->getState();
 
-    stat_evict[state]->addData(1);
+    stat_evict[state].addData(1);
 
     bool evict = false;
     bool wbSent = false;
@@ -2741,7 +2741,7 @@ void MESISharNoninclusive::retry(Addr addr) {
  * Protocol helper functions
  ***********************************************************************************************************/
 
-uint64_t MESISharNoninclusive::sendResponseUp(MemEvent * event, vector<uint8_t> * data, bool inMSHR, uint64_t time, Command cmd, bool success) {
+uint64_t MESISharNoninclusive::sendResponseUp(MemEvent * event, const PayloadBuffer* data, bool inMSHR, uint64_t time, Command cmd, bool success) {
     MemEvent * responseEvent = event->makeResponse();
     if (cmd != Command::NULLCMD)
         responseEvent->setCmd(cmd);
@@ -2751,7 +2751,7 @@ uint64_t MESISharNoninclusive::sendResponseUp(MemEvent * event, vector<uint8_t>
         responseEvent->setPayload(*data);
         responseEvent->setSize(data->size()); // Return size that was written
         if (is_debug_event(event)) {
-            printData(data, false);
+            printData(&data->read(), false);
         }
     }
 
@@ -2770,7 +2770,7 @@ uint64_t MESISharNoninclusive::sendResponseUp(MemEvent * event, vector<uint8_t>
     return deliveryTime;
 }
 
-void MESISharNoninclusive::sendResponseDown(MemEvent * event, std::vector<uint8_t> * data, bool dirty, bool evict) {
+void MESISharNoninclusive::sendResponseDown(MemEvent * event, const PayloadBuffer* data, bool dirty, bool evict) {
     MemEvent * responseEvent = event->makeResponse();
 
     if (data) {
@@ -2791,7 +2791,7 @@ void MESISharNoninclusive::sendResponseDown(MemEvent * event, std::vector<uint8_
 }
 
 
-uint64_t MESISharNoninclusive::forwardFlush(MemEvent * event, bool evict, std::vector<uint8_t>* data, bool dirty, uint64_t time) {
+uint64_t MESISharNoninclusive::forwardFlush(MemEvent * event, bool evict, const PayloadBuffer* data, bool dirty, uint64_t time) {
     MemEvent * flush = new MemEvent(*event);
 
     flush->setSrc(cachename_);
@@ -2840,11 +2840,11 @@ void MESISharNoninclusive::sendWritebackFromCache(Command cmd, DirectoryLine* ta
 
     /* Writeback data */
     if (dirty || writebackCleanBlocks_) {
-        writeback->setPayload(*(data->getData()));
+        writeback->setPayload(*data->getDataBuffer());
         writeback->setDirty(dirty);
 
         if (is_debug_addr(tag->getAddr())) {
-            printData(data->getData(), false);
+            printData(&data->getDataBuffer()->read(), false);
         }
         
         latency = accessLatency_;
@@ -2873,7 +2873,7 @@ void MESISharNoninclusive::sendWritebackFromMSHR(Command cmd, DirectoryLine* tag
         writeback->setDirty(dirty);
 
         if (is_debug_addr(tag->getAddr())) {
-            printData(&(mshr_->getData(tag->getAddr())), false);
+            printData(&(mshr_->getData(tag->getAddr()).read()), false);
         }
         
         latency = accessLatency_;
@@ -3097,12 +3097,12 @@ bool MESISharNoninclusive::applyPendingReplacement(Addr addr) {
  *  Override message send functions with versions that record statistics & call parent class
  *---------------------------------------------------------------------------------------------------------------------*/
 void MESISharNoninclusive::addToOutgoingQueue(Response& resp) {
-    stat_eventSent[(int)resp.event->getCmd()]->addData(1);
+    stat_eventSent[(int)resp.event->getCmd()].addData(1);
     CoherenceController::addToOutgoingQueue(resp);
 }
 
 void MESISharNoninclusive::addToOutgoingQueueUp(Response& resp) {
-    stat_eventSent[(int)resp.event->getCmd()]->addData(1);
+    stat_eventSent[(int)resp.event->getCmd()].addData(1);
     CoherenceController::addToOutgoingQueueUp(resp);
 }
 
@@ -3115,7 +3115,7 @@ void MESISharNoninclusive::removeSharerViaInv(MemEvent * event, DirectoryLine *
     Addr addr = event->getBaseAddr();
     tag->removeSharer(event->getSrc());
     if (!data && !mshr_->hasData(addr))
-        mshr_->setData(addr, event->getPayload());
+        mshr_->setData(addr, event->getPayloadBuffer());
 
     if (remove) { 
         responses.find(addr)->second.erase(event->getSrc());
@@ -3128,9 +3128,9 @@ void MESISharNoninclusive::removeOwnerViaInv(MemEvent * event, DirectoryLine * t
     Addr addr = event->getBaseAddr();
     tag->removeOwner();
     if (data)   
-        data->setData(event->getPayload(), 0);
+        data->setData(event->getPayloadBuffer(), 0);
     else
-        mshr_->setData(addr, event->getPayload());
+        mshr_->setData(addr, event->getPayloadBuffer());
 
     if (event->getDirty()) {
         if (tag->getState() == E)             
@@ -3148,9 +3148,9 @@ void MESISharNoninclusive::removeOwnerViaInv(MemEvent * event, DirectoryLine * t
     }
 }
 
-void MESISharNoninclusive::recordPrefetchResult(DirectoryLine * tag, Statistic<uint64_t> * stat) {
+void MESISharNoninclusive::recordPrefetchResult(DirectoryLine * tag, StatCounter& stat) {
     if (tag->getPrefetch()) {
-        stat->addData(1);
+        stat.addData(1);
         tag->setPrefetch(false);
     }
 }
@@ -3175,7 +3175,7 @@ void MESISharNoninclusive::printLine(Addr addr) {
     }
 }
 
-void MESISharNoninclusive::printData(vector<uint8_t> * data, bool set) {
+void MESISharNoninclusive::printData(const vector<uint8_t> * data, bool set) {
 /*    if (set)    printf("Setting data (%zu): 0x", data->size());
     else        printf("Getting data (%zu): 0x", data->size());
     
@@ -3186,6 +3186,12 @@ void MESISharNoninclusive::printData(vector<uint8_t> * data, bool set) {
 }
 
 
+void MESISharNoninclusive::visitStatCounters(const StatCounterVisitor& visit) {
+    CoherenceController::visitStatCounters(visit);
+    SST::MemHierarchy::visitStatCounters(stat_hit, visit);
+    SST::MemHierarchy::visitStatCounters(stat_miss, visit);
+}
+
 void MESISharNoninclusive::recordLatency(Command cmd, int type, uint64_t latency) {
     if (type == -1)
         return;
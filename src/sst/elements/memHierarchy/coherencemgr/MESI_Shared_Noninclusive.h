@@ -537,6 +537,7 @@ public:
     MemEventInitCoherence* getInitCoherenceEvent();
     
     virtual Addr getBank(Addr addr) { return dirArray_->getBank(addr); }
+    virtual bool isCached(Addr addr) { DataLine* line = dataArray_->lookup(addr, false); return line && line->getState() != I; }
     virtual void setSliceAware(uint64_t size, uint64_t step) { 
         dirArray_->setSliceAware(size, step);
         dataArray_->setSliceAware(size, step); 
@@ -589,13 +590,13 @@ private:
     bool invalidateOwner(MemEvent * event, DirectoryLine * line, bool inMSHR, Command cmd = Command::FetchInv);
     
     /** Forward a flush line request, with or without data */
-    uint64_t forwardFlush(MemEvent* event, bool evict, std::vector<uint8_t>* data, bool dirty, uint64_t time);
+    uint64_t forwardFlush(MemEvent* event, bool evict, const PayloadBuffer* data, bool dirty, uint64_t time);
 
     /** Send response up (to processor) */
-    uint64_t sendResponseUp(MemEvent * event, vector<uint8_t>* data, bool inMSHR, uint64_t baseTime, Command cmd = Command::NULLCMD, bool success = false);
+    uint64_t sendResponseUp(MemEvent * event, const PayloadBuffer* data, bool inMSHR, uint64_t baseTime, Command cmd = Command::NULLCMD, bool success = false);
     
     /** Send response down (towards memory) */
-    void sendResponseDown(MemEvent* event, std::vector<uint8_t>* data, bool dirty, bool evict);
+    void sendResponseDown(MemEvent* event, const PayloadBuffer* data, bool dirty, bool evict);
     
     /** Send writeback request to lower level caches */
     void sendWritebackFromCache(Command cmd, DirectoryLine* tag, DataLine* data, bool dirty);
@@ -616,12 +617,13 @@ private:
     bool applyPendingReplacement(Addr addr);
 
 /* Miscellaneous */
-    void printData(vector<uint8_t> * data, bool set);
+    void printData(const vector<uint8_t> * data, bool set);
     void printLine(Addr addr);
 
 /* Statistics */
     void recordLatency(Command cmd, int type, uint64_t latency);
-    void recordPrefetchResult(DirectoryLine * line, Statistic<uint64_t> * stat);
+    void visitStatCounters(const StatCounterVisitor& visit);
+    void recordPrefetchResult(DirectoryLine * line, StatCounter& stat);
 
 /* Private data members */
     CacheArray<DataLine>* dataArray_;
@@ -641,8 +643,8 @@ private:
     Statistic<uint64_t>* stat_latencyGetSX[4];
     Statistic<uint64_t>* stat_latencyFlushLine;
     Statistic<uint64_t>* stat_latencyFlushLineInv;
-    Statistic<uint64_t>* stat_hit[3][2];
-    Statistic<uint64_t>* stat_miss[3][2];
+    StatCounter stat_hit[3][2];
+    StatCounter stat_miss[3][2];
 
 
 };
@@ -734,6 +734,26 @@ void CoherenceController::removeRequestRecord(SST::Event::id_type id) {
         startTimes_.erase(id);
 }
 
+void CoherenceController::visitStatCounters(const StatCounterVisitor& visit) {
+    SST::MemHierarchy::visitStatCounters(stat_eventSent, visit);
+    SST::MemHierarchy::visitStatCounters(stat_evict, visit);
+    SST::MemHierarchy::visitStatCounters(stat_eventState, visit);
+    SST::MemHierarchy::visitStatCounters(statPrefetchEvict, visit);
+    SST::MemHierarchy::visitStatCounters(statPrefetchInv, visit);
+    SST::MemHierarchy::visitStatCounters(statPrefetchRedundant, visit);
+    SST::MemHierarchy::visitStatCounters(statPrefetchUpgradeMiss, visit);
+    SST::MemHierarchy::visitStatCounters(statPrefetchHit, visit);
+    SST::MemHierarchy::visitStatCounters(statPrefetchDrop, visit);
+}
+
+void CoherenceController::setStatisticsDeferred(bool deferred) {
+    visitStatCounters([deferred](StatCounter& counter) { counter.setDeferred(deferred); });
+}
+
+void CoherenceController::flushStatistics() {
+    visitStatCounters([](StatCounter& counter) { counter.flush(); });
+}
+
 void CoherenceController::recordLatencyType(Event::id_type id, int type) {
     if (startTimes_.find(id) != startTimes_.end())
         startTimes_.find(id)->second.missType = type;
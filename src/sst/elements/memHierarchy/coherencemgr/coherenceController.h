@@ -32,6 +32,7 @@
 #include "sst/elements/memHierarchy/memLinkBase.h"
 #include "sst/elements/memHierarchy/replacementManager.h"
 #include "sst/elements/memHierarchy/hash.h"
+#include "sst/elements/memHierarchy/statCounter.h"
 
 namespace SST { namespace MemHierarchy {
 using namespace std;
@@ -112,6 +113,9 @@ public:
     /* Get which bank an address maps to (call through to cache array) */
     virtual Addr getBank(Addr addr) = 0;
 
+    /* Whether the line is present (or being filled) here - used to filter prefetches before they are issued */
+    virtual bool isCached(Addr UNUSED(addr)) { return false; }
+
 
     /*********************************************************************************
      * Initialization/finish functions used by parent
@@ -148,6 +152,11 @@ public:
     /* Prefetch drop statistic is used by both controller and coherence managers */
     void setStatistics(Statistic<uint64_t>* prefetchdrop) { statPrefetchDrop = prefetchdrop; }
 
+    /* Aggregate the event-count statistics locally until flushStatistics() is called.
+     * The controller flushes them periodically, when it goes idle, and at finish */
+    void setStatisticsDeferred(bool deferred);
+    void flushStatistics();
+
     /* Controller records received events, but valid types are determined by coherence manager. Share those here */
     virtual std::set<Command> getValidReceiveEvents() = 0;
 
@@ -202,6 +211,9 @@ protected:
     /* Statistics */
     virtual void recordLatencyType(SST::Event::id_type id, int latencytype);
     virtual void recordPrefetchLatency(SST::Event::id_type, int latencytype);
+
+    /* Apply 'visit' to every StatCounter; coherence managers with their own counters extend this */
+    virtual void visitStatCounters(const StatCounterVisitor& visit);
     
     /* Debug */
 
@@ -289,9 +301,9 @@ protected:
     std::vector<MemEventBase*> retryBuffer_;
 
     /* Statistics - some variables used by all are declared here, but they are maintained by coherence protocols */
-    Statistic<uint64_t>* stat_eventSent[(int)Command::LAST_CMD];    // Count events sent
-    Statistic<uint64_t>* stat_evict[LAST_STATE];                    // Count how many evictions happened in a given state
-    std::array<std::array<Statistic<uint64_t>*, LAST_STATE>, (int)Command::LAST_CMD> stat_eventState;
+    StatCounter stat_eventSent[(int)Command::LAST_CMD];    // Count events sent
+    StatCounter stat_evict[LAST_STATE];                    // Count how many evictions happened in a given state
+    std::array<std::array<StatCounter, LAST_STATE>, (int)Command::LAST_CMD> stat_eventState;
     
     struct LatencyStat{
         uint64_t time;
@@ -337,12 +349,12 @@ protected:
     uint64_t packetHeaderBytes;
 
     /* Prefetch statistics */
-    Statistic<uint64_t>* statPrefetchEvict;
-    Statistic<uint64_t>* statPrefetchInv;
-    Statistic<uint64_t>* statPrefetchRedundant;
-    Statistic<uint64_t>* statPrefetchUpgradeMiss;
-    Statistic<uint64_t>* statPrefetchHit;
-    Statistic<uint64_t>* statPrefetchDrop;
+    StatCounter statPrefetchEvict;
+    StatCounter statPrefetchInv;
+    StatCounter statPrefetchRedundant;
+    StatCounter statPrefetchUpgradeMiss;
+    StatCounter statPrefetchHit;
+    StatCounter statPrefetchDrop;
 };
 
 }}
@@ -971,7 +971,7 @@ bool DirectoryController::handleFlushLine(MemEvent* event, bool inMSHR) {
                 if (event->getEvict()) {
                     entry->removeOwner();
                     entry->addSharer(event->getSrc());
-                    mshr->setData(addr, event->getPayload(), event->getDirty());
+                    mshr->setData(addr, event->getPayloadBuffer(), event->getDirty());
                     event->setEvict(false);
                 } else if (entry->hasOwner()) {
                     issueFetch(event, entry, Command::FetchInvX);
@@ -986,7 +986,7 @@ bool DirectoryController::handleFlushLine(MemEvent* event, bool inMSHR) {
             if (event->getEvict()) {
                 entry->removeOwner();
                 entry->addSharer(event->getSrc());
-                mshr->setData(addr, event->getPayload(), event->getDirty());
+                mshr->setData(addr, event->getPayloadBuffer(), event->getDirty());
                 event->setEvict(false);
                 entry->setState(S_Inv);
             }
@@ -995,7 +995,7 @@ bool DirectoryController::handleFlushLine(MemEvent* event, bool inMSHR) {
             if (event->getEvict()) {
                 entry->removeOwner();
                 entry->addSharer(event->getSrc());
-                mshr->setData(addr, event->getPayload(), event->getDirty());
+                mshr->setData(addr, event->getPayloadBuffer(), event->getDirty());
                 entry->setState(S);
                 mshr->decrementAcksNeeded(addr);
                 responses.find(addr)->second.erase(event->getSrc());
@@ -1062,7 +1062,7 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
             if (status == MemEventStatus::OK) {
                 if (event->getEvict()) {
                     entry->removeOwner();
-                    mshr->setData(addr, event->getPayload(), event->getDirty());
+                    mshr->setData(addr, event->getPayloadBuffer(), event->getDirty());
                     event->setEvict(false);
                 }
 
@@ -1094,7 +1094,7 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
         case M_InvX:
             if (event->getEvict()) {
                 entry->removeOwner();
-                mshr->setData(addr, event->getPayload(), event->getDirty());
+                mshr->setData(addr, event->getPayloadBuffer(), event->getDirty());
                 event->setEvict(false);
                 responses.find(addr)->second.erase(event->getSrc());
                 if (responses.find(addr)->second.empty()) responses.erase(addr);
@@ -1272,14 +1272,14 @@ bool DirectoryController::handlePutX(MemEvent * event, bool inMSHR) {
             update = true;
             break;
         case M_Inv:
-            mshr->setData(addr, event->getPayload(), event->getDirty());
+            mshr->setData(addr, event->getPayloadBuffer(), event->getDirty());
             entry->setState(S_Inv);
             break;
         case M_InvX:
             mshr->decrementAcksNeeded(addr);
             responses.find(addr)->second.erase(event->getSrc());
             if (responses.find(addr)->second.empty()) responses.erase(addr);
-            mshr->setData(addr, event->getPayload(), event->getDirty());
+            mshr->setData(addr, event->getPayloadBuffer(), event->getDirty());
             entry->setState(S);
             break;
         default:
@@ -1328,7 +1328,7 @@ bool DirectoryController::handlePutE(MemEvent * event, bool inMSHR) {
             mshr->decrementAcksNeeded(addr);
             responses.find(addr)->second.erase(event->getSrc());
             if (responses.find(addr)->second.empty()) responses.erase(addr);
-            mshr->setData(addr, event->getPayload(), event->getDirty());
+            mshr->setData(addr, event->getPayloadBuffer(), event->getDirty());
             entry->setState(I);
             break;
         default:
@@ -1378,7 +1378,7 @@ bool DirectoryController::handlePutM(MemEvent * event, bool inMSHR) {
             mshr->decrementAcksNeeded(addr);
             responses.find(addr)->second.erase(event->getSrc());
             if (responses.find(addr)->second.empty()) responses.erase(addr);
-            mshr->setData(addr, event->getPayload(), event->getDirty());
+            mshr->setData(addr, event->getPayloadBuffer(), event->getDirty());
             entry->setState(I);
             break;
         default:
@@ -1626,8 +1626,8 @@ bool DirectoryController::handleGetSResp(MemEvent * event, bool inMSHR) {
     entry->setState(S);
     entry->addSharer(reqEv->getSrc());
    
-    sendDataResponse(reqEv, entry, event->getPayload(), Command::GetSResp);
-    mshr->setData(addr, event->getPayload(), false); // Save data for a subsequent GetS
+    sendDataResponse(reqEv, entry, event->getPayloadBuffer(), Command::GetSResp);
+    mshr->setData(addr, event->getPayloadBuffer(), false); // Save data for a subsequent GetS
     cleanUpAfterResponse(event, inMSHR);
     
     if (is_debug_addr(addr)) {
@@ -1653,23 +1653,23 @@ bool DirectoryController::handleGetXResp(MemEvent * event, bool inMSHR) {
             if (protocol == CoherenceProtocol::MESI) {
                 entry->setState(M);
                 entry->setOwner(reqEv->getSrc());
-                sendDataResponse(reqEv, entry, event->getPayload(), Command::GetXResp);
+                sendDataResponse(reqEv, entry, event->getPayloadBuffer(), Command::GetXResp);
                 break;
             }
         case S_D:
             entry->setState(S);
             entry->addSharer(reqEv->getSrc());
-            sendDataResponse(reqEv, entry, event->getPayload(), Command::GetSResp);
-            mshr->setData(addr, event->getPayload(), false); // So subsequent GetS can get data
+            sendDataResponse(reqEv, entry, event->getPayloadBuffer(), Command::GetSResp);
+            mshr->setData(addr, event->getPayloadBuffer(), false); // So subsequent GetS can get data
             break;
         case IM:
             entry->setState(M);
             entry->setOwner(reqEv->getSrc());
-            sendDataResponse(reqEv, entry, event->getPayload(), Command::GetXResp);
+            sendDataResponse(reqEv, entry, event->getPayloadBuffer(), Command::GetXResp);
             break;
         case SM_Inv:
             entry->setState(S_Inv);
-            mshr->setData(addr, event->getPayload(), false); // Save data for when the invalidations finish
+            mshr->setData(addr, event->getPayloadBuffer(), false); // Save data for when the invalidations finish
             if (is_debug_addr(addr)) {
                 eventDI.newst = entry->getState();
                 eventDI.verboseline = entry->getString();
@@ -1815,7 +1815,7 @@ bool DirectoryController::handleFetchXResp(MemEvent* event, bool inMSHR) {
     responses.find(addr)->second.erase(event->getSrc());
     if (responses.find(addr)->second.empty()) responses.erase(addr);
    
-    mshr->setData(addr, event->getPayload(), event->getDirty());       // Save data for retry
+    mshr->setData(addr, event->getPayloadBuffer(), event->getDirty());       // Save data for retry
     
     entry->removeOwner();
     entry->addSharer(event->getSrc());
@@ -1850,7 +1850,7 @@ bool DirectoryController::handleFetchResp(MemEvent* event, bool inMSHR) {
     responses.find(addr)->second.erase(event->getSrc());
     if (responses.find(addr)->second.empty()) 
         responses.erase(addr);
-    mshr->setData(addr, event->getPayload(), event->getDirty());       // Save data for retry
+    mshr->setData(addr, event->getPayloadBuffer(), event->getDirty());       // Save data for retry
 
     entry->setState(I);
 
@@ -2169,7 +2169,7 @@ void DirectoryController::issueInvalidation(std::string dst, MemEvent* event, Di
     cpuMsgQueue.insert(std::make_pair(deliveryTime, inv));
 }
     
-void DirectoryController::sendDataResponse(MemEvent* event, DirEntry* entry, std::vector<uint8_t>& data, Command cmd, uint32_t flags) {
+void DirectoryController::sendDataResponse(MemEvent* event, DirEntry* entry, const PayloadBuffer& data, Command cmd, uint32_t flags) {
     MemEvent * respEv = event->makeResponse(cmd);
     respEv->setSize(lineSize);
     respEv->setPayload(data);
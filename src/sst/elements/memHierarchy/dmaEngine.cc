@@ -16,8 +16,11 @@
 #include <sst_config.h>
 #include "dmaEngine.h"
 
+#include <algorithm>
+
 #include <sst/core/component.h>
 #include <sst/core/params.h>
+#include <sst/core/unitAlgebra.h>
 
 using namespace SST;
 using namespace SST::MemHierarchy;
@@ -25,9 +28,9 @@ using namespace SST::MemHierarchy;
 uint64_t DMACommand::main_id = 0;
 
 DMAEngine::DMAEngine(ComponentId_t id, Params &params) :
-    Component(id)
+    Component(id), numTransfers(0), bytesTransferred(0), numRequests(0)
 {
-    dbg.init("@t:DMAEngine::@p():@l " + getName() + ": ", 0, 0,
+    dbg.init("@t:DMAEngine::@p():@l " + getName() + ": ", params.find<int>("debug_level", 0), 0,
             (Output::output_location_t)params.find<int>("debug", 0));
     statsOutputTarget = (Output::output_location_t)params.find<int>("printStats", 0);
 
@@ -36,59 +39,76 @@ DMAEngine::DMAEngine(ComponentId_t id, Params &params) :
     commandLink = configureLink("cmdLink", tc, NULL);
     if ( NULL == commandLink ) dbg.fatal(CALL_INFO, 1, "Missing cmdLink\n");
 
-    if ( !isPortConnected("netLink") ) dbg.fatal(CALL_INFO, 1, "Missing netLink\n");
-/*
-    MemNIC::ComponentInfo myInfo;
-    myInfo.link_port = "netLink";
-    myInfo.link_bandwidth = "1GiB/s";
-	myInfo.num_vcs = params.find<int>("network_num_vc", 1);
-    myInfo.name = getName();
-    myInfo.type = MemNIC::TypeDMAEngine;
-    networkLink = new MemNIC(this, &dbg, -1, myInfo);
-*/
-    blocksize = 0;
+    /* Transfer shaping */
+    UnitAlgebra lineUA(params.find<std::string>("line_size", "64B"));
+    UnitAlgebra burstUA(params.find<std::string>("max_burst_size", "512B"));
+    if ( !lineUA.hasUnits("B") || !isPowerOfTwo(lineUA.getRoundedValue()) )
+        dbg.fatal(CALL_INFO, -1, "Invalid param(%s): line_size - must be a power of two in bytes. You specified '%s'.\n", getName().c_str(), lineUA.toString().c_str());
+    if ( !burstUA.hasUnits("B") )
+        dbg.fatal(CALL_INFO, -1, "Invalid param(%s): max_burst_size - must have units of bytes (B). You specified '%s'.\n", getName().c_str(), burstUA.toString().c_str());
+    lineSize = lineUA.getRoundedValue();
+    maxBurstSize = std::max(lineSize, (uint64_t)burstUA.getRoundedValue());
+
+    maxOutstanding = params.find<uint32_t>("max_outstanding", 16);
+    maxIssuePerCycle = params.find<uint32_t>("max_issue_per_cycle", 1);
+    maxActiveCommands = params.find<uint32_t>("max_active_commands", 4);
+    if ( maxOutstanding == 0 ) maxOutstanding = 1;
+    if ( maxIssuePerCycle == 0 ) maxIssuePerCycle = 1;
+    if ( maxActiveCommands == 0 ) maxActiveCommands = 1;
+
+    stat_burstSize = registerStatistic<uint64_t>("burst_size");
+    stat_windowFull = registerStatistic<uint64_t>("window_full");
+
+    /* Link to memory */
+    networkLink = loadUserSubComponent<MemLinkBase>("memlink");
+    if ( !networkLink ) {
+        if ( !isPortConnected("netLink") ) dbg.fatal(CALL_INFO, 1, "Missing netLink\n");
+
+        // These are defaults and will not overwrite user provided
+        Params nicParams = params.find_prefix_params("memNIC.");
+        nicParams.insert("addr_range_start", "0", false);
+        nicParams.insert("addr_range_end", std::to_string((uint64_t) - 1), false);
+        nicParams.insert("interleave_size", "0B", false);
+        nicParams.insert("interleave_step", "0B", false);
+        nicParams.insert("port", "netLink");
+        nicParams.insert("group", "3", false); // Talks to memory
+        networkLink = loadAnonymousSubComponent<MemLinkBase>("memHierarchy.MemNIC", "memlink", 0, ComponentInfo::SHARE_PORTS | ComponentInfo::INSERT_STATS, nicParams);
+    }
+    networkLink->setRecvHandler(new Event::Handler<DMAEngine>(this, &DMAEngine::handleNetworkEvent));
+    networkLink->setName(getName());
 }
 
 
 void DMAEngine::init(unsigned int phase)
 {
     networkLink->init(phase);
+
+    /* Nothing to do with memory's init traffic */
+    while ( MemEventInit *ev = networkLink->recvInitData() ) {
+        delete ev;
+    }
 }
 
 
 void DMAEngine::setup(void)
 {
     networkLink->setup();
-    bool blocksizeSet = false;
-
-/*    const std::vector<MemNIC::PeerInfo_t> &peers = networkLink->getPeerInfo();
-    for ( std::vector<MemNIC::PeerInfo_t>::const_iterator i = peers.begin() ; i != peers.end() ; ++i ) {
-        switch (i->first.type) {
-        case MemNIC::TypeDirectoryCtrl:
-            break;
-        case MemNIC::TypeCache:
-            if ( !blocksizeSet ) {
-                blocksize = i->second.blocksize;
-                blocksizeSet = true;
-            }
-        default:
-            ;
-        }
-    }
-
-    networkLink->clearPeerInfo();*/
 }
 
 
 void DMAEngine::finish(void)
 {
+    networkLink->finish();
+
     Output out("", 0, 0, statsOutputTarget);
     out.output("DMA Controller %s stats:\n"
             "\t # Transfers:        %" PRIu64 "\n"
-            "\t Bytes Transferred:  %" PRIu64 "\n",
+            "\t Bytes Transferred:  %" PRIu64 "\n"
+            "\t Network Requests:   %" PRIu64 "\n",
             getName().c_str(),
             numTransfers,
-            bytesTransferred);
+            bytesTransferred,
+            numRequests);
 }
 
 
@@ -96,40 +116,57 @@ bool DMAEngine::clock(Cycle_t cycle)
 {
     /* Process Network
      * Check Command link
-     * If new command, check overlap, and delay if needed, otherwise process
+     * Start any commands that don't overlap with active ones
+     * Issue reads and writes up to the outstanding window
      */
+    if ( networkLink->isClocked() )
+        networkLink->clock();
 
-    //networkLink->clock();
-
-    MemEventBase *me = NULL;
     SST::Event *se = NULL;
-
-//    while ( NULL != (me = networkLink->recv()) ) {
-        /* Process network packet */
-/*        Request* req = findRequest(me->getResponseToID());
-#ifdef __SST_DEBUG_OUTPUT__
-        if ( NULL == req ) {
-            dbg.debug(_L10_, "Received Packet for which we have no response ID waiting.  ID received: (%" PRIx64 ", %d)\n", me->getResponseToID().first, me->getResponseToID().second);
-        }
-#endif
-        processPacket(req, me);
-    }
-*/
-
     while ( NULL != (se = commandLink->recv()) ) {
         /* Process new commands */
         DMACommand* cmd = static_cast<DMACommand*>(se);
         commandQueue.push_back(cmd);
     }
 
-    /* See if we can process the next command */
-    if ( !commandQueue.empty() ) {
+    /* See if we can start the next commands */
+    while ( !commandQueue.empty() && activeRequests.size() < maxActiveCommands ) {
         DMACommand *cmd = commandQueue.front();
-        if ( isIssuable(cmd) ) {
-            commandQueue.pop_front();
-            Request *req = new Request(cmd);
-            startRequest(req);
+        if ( !isIssuable(cmd) ) break;
+        commandQueue.pop_front();
+        startRequest(new Request(cmd));
+    }
+
+    /* Issue requests.  A write takes over the window slot of the read it
+     * completes, so queued writes always go out; only new reads wait for
+     * the window.
+     */
+    for ( uint32_t issued = 0; issued < maxIssuePerCycle; issued++ ) {
+        if ( !writeQueue.empty() ) {
+            MemEvent * write = writeQueue.front();
+            writeQueue.pop_front();
+            networkLink->send(write);
+            numRequests++;
+            continue;
         }
+
+        if ( chunkQueue.empty() ) break;
+
+        if ( outstanding.size() >= maxOutstanding ) {
+            stat_windowFull->addData(1);
+            break;
+        }
+
+        Chunk chunk = chunkQueue.front();
+        chunkQueue.pop_front();
+
+        MemEvent * read = new MemEvent(this, chunk.src, chunk.src & ~(lineSize - 1), Command::GetS, chunk.size);
+        read->setFlag(MemEvent::F_NONCACHEABLE);
+        read->setDst(networkLink->findTargetDestination(chunk.src));
+        outstanding.insert(read->getID(), chunk);
+        stat_burstSize->addData(chunk.size);
+        networkLink->send(read);
+        numRequests++;
     }
 
     return false;
@@ -138,79 +175,121 @@ bool DMAEngine::clock(Cycle_t cycle)
 
 bool DMAEngine::isIssuable(DMACommand *cmd) const
 {
-    bool isOK = true;
     /* Cycle through current requests.  If any overlap, then we should wait. */
-    for ( std::set<Request*>::iterator i = activeRequests.begin() ; isOK && i != activeRequests.end() ; ++i ) {
-        Request *req = (*i);
-        isOK = !findOverlap(req->command, cmd);
+    for ( std::vector<Request*>::const_iterator i = activeRequests.begin() ; i != activeRequests.end() ; ++i ) {
+        if ( findOverlap((*i)->command, cmd) )
+            return false;
     }
-
-    return isOK;
+    return true;
 }
 
 
 void DMAEngine::startRequest(Request *req)
 {
-    assert(0);
-    /*  Needs to be updated with current MemHierarchy Commands/States, MemHierarchyInterface
-    dbg.debug(_L10_, "Received request to transfer from %#" PRIx64 " to 0x%" PRIx64 "\n",
-            req->getSrc(), req->getDst());
+    dbg.debug(_L10_, "Received request to transfer %zu bytes in %zu segment(s) from %#" PRIx64 " to %#" PRIx64 "\n",
+            req->command->size, req->command->segments.size(), req->command->src, req->command->dst);
     ++numTransfers;
-    Addr ptr = req->getSrc();
-    while ( ptr < (req->getSrc() + req->getSize()) ) {
-        MemEvent *ev = new MemEvent(this, ptr, ptr, GetS);
-        ev->setSize(blocksize);
-        ev->setFlag(MemEvent::F_NONCACHEABLE);
-        ev->setDst(networkLink->findTargetDestination(ptr));
-        req->loadKeys.insert(ev->getID());
-        networkLink->send(ev);
-        ptr += blocksize;
+
+    if ( req->bytesRemaining == 0 ) {
+        commandLink->send(req->command);
+        delete req;
+        return;
+    }
+
+    activeRequests.push_back(req);
+    for ( std::vector<DMACommand::Segment>::iterator it = req->command->segments.begin(); it != req->command->segments.end(); it++ ) {
+        addChunks(req, it->src, it->dst, it->size);
     }
-    activeRequests.insert(req);
-    */
 }
 
 
-void DMAEngine::processPacket(Request *req, MemEventBase *ev)
+/*
+ * Split a segment into bursts.  The segment is cut at line boundaries of
+ * both the source and the destination, and consecutive pieces are then
+ * combined while they stay within max_burst_size and go to the same
+ * memory on both the read and the write side.
+ */
+void DMAEngine::addChunks(Request *req, Addr src, Addr dst, size_t size)
 {
-    assert(0);
-    /*  Needs to be updated with current MemHierarchy Commands/States, MemHierarchyInterface
-    if ( ev->getCmd() == GetSResp) {
-        if ( !req->loadKeys.count(ev->getResponseToID()) ) {
-            dbg.fatal(CALL_INFO, 1, "Received GetSResp, but we don't have a corresponding request in loadKeys!\n");
+    while ( size > 0 ) {
+        Chunk chunk = { req, src, dst, 0 };
+        std::string srcTarget = networkLink->findTargetDestination(src);
+        std::string dstTarget = networkLink->findTargetDestination(dst);
+
+        while ( size > 0 ) {
+            uint64_t piece = std::min(lineSize - (src % lineSize), lineSize - (dst % lineSize));
+            piece = std::min(piece, (uint64_t)size);
+
+            if ( chunk.size != 0 ) {
+                if ( chunk.size + piece > maxBurstSize ) break;
+                if ( networkLink->findTargetDestination(src) != srcTarget ) break;
+                if ( networkLink->findTargetDestination(dst) != dstTarget ) break;
+            }
+
+            chunk.size += piece;
+            src += piece;
+            dst += piece;
+            size -= piece;
         }
-        size_t offset = ev->getAddr() - req->getSrc();
-        req->loadKeys.erase(ev->getResponseToID());
-        MemEvent *storeEV = new MemEvent(this, (req->getDst() + offset), (req->getDst() + offset), GetX);
+        chunkQueue.push_back(chunk);
+    }
+}
+
+
+void DMAEngine::handleNetworkEvent(SST::Event *ev)
+{
+    MemEvent * me = static_cast<MemEvent*>(ev);
+    Chunk chunk;
+    if ( !outstanding.remove(me->getResponseToID(), &chunk) ) {
+        dbg.fatal(CALL_INFO, 1, "Received response for which we have no request waiting. ID received: (%" PRIu64 ", %d)\n",
+                me->getResponseToID().first, me->getResponseToID().second);
+    }
+    processPacket(chunk, me);
+    delete me;
+}
+
+
+void DMAEngine::processPacket(Chunk &chunk, MemEvent *ev)
+{
+    if ( ev->getCmd() == Command::GetSResp ) {
+        MemEvent *storeEV;
+        if ( ev->getPayload().size() == chunk.size )
+            storeEV = new MemEvent(this, chunk.dst, chunk.dst & ~(lineSize - 1), Command::GetX, ev->getPayload());
+        else
+            storeEV = new MemEvent(this, chunk.dst, chunk.dst & ~(lineSize - 1), Command::GetX, chunk.size);
         storeEV->setFlag(MemEvent::F_NONCACHEABLE);
-        storeEV->setPayload(ev->getPayload());
-        storeEV->setDst(networkLink->findTargetDestination(req->getDst() + offset));
-        req->storeKeys.insert(storeEV->getID());
-        networkLink->send(storeEV);
-    } else if ( ev->getCmd() == GetXResp ) {
-        bytesTransferred += ev->getSize();
-        req->storeKeys.erase(ev->getResponseToID());
-        if ( req->storeKeys.empty() ) {
+        storeEV->setDst(networkLink->findTargetDestination(chunk.dst));
+        outstanding.insert(storeEV->getID(), chunk);
+        writeQueue.push_back(storeEV);
+    } else if ( ev->getCmd() == Command::GetXResp ) {
+        Request * req = chunk.req;
+        bytesTransferred += chunk.size;
+        req->bytesRemaining -= chunk.size;
+        if ( req->bytesRemaining == 0 ) {
             // Done with this request.
-            activeRequests.erase(req);
+            activeRequests.erase(std::find(activeRequests.begin(), activeRequests.end(), req));
             commandLink->send(req->command);
-            dbg.debug(_L10_, "Request to transfer 0x%" PRIx64 " to 0x%" PRIx64 " is complete.\n", req->getSrc(), req->getDst());
+            dbg.debug(_L10_, "Request to transfer 0x%" PRIx64 " to 0x%" PRIx64 " is complete.\n", req->command->src, req->command->dst);
             delete req;
         }
     } else {
-	dbg.fatal(CALL_INFO, 1, "Received unexpected message %s 0x%" PRIx64 " from %s\n", CommandString[ev->getCmd()], ev->getAddr(), ev->getSrc().c_str());
+        dbg.fatal(CALL_INFO, 1, "Received unexpected message %s 0x%" PRIx64 " from %s\n", CommandString[(int)ev->getCmd()], ev->getAddr(), ev->getSrc().c_str());
     }
-    */
 }
 
 
 /* Returns true if there is overlap */
 bool DMAEngine::findOverlap(DMACommand *c1, DMACommand *c2) const
 {
-    return (findOverlap(c1->src, c1->size, c2->src, c2->size) ||
-            findOverlap(c1->src, c1->size, c2->dst, c2->size) ||
-            findOverlap(c1->dst, c1->size, c2->src, c2->size) ||
-            findOverlap(c1->dst, c1->size, c2->dst, c2->size));
+    for ( std::vector<DMACommand::Segment>::const_iterator i = c1->segments.begin(); i != c1->segments.end(); i++ ) {
+        for ( std::vector<DMACommand::Segment>::const_iterator j = c2->segments.begin(); j != c2->segments.end(); j++ ) {
+            if ( findOverlap(i->src, i->size, j->dst, j->size) ||
+                 findOverlap(i->dst, i->size, j->src, j->size) ||
+                 findOverlap(i->dst, i->size, j->dst, j->size) )
+                return true;
+        }
+    }
+    return false;
 }
 
 
@@ -220,18 +299,5 @@ bool DMAEngine::findOverlap(Addr a1, size_t s1, Addr a2, size_t s2) const
     Addr end1 = a1 + s1;
     Addr end2 = a2 + s2;
 
-    return (( a1 <= end2 ) || ( a2 <= end1 ));
+    return ( a1 < end2 ) && ( a2 < end1 );
 }
-
-
-DMAEngine::Request* DMAEngine::findRequest(SST::Event::id_type id)
-{
-    for ( std::set<Request*>::iterator i = activeRequests.begin() ; i != activeRequests.end() ; ++i ) {
-        Request *req = (*i);
-        if ( req->loadKeys.count(id) || req->storeKeys.count(id) )
-            return req;
-    }
-    return NULL;
-}
-
-
@@ -18,6 +18,7 @@
 
 
 
+#include <deque>
 #include <vector>
 
 #include <sst/core/event.h>
@@ -26,30 +27,76 @@
 #include <sst/core/output.h>
 
 #include "sst/elements/memHierarchy/memEvent.h"
-#include "sst/elements/memHierarchy/memNIC.h"
+#include "sst/elements/memHierarchy/memLinkBase.h"
+#include "sst/elements/memHierarchy/idSlotTable.h"
 
 
 namespace SST {
 namespace MemHierarchy {
 
-/* Send this to the DMAEngine to cause a DMA.  Returned when complete. */
+/* Send this to the DMAEngine to cause a DMA.  Returned when complete.
+ * A command is either a single contiguous copy (dst, src, size) or a
+ * scatter-gather list of segments; in the latter case 'size' is the total
+ * number of bytes.
+ */
 class DMACommand : public Event {
 private:
     static uint64_t main_id;
     SST::Event::id_type event_id;
 public:
+    struct Segment {
+        Addr dst;
+        Addr src;
+        size_t size;
+    };
+
     Addr dst;
     Addr src;
     size_t size;
+    std::vector<Segment> segments;
+
     DMACommand(const Component *origin, Addr dst, Addr src, size_t size) :
         Event(), dst(dst), src(src), size(size)
     {
       event_id = std::make_pair(main_id++, origin->getId());
+      Segment seg = { dst, src, size };
+      segments.push_back(seg);
+    }
+
+    DMACommand(const Component *origin, const std::vector<Segment>& sgList) :
+        Event(), dst(0), src(0), size(0), segments(sgList)
+    {
+      event_id = std::make_pair(main_id++, origin->getId());
+      if (!segments.empty()) {
+          dst = segments.front().dst;
+          src = segments.front().src;
+      }
+      for (std::vector<Segment>::const_iterator it = segments.begin(); it != segments.end(); it++)
+          size += it->size;
     }
     SST::Event::id_type getID(void) const { return event_id; }
 
+    void serialize_order(SST::Core::Serialization::serializer &ser) override {
+        Event::serialize_order(ser);
+        ser & event_id;
+        ser & dst;
+        ser & src;
+        ser & size;
+        size_t numSegments = segments.size();
+        ser & numSegments;
+        if ( ser.mode() == SST::Core::Serialization::serializer::UNPACK )
+            segments.resize(numSegments);
+        for ( size_t i = 0; i < numSegments; i++ ) {
+            ser & segments[i].dst;
+            ser & segments[i].src;
+            ser & segments[i].size;
+        }
+    }
+
 private:
     DMACommand() {} // For serialization
+
+    ImplementSerializable(SST::MemHierarchy::DMACommand);
 };
 
 
@@ -65,38 +112,65 @@ public:
             {"clockRate",       "Clock Rate for processing DMAs.", "1GHz"},
             {"netAddr",         "Network address of component.", NULL},
             {"network_num_vc",  "DEPRECATED. Number of virtual channels (VCs) on the on-chip network. memHierarchy only uses one VC.", "1"},
-            {"printStats",      "0 (default): Don't print, 1: STDOUT, 2: STDERR, 3: FILE.", "0"} )
+            {"printStats",      "0 (default): Don't print, 1: STDOUT, 2: STDERR, 3: FILE.", "0"},
+            {"line_size",       "(string) Granularity at which transfers are split before being combined into bursts.", "64B"},
+            {"max_burst_size",  "(string) Largest request sent to memory. Contiguous lines with the same destination are combined up to this size.", "512B"},
+            {"max_outstanding", "(uint) Maximum number of read and write requests outstanding in the network.", "16"},
+            {"max_issue_per_cycle", "(uint) Maximum number of requests issued per cycle.", "1"},
+            {"max_active_commands", "(uint) Maximum number of non-overlapping commands processed concurrently.", "4"} )
+
+    SST_ELI_DOCUMENT_PORTS( 
+            {"netLink", "Network Link", {"memHierarchy.MemRtrEvent"} },
+            {"cmdLink", "Link on which DMACommands are received and returned on completion", {"memHierarchy.DMACommand"} } )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+            {"burst_size",      "Size in bytes of each read burst sent to memory", "bytes", 1},
+            {"window_full",     "Cycles in which a read could not be issued because max_outstanding was reached", "cycles", 1} )
 
-    SST_ELI_DOCUMENT_PORTS( {"netLink", "Network Link", {"memHierarchy.MemRtrEvent"} } )
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS( {"memlink", "Link manager to memory. Defaults to a MemNIC on port 'netLink'.", "SST::MemHierarchy::MemLinkBase"} )
 
 /* Begin class definition */
 private:
+    /* A command being processed */
     struct Request {
         DMACommand *command;
-        std::set<SST::Event::id_type> loadKeys;
-        std::set<SST::Event::id_type> storeKeys;
-
-        Addr getDst() const { return command->dst; }
-        Addr getSrc() const { return command->src; }
-        size_t getSize() const { return command->size; }
+        size_t bytesRemaining;  // Bytes not yet written
 
         Request(DMACommand *cmd) :
-            command(cmd)
+            command(cmd), bytesRemaining(cmd->size)
         { }
     };
 
+    /* A piece of a command: one read burst from src and one write burst to dst */
+    struct Chunk {
+        Request * req;
+        Addr src;
+        Addr dst;
+        uint32_t size;
+    };
+
     std::deque<DMACommand*> commandQueue;
-    std::set<Request*> activeRequests;
+    std::vector<Request*> activeRequests;
+    std::deque<Chunk> chunkQueue;           // Chunks waiting to be read, in command order
+    std::deque<MemEvent*> writeQueue;       // Writes waiting to be issued, already counted in the window
+    IDSlotTable<Chunk> outstanding;         // In-flight reads and writes by event ID
 
     Output dbg;
-    uint64_t blocksize;
+    uint64_t lineSize;
+    uint64_t maxBurstSize;
+    uint32_t maxOutstanding;
+    uint32_t maxIssuePerCycle;
+    uint32_t maxActiveCommands;
     Output::output_location_t statsOutputTarget;
     uint64_t numTransfers;
     uint64_t bytesTransferred;
+    uint64_t numRequests;
 
+    Statistic<uint64_t>* stat_burstSize;
+    Statistic<uint64_t>* stat_windowFull;
 
     Link *commandLink;
-    MemNIC *networkLink;
+    MemLinkBase *networkLink;
 
 public:
     DMAEngine(ComponentId_t id, Params& params);
@@ -112,16 +186,15 @@ private:
 
     bool isIssuable(DMACommand *cmd) const;
     void startRequest(Request *req);
-    void processPacket(Request *req, MemEventBase *ev);
+    void addChunks(Request *req, Addr src, Addr dst, size_t size);
+    void handleNetworkEvent(SST::Event *ev);
+    void processPacket(Chunk &chunk, MemEvent *ev);
 
     bool findOverlap(DMACommand *c1, DMACommand *c2) const;
     bool findOverlap(Addr a1, size_t s1, Addr a2, size_t s2) const;
-    Request* findRequest(SST::Event::id_type id);
-    //std::string findTargetDirectory(Addr addr); Moved to MemNIC
 };
 
 }
 }
 
 #endif
-
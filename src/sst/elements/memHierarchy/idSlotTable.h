@@ -0,0 +1,152 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _MEMHIERARCHY_IDSLOTTABLE_H_
+#define _MEMHIERARCHY_IDSLOTTABLE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+#include <sst/core/event.h>
+
+namespace SST { namespace MemHierarchy {
+
+/*
+ * Table of outstanding requests keyed by event ID (or by address).
+ *
+ * Used in place of std::map<Event::id_type, V> on paths where every
+ * request inserts and every response removes an entry.  Entries live in
+ * an open-addressed slot array (linear probing, backward-shift delete),
+ * so steady-state inserts and removals do not allocate and lookups touch
+ * one or two cache lines.  The table doubles when it is half full.
+ */
+template<typename V, typename K = SST::Event::id_type>
+class IDSlotTable {
+public:
+    typedef K key_type;
+
+    IDSlotTable(size_t capacity = 64) : count(0) {
+        size_t n = 16;
+        while (n < capacity * 2) n <<= 1;
+        slots.resize(n);
+    }
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    /* Insert or overwrite */
+    void insert(const key_type& id, const V& value) {
+        if ((count + 1) * 2 > slots.size()) grow();
+        size_t i = find(id);
+        if (!slots[i].used) {
+            slots[i].used = true;
+            slots[i].id = id;
+            count++;
+        }
+        slots[i].value = value;
+    }
+
+    /* Returns a pointer to the value for 'id' or NULL if there is none */
+    V* lookup(const key_type& id) {
+        size_t i = find(id);
+        return slots[i].used ? &slots[i].value : nullptr;
+    }
+
+    bool contains(const key_type& id) const {
+        return slots[find(id)].used;
+    }
+
+    /* Removes 'id' and returns true if it was present.  The value is copied out if 'value' is not NULL. */
+    bool remove(const key_type& id, V* value = nullptr) {
+        size_t i = find(id);
+        if (!slots[i].used) return false;
+        if (value) *value = slots[i].value;
+        erase(i);
+        return true;
+    }
+
+    /* Visit every entry, order is unspecified */
+    template<typename F>
+    void forEach(F func) {
+        for (size_t i = 0; i < slots.size(); i++) {
+            if (slots[i].used) func(slots[i].id, slots[i].value);
+        }
+    }
+
+private:
+    struct Slot {
+        Slot() : used(false), value() { }
+        bool used;
+        key_type id;
+        V value;
+    };
+
+    static size_t hash(const SST::Event::id_type& id) {
+        return mix(id.first ^ ((uint64_t)id.second << 48));
+    }
+
+    static size_t hash(uint64_t addr) {
+        return mix(addr);
+    }
+
+    static size_t mix(uint64_t key) {
+        uint64_t h = key * UINT64_C(0x9E3779B97F4A7C15);
+        return h ^ (h >> 29);
+    }
+
+    size_t find(const key_type& id) const {
+        size_t mask = slots.size() - 1;
+        size_t i = hash(id) & mask;
+        while (slots[i].used && slots[i].id != id) i = (i + 1) & mask;
+        return i;
+    }
+
+    void erase(size_t i) {
+        slots[i].used = false;
+        slots[i].value = V();
+        count--;
+        // Backward-shift the rest of the probe cluster so lookups stay correct
+        size_t mask = slots.size() - 1;
+        size_t j = i;
+        while (true) {
+            j = (j + 1) & mask;
+            if (!slots[j].used) break;
+            size_t home = hash(slots[j].id) & mask;
+            if (((j - home) & mask) >= ((j - i) & mask)) {
+                slots[i] = slots[j];
+                slots[j].used = false;
+                slots[j].value = V();
+                i = j;
+            }
+        }
+    }
+
+    void grow() {
+        std::vector<Slot> old;
+        old.swap(slots);
+        slots.resize(old.size() * 2);
+        for (size_t i = 0; i < old.size(); i++) {
+            if (old[i].used) slots[find(old[i].id)] = old[i];
+        }
+    }
+
+    std::vector<Slot> slots;
+    size_t count;
+};
+
+}}
+
+#endif /* _MEMHIERARCHY_IDSLOTTABLE_H_ */
@@ -21,6 +21,7 @@
 #include <sst/core/output.h>
 
 #include "sst/elements/memHierarchy/memTypes.h"
+#include "sst/elements/memHierarchy/payloadBuffer.h"
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/replacementManager.h"
 
@@ -134,12 +135,12 @@ class DataLine {
     private:
         const unsigned int index_;
         Addr addr_;
-        vector<uint8_t> data_;
+        PayloadBuffer data_;
         DirectoryLine* tag_;
         CoherenceReplacementInfo* info_;
     public:
         DataLine(uint8_t size, unsigned int index) : index_(index), addr_(0), tag_(nullptr) {
-            data_.resize(size);
+            data_.write().resize(size);
             info_ = new CoherenceReplacementInfo(index, I, false, false);
         }
         virtual ~DataLine() { }
@@ -163,9 +164,15 @@ class DataLine {
         DirectoryLine* getTag() { return tag_; }
 
         // Data
-        vector<uint8_t>* getData() { return &data_; }
-        void setData(vector<uint8_t> data, uint32_t offset) {
-            std::copy(data.begin(), data.end(), data_.begin() + offset);
+        vector<uint8_t>* getData() { return &data_.write(); }
+        const PayloadBuffer* getDataBuffer() { return &data_; }
+        void setData(const vector<uint8_t>& data, uint32_t offset) {
+            vector<uint8_t>& line = data_.write();
+            std::copy(data.begin(), data.end(), line.begin() + offset);
+        }
+        void setData(const PayloadBuffer& data, uint32_t offset) {
+            if (offset == 0 && data.size() == data_.size()) data_ = data; // Whole line, share it
+            else setData(data.read(), offset);
         }
         
         // Replacement
@@ -183,7 +190,7 @@ class CacheLine {
         const unsigned int index_;
         Addr addr_;
         State state_;
-        vector<uint8_t> data_;
+        PayloadBuffer data_;
             
         // Timing
         uint64_t lastSendTimestamp_;
@@ -194,7 +201,7 @@ class CacheLine {
         virtual void updateReplacement() = 0;
     public:
         CacheLine(uint32_t size, unsigned int index) : index_(index), addr_(0), state_(I), lastSendTimestamp_(0), wasPrefetch_(false) {
-            data_.resize(size);
+            data_.write().resize(size);
         }
         virtual ~CacheLine() { }
         
@@ -216,9 +223,15 @@ class CacheLine {
         void setState(State state) { state_ = state; updateReplacement(); }
 
         // Data
-        vector<uint8_t>* getData() { return &data_; }
-        void setData(vector<uint8_t> in, uint32_t offset) {
-            std::copy(in.begin(), in.end(), std::next(data_.begin(), offset));
+        vector<uint8_t>* getData() { return &data_.write(); }
+        const PayloadBuffer* getDataBuffer() { return &data_; }
+        void setData(const vector<uint8_t>& in, uint32_t offset) {
+            vector<uint8_t>& line = data_.write();
+            std::copy(in.begin(), in.end(), std::next(line.begin(), offset));
+        }
+        void setData(const PayloadBuffer& in, uint32_t offset) {
+            if (offset == 0 && in.size() == data_.size()) data_ = in; // Whole line, share it
+            else setData(in.read(), offset);
         }
 
         // Timestamp
@@ -24,6 +24,7 @@
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/memEventBase.h"
 #include "sst/elements/memHierarchy/memTypes.h"
+#include "sst/elements/memHierarchy/payloadBuffer.h"
 
 namespace SST { namespace MemHierarchy {
 
@@ -201,18 +202,36 @@ public:
     bool fromHighNetNACK()  { return !CommandCPUSide[(int)cmd_];}
     bool fromLowNetNACK()   { return CommandCPUSide[(int)cmd_];}
 
-    /** @return  the data payload. */
+    /** @return  the data payload, writable.
+     * The payload may be shared with other events, MSHR entries, or cache lines
+     * and is copied here first if it is. Use getPayloadBuffer() to pass the
+     * data on without modifying it.
+     */
     dataVec& getPayload(void) {
         /* Lazily allocate space for payload */
-        if ( payload_.size() < size_ )  payload_.resize(size_);
-        return payload_;
+        if ( payload_.size() < size_ )  payload_.write().resize(size_);
+        return payload_.write();
     }
     
+    /** @return  the data payload as a shareable buffer */
+    const PayloadBuffer& getPayloadBuffer(void) {
+        /* Lazily allocate space for payload */
+        if ( payload_.size() < size_ )  payload_.write().resize(size_);
+        return payload_;
+    }
 
     /** Sets the data payload and payload size.
      * @param[in] data  Vector from which to copy data
      */
-    void setPayload(std::vector<uint8_t>& data) {
+    void setPayload(const std::vector<uint8_t>& data) {
+        setSize(data.size());
+        payload_.assign(data);
+    }
+    
+    /** Sets the data payload and payload size without copying the data.
+     * @param[in] data  Buffer to share
+     */
+    void setPayload(const PayloadBuffer& data) {
         setSize(data.size());
         payload_ = data;
     }
@@ -223,16 +242,18 @@ public:
      */
     void setPayload(uint32_t size, uint8_t* data) {
         setSize(size);
-        payload_.resize(size);
+        payload_.clear();   // Don't copy a shared payload just to overwrite it
+        dataVec& payload = payload_.write();
+        payload.resize(size);
         for ( uint32_t i = 0 ; i < size ; i++ ) {
-            payload_[i] = data[i];
+            payload[i] = data[i];
         }
     }
 
     void setZeroPayload(uint32_t size) {
         setSize(size);
         payload_.clear();
-        payload_.resize(size, 0);
+        payload_.write().resize(size, 0);
     }
 
     size_t getPayloadSize() override {
@@ -305,7 +326,7 @@ private:
     bool            addrGlobal_;        // Whether address is a local or global address 
     MemEvent*       NACKedEvent_;       // For a NACK, pointer to the NACKed event
     int             retries_;           // For NACKed events, how many times a retry has been sent
-    dataVec         payload_;           // Data
+    PayloadBuffer   payload_;           // Data, shared with copies of this event until one writes it
     bool            prefetch_;          // Whether this request came from a prefetcher
     bool            blocked_;           // Whether this request blocked for another pending request (for profiling) TODO move to mshrs
     bool            dirty_;             // For a replacement, whether the data is dirty or not
@@ -325,7 +346,10 @@ public:
         ser & addrGlobal_;
         ser & NACKedEvent_;
         ser & retries_;
-        ser & payload_;
+        if (ser.mode() == SST::Core::Serialization::serializer::UNPACK)
+            ser & payload_.write();
+        else
+            ser & const_cast<dataVec&>(payload_.read());
         ser & prefetch_;
         ser & blocked_;
         ser & dirty_;
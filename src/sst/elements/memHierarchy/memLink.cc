@@ -107,11 +107,11 @@ void MemLink::addRemote(EndpointInfo info) {
     remotes.insert(info);
 }
 
-bool MemLink::isDest(std::string UNUSED(str)) {
+bool MemLink::isDest(const std::string &UNUSED(str)) {
     return true;
 }
 
-bool MemLink::isSource(std::string UNUSED(str)) {
+bool MemLink::isSource(const std::string &UNUSED(str)) {
     return true;
 }
 
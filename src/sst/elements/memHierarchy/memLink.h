@@ -101,8 +101,8 @@ public:
     /* Remote endpoint info management */
     virtual std::set<EndpointInfo>* getSources();
     virtual std::set<EndpointInfo>* getDests();
-    virtual bool isDest(std::string UNUSED(str));
-    virtual bool isSource(std::string UNUSED(str));
+    virtual bool isDest(const std::string &UNUSED(str));
+    virtual bool isSource(const std::string &UNUSED(str));
     virtual std::string findTargetDestination(Addr addr);
     
     /* Send and receive functions for MemLink */
@@ -115,8 +115,8 @@ public:
     virtual std::set<EndpointInfo>* getSources() =0;
     virtual std::set<EndpointInfo>* getDests() =0;
 
-    virtual bool isDest(std::string UNUSED(str)) =0;
-    virtual bool isSource(std::string UNUSED(str)) =0;
+    virtual bool isDest(const std::string &UNUSED(str)) =0;
+    virtual bool isSource(const std::string &UNUSED(str)) =0;
 
     MemRegion getRegion() { return info.region; }
     void setRegion(MemRegion region) { info.region = region; }
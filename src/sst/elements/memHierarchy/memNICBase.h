@@ -18,6 +18,7 @@
 
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <queue>
 
 #include <sst/core/event.h>
@@ -137,19 +138,10 @@ class MemNICBase : public MemLinkBase {
             return nullptr;
         }
 
-        virtual bool isSource(std::string str) { /* Note this is only used during init so doesn't need to be fast */
-            for (std::set<EndpointInfo>::iterator it = sourceEndpointInfo.begin(); it != sourceEndpointInfo.end(); it++) {
-                if (it->name == str) return true;   
-            }
-            return false;
-        }
-
-        virtual bool isDest(std::string str) { /* Note this is only used during init so doesn't need to be fast */
-            for (std::set<EndpointInfo>::iterator it = destEndpointInfo.begin(); it != destEndpointInfo.end(); it++) {
-                if (it->name == str) return true;   
-            }
-            return false;
-        }
+        /* Called for every broadcast init event each endpoint receives, so these are hashed.
+         * This only makes the lookups O(1); each endpoint still receives O(N) broadcast events during init */
+        virtual bool isSource(const std::string &str) { return sourceNames.find(str) != sourceNames.end(); }
+        virtual bool isDest(const std::string &str) { return destNames.find(str) != destNames.end(); }
 
         virtual bool isClocked() { return true; } // Tell parent to trigger our clock
 
@@ -172,8 +164,8 @@ class MemNICBase : public MemLinkBase {
         }
     
     protected:
-        virtual void addSource(EndpointInfo info) { sourceEndpointInfo.insert(info); }
-        virtual void addDest(EndpointInfo info) { destEndpointInfo.insert(info); }
+        virtual void addSource(EndpointInfo info) { sourceEndpointInfo.insert(info); sourceNames.insert(info.name); }
+        virtual void addDest(EndpointInfo info) { destEndpointInfo.insert(info); destNames.insert(info.name); }
 
         virtual InitMemRtrEvent* createInitMemRtrEvent() {
             return new InitMemRtrEvent(info);
@@ -339,6 +331,8 @@ class MemNICBase : public MemLinkBase {
         std::unordered_map<std::string,uint64_t> networkAddressMap; // Map of name -> address for each network endpoint
         std::set<EndpointInfo> sourceEndpointInfo;
         std::set<EndpointInfo> destEndpointInfo;
+        std::unordered_set<std::string> sourceNames; // Names in sourceEndpointInfo, use addSource() to keep these in step
+        std::unordered_set<std::string> destNames;   // Names in destEndpointInfo, use addDest() to keep these in step
 
         // Init queues
         std::queue<MemRtrEvent*> initQueue; // Queue for received init events
@@ -33,13 +33,13 @@ using namespace HBMDRAMSim;
 
 #ifndef SST_ENABLE_PREVIEW_BUILD  // inserted by script
 HBMpagedMultiMemory::HBMpagedMultiMemory(Component *comp, Params &params)
-  : HBMDRAMSimMemory(comp, params), pagesInFast(0), lastMin(0) {
+  : HBMDRAMSimMemory(comp, params), pagesInFast(0) {
       build(params);
   }
 #endif  // inserted by script
 
 HBMpagedMultiMemory::HBMpagedMultiMemory(ComponentId_t id, Params &params)
-  : HBMDRAMSimMemory(id, params), pagesInFast(0), lastMin(0) {
+  : HBMDRAMSimMemory(id, params), pagesInFast(0) {
       build(params); 
   }
 
@@ -149,31 +149,31 @@ void HBMpagedMultiMemory::build(Params& params) {
 }
 
 // should we add it?
-bool HBMpagedMultiMemory::checkAdd(HBMpageInfo &page) {
+bool HBMpagedMultiMemory::checkAdd(pageInfo &page) {
     // only add if the dram isn't too busy
     if (dramBackpressure && dramQ.size() >= 4) return false;
 
 
     switch (addStrat) {
     case addT:
-        return (page.touched > threshold);
+        return (pages.touches(page) > threshold);
         break;
     case addMRPU:
     case addMFRPU:
         {
             // based on threshold and if the most recent previous use is
             // more recent than the least recently used page in fast
-            if (pageList.empty()) return (page.lastTouch > threshold); // startup case
+            if (pages.listEmpty()) return (page.lastTouch > threshold); // startup case
 
             SimTime_t myLastTouch = page.lastTouch;
-            const auto &victimPage = pageList.back();
+            const pageInfo *victimPage = pages.listBack();
             if (myLastTouch > victimPage->lastTouch) {
 	      if (addStrat == addMFRPU) {
 		// more recent && more frequent
-		return (page.touched > threshold) && (page.touched > victimPage->touched); 
+		return (pages.touches(page) > threshold) && (pages.touches(page) > pages.touches(*victimPage)); 
 	      } else {
                 // more recent
-                return (page.touched > threshold); 
+                return (pages.touches(page) > threshold); 
 	      }
             } else {
                 return false;
@@ -183,13 +183,13 @@ bool HBMpagedMultiMemory::checkAdd(HBMpageInfo &page) {
 
     case addSCF:
       {
-            if (pageList.empty()) return (page.lastTouch > threshold); // startup case
+            if (pages.listEmpty()) return (page.lastTouch > threshold); // startup case
 
-            if (page.touched > threshold) {
+            if (pages.touches(page) > threshold) {
 	        SimTime_t myLastTouch = page.lastTouch;
-	        const auto &victimPage = pageList.back();
+	        const pageInfo *victimPage = pages.listBack();
 
-		if (page.touched > victimPage->touched) {
+		if (pages.touches(page) > pages.touches(*victimPage)) {
 		  if (page.scanLeng > scanThreshold) {
                     // roughly 1:1000 chance
                     return (rng->generateNextUInt32() & 0x3ff) == 0;
@@ -206,7 +206,7 @@ bool HBMpagedMultiMemory::checkAdd(HBMpageInfo &page) {
       }
     case addSC:
         {
-            if (page.touched > threshold) {
+            if (pages.touches(page) > threshold) {
                 if (page.scanLeng > scanThreshold) {
                     // roughly 1:1000 chance
                     return (rng->generateNextUInt32() & 0x3ff) == 0;
@@ -219,7 +219,7 @@ bool HBMpagedMultiMemory::checkAdd(HBMpageInfo &page) {
         }
         return 0;
     case addRAND:
-        if (page.touched > threshold) {
+        if (pages.touches(page) > threshold) {
             if (pagesInFast < maxFastPages) { // there is room to spare!
                 // roughly 1:1000 chance
                 return (rng->generateNextUInt32() & 0x3ff) == 0;
@@ -236,8 +236,8 @@ bool HBMpagedMultiMemory::checkAdd(HBMpageInfo &page) {
     }
 }
 
-void HBMpagedMultiMemory::do_FIFO_LRU( HBMpageInfo &page, bool &inFast, bool &swapping) {  
-    swapping = 0;
+void HBMpagedMultiMemory::do_FIFO_LRU( pageInfo &page, bool &inFast, bool &swapping) {  
+    swapping = 0; 
     if (0 == page.inFast) {
         // not in fast
         if (checkAdd(page)) { // we're hitting it "a lot"
@@ -245,38 +245,28 @@ void HBMpagedMultiMemory::do_FIFO_LRU( HBMpageInfo &page, bool &inFast, bool &sw
                 // put it in
                 page.inFast = 1;
                 pagesInFast++;
-                pageList.push_front(&page); // put in FIFO/list
-                page.listEntry = pageList.begin();
+                pages.listPushFront(&page); // put in FIFO/list
                 swapping = 1;
                 if (modelSwaps) {moveToFast(page);}
             } else {
                 // kick someone out
-                HBMpageInfo *victimPage = pageList.back();
-                HBMpageInfo::pageListIter e = pageList.end();
-                bool found = 0;
-                while (e != pageList.begin()) {
-                    e--;
-                    victimPage = *e;
-                    if (victimPage->swapDir == HBMpageInfo::NONE) {
-                        found = 1;
-                        break;
-                    }
+                pageInfo *victimPage = pages.listBack();
+                while (victimPage && victimPage->swapDir != pageInfo::NONE) {
+                    victimPage = pages.listPrev(victimPage);
                 }
-                assert(e == victimPage->listEntry);
 
-                if (!found) {
+                if (!victimPage) {
                     // don't move anything.
                     inFast = 0;
                     swapping = 0;
                     page.lastTouch = getCurrentSimTimeNano(); // for mrpu
-                    dbg.debug(_L10_, "no pages to swap out (%d candidates)\n", (int)pageList.size());
+                    dbg.debug(_L10_, "no pages to swap out (%d candidates)\n", (int)pages.listCount());
                     cantSwapOut->addData(1);
                     return;
                 }
 
                 victimPage->inFast = 0;
-                victimPage->listEntry = pageList.end();
-                pageList.erase(e);
+                pages.listErase(victimPage);
                 if (modelSwaps) {moveToSlow(victimPage);}
                 
                 // put this one in
@@ -284,17 +274,12 @@ void HBMpagedMultiMemory::do_FIFO_LRU( HBMpageInfo &page, bool &inFast, bool &sw
                 swapping = 1;
                 if (modelSwaps) {moveToFast(page);}
                 if ((replaceStrat == BiLRU) && ((rng->generateNextUInt32() & 0x7f) == 0)) { // roughly 1:128 chance
-                    pageList.push_back(&page); // put in back of list
-                    HBMpageInfo::pageListIter le = pageList.end(); le--;
-                    page.listEntry = le;
+                    pages.listPushBack(&page); // put in back of list
                 } else if ((replaceStrat == SCLRU) && (page.scanLeng > scanThreshold)) {
                     // put "scan-y" pages at the back
-                    pageList.push_back(&page); // put in back of list
-                    HBMpageInfo::pageListIter le = pageList.end(); le--;
-                    page.listEntry = le;
+                    pages.listPushBack(&page); // put in back of list
                 } else {
-                    pageList.push_front(&page); // put in front of FIFO/list
-                    page.listEntry = pageList.begin();
+                    pages.listPushFront(&page); // put in front of FIFO/list
                 }
 
                 fastSwaps->addData(1);
@@ -311,9 +296,8 @@ void HBMpagedMultiMemory::do_FIFO_LRU( HBMpageInfo &page, bool &inFast, bool &sw
 	    ;
 	  } else {
 	    // move to the front of list
-	    pageList.erase(page.listEntry);
-	    pageList.push_front(&page);
-	    page.listEntry = pageList.begin();
+	    pages.listErase(&page);
+	    pages.listPushFront(&page);
 	  }
         }
 
@@ -322,55 +306,48 @@ void HBMpagedMultiMemory::do_FIFO_LRU( HBMpageInfo &page, bool &inFast, bool &sw
     page.lastTouch = getCurrentSimTimeNano(); // for mrpu       
 }
 
-void HBMpagedMultiMemory::do_LFU( Addr addr, HBMpageInfo &page, bool &inFast, bool &swapping) {
-    const uint64_t pageAddr = addr >> pageShift;
+void HBMpagedMultiMemory::do_LFU( Addr addr, pageInfo &page, bool &inFast, bool &swapping) {
     inFast = 0;
     swapping = 0;
 
     // if we are hitting it "a lot" see if we can put it in fast
-    if ((0 == page.inFast) && (page.touched > threshold)) { 
+    if ((0 == page.inFast) && (pages.touches(page) > threshold)) { 
         if (pagesInFast < maxFastPages) {
             // put it in
             page.inFast = 1;
             pagesInFast++;
             swapping = 1;
             if (modelSwaps) {moveToFast(page);}
+            else {pages.addResident(&page);}
         } else {
             if (maxFastPages > 0) {
-	      if(page.touched > lastMin) {
-                // we're full, search for someone to bump
-	        lastMin = std::numeric_limits<uint>::max(); // UINT_MAX;
-	        const auto endP = pageMap.end();
-                bool found = 0;
-                for (auto p = pageMap.begin(); p != endP; ++p) {
-		  if ((p->second.inFast == 1) && (p->first != pageAddr)) {
-		    lastMin = min(lastMin, p->second.touched);
-		    if((p->second.touched < page.touched) &&
-                       (p->second.swapDir == HBMpageInfo::NONE)) { // make sure we don't bump someone in motion
-                        found = 1;
-                        p->second.inFast = 0; // rm old
-                        if (modelSwaps) {moveToSlow(&(p->second));}
-                        page.inFast = 1; // add new
-                        fastSwaps->addData(1);
-                        swapping = 1;
-                        if (modelSwaps) {moveToFast(page);}
-                        break;
-		    }
-		  }
-                } // end for
+                // we're full, bump the least touched fast page if it is
+                // touched less than this one. Pages in motion are not
+                // resident so they are never picked.
+                pageInfo *victimPage = pages.coldestResident();
 
-                if (!found) {
+                if (!victimPage) {
                     // don't move anything.
                     inFast = 0;
                     assert(page.inFast == 0);
                     swapping = 0;
                     page.lastTouch = getCurrentSimTimeNano(); // for mrpu
                     dbg.debug(_L10_, "no pages to swap out (%d candidates)\n", 
-                              (int)pageMap.size());
+                              (int)pagesInFast);
                     cantSwapOut->addData(1);
                     return;
                 }
-	      } 
+
+                if (pages.touches(*victimPage) < pages.touches(page)) {
+                    victimPage->inFast = 0; // rm old
+                    pages.removeResident(victimPage);
+                    if (modelSwaps) {moveToSlow(victimPage);}
+                    page.inFast = 1; // add new
+                    fastSwaps->addData(1);
+                    swapping = 1;
+                    if (modelSwaps) {moveToFast(page);}
+                    else {pages.addResident(&page);}
+                }
             }
         }
     } else {
@@ -383,9 +360,9 @@ bool HBMpagedMultiMemory::issueRequest(ReqId id, Addr addr, bool isWrite, unsign
     bool inFast = 0;
     bool swapping = 0;
     SimTime_t extraDelay = 0;
-    auto &page = pageMap[pageAddr];
+    pageInfo &page = pages.getPage(pageAddr);
 
-    page.record(addr, isWrite, getRequestor(id), collectStats, pageAddr, replaceStrat == LFU8);
+    pages.record(page, addr, isWrite, collectStats ? getRequestor(id) : std::string(), collectStats, pageAddr, replaceStrat == LFU8);
 
     if (maxFastPages > 0) {
         if (modelSwaps && pageIsSwapping(page)) {
@@ -476,17 +453,15 @@ void HBMpagedMultiMemory::printAccStats() {
   if (NULL == pFile) {
       dbg.fatal(CALL_INFO, -1, "Coulnd't open %s for output\n", buf);
   } else {
-      for (auto p = pageMap.begin(); p != pageMap.end(); ++p) {
-          p->second.printAndClearRecord(p->first, pFile);
-      }
+      pages.printAndClearRecords(pFile);
       fclose(pFile);
   }
 }
 
 void HBMpagedMultiMemory::finish(){
-    printf("fast_t_pages: %lu\n", pageMap.size());
+    printf("fast_t_pages: %zu\n", pages.numPages());
 
-    tPages->addData(pageMap.size());
+    tPages->addData(pages.numPages());
 
     if (collectStats) printAccStats();
 
@@ -513,7 +488,7 @@ void HBMpagedMultiMemory::handleSelfEvent(SST::Event *event){
         delete ev;
     } else if (modelSwaps && si_w != swapToFast_Writes.end()) {
         // this is from fast mem, indicating a transfer from slow.
-        HBMpageInfo *page = si_w->second;
+        pageInfo *page = si_w->second;
         page->swapsOut -= 1;
 	//printf(" got moveToFast write addr:%p ev:%p p:%p sO:%d\n", (void*)(req->baseAddr_ + req->amtInProcess_) ,ev, page, page->swapsOut);
         if (page->swapsOut == 0) {
@@ -533,23 +508,19 @@ void HBMpagedMultiMemory::handleSelfEvent(SST::Event *event){
 bool HBMpagedMultiMemory::quantaClock(SST::Cycle_t _cycle) {
     if (collectStats) printAccStats();
 
-    lastMin = 0;
-
-    for (auto p = pageMap.begin(); p != pageMap.end(); ++p) {
-      //p->second.touched = p->second.touched >> 4;
-      p->second.touched = 0;
-    }
+    // Touch counts are per quantum, this resets all of them
+    pages.newQuantum();
     return false;
 }
 
-void HBMpagedMultiMemory::moveToFast(HBMpageInfo &page) {
-    assert(page.swapDir == HBMpageInfo::NONE);
+void HBMpagedMultiMemory::moveToFast(pageInfo &page) {
+    assert(page.swapDir == pageInfo::NONE);
 
     uint64_t addr = page.pageAddr << pageShift;
     const uint numTransfers = 1 << (pageShift - 6); // assume 2^6 byte cache liens
 
     // mark page as swapping
-    page.swapDir = HBMpageInfo::StoF;
+    page.swapDir = pageInfo::StoF;
     page.swapsOut = numTransfers;   
 
     dbg.debug(_L10_, "moveToFast(%p addr:%p) sO:%d\n", &page, (void*)(addr), 
@@ -566,8 +537,8 @@ void HBMpagedMultiMemory::moveToFast(HBMpageInfo &page) {
     }
 }
 
-void HBMpagedMultiMemory::moveToSlow(HBMpageInfo *page) {
-    assert(page->swapDir == HBMpageInfo::NONE);
+void HBMpagedMultiMemory::moveToSlow(pageInfo *page) {
+    assert(page->swapDir == pageInfo::NONE);
 
     uint64_t addr = page->pageAddr << pageShift;
     const uint numTransfers = 1 << (pageShift - 6); // assume 2^6 byte cache liens
@@ -575,7 +546,7 @@ void HBMpagedMultiMemory::moveToSlow(HBMpageInfo *page) {
     dbg.debug(_L10_, "moveToSlow(%p addr:%p)\n", page, (void*)(addr));
 
     // mark page as swapping
-    page->swapDir = HBMpageInfo::FtoS;
+    page->swapDir = pageInfo::FtoS;
     page->swapsOut = numTransfers;
 
     // issue reads to fast mem
@@ -605,7 +576,7 @@ void HBMpagedMultiMemory::dramSimDone(unsigned int id, uint64_t addr, uint64_t c
     if (modelSwaps && si != swapToSlow_Writes.end()) {
         // this is a returning write from the DRAM
         // mark the page as having less outstanding
-        HBMpageInfo *page = si->second;
+        pageInfo *page = si->second;
         page->swapsOut -= 1;
         if (page->swapsOut == 0) {
             swapDone(page, addr);
@@ -630,38 +601,43 @@ void HBMpagedMultiMemory::dramSimDone(unsigned int id, uint64_t addr, uint64_t c
     }
 }
 
-void HBMpagedMultiMemory::swapDone(HBMpageInfo *page, const uint64_t addr) {
+void HBMpagedMultiMemory::swapDone(pageInfo *page, const uint64_t addr) {
     const uint64_t pageAddr = addr >> pageShift;
     dbg.debug(_L10_, "swapDone(%p addr:%p) %d\n", page, (void*)pageAddr, page->swapDir);
 
     assert(page->swapsOut == 0);
-    assert(page->swapDir != HBMpageInfo::NONE);
-    assert(&pageMap[pageAddr] == page);
+    assert(page->swapDir != pageInfo::NONE);
+    assert(&pages.getPage(pageAddr) == page);
 
 
     // launch requests waiting on the swap
-    auto &waitList = waitingReqs[pageAddr];
-    //printf(" - swapDone releasing %d\n", (int)waitList.size());
-    for (auto it = waitList.begin(); it != waitList.end(); ++it) {
-        Req *req = *it;
-        if (page->swapDir == HBMpageInfo::FtoS) {
-            // just finished moving page from fast to slow mem, so issue to DRAM
-            //assert(HBMDRAMSimMemory::issueRequest(req));
-            queueRequest(req);
-        } else {
-            // just finished moving page from slow to fast, so issue to fast
-            self_link->send(1, new MemCtrlEvent(req));
+    auto waitList = waitingReqs.find(pageAddr);
+    if (waitList != waitingReqs.end()) {
+        //printf(" - swapDone releasing %d\n", (int)waitList->second.size());
+        for (auto it = waitList->second.begin(); it != waitList->second.end(); ++it) {
+            Req *req = *it;
+            if (page->swapDir == pageInfo::FtoS) {
+                // just finished moving page from fast to slow mem, so issue to DRAM
+                queueRequest(req);
+            } else {
+                // just finished moving page from slow to fast, so issue to fast
+                self_link->send(1, new MemCtrlEvent(req));
+            }
         }
+        waitingReqs.erase(waitList);
+    }
+
+    // LFU picks victims among the fast pages that are not swapping
+    if (page->swapDir == pageInfo::StoF && page->inFast && (replaceStrat == LFU || replaceStrat == LFU8)) {
+        pages.addResident(page);
     }
-    waitList.clear();
-    waitingReqs.erase(pageAddr);
 
     // mark page as ready
-    page->swapDir = HBMpageInfo::NONE;
+    page->swapDir = pageInfo::NONE;
 }
 
 
-bool HBMpagedMultiMemory::pageIsSwapping(const HBMpageInfo &page) {
-    return (page.swapDir != HBMpageInfo::NONE);
+bool HBMpagedMultiMemory::pageIsSwapping(const pageInfo &page) {
+    return (page.swapDir != pageInfo::NONE);
 }
 
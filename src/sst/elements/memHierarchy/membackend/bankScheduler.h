@@ -0,0 +1,224 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_MEMH_BANK_SCHEDULER
+#define _H_SST_MEMH_BANK_SCHEDULER
+
+#include <stddef.h>
+#include <stdint.h>
+#include <unordered_map>
+#include <vector>
+
+namespace SST {
+namespace MemHierarchy {
+
+/*
+ * Scheduler core shared by the row-aware DRAM backends (reorderByRow
+ * and TimingDRAM's frfcfsTransactionQ).
+ *
+ * RowIndexedQueue holds the pending requests for one bank.  Entries
+ * live in a slot array and are threaded on two intrusive lists: one in
+ * arrival order across the whole bank and one per row, also in arrival
+ * order.  The oldest request and the oldest request to a given row are
+ * therefore both found in O(1) and removing either is O(1).
+ */
+template<typename T>
+class RowIndexedQueue {
+public:
+    RowIndexedQueue() : ageHead(NIL), ageTail(NIL), freeHead(NIL), count(0) { }
+
+    bool empty() const { return count == 0; }
+    size_t size() const { return count; }
+
+    void push(unsigned row, const T& item) {
+        int slot = allocSlot();
+        Node& node = nodes[slot];
+        node.item = item;
+        node.row = row;
+
+        // Append to age order
+        node.agePrev = ageTail;
+        node.ageNext = NIL;
+        if (ageTail != NIL) nodes[ageTail].ageNext = slot;
+        else ageHead = slot;
+        ageTail = slot;
+
+        // Append to row order
+        RowList& rl = rows[row];
+        if (rl.count == 0) {
+            rl.head = slot;
+            node.rowPrev = NIL;
+        } else {
+            nodes[rl.tail].rowNext = slot;
+            node.rowPrev = rl.tail;
+        }
+        node.rowNext = NIL;
+        rl.tail = slot;
+        rl.count++;
+        count++;
+    }
+
+    /* Oldest request in the bank, NULL if empty */
+    T* front() {
+        return ageHead == NIL ? nullptr : &nodes[ageHead].item;
+    }
+
+    unsigned frontRow() const {
+        return nodes[ageHead].row;
+    }
+
+    /* Oldest request to 'row', NULL if there is none */
+    T* front(unsigned row) {
+        typename std::unordered_map<unsigned, RowList>::iterator it = rows.find(row);
+        if (it == rows.end() || it->second.count == 0) return nullptr;
+        return &nodes[it->second.head].item;
+    }
+
+    void pop() {
+        // The oldest request is always the head of its row list
+        unlink(ageHead);
+    }
+
+    void pop(unsigned row) {
+        unlink(rows[row].head);
+    }
+
+    /* Number of requests pending to 'row' */
+    unsigned rowCount(unsigned row) const {
+        typename std::unordered_map<unsigned, RowList>::const_iterator it = rows.find(row);
+        return it == rows.end() ? 0 : it->second.count;
+    }
+
+private:
+    static const int NIL = -1;
+
+    struct Node {
+        T item;
+        unsigned row;
+        int agePrev, ageNext;
+        int rowPrev, rowNext;
+    };
+
+    struct RowList {
+        RowList() : head(NIL), tail(NIL), count(0) { }
+        int head, tail;
+        unsigned count;
+    };
+
+    int allocSlot() {
+        if (freeHead == NIL) {
+            nodes.push_back(Node());
+            return nodes.size() - 1;
+        }
+        int slot = freeHead;
+        freeHead = nodes[slot].ageNext;
+        return slot;
+    }
+
+    void unlink(int slot) {
+        Node& node = nodes[slot];
+
+        if (node.agePrev != NIL) nodes[node.agePrev].ageNext = node.ageNext;
+        else ageHead = node.ageNext;
+        if (node.ageNext != NIL) nodes[node.ageNext].agePrev = node.agePrev;
+        else ageTail = node.agePrev;
+
+        RowList& rl = rows[node.row];
+        if (node.rowPrev != NIL) nodes[node.rowPrev].rowNext = node.rowNext;
+        else rl.head = node.rowNext;
+        if (node.rowNext != NIL) nodes[node.rowNext].rowPrev = node.rowPrev;
+        else rl.tail = node.rowPrev;
+        // Keep the row entry around; banks cycle through a bounded set
+        // of rows and this avoids rehashing on every open/close
+        if (--rl.count == 0) {
+            rl.head = rl.tail = NIL;
+            if (rows.size() > maxIdleRows) rows.erase(node.row);
+        }
+
+        node.item = T();
+        node.ageNext = freeHead;
+        freeHead = slot;
+        count--;
+    }
+
+    static const size_t maxIdleRows = 1024;
+
+    std::vector<Node> nodes;
+    std::unordered_map<unsigned, RowList> rows;
+    int ageHead, ageTail;
+    int freeHead;
+    size_t count;
+};
+
+/*
+ * Fixed-size bitset used to track which banks/ranks have work.
+ * nextSet() returns the first set bit at or after 'from', or size() if
+ * there is none, so round-robin scans skip idle entries a word at a time.
+ */
+class ReadyMask {
+public:
+    ReadyMask() : bits(0), setWords(0) { }
+    ReadyMask(unsigned size) { resize(size); }
+
+    void resize(unsigned size) {
+        bits = size;
+        words.assign((size + 63) / 64, 0);
+        setWords = 0;
+    }
+
+    unsigned size() const { return bits; }
+    bool any() const { return setWords != 0; }
+
+    bool test(unsigned i) const {
+        return words[i >> 6] & (UINT64_C(1) << (i & 63));
+    }
+
+    void set(unsigned i) {
+        uint64_t& w = words[i >> 6];
+        if (w == 0) setWords++;
+        w |= (UINT64_C(1) << (i & 63));
+    }
+
+    void clear(unsigned i) {
+        uint64_t& w = words[i >> 6];
+        if (w == 0) return;
+        w &= ~(UINT64_C(1) << (i & 63));
+        if (w == 0) setWords--;
+    }
+
+    unsigned nextSet(unsigned from) const {
+        if (from >= bits) return bits;
+        unsigned idx = from >> 6;
+        uint64_t w = words[idx] & (~UINT64_C(0) << (from & 63));
+        while (true) {
+            if (w) {
+                unsigned i = (idx << 6) + __builtin_ctzll(w);
+                return i < bits ? i : bits;
+            }
+            if (++idx == words.size()) return bits;
+            w = words[idx];
+        }
+    }
+
+private:
+    unsigned bits;
+    unsigned setWords;
+    std::vector<uint64_t> words;
+};
+
+}}
+
+#endif
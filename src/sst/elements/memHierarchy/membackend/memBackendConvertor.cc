@@ -31,7 +31,7 @@ using namespace SST::MemHierarchy;
 
 #ifndef SST_ENABLE_PREVIEW_BUILD  // inserted by script
 MemBackendConvertor::MemBackendConvertor(Component *comp, Params& params ) : 
-    SubComponent(comp), m_cycleCount(0), m_reqId(0)
+    SubComponent(comp), m_cycleCount(0)
 {
     m_dbg.init("", 0, 0, Output::STDOUT);
     m_dbg.fatal(CALL_INFO, -1, "%s, Error: MembackendConvertor does not support loading as legacy subcomponent\n", getName().c_str());
@@ -39,7 +39,7 @@ MemBackendConvertor::MemBackendConvertor(Component *comp, Params& params ) :
 #endif  // inserted by script
 
 MemBackendConvertor::MemBackendConvertor(ComponentId_t id, Params& params, MemBackend* backend, uint32_t request_width) :
-    SubComponent(id), m_cycleCount(0), m_reqId(0), m_backend(backend) 
+    SubComponent(id), m_cycleCount(0), m_backend(backend), m_pendingCount(0)
 {
     m_dbg.init("", 
             params.find<uint32_t>("debug_level", 0),
@@ -56,6 +56,18 @@ MemBackendConvertor::MemBackendConvertor(ComponentId_t id, Params& params, MemBa
     }
     
     m_clockBackend = m_backend->isClocked();
+
+    m_pendingSlots.push_back(nullptr); // ID 0 is never handed out
+
+    m_coalesce = params.find<bool>("coalesce", false);
+    m_burstLeft = 0;
+    m_coalesceWindow = params.find<uint32_t>("coalesce_window", 8);
+    m_coalesceMaxBytes = params.find<uint64_t>("coalesce_max_bytes", 256);
+    m_coalescePageSize = params.find<uint64_t>("coalesce_page_size", 8192);
+    if (m_coalesce && (m_coalescePageSize == 0 || m_coalescePageSize % m_backendRequestWidth != 0)) {
+        m_dbg.fatal(CALL_INFO, -1, "%s, Error: coalesce_page_size (%" PRIu64 ") must be a non-zero multiple of the backend request width (%" PRIu32 ")\n",
+                getName().c_str(), m_coalescePageSize, m_backendRequestWidth);
+    }
     
     stat_GetSReqReceived    = registerStatistic<uint64_t>("requests_received_GetS");
     stat_GetSXReqReceived   = registerStatistic<uint64_t>("requests_received_GetSX");
@@ -70,6 +82,13 @@ MemBackendConvertor::MemBackendConvertor(ComponentId_t id, Params& params, MemBa
     stat_cyclesWithIssue = registerStatistic<uint64_t>( "cycles_with_issue" );
     stat_cyclesAttemptIssueButRejected = registerStatistic<uint64_t>( "cycles_attempted_issue_but_rejected" );
     stat_totalCycles = registerStatistic<uint64_t>( "total_cycles" );;
+    if (m_coalesce) {
+        stat_requestsCoalesced = registerStatistic<uint64_t>( "requests_coalesced" );
+        stat_burstSize = registerStatistic<uint64_t>( "burst_size" );
+    } else {
+        stat_requestsCoalesced = nullptr;
+        stat_burstSize = nullptr;
+    }
 
     m_clockOn = true; /* Maybe parent should set this */
 }
@@ -96,8 +115,86 @@ void MemBackendConvertor::handleMemEvent(  MemEvent* ev ) {
 void MemBackendConvertor::handleCustomEvent( CustomCmdInfo * info) {
     uint32_t id = genReqId();
     CustomReq* req = new CustomReq( info, id );
-    m_requestQueue.push_back( req );
-    m_pendingRequests[id] = req;
+    enqueue( req );
+    m_pendingSlots[id] = req;
+}
+
+/*
+ * Pull queued requests that continue the lead request's line in the same
+ * page forward so they are issued to the backend right behind it, one line
+ * per backend request, as a back-to-back stream.  Only whole, aligned,
+ * single-chunk requests of the same kind (read/write, flags) are gathered,
+ * custom commands end the search, and a request is skipped if an earlier
+ * queued request overlaps it so requests to the same address are never
+ * reordered.
+ */
+void MemBackendConvertor::gatherBurst( MemReq* lead ) {
+    const uint32_t width = m_backendRequestWidth;
+
+    if (lead->processed() != 0 || lead->size() != width || lead->addr() % width != 0)
+        return;
+
+    const bool write = lead->isWrite();
+    const uint32_t flags = lead->getMemEvent()->getFlags();
+    const Addr start = lead->addr();
+    const Addr pageEnd = (start / m_coalescePageSize + 1) * m_coalescePageSize;
+    Addr end = start + width;
+
+    m_burstMembers.clear();
+    size_t window = std::min(m_requestQueue.size(), (size_t)m_coalesceWindow + 1);
+    bool grew = true;
+
+    while (grew && end + width <= pageEnd && (end - start) + width <= m_coalesceMaxBytes) {
+        grew = false;
+
+        for (size_t j = 1; j < window; j++) {
+            BaseReq* breq = m_requestQueue[j];
+            if (!breq->isMemEv()) {
+                window = j;
+                break;
+            }
+
+            MemReq* mreq = static_cast<MemReq*>(breq);
+            if (mreq->baseAddr() != end || mreq->processed() != 0 || mreq->size() != width ||
+                    mreq->isWrite() != write || mreq->getMemEvent()->getFlags() != flags)
+                continue;
+
+            bool hazard = false;
+            for (size_t k = 1; k < j && !hazard; k++) {
+                if (std::find(m_burstMembers.begin(), m_burstMembers.end(), k) != m_burstMembers.end())
+                    continue;
+                MemReq* earlier = static_cast<MemReq*>(m_requestQueue[k]);
+                hazard = earlier->baseAddr() < end + width && earlier->baseAddr() + earlier->size() > end;
+            }
+            if (hazard)
+                break;
+
+            m_burstMembers.push_back(j);
+            end += width;
+            grew = true;
+            break;
+        }
+    }
+
+    if (m_burstMembers.empty())
+        return;
+
+    // Move the members, in address order, to just behind the lead
+    std::vector<BaseReq*> members;
+    members.reserve(m_burstMembers.size());
+    for (std::vector<size_t>::iterator it = m_burstMembers.begin(); it != m_burstMembers.end(); it++)
+        members.push_back(m_requestQueue[*it]);
+
+    std::sort(m_burstMembers.begin(), m_burstMembers.end());
+    for (std::vector<size_t>::reverse_iterator it = m_burstMembers.rbegin(); it != m_burstMembers.rend(); it++)
+        m_requestQueue.erase( m_requestQueue.begin() + *it );
+    m_requestQueue.insert( m_requestQueue.begin() + 1, members.begin(), members.end() );
+
+    Debug(_L10_, "Gathered burst of %zu requests, %" PRIu64 " bytes\n", members.size() + 1, (uint64_t)(end - start));
+
+    m_burstLeft = members.size() + 1;
+    stat_requestsCoalesced->addData(members.size());
+    stat_burstSize->addData(members.size() + 1);
 }
 
 bool MemBackendConvertor::clock(Cycle_t cycle) {
@@ -113,6 +210,10 @@ bool MemBackendConvertor::clock(Cycle_t cycle) {
         BaseReq* req = m_requestQueue.front();
         Debug(_L10_, "Processing request: %s\n", req->getString().c_str());
 
+        if ( m_coalesce && m_burstLeft == 0 && req->isMemEv() ) {
+            gatherBurst( static_cast<MemReq*>(req) );
+        }
+
         if ( issue( req ) ) {
             cycleWithIssue = true;
         } else {
@@ -126,14 +227,16 @@ bool MemBackendConvertor::clock(Cycle_t cycle) {
 
         if ( req->issueDone() ) {
             Debug(_L10_, "Completed issue of request\n");
+            dequeued( req );
             m_requestQueue.pop_front();
+            if ( m_burstLeft ) m_burstLeft--;
         }
     }
 
     if (cycleWithIssue)
         stat_cyclesWithIssue->addData(1);
 
-    stat_outstandingReqs->addData( m_pendingRequests.size() );
+    stat_outstandingReqs->addData( m_pendingCount );
 
     bool unclock = !m_clockBackend;
     if (m_clockBackend)
@@ -155,7 +258,7 @@ bool MemBackendConvertor::clock(Cycle_t cycle) {
 void MemBackendConvertor::turnClockOn(Cycle_t cycle) {
     Cycle_t cyclesOff = cycle - m_cycleCount;
     for (Cycle_t i = 0; i < cyclesOff; i++)
-        stat_outstandingReqs->addData( m_pendingRequests.size() );
+        stat_outstandingReqs->addData( m_pendingCount );
     m_cycleCount = cycle;
     m_clockOn = true;
 }
@@ -176,18 +279,16 @@ void MemBackendConvertor::doResponse( ReqId reqId, uint32_t flags ) {
     }
 
     uint32_t id = BaseReq::getBaseId(reqId);
-    MemEvent* resp = NULL;
 
-    if ( m_pendingRequests.find( id ) == m_pendingRequests.end() ) {
+    BaseReq* req = findPending( id );
+    if ( nullptr == req ) {
         m_dbg.fatal(CALL_INFO, -1, "memory request not found; id=%" PRId32 "\n", id);
     }
 
-    BaseReq* req = m_pendingRequests[id];
-
     req->decrement( );
 
     if ( req->isDone() ) {
-        m_pendingRequests.erase(id);
+        releaseReqId(id);
 
         if (!req->isMemEv()) {
             CustomCmdInfo * info = static_cast<CustomReq*>(req)->getInfo();
@@ -211,18 +312,16 @@ void MemBackendConvertor::doResponse( ReqId reqId, uint32_t flags ) {
 
             // TODO clock responses
             // Check for flushes that are waiting on this event to finish
-            if (m_dependentRequests.find(evID) != m_dependentRequests.end()) {
-                std::set<MemEvent*, memEventCmp> flushes = m_dependentRequests.find(evID)->second;
-
-                for (std::set<MemEvent*, memEventCmp>::iterator it = flushes.begin(); it != flushes.end(); it++) {
-                    (m_waitingFlushes.find(*it)->second).erase(evID);
-                    if ((m_waitingFlushes.find(*it)->second).empty()) {
-                        MemEvent * flush = *it;
+            std::vector<MemEvent*> flushes;
+            if (!m_dependentRequests.empty() && m_dependentRequests.remove(evID, &flushes)) {
+                for (std::vector<MemEvent*>::iterator it = flushes.begin(); it != flushes.end(); it++) {
+                    MemEvent * flush = *it;
+                    WaitingFlush* waiting = m_waitingFlushes.lookup(flush->getID());
+                    if (--waiting->dependsOn == 0) {
                         sendResponse(flush->getID(), (flush->getFlags() | MemEvent::F_SUCCESS));
-                        m_waitingFlushes.erase(flush);
+                        m_waitingFlushes.remove(flush->getID());
                     }
                 }
-                m_dependentRequests.erase(evID);
             }
         }
         delete req;
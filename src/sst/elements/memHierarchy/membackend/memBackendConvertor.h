@@ -17,11 +17,16 @@
 #ifndef __SST_MEMH_MEMBACKENDCONVERTOR__
 #define __SST_MEMH_MEMBACKENDCONVERTOR__
 
+#include <algorithm>
+#include <deque>
+#include <vector>
+
 #include <sst/core/subcomponent.h>
 #include <sst/core/event.h>
 #include <sst/core/warnmacros.h>
 
 #include "sst/elements/memHierarchy/memEvent.h"
+#include "sst/elements/memHierarchy/idSlotTable.h"
 #include "sst/elements/memHierarchy/customcmd/customCmdMemory.h"
 
 namespace SST {
@@ -40,7 +45,11 @@ class MemBackendConvertor : public SubComponent {
 /* ELI definitions for subclasses */
 #define MEMBACKENDCONVERTOR_ELI_PARAMS {"debug_level",     "(uint) Debugging level: 0 (no output) to 10 (all output). Output also requires that SST Core be compiled with '--enable-debug'", "0"},\
             {"debug_mask",      "(uint) Mask on debug_level", "0"},\
-            {"debug_location",  "(uint) 0: No debugging, 1: STDOUT, 2: STDERR, 3: FILE", "0"}
+            {"debug_location",  "(uint) 0: No debugging, 1: STDOUT, 2: STDERR, 3: FILE", "0"},\
+            {"coalesce",            "(bool) Issue queued requests to adjacent addresses in the same page back-to-back as a burst of line requests", "0"},\
+            {"coalesce_window",     "(uint) Number of queued requests searched for burst members", "8"},\
+            {"coalesce_max_bytes",  "(uint) Largest burst, in bytes", "256"},\
+            {"coalesce_page_size",  "(uint) Bursts do not cross a boundary of this many bytes (e.g., the DRAM row or page size)", "8192"}
 
 #define MEMBACKENDCONVERTOR_ELI_STATS { "cycles_with_issue",                  "Total cycles with successful issue to back end",   "cycles",   1 },\
             { "cycles_attempted_issue_but_rejected","Total cycles where an attempt to issue to backend was rejected (indicates backend full)", "cycles", 1 },\
@@ -53,7 +62,9 @@ class MemBackendConvertor : public SubComponent {
             { "latency_GetS",                       "Total latency of handled GetS requests",           "cycles",   1 },\
             { "latency_GetSX",                      "Total latency of handled GetSX requests",          "cycles",   1 },\
             { "latency_GetX",                       "Total latency of handled GetX requests",           "cycles",   1 },\
-            { "latency_PutM",                       "Total latency of handled PutM requests",           "cycles",   1 }
+            { "latency_PutM",                       "Total latency of handled PutM requests",           "cycles",   1 },\
+            { "requests_coalesced",                 "With coalesce, number of requests moved forward to issue in another request's burst", "requests", 1 },\
+            { "burst_size",                         "With coalesce, number of requests in each coalesced burst", "requests", 2 }
 
     SST_ELI_REGISTER_SUBCOMPONENT_API(SST::MemHierarchy::MemBackendConvertor, MemBackend*, uint32_t)
 
@@ -160,12 +171,12 @@ class MemBackendConvertor : public SubComponent {
     virtual bool isBackendClocked() { return m_clockBackend; }
 
     virtual const std::string getRequestor( ReqId reqId ) { 
-        uint32_t id = BaseReq::getBaseId(reqId);
-        if ( m_pendingRequests.find( id ) == m_pendingRequests.end() ) {
+        BaseReq* req = findPending( BaseReq::getBaseId(reqId) );
+        if ( nullptr == req ) {
             m_dbg.fatal(CALL_INFO, -1, "memory request not found\n");
         }
 
-        return m_pendingRequests[id]->getRqstr();
+        return req->getRqstr();
     }
     
     virtual void setCallbackHandlers(std::function<void(Event::id_type,uint32_t)> responseCB, std::function<Cycle_t()> clockenableCB);
@@ -192,42 +203,62 @@ class MemBackendConvertor : public SubComponent {
   private:
     virtual bool issue(BaseReq*) = 0;
 
-
-
-
     bool setupMemReq( MemEvent* ev ) {
         if ( Command::FlushLine == ev->getCmd() || Command::FlushLineInv == ev->getCmd() ) {
-            // TODO optimize if this becomes a problem, it is slow
-            std::set<SST::Event::id_type> dependsOn;
-            for (std::deque<BaseReq*>::iterator it = m_requestQueue.begin(); it != m_requestQueue.end(); it++) {
-                if (!(*it)->isMemEv())
-                    continue;
-                MemReq * mr = static_cast<MemReq*>(*it);
-                if (mr->baseAddr() == ev->getBaseAddr()) {
-                    MemEvent * req = mr->getMemEvent();
-                    dependsOn.insert(req->getID());
-                    if (m_dependentRequests.find(req->getID()) == m_dependentRequests.end()) {
-                        std::set<MemEvent*, memEventCmp> flushSet;
-                        flushSet.insert(ev);
-                        m_dependentRequests.insert(std::make_pair(req->getID(), flushSet));
-                    } else {
-                        (m_dependentRequests.find(req->getID())->second).insert(ev);
-                    }
+            // A flush waits for every queued request to its line
+            std::vector<MemEvent*>* queued = m_queuedLines.lookup(ev->getBaseAddr());
+            if (nullptr == queued || queued->empty()) return false;
+
+            for (std::vector<MemEvent*>::iterator it = queued->begin(); it != queued->end(); it++) {
+                std::vector<MemEvent*>* flushes = m_dependentRequests.lookup((*it)->getID());
+                if (nullptr == flushes) {
+                    m_dependentRequests.insert((*it)->getID(), std::vector<MemEvent*>(1, ev));
+                } else {
+                    // Keep in ID order so flushes complete in the order they always have
+                    flushes->insert(std::upper_bound(flushes->begin(), flushes->end(), ev, memEventCmp()), ev);
                 }
             }
 
-            if (dependsOn.empty()) return false;
-            m_waitingFlushes.insert(std::make_pair(ev, dependsOn));
+            WaitingFlush waiting = { ev, (uint32_t)queued->size() };
+            m_waitingFlushes.insert(ev->getID(), waiting);
             return true; 
         }
 
         uint32_t id = genReqId();
         MemReq* req = new MemReq( ev, id );
-        m_requestQueue.push_back( req );
-        m_pendingRequests[id] = req;
+        enqueue( req );
+        m_pendingSlots[id] = req;
         return true;
     }
 
+    void enqueue( BaseReq* req ) {
+        m_requestQueue.push_back( req );
+        if (req->isMemEv()) {
+            MemEvent* ev = static_cast<MemReq*>(req)->getMemEvent();
+            std::vector<MemEvent*>* queued = m_queuedLines.lookup(ev->getBaseAddr());
+            if (nullptr == queued) {
+                m_queuedLines.insert(ev->getBaseAddr(), std::vector<MemEvent*>(1, ev));
+            } else {
+                queued->push_back(ev);
+            }
+        }
+    }
+
+    /* Called once a request has been completely issued and leaves the queue */
+    void dequeued( BaseReq* req ) {
+        if (!req->isMemEv()) return;
+        MemEvent* ev = static_cast<MemReq*>(req)->getMemEvent();
+        std::vector<MemEvent*>* queued = m_queuedLines.lookup(ev->getBaseAddr());
+        queued->erase(std::find(queued->begin(), queued->end(), ev));
+        if (queued->empty()) m_queuedLines.remove(ev->getBaseAddr());
+    }
+
+    void gatherBurst( MemReq* lead );
+
+    BaseReq* findPending( uint32_t id ) {
+        return id < m_pendingSlots.size() ? m_pendingSlots[id] : nullptr;
+    }
+
     inline void doClockStat( ) {
         stat_totalCycles->addData(1);        
     }
@@ -280,18 +311,45 @@ class MemBackendConvertor : public SubComponent {
     std::function<Cycle_t()> m_enableClock; // Re-enable parent's clock
     std::function<void(Event::id_type id, uint32_t)> m_notifyResponse; // notify parent of response
 
-    uint32_t genReqId( ) { return ++m_reqId; }
-
-    uint32_t m_reqId;
+    /* Request IDs index m_pendingSlots and are reused once their request completes; 0 is never used */
+    uint32_t genReqId( ) {
+        m_pendingCount++;
+        if (!m_freeReqIds.empty()) {
+            uint32_t id = m_freeReqIds.back();
+            m_freeReqIds.pop_back();
+            return id;
+        }
+        m_pendingSlots.push_back(nullptr);
+        return m_pendingSlots.size() - 1;
+    }
 
-    typedef std::map<uint32_t,BaseReq*> PendingRequests;
+    void releaseReqId( uint32_t id ) {
+        m_pendingSlots[id] = nullptr;
+        m_freeReqIds.push_back(id);
+        m_pendingCount--;
+    }
 
     std::deque<BaseReq*>    m_requestQueue;
-    PendingRequests         m_pendingRequests;
+    std::vector<BaseReq*>   m_pendingSlots;     // Outstanding requests by ID
+    std::vector<uint32_t>   m_freeReqIds;
+    size_t                  m_pendingCount;
     uint32_t                m_frontendRequestWidth;
 
-    std::map<MemEvent*, std::set<SST::Event::id_type> > m_waitingFlushes; // Set of request IDs for each flush
-    std::map<SST::Event::id_type, std::set<MemEvent*, memEventCmp> > m_dependentRequests; // Reverse map, set of flushes for each request ID, for faster lookup
+    struct WaitingFlush {
+        MemEvent* flush;
+        uint32_t dependsOn;     // Number of requests the flush is still waiting for
+    };
+    IDSlotTable<WaitingFlush> m_waitingFlushes;                         // Flushes by flush event ID
+    IDSlotTable<std::vector<MemEvent*> > m_dependentRequests;           // Flushes waiting on each request ID, in ID order
+    IDSlotTable<std::vector<MemEvent*>, uint64_t> m_queuedLines;        // Queued requests by line address, to find a flush's dependences
+
+    // Coalescing
+    bool        m_coalesce;
+    uint32_t    m_coalesceWindow;
+    uint64_t    m_coalesceMaxBytes;
+    uint64_t    m_coalescePageSize;
+    std::vector<size_t> m_burstMembers;                                 // Queue positions of the burst being gathered
+    size_t      m_burstLeft;                                            // Requests at the head of the queue that still belong to the current burst
 
     Statistic<uint64_t>* stat_GetSLatency;
     Statistic<uint64_t>* stat_GetSXLatency;
@@ -307,6 +365,8 @@ class MemBackendConvertor : public SubComponent {
     Statistic<uint64_t>* stat_cyclesAttemptIssueButRejected;
     Statistic<uint64_t>* stat_totalCycles;
     Statistic<uint64_t>* stat_outstandingReqs;
+    Statistic<uint64_t>* stat_requestsCoalesced;
+    Statistic<uint64_t>* stat_burstSize;
 
 };
 
@@ -29,9 +29,9 @@ using namespace SST;
 using namespace SST::MemHierarchy;
 
 #ifndef SST_ENABLE_PREVIEW_BUILD  // inserted by script
-pagedMultiMemory::pagedMultiMemory(Component *comp, Params &params) : DRAMSimMemory(comp, params), pagesInFast(0), lastMin(0) { build(params); }
+pagedMultiMemory::pagedMultiMemory(Component *comp, Params &params) : DRAMSimMemory(comp, params), pagesInFast(0) { build(params); }
 #endif  // inserted by script
-pagedMultiMemory::pagedMultiMemory(ComponentId_t id, Params &params) : DRAMSimMemory(id, params), pagesInFast(0), lastMin(0) { build(params); }
+pagedMultiMemory::pagedMultiMemory(ComponentId_t id, Params &params) : DRAMSimMemory(id, params), pagesInFast(0) { build(params); }
 
 void pagedMultiMemory::build(Params& params) {
     dbg.init("@R:pagedMultiMemory::@p():@l " + getName() + ": ", 0, 0, 
@@ -145,24 +145,24 @@ bool pagedMultiMemory::checkAdd(pageInfo &page) {
 
     switch (addStrat) {
     case addT: 
-        return (page.touched > threshold); 
+        return (pages.touches(page) > threshold); 
         break;
     case addMRPU:
     case addMFRPU:
         {
             // based on threshold and if the most recent previous use is
             // more recent than the least recently used page in fast
-            if (pageList.empty()) return (page.lastTouch > threshold); // startup case
+            if (pages.listEmpty()) return (page.lastTouch > threshold); // startup case
             
             SimTime_t myLastTouch = page.lastTouch;
-            const auto &victimPage = pageList.back();
+            const pageInfo *victimPage = pages.listBack();
             if (myLastTouch > victimPage->lastTouch) {
 	      if (addStrat == addMFRPU) {
 		// more recent && more frequent
-		return (page.touched > threshold) && (page.touched > victimPage->touched); 
+		return (pages.touches(page) > threshold) && (pages.touches(page) > pages.touches(*victimPage)); 
 	      } else {
                 // more recent
-                return (page.touched > threshold); 
+                return (pages.touches(page) > threshold); 
 	      }
             } else {
                 return false;
@@ -172,13 +172,13 @@ bool pagedMultiMemory::checkAdd(pageInfo &page) {
 
     case addSCF:
       {
-            if (pageList.empty()) return (page.lastTouch > threshold); // startup case
+            if (pages.listEmpty()) return (page.lastTouch > threshold); // startup case
             
-            if (page.touched > threshold) {
+            if (pages.touches(page) > threshold) {
 	        SimTime_t myLastTouch = page.lastTouch;
-	        const auto &victimPage = pageList.back();
+	        const pageInfo *victimPage = pages.listBack();
 
-		if (page.touched > victimPage->touched) {
+		if (pages.touches(page) > pages.touches(*victimPage)) {
 		  if (page.scanLeng > scanThreshold) {
                     // roughly 1:1000 chance
                     return (rng->generateNextUInt32() & 0x3ff) == 0;
@@ -195,7 +195,7 @@ bool pagedMultiMemory::checkAdd(pageInfo &page) {
       }
     case addSC:
         {
-            if (page.touched > threshold) {
+            if (pages.touches(page) > threshold) {
                 if (page.scanLeng > scanThreshold) {
                     // roughly 1:1000 chance
                     return (rng->generateNextUInt32() & 0x3ff) == 0;
@@ -208,7 +208,7 @@ bool pagedMultiMemory::checkAdd(pageInfo &page) {
         }
         return 0;
     case addRAND:
-        if (page.touched > threshold) {
+        if (pages.touches(page) > threshold) {
             if (pagesInFast < maxFastPages) { // there is room to spare!
                 // roughly 1:1000 chance
                 return (rng->generateNextUInt32() & 0x3ff) == 0;
@@ -234,38 +234,28 @@ void pagedMultiMemory::do_FIFO_LRU( pageInfo &page, bool &inFast, bool &swapping
                 // put it in
                 page.inFast = 1;
                 pagesInFast++;
-                pageList.push_front(&page); // put in FIFO/list
-                page.listEntry = pageList.begin();
+                pages.listPushFront(&page); // put in FIFO/list
                 swapping = 1;
                 if (modelSwaps) {moveToFast(page);}
             } else {
                 // kick someone out
-                pageInfo *victimPage = pageList.back();
-                pageInfo::pageListIter e = pageList.end();
-                bool found = 0;
-                while (e != pageList.begin()) {
-                    e--;
-                    victimPage = *e;
-                    if (victimPage->swapDir == pageInfo::NONE) {
-                        found = 1;
-                        break;
-                    }
+                pageInfo *victimPage = pages.listBack();
+                while (victimPage && victimPage->swapDir != pageInfo::NONE) {
+                    victimPage = pages.listPrev(victimPage);
                 }
-                assert(e == victimPage->listEntry);
 
-                if (!found) {
+                if (!victimPage) {
                     // don't move anything.
                     inFast = 0;
                     swapping = 0;
                     page.lastTouch = getCurrentSimTimeNano(); // for mrpu
-                    dbg.debug(_L10_, "no pages to swap out (%d candidates)\n", (int)pageList.size());
+                    dbg.debug(_L10_, "no pages to swap out (%d candidates)\n", (int)pages.listCount());
                     cantSwapOut->addData(1);
                     return;
                 }
 
                 victimPage->inFast = 0;
-                victimPage->listEntry = pageList.end();
-                pageList.erase(e);
+                pages.listErase(victimPage);
                 if (modelSwaps) {moveToSlow(victimPage);}
                 
                 // put this one in
@@ -273,17 +263,12 @@ void pagedMultiMemory::do_FIFO_LRU( pageInfo &page, bool &inFast, bool &swapping
                 swapping = 1;
                 if (modelSwaps) {moveToFast(page);}
                 if ((replaceStrat == BiLRU) && ((rng->generateNextUInt32() & 0x7f) == 0)) { // roughly 1:128 chance
-                    pageList.push_back(&page); // put in back of list
-                    pageInfo::pageListIter le = pageList.end(); le--;
-                    page.listEntry = le;
+                    pages.listPushBack(&page); // put in back of list
                 } else if ((replaceStrat == SCLRU) && (page.scanLeng > scanThreshold)) {
                     // put "scan-y" pages at the back
-                    pageList.push_back(&page); // put in back of list
-                    pageInfo::pageListIter le = pageList.end(); le--;
-                    page.listEntry = le;
+                    pages.listPushBack(&page); // put in back of list
                 } else {
-                    pageList.push_front(&page); // put in front of FIFO/list
-                    page.listEntry = pageList.begin();
+                    pages.listPushFront(&page); // put in front of FIFO/list
                 }
 
                 fastSwaps->addData(1);
@@ -300,9 +285,8 @@ void pagedMultiMemory::do_FIFO_LRU( pageInfo &page, bool &inFast, bool &swapping
 	    ;
 	  } else {
 	    // move to the front of list
-	    pageList.erase(page.listEntry);
-	    pageList.push_front(&page);
-	    page.listEntry = pageList.begin();
+	    pages.listErase(&page);
+	    pages.listPushFront(&page);
 	  }
         }
 
@@ -312,54 +296,47 @@ void pagedMultiMemory::do_FIFO_LRU( pageInfo &page, bool &inFast, bool &swapping
 }
 
 void pagedMultiMemory::do_LFU( Addr addr, pageInfo &page, bool &inFast, bool &swapping) {
-    const uint64_t pageAddr = addr >> pageShift;
     inFast = 0;
     swapping = 0;
 
     // if we are hitting it "a lot" see if we can put it in fast
-    if ((0 == page.inFast) && (page.touched > threshold)) { 
+    if ((0 == page.inFast) && (pages.touches(page) > threshold)) { 
         if (pagesInFast < maxFastPages) {
             // put it in
             page.inFast = 1;
             pagesInFast++;
             swapping = 1;
             if (modelSwaps) {moveToFast(page);}
+            else {pages.addResident(&page);}
         } else {
             if (maxFastPages > 0) {
-	      if(page.touched > lastMin) {
-                // we're full, search for someone to bump
-	        lastMin = std::numeric_limits<uint>::max(); // UINT_MAX;
-	        const auto endP = pageMap.end();
-                bool found = 0;
-                for (auto p = pageMap.begin(); p != endP; ++p) {
-		  if ((p->second.inFast == 1) && (p->first != pageAddr)) {
-		    lastMin = min(lastMin, p->second.touched);
-		    if((p->second.touched < page.touched) &&
-                       (p->second.swapDir == pageInfo::NONE)) { // make sure we don't bump someone in motion
-                        found = 1;
-                        p->second.inFast = 0; // rm old
-                        if (modelSwaps) {moveToSlow(&(p->second));}
-                        page.inFast = 1; // add new
-                        fastSwaps->addData(1);
-                        swapping = 1;
-                        if (modelSwaps) {moveToFast(page);}
-                        break;
-		    }
-		  }
-                } // end for
+                // we're full, bump the least touched fast page if it is
+                // touched less than this one. Pages in motion are not
+                // resident so they are never picked.
+                pageInfo *victimPage = pages.coldestResident();
 
-                if (!found) {
+                if (!victimPage) {
                     // don't move anything.
                     inFast = 0;
                     assert(page.inFast == 0);
                     swapping = 0;
                     page.lastTouch = getCurrentSimTimeNano(); // for mrpu
                     dbg.debug(_L10_, "no pages to swap out (%d candidates)\n", 
-                              (int)pageMap.size());
+                              (int)pagesInFast);
                     cantSwapOut->addData(1);
                     return;
                 }
-	      } 
+
+                if (pages.touches(*victimPage) < pages.touches(page)) {
+                    victimPage->inFast = 0; // rm old
+                    pages.removeResident(victimPage);
+                    if (modelSwaps) {moveToSlow(victimPage);}
+                    page.inFast = 1; // add new
+                    fastSwaps->addData(1);
+                    swapping = 1;
+                    if (modelSwaps) {moveToFast(page);}
+                    else {pages.addResident(&page);}
+                }
             }
         }
     } else {
@@ -372,9 +349,9 @@ bool pagedMultiMemory::issueRequest(ReqId id, Addr addr, bool isWrite, unsigned
     bool inFast = 0;
     bool swapping = 0;
     SimTime_t extraDelay = 0;
-    auto &page = pageMap[pageAddr];
+    pageInfo &page = pages.getPage(pageAddr);
 
-    page.record(addr, isWrite, getRequestor(id), collectStats, pageAddr, replaceStrat == LFU8);
+    pages.record(page, addr, isWrite, collectStats ? getRequestor(id) : std::string(), collectStats, pageAddr, replaceStrat == LFU8);
 
     if (maxFastPages > 0) {
         if (modelSwaps && pageIsSwapping(page)) {
@@ -465,17 +442,15 @@ void pagedMultiMemory::printAccStats() {
   if (NULL == pFile) {
       dbg.fatal(CALL_INFO, -1, "Coulnd't open %s for output\n", buf);
   } else {
-      for (auto p = pageMap.begin(); p != pageMap.end(); ++p) {
-          p->second.printAndClearRecord(p->first, pFile);
-      }
+      pages.printAndClearRecords(pFile);
       fclose(pFile);
   }
 }
 
 void pagedMultiMemory::finish(){
-    printf("fast_t_pages: %zu\n", pageMap.size());
+    printf("fast_t_pages: %zu\n", pages.numPages());
     
-    tPages->addData(pageMap.size());
+    tPages->addData(pages.numPages());
 
     if (collectStats) printAccStats();
 
@@ -521,13 +496,9 @@ void pagedMultiMemory::handleSelfEvent(SST::Event *event){
 
 bool pagedMultiMemory::quantaClock(SST::Cycle_t _cycle) {
     if (collectStats) printAccStats();
-    
-    lastMin = 0;
 
-    for (auto p = pageMap.begin(); p != pageMap.end(); ++p) {
-      //p->second.touched = p->second.touched >> 4;
-      p->second.touched = 0;
-    }
+    // Touch counts are per quantum, this resets all of them
+    pages.newQuantum();
     return false;
 }
 
@@ -625,25 +596,30 @@ void pagedMultiMemory::swapDone(pageInfo *page, const uint64_t addr) {
 
     assert(page->swapsOut == 0);
     assert(page->swapDir != pageInfo::NONE);
-    assert(&pageMap[pageAddr] == page);
+    assert(&pages.getPage(pageAddr) == page);
 
 
     // launch requests waiting on the swap
-    auto &waitList = waitingReqs[pageAddr];
-    //printf(" - swapDone releasing %d\n", (int)waitList.size());
-    for (auto it = waitList.begin(); it != waitList.end(); ++it) {
-        Req *req = *it;
-        if (page->swapDir == pageInfo::FtoS) {
-            // just finished moving page from fast to slow mem, so issue to DRAM
-            //assert(DRAMSimMemory::issueRequest(req));
-            queueRequest(req);
-        } else {
-            // just finished moving page from slow to fast, so issue to fast
-            self_link->send(1, new MemCtrlEvent(req));
+    auto waitList = waitingReqs.find(pageAddr);
+    if (waitList != waitingReqs.end()) {
+        //printf(" - swapDone releasing %d\n", (int)waitList->second.size());
+        for (auto it = waitList->second.begin(); it != waitList->second.end(); ++it) {
+            Req *req = *it;
+            if (page->swapDir == pageInfo::FtoS) {
+                // just finished moving page from fast to slow mem, so issue to DRAM
+                queueRequest(req);
+            } else {
+                // just finished moving page from slow to fast, so issue to fast
+                self_link->send(1, new MemCtrlEvent(req));
+            }
         }
+        waitingReqs.erase(waitList);
+    }
+
+    // LFU picks victims among the fast pages that are not swapping
+    if (page->swapDir == pageInfo::StoF && page->inFast && (replaceStrat == LFU || replaceStrat == LFU8)) {
+        pages.addResident(page);
     }
-    waitList.clear();
-    waitingReqs.erase(pageAddr);
 
     // mark page as ready
     page->swapDir = pageInfo::NONE;
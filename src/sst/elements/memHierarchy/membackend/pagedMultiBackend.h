@@ -18,7 +18,10 @@
 #define _H_SST_MEMH_PAGEDMULTI_BACKEND
 
 #include <queue>
+#include <unordered_map>
+#include <vector>
 #include "sst/elements/memHierarchy/membackend/dramSimBackend.h"
+#include "sst/elements/memHierarchy/membackend/tieredPageTracker.h"
 #include <sst/core/rng/sstrng.h>
 
 #ifdef DEBUG
@@ -36,115 +39,6 @@
 namespace SST {
 namespace MemHierarchy {
 
-struct pageInfo {
-    typedef list<pageInfo*> pageList_t;
-    typedef pageList_t::iterator pageListIter;
-
-    uint64_t pageAddr;
-    uint touched; // how many times it is touched in quanta (used in LFU)
-    pageListIter listEntry;
-    bool inFast;
-    SimTime_t lastTouch; // used in mrpuLRU
-    uint64_t lastRef; // used in scan detection
-    uint scanLeng; // number of consecutive unit-1-stride accesses
-    SimTime_t pageDelay; // time when page will be in fast mem
-
-    typedef enum {NONE, FtoS, StoF} swapDir_t;
-    swapDir_t swapDir;
-    int swapsOut;
-
-    // stats
-    typedef enum {LT_NEG_ONE, NEG_ONE, ZERO, ONE, GT_ONE, LAST_CASE} AcCases;
-    uint64_t accPat[LAST_CASE];
-    set<string> rqstrs; // requestors who have touched this page
-
-    void record( Addr addr, bool isWrite, const std::string& requestor, 
-                    const bool collectStats, const uint64_t pAddr, const bool limitTouch) {
-        
-        // record the pageAddr
-        assert((pageAddr == 0) || (pAddr == pageAddr));
-        pageAddr = pAddr;
-
-        //stats ignore writes
-        if ((1 == collectStats) && isWrite) return;
-
-        // record that we've been touched
-        touched++;
-	if (limitTouch) {
-	  if (touched > 64) touched = 64;
-	}
-
-        // detect scans
-        addr >>= 6; // cacheline
-        if (lastRef != 0) {
-            int64_t diff = addr - lastRef;
-            if (diff == 1) {
-                scanLeng++;
-            } else {
-                scanLeng = 0;
-            }
-        }
-         
-        if (0 == collectStats) {
-            lastRef = addr;
-            return;
-        }
-        
-        // note: this is slow, and only works if directory controller
-        // is modified to send along the requestor info
-        if (1 == collectStats) {
-            rqstrs.insert(requestor);
-            //printf("%s\n", requestor.c_str());
-        }
-
-        if (0 == lastRef) {
-            // first touch, do nothing
-        } else {
-            int64_t diff = addr - lastRef;
-            if (diff < -1) {
-                accPat[LT_NEG_ONE]++;
-            } else if (diff == -1) {
-                accPat[NEG_ONE]++;
-            } else if (diff == 0) {
-                accPat[ZERO]++;
-            } else if (diff == 1) {
-                accPat[ONE]++;
-            } else { // (diff >= 1)
-                accPat[GT_ONE]++;
-            }
-        }
-        lastRef = addr;
-    }
-
-    void printAndClearRecord(uint64_t addr, FILE *outF) {
-        uint64_t sum = 0;
-        for (int i = 0; i < LAST_CASE; ++i) {
-            sum += accPat[i];
-        }
-	if (sum > 0) {
-	  fprintf(outF, "Page: %" PRIu64 " %" PRIu64, addr, sum);
-	  for (int i = 0; i < LAST_CASE; ++i) {
-	    fprintf(outF, " %.1f", double(accPat[i]*100)/double(sum));
-	  }
-	  fprintf(outF, " %" PRIu64, (uint64_t)rqstrs.size());
-	  fprintf(outF, "\n");
-	}	  
-
-        //clear
-	for (int i = 0; i < LAST_CASE; ++i) {
-	  accPat[i] = 0;
-	} 
-	rqstrs.clear();
-    }
-
-    pageInfo() : pageAddr(0), touched(0), inFast(0), lastTouch(0), lastRef(0), scanLeng(0),
-                 pageDelay(0), swapDir(NONE), swapsOut(0) {
-        for (int i = 0; i < LAST_CASE; ++i) {
-            accPat[i] = 0;
-        }
-    }
-};
-
 class pagedMultiMemory : public DRAMSimMemory {
 public:
 /* Element Library Info */
@@ -209,7 +103,6 @@ private:
         Req() {}
 		ImplementSerializable(SST::MemHierarchy::pagedMultiMemory::Req)
     };
-    pageInfo::pageList_t pageList; // used in FIFO
 
     // addition strategy
     typedef enum {addMFU, // Most Frequent
@@ -248,12 +141,12 @@ private:
 
     // swap tracking stuff
     const bool modelSwaps = 1;
-    map<uint64_t, list<Req*> > waitingReqs;
+    std::unordered_map<uint64_t, std::vector<Req*> > waitingReqs;
 public:    
     class MemCtrlEvent;
 private:    
-    typedef map<MemCtrlEvent *, pageInfo*> evToPage_t;
-    typedef map<Req *, pageInfo*> reqToPage_t;
+    typedef std::unordered_map<MemCtrlEvent *, pageInfo*> evToPage_t;
+    typedef std::unordered_map<Req *, pageInfo*> reqToPage_t;
     evToPage_t swapToSlow_Reads;
     evToPage_t swapToFast_Writes;
     reqToPage_t swapToSlow_Writes;
@@ -285,12 +178,10 @@ public:
         ImplementSerializable(SST::MemHierarchy::pagedMultiMemory::MemCtrlEvent);     
     };
 
-    typedef map<uint64_t, pageInfo> pageMap_t;
-    pageMap_t pageMap;
+    PageTracker pages;  // Per-page state, fast page list (FIFO/LRU) and resident heap (LFU)
     uint maxFastPages;
     uint pageShift;
     uint pagesInFast;
-    uint lastMin;
     uint threshold;
     uint scanThreshold;
     SimTime_t transferDelay;
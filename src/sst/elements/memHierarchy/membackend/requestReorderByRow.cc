@@ -74,9 +74,9 @@ void RequestReorderRow::build(Params& params) {
     bankMask = banks - 1;
     rowOffset = log2Of(rowSize.getRoundedValue());
     lineOffset = log2Of(requestSize.getRoundedValue());
+    requestQueue.resize(banks);
+    banksWithRequests.resize(banks);
     for (unsigned int i = 0; i < banks; i++) {
-        std::list<Req >* bankList = new std::list<Req>;
-        requestQueue.push_back(bankList);
         lastRow.push_back(-1);  // No last request to this bank
         reorderCount.push_back(maxReqsPerRow);  // No requests reordered to this row
     }
@@ -89,7 +89,8 @@ bool RequestReorderRow::issueRequest(ReqId id, Addr addr, bool isWrite, unsigned
 #endif
     int bank = (addr >> lineOffset) & bankMask;
     
-    requestQueue[bank]->push_back(Req(id,addr,isWrite,numBytes));
+    requestQueue[bank].push(addr >> rowOffset, Req(id,addr,isWrite,numBytes));
+    banksWithRequests.set(bank);
     return true;
 }
 
@@ -99,59 +100,61 @@ bool RequestReorderRow::issueRequest(ReqId id, Addr addr, bool isWrite, unsigned
  */
 bool RequestReorderRow::clock(Cycle_t cycle) {
     
-    if (!requestQueue.empty()) {
+    if (banksWithRequests.any()) {
         
         int reqsIssuedThisCycle = 0;
-        int reqsSearchedThisCycle = 0;
-        // For current bank
-        unsigned int bank = nextBank;
-        for (unsigned int i = 0; i < banks; i++) {
-            if (requestQueue[bank]->empty()) {
-                bank = (bank + 1) % banks;
+        // Visit banks with pending requests round-robin, starting at nextBank
+        unsigned int startBank = nextBank;
+        unsigned int bank = banksWithRequests.nextSet(startBank);
+        bool wrapped = false;
+        while (true) {
+            if (bank == banks) {
+                if (wrapped || startBank == 0) break;
+                wrapped = true;
+                bank = banksWithRequests.nextSet(0);
                 continue;
             }
+            if (wrapped && bank >= startBank) break;
+
+            RowIndexedQueue<Req>& bankQueue = requestQueue[bank];
 
             // Decide whether to try to re-order a request to this bank or issue a new row
             bool reorderIssued = false;
             if (reorderCount[bank] != maxReqsPerRow) {
-                std::list<Req>* bankList = requestQueue[bank];
-                for (std::list<Req>::iterator it = bankList->begin(); it != bankList->end(); it++) {
-                    unsigned int row = (*it).addr >> rowOffset;
-                    
-                    if (row == lastRow[bank]) {
-                        // Attempt issue, if we're blocked, this bank is busy & move to next bank
-                        bool issued = backend->issueRequest((*it).id,(*it).addr,(*it).isWrite,(*it).numBytes);
-                        reorderIssued = true;
-                        if (issued) {
-                            reqsIssuedThisCycle++;
-                            nextBank = (bank + 1) % banks;
-                            reorderCount[bank]++;
-                            bankList->erase(it);
-                            break; 
-                        } else {
-                            break;
-                        }
+                // Oldest request to the open row, if any
+                Req* hit = bankQueue.front(lastRow[bank]);
+                if (hit != nullptr) {
+                    // Attempt issue, if we're blocked, this bank is busy & move to next bank
+                    reorderIssued = true;
+                    if (backend->issueRequest(hit->id, hit->addr, hit->isWrite, hit->numBytes)) {
+                        reqsIssuedThisCycle++;
+                        nextBank = (bank + 1) % banks;
+                        reorderCount[bank]++;
+                        bankQueue.pop(lastRow[bank]);
                     }
                 }
             }
             
             if (!reorderIssued) {
                 // Try to issue oldest request
-				Req& req = *requestQueue[bank]->begin();
+                Req& req = *bankQueue.front();
                 if (backend->issueRequest( req.id, req.addr, req.isWrite, req.numBytes ) ) {
                     reqsIssuedThisCycle++;
                     nextBank = (bank + 1) % banks;
                     reorderCount[bank] = 1;
-                    lastRow[bank] = req.addr >> rowOffset;
-                    requestQueue[bank]->erase(requestQueue[bank]->begin());
+                    lastRow[bank] = bankQueue.frontRow();
+                    bankQueue.pop();
                 }
             }
 
+            if (bankQueue.empty())
+                banksWithRequests.clear(bank);
+
             if (reqsIssuedThisCycle == reqsPerCycle) {
                 break;  // Can't issue any more
             }
 
-            bank = (bank + 1) % banks;
+            bank = banksWithRequests.nextSet(bank + 1);
         }
     } 
 
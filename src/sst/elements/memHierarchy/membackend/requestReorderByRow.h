@@ -18,7 +18,7 @@
 #define _H_SST_MEMH_REQUEST_REORDER_ROW_BACKEND
 
 #include "sst/elements/memHierarchy/membackend/memBackend.h"
-#include <list>
+#include "sst/elements/memHierarchy/membackend/bankScheduler.h"
 #include <vector>
 
 namespace SST {
@@ -61,6 +61,7 @@ private:
         SimpleMemBackend::handleMemResponse( id );
     }
 	struct Req {
+        Req() { }
         Req( ReqId id, Addr addr, bool isWrite, unsigned numBytes ) :
             id(id), addr(addr), isWrite(isWrite), numBytes(numBytes)
         { }
@@ -77,7 +78,8 @@ private:
     unsigned int rowOffset;     // Offset for determining request row
     unsigned int lineOffset;    // Offset for determining line (needed for finding bank)
     int reqsPerCycle;           // Number of requests to issue per cycle (max) -> memCtrl limits how many we accept
-    std::vector< std::list<Req>* > requestQueue;
+    std::vector< RowIndexedQueue<Req> > requestQueue;
+    ReadyMask banksWithRequests;    // Banks with a non-empty requestQueue
     std::vector<unsigned int> reorderCount;
     std::vector<unsigned int> lastRow;
 
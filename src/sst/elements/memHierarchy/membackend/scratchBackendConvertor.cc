@@ -113,7 +113,7 @@ bool ScratchBackendConvertor::clock(Cycle_t cycle) {
         reqsThisCycle++;
         req->increment( m_backendRequestWidth );
 
-        if ( req->processed() >= m_backendRequestWidth ) {
+        if ( req->issueDone() ) {
             Debug(_L10_, "Completed issue of request\n");
             m_requestQueue.pop_front();
         }
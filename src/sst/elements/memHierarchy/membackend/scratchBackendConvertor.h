@@ -57,6 +57,9 @@ public:
             ++m_numReq;
         }
         void decrement( ) { --m_numReq; }
+        bool issueDone() {
+            return m_offset >= m_event->getSize();
+        }
         bool isDone( ) {
             return ( m_offset >= m_event->getSize() && 0 == m_numReq );
         }
@@ -0,0 +1,330 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_MEMH_TIERED_PAGE_TRACKER
+#define _H_SST_MEMH_TIERED_PAGE_TRACKER
+
+#include <stdint.h>
+#include <stdio.h>
+#include <inttypes.h>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <sst/core/sst_types.h>
+
+#include "sst/elements/memHierarchy/util.h"
+
+namespace SST {
+namespace MemHierarchy {
+
+/*
+ * Page bookkeeping shared by the paged multi-level memories
+ * (pagedMultiMemory and HBMpagedMultiMemory).
+ *
+ * PageTracker owns the per-page state and the structures the
+ * promotion/demotion policies need, so that no policy has to walk every
+ * page the simulation has touched:
+ *  - Touch counts are per quantum.  Each page remembers the quantum its
+ *    count belongs to, so starting a new quantum is O(1) instead of a
+ *    reset of every page.
+ *  - Fast pages that are not swapping can be kept in a min-heap on their
+ *    touch count (LFU).  The heap is bounded by the number of fast pages,
+ *    so finding the coldest resident page is O(1) and updating it on an
+ *    access is O(log K).
+ *  - Fast pages can be kept on an intrusive list (FIFO/LRU).
+ *  - Access pattern statistics are only allocated when they are being
+ *    collected, requestors are interned, and a dump only visits pages
+ *    that were recorded since the previous dump.
+ */
+
+struct pageInfo {
+    typedef enum {NONE, FtoS, StoF} swapDir_t;
+    typedef enum {LT_NEG_ONE, NEG_ONE, ZERO, ONE, GT_ONE, LAST_CASE} AcCases;
+
+    /* Access pattern statistics, only allocated with collect_stats */
+    struct AccStats {
+        AccStats() : listed(false) {
+            for (int i = 0; i < LAST_CASE; ++i) accPat[i] = 0;
+        }
+        uint64_t accPat[LAST_CASE];
+        std::vector<uint32_t> rqstrs;   // requestors who have touched this page (interned, sorted)
+        bool listed;                    // on the tracker's list of pages to dump
+    };
+
+    uint64_t pageAddr;
+    uint32_t touched;       // how many times it is touched in quanta (used in LFU), valid if epoch is current
+    uint32_t epoch;         // quantum that 'touched' belongs to
+    uint64_t lastRef;       // used in scan detection
+    SimTime_t lastTouch;    // used in mrpuLRU
+    SimTime_t pageDelay;    // time when page will be in fast mem
+    uint32_t scanLeng;      // number of consecutive unit-1-stride accesses
+    int32_t swapsOut;
+    swapDir_t swapDir;
+    bool inFast;
+
+    // Links owned by PageTracker
+    int32_t heapIdx;        // position in the resident heap, -1 if not in it
+    pageInfo* prev;         // fast page list
+    pageInfo* next;
+    bool onList;
+
+    std::unique_ptr<AccStats> stats;
+
+    pageInfo() : pageAddr(0), touched(0), epoch(0), lastRef(0), lastTouch(0), pageDelay(0), scanLeng(0),
+                 swapsOut(0), swapDir(NONE), inFast(0), heapIdx(-1), prev(nullptr), next(nullptr), onList(false) { }
+};
+
+/* Interns requestor names so a page can record who touched it with an integer */
+class RequestorTable {
+public:
+    uint32_t intern(const std::string& name) {
+        std::unordered_map<std::string, uint32_t>::iterator it = ids.find(name);
+        if (it != ids.end()) return it->second;
+        uint32_t id = names.size();
+        ids.insert(std::make_pair(name, id));
+        names.push_back(name);
+        return id;
+    }
+
+    const std::string& name(uint32_t id) const { return names[id]; }
+    size_t size() const { return names.size(); }
+
+private:
+    std::unordered_map<std::string, uint32_t> ids;
+    std::vector<std::string> names;
+};
+
+class PageTracker {
+public:
+    PageTracker() : epoch(1), listHead(nullptr), listTail(nullptr), listSize(0) { }
+
+    /* Pages are never removed, references stay valid */
+    pageInfo& getPage(uint64_t pageAddr) { return pages[pageAddr]; }
+    size_t numPages() const { return pages.size(); }
+
+    /* Touch count in the current quantum */
+    uint32_t touches(const pageInfo& page) const {
+        return page.epoch == epoch ? page.touched : 0;
+    }
+
+    /* Start a new quantum, all touch counts become 0. The resident heap
+     * stays valid since all of its keys are now equal. */
+    void newQuantum() { epoch++; }
+
+    /*
+     * Record an access to a page.
+     * collectStats: 0 = only count and detect scans, 1 = also record the
+     * access pattern (reads only) and the requestor
+     */
+    void record(pageInfo& page, Addr addr, bool isWrite, const std::string& requestor,
+            const bool collectStats, const uint64_t pAddr, const bool limitTouch) {
+
+        // record the pageAddr
+        page.pageAddr = pAddr;
+
+        //stats ignore writes
+        if (collectStats && isWrite) return;
+
+        // record that we've been touched
+        if (page.epoch != epoch) {
+            page.epoch = epoch;
+            page.touched = 0;
+        }
+        page.touched++;
+        if (limitTouch) {
+            if (page.touched > 64) page.touched = 64;
+        }
+        if (page.heapIdx >= 0) siftDown(page.heapIdx);
+
+        // detect scans
+        addr >>= 6; // cacheline
+        if (page.lastRef != 0) {
+            int64_t diff = addr - page.lastRef;
+            if (diff == 1) {
+                page.scanLeng++;
+            } else {
+                page.scanLeng = 0;
+            }
+        }
+
+        if (!collectStats) {
+            page.lastRef = addr;
+            return;
+        }
+
+        // note: this only works if directory controller
+        // is modified to send along the requestor info
+        if (!page.stats) page.stats.reset(new pageInfo::AccStats());
+        pageInfo::AccStats& st = *page.stats;
+        if (!st.listed) {
+            st.listed = true;
+            statPages.push_back(&page);
+        }
+        uint32_t rqstr = requestors.intern(requestor);
+        std::vector<uint32_t>::iterator it = std::lower_bound(st.rqstrs.begin(), st.rqstrs.end(), rqstr);
+        if (it == st.rqstrs.end() || *it != rqstr) st.rqstrs.insert(it, rqstr);
+
+        if (0 == page.lastRef) {
+            // first touch, do nothing
+        } else {
+            int64_t diff = addr - page.lastRef;
+            if (diff < -1) {
+                st.accPat[pageInfo::LT_NEG_ONE]++;
+            } else if (diff == -1) {
+                st.accPat[pageInfo::NEG_ONE]++;
+            } else if (diff == 0) {
+                st.accPat[pageInfo::ZERO]++;
+            } else if (diff == 1) {
+                st.accPat[pageInfo::ONE]++;
+            } else { // (diff >= 1)
+                st.accPat[pageInfo::GT_ONE]++;
+            }
+        }
+        page.lastRef = addr;
+    }
+
+    /* Print and clear the access pattern of every page recorded since the last dump, in address order */
+    void printAndClearRecords(FILE *outF) {
+        std::sort(statPages.begin(), statPages.end(), [](const pageInfo* a, const pageInfo* b) { return a->pageAddr < b->pageAddr; });
+        for (std::vector<pageInfo*>::iterator p = statPages.begin(); p != statPages.end(); ++p) {
+            pageInfo::AccStats& st = *(*p)->stats;
+            uint64_t sum = 0;
+            for (int i = 0; i < pageInfo::LAST_CASE; ++i) {
+                sum += st.accPat[i];
+            }
+            if (sum > 0) {
+                fprintf(outF, "Page: %" PRIu64 " %" PRIu64, (*p)->pageAddr, sum);
+                for (int i = 0; i < pageInfo::LAST_CASE; ++i) {
+                    fprintf(outF, " %.1f", double(st.accPat[i]*100)/double(sum));
+                }
+                fprintf(outF, " %" PRIu64, (uint64_t)st.rqstrs.size());
+                fprintf(outF, "\n");
+            }
+            (*p)->stats.reset();
+        }
+        statPages.clear();
+    }
+
+    /* Resident heap: fast pages that are not swapping, ordered by touch count */
+    void addResident(pageInfo* page) {
+        if (page->heapIdx >= 0) return;
+        page->heapIdx = heap.size();
+        heap.push_back(page);
+        siftUp(page->heapIdx);
+    }
+
+    void removeResident(pageInfo* page) {
+        int idx = page->heapIdx;
+        if (idx < 0) return;
+        page->heapIdx = -1;
+        pageInfo* last = heap.back();
+        heap.pop_back();
+        if (last == page) return;
+        heap[idx] = last;
+        last->heapIdx = idx;
+        siftDown(idx);
+        siftUp(last->heapIdx);
+    }
+
+    /* Least touched resident page, NULL if there are none */
+    pageInfo* coldestResident() const { return heap.empty() ? nullptr : heap.front(); }
+
+    /* Fast page list (FIFO/LRU), front is most recent */
+    bool listEmpty() const { return listHead == nullptr; }
+    size_t listCount() const { return listSize; }
+    pageInfo* listBack() const { return listTail; }
+    pageInfo* listPrev(pageInfo* page) const { return page->prev; }
+
+    void listPushFront(pageInfo* page) {
+        page->prev = nullptr;
+        page->next = listHead;
+        if (listHead) listHead->prev = page;
+        else listTail = page;
+        listHead = page;
+        page->onList = true;
+        listSize++;
+    }
+
+    void listPushBack(pageInfo* page) {
+        page->next = nullptr;
+        page->prev = listTail;
+        if (listTail) listTail->next = page;
+        else listHead = page;
+        listTail = page;
+        page->onList = true;
+        listSize++;
+    }
+
+    void listErase(pageInfo* page) {
+        if (!page->onList) return;
+        if (page->prev) page->prev->next = page->next;
+        else listHead = page->next;
+        if (page->next) page->next->prev = page->prev;
+        else listTail = page->prev;
+        page->prev = page->next = nullptr;
+        page->onList = false;
+        listSize--;
+    }
+
+private:
+    bool less(int a, int b) const { return touches(*heap[a]) < touches(*heap[b]); }
+
+    void swap(int a, int b) {
+        std::swap(heap[a], heap[b]);
+        heap[a]->heapIdx = a;
+        heap[b]->heapIdx = b;
+    }
+
+    void siftUp(int idx) {
+        while (idx > 0) {
+            int parent = (idx - 1) / 2;
+            if (!less(idx, parent)) break;
+            swap(idx, parent);
+            idx = parent;
+        }
+    }
+
+    void siftDown(int idx) {
+        int n = heap.size();
+        while (true) {
+            int smallest = idx;
+            int l = 2 * idx + 1;
+            int r = l + 1;
+            if (l < n && less(l, smallest)) smallest = l;
+            if (r < n && less(r, smallest)) smallest = r;
+            if (smallest == idx) break;
+            swap(idx, smallest);
+            idx = smallest;
+        }
+    }
+
+    uint32_t epoch;
+    std::unordered_map<uint64_t, pageInfo> pages;
+    std::vector<pageInfo*> heap;
+    pageInfo* listHead;
+    pageInfo* listTail;
+    size_t listSize;
+    std::vector<pageInfo*> statPages;
+    RequestorTable requestors;
+};
+
+}
+}
+
+#endif
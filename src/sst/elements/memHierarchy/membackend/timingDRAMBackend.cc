@@ -12,6 +12,7 @@
 
 #include <sst_config.h>
 #include <sst/core/timeLord.h>
+#include <algorithm>
 #include "membackend/timingDRAMBackend.h"
 
 using namespace SST;
@@ -97,7 +98,7 @@ bool TimingDRAM::clock(Cycle_t cycle)
 //==================================================================================
 
 TimingDRAM::Channel::Channel( ComponentId_t id, std::function<void(ReqId)> handler, Params& params, unsigned mc, unsigned myNum, Output* output, AddrMapper* mapper ) :
-    ComponentExtension(id), m_responseHandler(handler), m_output( output ), m_mapper( mapper ), m_nextRankUp(0), m_dataBusAvailCycle(0)
+    ComponentExtension(id), m_responseHandler(handler), m_output( output ), m_mapper( mapper ), m_nextRankUp(0), m_dataBusAvailCycle(0), m_issueSeq(0)
 {
     std::ostringstream tmp;
     tmp << "@t:TimingDRAM:Channel:@p():@l:mc=" << mc << ":chan=" << myNum << ": "; 
@@ -122,6 +123,7 @@ TimingDRAM::Channel::Channel( ComponentId_t id, std::function<void(ReqId)> handl
     for ( unsigned i=0; i<numRanks; i++ ) {
         m_ranks.push_back( loadComponentExtension<Rank>( tmpParams, mc, myNum, i, output, mapper ) );
     } 
+    m_ranksActive.resize( numRanks );
 }
 
 void TimingDRAM::Channel::clock( SimTime_t cycle )
@@ -129,27 +131,31 @@ void TimingDRAM::Channel::clock( SimTime_t cycle )
     if (is_debug)
         m_output->verbosePrefix(prefix(),CALL_INFO, 5, DBG_MASK, "cycle %" PRIu64 "\n",cycle);
 
-    std::list<Cmd*>::iterator iter = m_issuedCmds.begin();
-
-    /* Check all outstanding commands to see if anything is finished */
-    while ( iter != m_issuedCmds.end() ) {
-        if ( (*iter)->isDone(cycle) ) {
-            Cmd* cmd = (*iter);
+    /* Collect the outstanding commands that are finished */
+    while ( ! m_issuedCmds.empty() && m_issuedCmds.top().cmd->isDone(cycle) ) {
+        m_doneCmds.push_back( m_issuedCmds.top() );
+        m_issuedCmds.pop();
+    }
 
-            if (is_debug)
-                m_output->verbosePrefix(prefix(),CALL_INFO, 2, DBG_MASK, "cycle=%" PRIu64 " retire %s for rank=%d bank=%d row=%d\n",
-                        cycle, cmd->getName().c_str(), cmd->getRank(), cmd->getBank(), cmd->getRow());
+    /* Retire them in issue order */
+    if ( m_doneCmds.size() > 1 ) {
+        std::sort( m_doneCmds.begin(), m_doneCmds.end(),
+                [](const IssuedCmd& a, const IssuedCmd& b) { return a.seq < b.seq; } );
+    }
+    for ( std::vector<IssuedCmd>::iterator iter = m_doneCmds.begin(); iter != m_doneCmds.end(); ++iter ) {
+        Cmd* cmd = iter->cmd;
 
-            if (cmd->getTrans() != nullptr) {
-                m_retiredTrans.push(cmd->getTrans());
-            }
+        if (is_debug)
+            m_output->verbosePrefix(prefix(),CALL_INFO, 2, DBG_MASK, "cycle=%" PRIu64 " retire %s for rank=%d bank=%d row=%d\n",
+                    cycle, cmd->getName().c_str(), cmd->getRank(), cmd->getBank(), cmd->getRow());
 
-            delete (*iter);
-            iter = m_issuedCmds.erase(iter); 
-        } else {
-            ++iter;
+        if (cmd->getTrans() != nullptr) {
+            m_retiredTrans.push(cmd->getTrans());
         }
+
+        delete cmd;
     }
+    m_doneCmds.clear();
  
     /* Return a response if possible */
     if ( ! m_retiredTrans.empty() ) {
@@ -173,34 +179,47 @@ void TimingDRAM::Channel::clock( SimTime_t cycle )
 
         m_dataBusAvailCycle = cmd->issue();  
 
-        m_issuedCmds.push_back(cmd);
+        IssuedCmd issued = { cmd->getFiniTime(), m_issueSeq++, cmd };
+        m_issuedCmds.push(issued);
     }
 }
 
 TimingDRAM::Cmd* TimingDRAM::Channel::popCmd( SimTime_t cycle, SimTime_t dataBusAvailCycle )
 {
     Cmd* cmd = nullptr;
-    unsigned current = m_nextRankUp;
-    for ( unsigned i = 0; i < m_ranks.size(); i++ ) {
-
-        if (m_ranks[current]->hasActiveBanks()) {
-            cmd = m_ranks[current]->popCmd( cycle, m_dataBusAvailCycle );
-
-            if ( cmd ) {
-
-                if ( current == m_nextRankUp ) {
-                    ++m_nextRankUp;
-                    m_nextRankUp %= m_ranks.size();
-                    if (is_debug)
-                        m_output->verbosePrefix(prefix(),CALL_INFO, 3, DBG_MASK, "rank %d next up\n",m_nextRankUp);
-                }
-            
-                break;
+    unsigned numRanks = m_ranks.size();
+    unsigned start = m_nextRankUp;
+    unsigned current = m_ranksActive.nextSet( start );
+    bool wrapped = false;
+
+    /* Visit ranks with active banks round-robin starting at m_nextRankUp */
+    while ( true ) {
+        if ( current == numRanks ) {
+            if ( wrapped ) break;
+            wrapped = true;
+            current = m_ranksActive.nextSet( 0 );
+            continue;
+        }
+        if ( wrapped && current >= start ) break;
+
+        cmd = m_ranks[current]->popCmd( cycle, m_dataBusAvailCycle );
+
+        if ( ! m_ranks[current]->hasActiveBanks() )
+            m_ranksActive.clear( current );
+
+        if ( cmd ) {
+
+            if ( current == m_nextRankUp ) {
+                ++m_nextRankUp;
+                m_nextRankUp %= numRanks;
+                if (is_debug)
+                    m_output->verbosePrefix(prefix(),CALL_INFO, 3, DBG_MASK, "rank %d next up\n",m_nextRankUp);
             }
+
+            break;
         }
 
-        ++current;
-        current %= m_ranks.size();
+        current = m_ranksActive.nextSet( current + 1 );
     }
     return cmd;
 }
@@ -231,6 +250,7 @@ TimingDRAM::Rank::Rank( ComponentId_t id, Params& params, unsigned mc, unsigned
     for ( unsigned i=0; i<banks; i++ ) {
         m_banks.push_back( loadComponentExtension<Bank>( tmpParams, mc, chan, myNum, i, output ) );
     } 
+    m_banksActive.resize( banks );
 }
 
 TimingDRAM::Cmd* TimingDRAM::Rank::popCmd( SimTime_t cycle, SimTime_t dataBusAvailCycle )
@@ -238,27 +258,37 @@ TimingDRAM::Cmd* TimingDRAM::Rank::popCmd( SimTime_t cycle, SimTime_t dataBusAva
     if (is_debug)
         m_output->verbosePrefix(prefix(),CALL_INFO, 5, DBG_MASK, "\n" );
 
-    unsigned current = m_nextBankUp;
-    for ( unsigned i = 0; i < m_banks.size(); i++ ) {
-        if (m_banksActive.find(current) != m_banksActive.end()) {
-            Cmd* cmd = m_banks[current]->popCmd( cycle, dataBusAvailCycle );
-
-            if (m_banks[current]->isIdle())
-                m_banksActive.erase(current);
-
-            if ( cmd ) {
-                if ( current == m_nextBankUp ) {
-                    ++m_nextBankUp;
-                    m_nextBankUp %= m_banks.size();
-                    if (is_debug)
-                        m_output->verbosePrefix(prefix(),CALL_INFO, 3, DBG_MASK, "rank %d next up\n",m_nextBankUp);
-                }
-                return cmd;
+    unsigned numBanks = m_banks.size();
+    unsigned start = m_nextBankUp;
+    unsigned current = m_banksActive.nextSet( start );
+    bool wrapped = false;
+
+    /* Visit active banks round-robin starting at m_nextBankUp */
+    while ( true ) {
+        if ( current == numBanks ) {
+            if ( wrapped ) break;
+            wrapped = true;
+            current = m_banksActive.nextSet( 0 );
+            continue;
+        }
+        if ( wrapped && current >= start ) break;
+
+        Cmd* cmd = m_banks[current]->popCmd( cycle, dataBusAvailCycle );
+
+        if (m_banks[current]->isIdle())
+            m_banksActive.clear(current);
+
+        if ( cmd ) {
+            if ( current == m_nextBankUp ) {
+                ++m_nextBankUp;
+                m_nextBankUp %= numBanks;
+                if (is_debug)
+                    m_output->verbosePrefix(prefix(),CALL_INFO, 3, DBG_MASK, "rank %d next up\n",m_nextBankUp);
             }
+            return cmd;
         }
 
-        ++current;
-        current %= m_banks.size();
+        current = m_banksActive.nextSet( current + 1 );
     }
     return nullptr;
 }
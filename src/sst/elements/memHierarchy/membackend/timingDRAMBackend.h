@@ -13,11 +13,14 @@
 #ifndef _H_SST_MEMH_TIMING_DRAM_BACKEND
 #define _H_SST_MEMH_TIMING_DRAM_BACKEND
 
+#include <functional>
 #include <queue>
+#include <vector>
 
 #include <sst/core/componentExtension.h>
 
 #include "sst/elements/memHierarchy/membackend/simpleMemBackend.h"
+#include "sst/elements/memHierarchy/membackend/bankScheduler.h"
 #include "sst/elements/memHierarchy/membackend/timingAddrMapper.h"
 #include "sst/elements/memHierarchy/membackend/timingTransaction.h"
 #include "sst/elements/memHierarchy/membackend/timingPagePolicy.h"
@@ -50,7 +53,7 @@ public:
             {"channel.rank.bank.RCD", "Row access latency in cycles", "11"},
             {"channel.rank.bank.TRP", "Precharge delay in cycles", "11"},
             {"channel.rank.bank.dataCycles", "", "4"},
-            {"channel.rank.bank.transactionQ", "Transaction queue model (subcomponent)", "memHierarchy.fifoTransactionQ"},
+            {"channel.rank.bank.transactionQ", "Transaction queue model (subcomponent): fifoTransactionQ, reorderTransactionQ or frfcfsTransactionQ", "memHierarchy.fifoTransactionQ"},
             {"channel.rank.bank.pagePolicy", "Policy subcomponent for managing row buffer", "memHierarchy.simplePagePolicy"})
 
     SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
@@ -202,6 +205,8 @@ private:
             return ret;
         }
 
+        SimTime_t getFiniTime() { return m_finiTime; }
+
         bool isDone( SimTime_t now ) {
 
             if (is_debug)
@@ -249,11 +254,11 @@ private:
 
             m_banks[bank]->pushTrans( trans );
 
-            m_banksActive.insert(bank);
+            m_banksActive.set(bank);
         }
 
         bool hasActiveBanks() {
-            return !m_banksActive.empty();
+            return m_banksActive.any();
         }
 
       private:
@@ -265,7 +270,7 @@ private:
 
         unsigned            m_nextBankUp;
         std::vector<Bank*>  m_banks;
-        std::set<unsigned>  m_banksActive;
+        ReadyMask           m_banksActive;
     };
 
     class Channel : public ComponentExtension {
@@ -292,6 +297,7 @@ private:
                                                 m_mapper->getRow(addr) );
             m_pendingCount++;
             m_ranks[ rank ]->pushTrans( trans );
+            m_ranksActive.set( rank );
             return true;
         }
 
@@ -306,12 +312,25 @@ private:
 
         unsigned            m_nextRankUp;
         std::vector<Rank*>  m_ranks;
+        ReadyMask           m_ranksActive;
 
         unsigned            m_dataBusAvailCycle;
         unsigned            m_maxPendingTrans;
         unsigned            m_pendingCount;
 
-        std::list<Cmd*>     m_issuedCmds;
+        // Issued commands ordered by completion time, ties broken by
+        // issue order so commands retire in the order they were issued
+        struct IssuedCmd {
+            SimTime_t   finiTime;
+            uint64_t    seq;
+            Cmd*        cmd;
+            bool operator>( const IssuedCmd& rhs ) const {
+                return finiTime != rhs.finiTime ? finiTime > rhs.finiTime : seq > rhs.seq;
+            }
+        };
+        std::priority_queue<IssuedCmd, std::vector<IssuedCmd>, std::greater<IssuedCmd> > m_issuedCmds;
+        std::vector<IssuedCmd> m_doneCmds;
+        uint64_t            m_issueSeq;
         std::queue<Transaction*> m_retiredTrans;
 
         std::function<void(ReqId)> m_responseHandler;
@@ -15,6 +15,8 @@
 
 #include <sst/core/subcomponent.h>
 
+#include "sst/elements/memHierarchy/membackend/bankScheduler.h"
+
 namespace SST {
 namespace MemHierarchy {
 namespace TimingDRAM_NS {
@@ -141,6 +143,74 @@ class ReorderTransactionQ : public TransactionQ {
     unsigned  windowCycles;
 };
 
+/*
+ * First-ready, first-come-first-served queue.  Returns the oldest
+ * transaction to the open row if there is one, otherwise the oldest
+ * transaction.  Transactions are indexed by row so both cases are O(1)
+ * regardless of queue depth.  'maxRowHits' bounds the number of
+ * consecutive row hits that may bypass an older transaction to another row.
+ */
+class FRFCFSTransactionQ : public TransactionQ {
+
+  public:
+/* Element Library Info */
+    SST_ELI_REGISTER_SUBCOMPONENT_DERIVED(FRFCFSTransactionQ, "memHierarchy", "frfcfsTransactionQ", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "FR-FCFS transaction queue, prioritizes row hits", SST::MemHierarchy::TimingDRAM_NS::TransactionQ)
+
+    SST_ELI_DOCUMENT_PARAMS( {"maxRowHits", "Maximum number of consecutive row hits to issue ahead of an older transaction. 0 is unlimited.", "16" } )
+
+/* Begin class definition */
+#ifndef SST_ENABLE_PREVIEW_BUILD  // inserted by script
+    FRFCFSTransactionQ( Component* owner, Params& params ) : TransactionQ( owner, params ), m_hitRow(0), m_hits(0) {
+        m_maxRowHits = params.find<unsigned int>("maxRowHits", 16);
+    }
+#endif  // inserted by script
+
+    FRFCFSTransactionQ( ComponentId_t id, Params& params ) : TransactionQ( id, params ), m_hitRow(0), m_hits(0) {
+        m_maxRowHits = params.find<unsigned int>("maxRowHits", 16);
+    }
+
+    virtual void push( Transaction* trans ) {
+        m_queue.push( trans->row, trans );
+    }
+
+    virtual Transaction* pop( unsigned row ) {
+        if ( m_queue.empty() ) {
+            return NULL;
+        }
+
+        // The bound is on consecutive hits to one row, start over when the bank's row changes
+        if ( row != m_hitRow ) {
+            m_hitRow = row;
+            m_hits = 0;
+        }
+
+        Transaction* trans;
+        Transaction** hit = m_queue.front( row );
+        if ( hit && ( 0 == m_maxRowHits || m_hits < m_maxRowHits ) ) {
+            trans = *hit;
+            m_queue.pop( row );
+            m_hits++;
+        } else {
+            // No hit, or the open row has had its share; go in order
+            trans = *m_queue.front();
+            m_queue.pop();
+            m_hits = 0;
+        }
+        return trans;
+    }
+
+    virtual bool empty() {
+        return m_queue.empty();
+    }
+
+  private:
+    RowIndexedQueue<Transaction*> m_queue;
+    unsigned m_maxRowHits;
+    unsigned m_hitRow;      // Open row that m_hits counts hits to
+    unsigned m_hits;
+};
+
 }
 }
 }
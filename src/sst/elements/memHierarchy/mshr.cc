@@ -574,7 +574,11 @@ uint32_t MSHR::getAcksNeeded(Addr addr) {
     return (mshr_.find(addr)->second.acksNeeded);
 }
     
-void MSHR::setData(Addr addr, vector<uint8_t>& data, bool dirty) {
+void MSHR::setData(Addr addr, const vector<uint8_t>& data, bool dirty) {
+    setData(addr, PayloadBuffer(data), dirty);
+}
+
+void MSHR::setData(Addr addr, const PayloadBuffer& data, bool dirty) {
 //    if (is_debug_addr(addr))
 //        d_->debug(_L10_, "    MSHR::setData(0x%" PRIx64 ")\n", addr);
     if (mshr_.find(addr) == mshr_.end()) {
@@ -598,7 +602,7 @@ void MSHR::clearData(Addr addr) {
     mshr_.find(addr)->second.dataDirty = false;
 }
 
-vector<uint8_t>& MSHR::getData(Addr addr) {
+const PayloadBuffer& MSHR::getData(Addr addr) {
 //    if (is_debug_addr(addr))
 //        d_->debug(_L20_, "    MSHR::getData(0x%" PRIx64 ")\n", addr);
     if (mshr_.find(addr) == mshr_.end()) {
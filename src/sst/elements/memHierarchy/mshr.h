@@ -27,6 +27,7 @@
 #include <sst/core/simulation.h>
 
 #include "sst/elements/memHierarchy/memEvent.h"
+#include "sst/elements/memHierarchy/payloadBuffer.h"
 #include "sst/elements/memHierarchy/util.h"
 
 namespace SST { namespace MemHierarchy {
@@ -167,7 +168,7 @@ struct MSHRRegister {
     MSHRRegister() : acksNeeded(0), dataDirty(false), pendingRetries(0) { }
     list<MSHREntry> entries;
     uint32_t acksNeeded;
-    vector<uint8_t> dataBuffer;
+    PayloadBuffer dataBuffer;   // Shared with the event the data arrived in
     bool dataDirty;
     uint32_t pendingRetries;
     
@@ -244,9 +245,10 @@ public:
     bool decrementAcksNeeded(Addr addr);
     uint32_t getAcksNeeded(Addr addr);
 
-    void setData(Addr addr, vector<uint8_t>& data, bool dirty = false);
+    void setData(Addr addr, const vector<uint8_t>& data, bool dirty = false);
+    void setData(Addr addr, const PayloadBuffer& data, bool dirty = false);
     void clearData(Addr addr);
-    vector<uint8_t>& getData(Addr addr); 
+    const PayloadBuffer& getData(Addr addr);
     bool hasData(Addr addr);
     bool getDataDirty(Addr addr);
     void setDataDirty(Addr addr, bool dirty);
@@ -15,9 +15,11 @@
 
 #include <sst_config.h>
 #include "multithreadL1Shim.h"
+#include "memEvent.h"
 
 #include <sst/core/params.h>
 #include <sst/core/simulation.h>
+#include <sst/core/unitAlgebra.h>
 #include <sst/core/interfaces/stringEvent.h>
 
 using namespace SST;
@@ -69,6 +71,44 @@ MultiThreadL1::MultiThreadL1(ComponentId_t id, Params &params) : Component(id) {
     /* Setup throughput limiting */
     requestsPerCycle = params.find<uint64_t>("requests_per_cycle", 0);
     responsesPerCycle = params.find<uint64_t>("responses_per_cycle", 0);
+
+    /* Setup translation */
+    tlbEnabled = params.find<bool>("tlb_enable", false);
+    translationSeq = 0;
+    if (tlbEnabled) {
+        UnitAlgebra pageSize = UnitAlgebra(params.find<std::string>("tlb_page_size", "4KiB"));
+        if (!pageSize.hasUnits("B"))
+            output.fatal(CALL_INFO, -1, "Invalid param(%s): tlb_page_size - must have units of bytes(B). SI units OK. You specified '%s'.\n", getName().c_str(), pageSize.toString().c_str());
+        if (!isPowerOfTwo(pageSize.getRoundedValue()))
+            output.fatal(CALL_INFO, -1, "Invalid param(%s): tlb_page_size - must be a power of 2. You specified '%s'.\n", getName().c_str(), pageSize.toString().c_str());
+
+        TranslationFrontEnd::Config cfg;
+        cfg.pageSize = pageSize.getRoundedValue();
+        cfg.l1Entries = params.find<unsigned>("tlb_l1_entries", 64);
+        cfg.l1Assoc = params.find<unsigned>("tlb_l1_assoc", 4);
+        cfg.l1Latency = params.find<unsigned>("tlb_l1_latency", 1);
+        cfg.l2Entries = params.find<unsigned>("tlb_l2_entries", 1536);
+        cfg.l2Assoc = params.find<unsigned>("tlb_l2_assoc", 12);
+        cfg.l2Latency = params.find<unsigned>("tlb_l2_latency", 8);
+        cfg.pwcEntries = params.find<unsigned>("tlb_pwc_entries", 32);
+        cfg.pwcAssoc = params.find<unsigned>("tlb_pwc_assoc", 4);
+        cfg.pwcLatency = params.find<unsigned>("tlb_pwc_latency", 2);
+        cfg.walkLatency = params.find<unsigned>("tlb_walk_latency", 30);
+        cfg.faultLatency = params.find<unsigned>("tlb_fault_latency", 0);
+        if (cfg.l1Entries == 0)
+            output.fatal(CALL_INFO, -1, "Invalid param(%s): tlb_l1_entries - must be at least 1.\n", getName().c_str());
+        translation.init(threadLinks.size(), cfg);
+
+        for (unsigned int i = 0; i < threadLinks.size(); i++) {
+            std::string thread = "thread" + std::to_string(i);
+            stat_tlbL1Hit.push_back(registerStatistic<uint64_t>("tlb_l1_hit", thread));
+            stat_tlbL1Miss.push_back(registerStatistic<uint64_t>("tlb_l1_miss", thread));
+        }
+        stat_tlbL2Hit = registerStatistic<uint64_t>("tlb_l2_hit");
+        stat_tlbL2Miss = registerStatistic<uint64_t>("tlb_l2_miss");
+        stat_tlbWalkLevels = registerStatistic<uint64_t>("tlb_walk_levels");
+        stat_tlbPageFaults = registerStatistic<uint64_t>("tlb_page_faults");
+    }
 }
 
 MultiThreadL1::~MultiThreadL1() {
@@ -80,13 +120,47 @@ MultiThreadL1::~MultiThreadL1() {
         delete responseQueue.front();
         responseQueue.pop();
     }
+    while (translationQueue.size()) {
+        delete translationQueue.top().event;
+        translationQueue.pop();
+    }
 }
 
 void MultiThreadL1::handleRequest(SST::Event * ev, unsigned int threadid) {
     MemEventBase *event = static_cast<MemEventBase*>(ev);
     if (!clockOn) enableClock();
-    threadRequestMap.insert(std::make_pair(event->getID(), threadid));
-    requestQueue.push(event);
+    threadRequestMap.insert(event->getID(), threadid);
+    if (tlbEnabled)
+        translate(event, threadid);
+    else
+        requestQueue.push(event);
+}
+
+/* Look up the translation and hold the request until its latency has elapsed */
+void MultiThreadL1::translate(MemEventBase * event, unsigned int threadid) {
+    MemEvent * memEvent = dynamic_cast<MemEvent*>(event);
+    Addr vaddr = event->getRoutingAddress();
+    if (memEvent && memEvent->getVirtualAddress() != 0)
+        vaddr = memEvent->getVirtualAddress();
+
+    TranslationFrontEnd::Result res = translation.translate(threadid, vaddr);
+
+    if (res.l1Hit) {
+        stat_tlbL1Hit[threadid]->addData(1);
+    } else {
+        stat_tlbL1Miss[threadid]->addData(1);
+        if (res.l2Hit) {
+            stat_tlbL2Hit->addData(1);
+        } else {
+            stat_tlbL2Miss->addData(1);
+            stat_tlbWalkLevels->addData(res.walkLevels);
+            if (res.fault) stat_tlbPageFaults->addData(1);
+        }
+    }
+
+    // A request arriving now would otherwise be sent on the next tick
+    TranslatingRequest req = { timestamp + 1 + res.latency, translationSeq++, event };
+    translationQueue.push(req);
 }
 
 void MultiThreadL1::handleResponse(SST::Event * ev) {
@@ -97,6 +171,12 @@ void MultiThreadL1::handleResponse(SST::Event * ev) {
 
 bool MultiThreadL1::tick(SST::Cycle_t cycle) {
     timestamp++;
+
+    /* Release requests whose translation has completed */
+    while (!translationQueue.empty() && translationQueue.top().readyTime <= timestamp) {
+        requestQueue.push(translationQueue.top().event);
+        translationQueue.pop();
+    }
    
     uint64_t sendcount = (requestsPerCycle == 0) ? requestQueue.size() : requestsPerCycle;
     
@@ -114,15 +194,15 @@ bool MultiThreadL1::tick(SST::Cycle_t cycle) {
         MemEventBase * event = responseQueue.front();
         responseQueue.pop();
         
-        unsigned int linkid = threadRequestMap.find(event->getResponseToID())->second;
-        threadRequestMap.erase(event->getResponseToID());
+        unsigned int linkid = 0;
+        threadRequestMap.remove(event->getResponseToID(), &linkid);
         threadLinks[linkid]->send(event);
         
         sendcount--;
     }
 
     /* Turn off clock if queues are empty */
-    if (requestQueue.empty() && responseQueue.empty()) {
+    if (requestQueue.empty() && responseQueue.empty() && translationQueue.empty()) {
         clockOn = false;
         return true;
     }
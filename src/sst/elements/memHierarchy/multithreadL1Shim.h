@@ -16,8 +16,9 @@
 #ifndef _MEMHIERARCHY_MULTITHREADL1_H_
 #define _MEMHIERARCHY_MULTITHREADL1_H_
 
-#include <map>
+#include <functional>
 #include <queue>
+#include <vector>
 
 #include <sst/core/event.h>
 #include <sst/core/sst_types.h>
@@ -26,7 +27,9 @@
 #include <sst/core/timeConverter.h>
 #include <sst/core/output.h>
 
+#include "sst/elements/memHierarchy/idSlotTable.h"
 #include "sst/elements/memHierarchy/memEventBase.h"
+#include "sst/elements/memHierarchy/translationFrontEnd.h"
 #include "sst/elements/memHierarchy/util.h"
 
 using namespace std;
@@ -45,7 +48,28 @@ public:
             {"responses_per_cycle", "(uint) Number of responses to forward to threads each cycle (for all threads combined). 0 indicates unlimited", "0"},
             {"debug",               "(uint) Where to print debug output. Options: 0[no output], 1[stdout], 2[stderr], 3[file]", "0"},
             {"debug_level",         "(uint) Debug verbosity level. Between 0 and 10", "0"},
-            {"debug_addr",          "(comma separated uint) Address(es) to be debugged. Leave empty for all, otherwise specify one or more, comma-separated values. Start and end string with brackets",""} )
+            {"debug_addr",          "(comma separated uint) Address(es) to be debugged. Leave empty for all, otherwise specify one or more, comma-separated values. Start and end string with brackets",""},
+            {"tlb_enable",          "(bool) Model address translation latency for requests from the threads (timing only, addresses are not changed)", "false"},
+            {"tlb_page_size",       "(string) Page size. Must be a power of 2.", "4KiB"},
+            {"tlb_l1_entries",      "(uint) Entries in each thread's private L1 TLB", "64"},
+            {"tlb_l1_assoc",        "(uint) Associativity of the L1 TLBs", "4"},
+            {"tlb_l1_latency",      "(uint) L1 TLB access latency in cycles", "1"},
+            {"tlb_l2_entries",      "(uint) Entries in the shared L2 TLB. 0 disables the L2 TLB", "1536"},
+            {"tlb_l2_assoc",        "(uint) Associativity of the L2 TLB", "12"},
+            {"tlb_l2_latency",      "(uint) L2 TLB access latency in cycles", "8"},
+            {"tlb_pwc_entries",     "(uint) Entries in each of the page walk caches (one per upper page table level). 0 disables them", "32"},
+            {"tlb_pwc_assoc",       "(uint) Associativity of the page walk caches", "4"},
+            {"tlb_pwc_latency",     "(uint) Page walk cache access latency in cycles", "2"},
+            {"tlb_walk_latency",    "(uint) Latency in cycles of each page table level read by a page walk", "30"},
+            {"tlb_fault_latency",   "(uint) Extra latency in cycles the first time a page is touched", "0"} )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+            {"tlb_l1_hit",          "Translations that hit in a thread's L1 TLB", "count", 1},
+            {"tlb_l1_miss",         "Translations that missed in a thread's L1 TLB", "count", 1},
+            {"tlb_l2_hit",          "Translations that hit in the L2 TLB", "count", 1},
+            {"tlb_l2_miss",         "Translations that missed in the L2 TLB", "count", 1},
+            {"tlb_walk_levels",     "Page table levels read by page walks", "count", 1},
+            {"tlb_page_faults",     "Pages touched for the first time", "count", 1} )
       
     SST_ELI_DOCUMENT_PORTS(           
           {"cache", "Link to L1 cache", {"memHierarchy.MemEventBase"} },
@@ -87,7 +111,30 @@ private:
     TimeConverter* clock;
 
     /** Track outstanding requests for routing responses correctly */
-    std::map<Event::id_type, unsigned int> threadRequestMap;
+    IDSlotTable<unsigned int> threadRequestMap;
+
+    /** Address translation */
+    bool tlbEnabled;
+    TranslationFrontEnd translation;
+    struct TranslatingRequest {
+        uint64_t readyTime;
+        uint64_t seq;
+        MemEventBase* event;
+        bool operator>(const TranslatingRequest& rhs) const {
+            return readyTime != rhs.readyTime ? readyTime > rhs.readyTime : seq > rhs.seq;
+        }
+    };
+    std::priority_queue<TranslatingRequest, std::vector<TranslatingRequest>, std::greater<TranslatingRequest> > translationQueue;
+    uint64_t translationSeq;
+
+    vector<Statistic<uint64_t>*> stat_tlbL1Hit;
+    vector<Statistic<uint64_t>*> stat_tlbL1Miss;
+    Statistic<uint64_t>* stat_tlbL2Hit;
+    Statistic<uint64_t>* stat_tlbL2Miss;
+    Statistic<uint64_t>* stat_tlbWalkLevels;
+    Statistic<uint64_t>* stat_tlbPageFaults;
+
+    void translate(MemEventBase* event, unsigned int threadid);
 
     /** Throughput control */
     uint64_t requestsPerCycle;
@@ -0,0 +1,95 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_PAYLOAD_BUFFER_H
+#define MEMHIERARCHY_PAYLOAD_BUFFER_H
+
+#include <stdint.h>
+#include <memory>
+#include <vector>
+
+namespace SST {
+namespace MemHierarchy {
+
+/*
+ * Reference-counted, copy-on-write data buffer.
+ *
+ * Events, MSHR entries and cache lines hold their data in a PayloadBuffer
+ * so that a line moving between them (a fill into the MSHR and the cache,
+ * a response copied from its request, a writeback of a cached line) shares
+ * one vector instead of copying it at every hop.  Readers use read(); any
+ * writer goes through write(), which copies the vector first if another
+ * holder can still see it.  A reference returned by write() is only valid
+ * until the buffer is shared again.
+ *
+ * The reference count is atomic so an event may carry a shared buffer to
+ * another thread; a holder only writes in place once it is the sole owner.
+ */
+class PayloadBuffer {
+public:
+    typedef std::vector<uint8_t> dataVec;
+
+    PayloadBuffer() { }
+    explicit PayloadBuffer(const dataVec& data) : data_(std::make_shared<dataVec>(data)) { }
+
+    /* Copying shares the data */
+    PayloadBuffer(const PayloadBuffer& other) = default;
+    PayloadBuffer& operator=(const PayloadBuffer& other) = default;
+
+    /* Read-only view, empty if nothing has been written */
+    const dataVec& read() const {
+        return data_ ? *data_ : none();
+    }
+
+    /* Writable vector, unshared first if needed */
+    dataVec& write() {
+        if (!data_) {
+            data_ = std::make_shared<dataVec>();
+        } else if (data_.use_count() > 1) {
+            data_ = std::make_shared<dataVec>(*data_);
+        }
+        return *data_;
+    }
+
+    /* Replace the contents with a copy of 'data' */
+    void assign(const dataVec& data) {
+        if (data_ && data_.use_count() == 1) {
+            *data_ = data;
+        } else {
+            data_ = std::make_shared<dataVec>(data);
+        }
+    }
+
+    /* Drop this holder's reference */
+    void clear() { data_.reset(); }
+
+    size_t size() const { return data_ ? data_->size() : 0; }
+    bool empty() const { return size() == 0; }
+
+    /* Whether both buffers currently share the same data */
+    bool sharedWith(const PayloadBuffer& other) const { return data_ && data_ == other.data_; }
+
+private:
+    static const dataVec& none() {
+        static const dataVec noData;
+        return noData;
+    }
+
+    std::shared_ptr<dataVec> data_;
+};
+
+}}
+
+#endif
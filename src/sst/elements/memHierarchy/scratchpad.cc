@@ -15,6 +15,7 @@
 
 
 #include <sst_config.h>
+#include <algorithm>
 #include <sst/core/params.h>
 #include <sst/core/simulation.h>
 
@@ -104,6 +105,12 @@ Scratchpad::Scratchpad(ComponentId_t id, Params &params) : Component(id) {
     // Throughput limits
     responsesPerCycle_ = params.find<uint32_t>("response_per_cycle",0);
 
+    // Scratch access size for Get/Put
+    UnitAlgebra moveBurst = UnitAlgebra(params.find<std::string>("move_burst_size", "0B"));
+    if (!moveBurst.hasUnits("B")) out.fatal(CALL_INFO, -1, "Invalid param (%s): move_burst_size - units must be bytes ('B'). SI units ok. You specified '%s'\n", getName().c_str(), moveBurst.toString().c_str());
+    moveBurstSize_ = moveBurst.getRoundedValue();
+    if (moveBurstSize_ < scratchLineSize_) moveBurstSize_ = scratchLineSize_;
+
     // Remote address computation
     remoteAddrOffset_ = params.find<uint64_t>("memory_addr_offset", scratchSize_);
 
@@ -395,17 +402,15 @@ void Scratchpad::processIncomingRemoteEvent(SST::Event * event) {
                 Simulation::getSimulation()->getCurrentSimCycle(), timestamp_, getName().c_str(), ev->getVerboseString().c_str());
 
     // Determine what kind of event spawned this and pass off to handler
-    std::map<SST::Event::id_type,SST::Event::id_type>::iterator it = responseIDMap_.find(ev->getResponseToID());
-
-    if (it == responseIDMap_.end()) {
-        dbg.fatal(CALL_INFO, -1, "(%s) Received data response from remote but no matching request in responseIDMap_, id is (%" PRIu64 ", %" PRIu32 "), timestamp is %" PRIu64 "\n",
+    ResponseTarget target;
+    if (!responseTable_.remove(ev->getResponseToID(), &target)) {
+        dbg.fatal(CALL_INFO, -1, "(%s) Received data response from remote but no matching request in responseTable_, id is (%" PRIu64 ", %" PRIu32 "), timestamp is %" PRIu64 "\n",
                 getName().c_str(), ev->getResponseToID().first, ev->getResponseToID().second, timestamp_);
     }
 
-    SST::Event::id_type requestID = it->second;
-    responseIDMap_.erase(it);
+    SST::Event::id_type requestID = target.requestID;
 
-    MemEventBase * requestBase = outstandingEventList_.find(requestID)->second.request;
+    MemEventBase * requestBase = outstandingEventList_.lookup(requestID)->request;
 
     if (requestBase->getCmd() == Command::Get) handleRemoteGetResponse(ev, requestID);
     else handleRemoteReadResponse(ev, requestID);
@@ -518,21 +523,20 @@ void Scratchpad::handleScratchRead(MemEvent * ev) {
     read->setVirtualAddress(ev->getVirtualAddress());
     read->setInstructionPointer(ev->getInstructionPointer());
 
-    responseIDMap_.insert(std::make_pair(read->getID(),ev->getID()));
-    responseIDAddrMap_.insert(std::make_pair(read->getID(),ev->getBaseAddr()));
-    outstandingEventList_.insert(std::make_pair(ev->getID(),OutstandingEvent(ev,response)));
+    responseTable_.insert(read->getID(), ResponseTarget(ev->getID(), ev->getBaseAddr()));
+    outstandingEventList_.insert(ev->getID(), OutstandingEvent(ev,response));
 
-    if (mshr_.find(ev->getBaseAddr()) == mshr_.end()) {
+    if (!mshr_.contains(ev->getBaseAddr())) {
         std::vector<uint8_t> data = doScratchRead(read);
         response->setPayload(data);
-        mshr_.insert(std::make_pair(ev->getBaseAddr(), std::list<MSHREntry>(1,MSHREntry(ev->getID(), Command::GetS, true, false))));
+        mshr_.push_back(ev->getBaseAddr(), MSHREntry(ev->getID(), Command::GetS, true, false));
         if (caching_ && !ev->queryFlag(MemEvent::F_NONCACHEABLE)) {
             cacheStatus_.at(ev->getBaseAddr()/scratchLineSize_) = true;
         }
         if (is_debug_addr(addr))
             eventDI.action = "ScrRead";
     } else {
-        mshr_.find(ev->getBaseAddr())->second.push_back(MSHREntry(ev->getID(), Command::GetS, read));
+        mshr_.push_back(ev->getBaseAddr(), MSHREntry(ev->getID(), Command::GetS, read));
         if (is_debug_addr(addr)) {
             eventDI.action = "stall";
             eventDI.reason = "MSHR conflict";
@@ -541,7 +545,7 @@ void Scratchpad::handleScratchRead(MemEvent * ev) {
     
     if (is_debug_event(ev)) {
         dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:InsEv    0x%-16" PRIx64 " %s\n",
-                Simulation::getSimulation()->getCurrentSimCycle(), timestamp_, getName().c_str(), ev->getBaseAddr(), mshr_.find(ev->getBaseAddr())->second.back().getString().c_str());
+                Simulation::getSimulation()->getCurrentSimCycle(), timestamp_, getName().c_str(), ev->getBaseAddr(), mshr_.back(ev->getBaseAddr())->getString().c_str());
     }
 }
 
@@ -568,13 +572,13 @@ void Scratchpad::handleScratchWrite(MemEvent * ev) {
     bool doWrite = false; // Decide whether to handle this write immediately EVEN if a conflict
     bool inserted = false;
     /* Check for writeback/invalidation races */
-    if (!directory_ && ev->isWriteback() && mshr_.find(ev->getBaseAddr()) != mshr_.end()) {
-        MSHREntry * entry = &(mshr_.find(ev->getBaseAddr())->second.front());
-        if (outstandingEventList_.find(entry->id)->second.request->getCmd() == Command::Get) {
+    if (!directory_ && ev->isWriteback() && mshr_.contains(ev->getBaseAddr())) {
+        MSHREntry * entry = mshr_.front(ev->getBaseAddr());
+        if (outstandingEventList_.lookup(entry->id)->request->getCmd() == Command::Get) {
             handleAckInv(ev);
             return;
             // TODO handle corner cases where Get only writes partial line
-        } else if (outstandingEventList_.find(entry->id)->second.request->getCmd() == Command::Put) {
+        } else if (outstandingEventList_.lookup(entry->id)->request->getCmd() == Command::Put) {
             if (ev->getPayload().empty()) {
                 handleAckInv(ev);
             } else {
@@ -606,31 +610,31 @@ void Scratchpad::handleScratchWrite(MemEvent * ev) {
     write->setInstructionPointer(ev->getInstructionPointer());
     write->setFlag(MemEvent::F_NORESPONSE);
     
-    if (directory_ && ev->isWriteback() && mshr_.find(ev->getBaseAddr()) != mshr_.end()) {
+    if (directory_ && ev->isWriteback() && mshr_.contains(ev->getBaseAddr())) {
         /* For directory - jump write ahead of a Put so we have correct data but otherwise
          * do not resolve race by treating writeback as ackinv since it may not actually signal that
          * the block is not present in caches */
-        std::list<MSHREntry>* entry = &(mshr_.find(ev->getBaseAddr())->second);
-        for (std::list<MSHREntry>::iterator it = entry->begin(); it != entry->end(); it++) {
-            if (it->cmd == Command::Put) {
-                if (it == entry->begin()) {
+        int head = mshr_.begin(ev->getBaseAddr());
+        for (int it = head; it != MSHR::NIL; it = mshr_.next(it)) {
+            if (mshr_.at(it).cmd == Command::Put) {
+                if (it == head) {
                     doScratchWrite(write);
                     sendResponse(response); /* Send response when request is sent to scratch, since scratch doesn't respond */
                     delete ev;
                 } else {
-                    outstandingEventList_.insert(std::make_pair(ev->getID(),OutstandingEvent(ev,response)));
-                    it = entry->insert(it, MSHREntry(ev->getID(), Command::GetX, write));
+                    outstandingEventList_.insert(ev->getID(), OutstandingEvent(ev,response));
+                    it = mshr_.insert(ev->getBaseAddr(), it, MSHREntry(ev->getID(), Command::GetX, write));
                 
                     if (is_debug_event(ev))
                         dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:InsEv    0x%-16" PRIx64 " %s\n",
-                                Simulation::getSimulation()->getCurrentSimCycle(), timestamp_, getName().c_str(), ev->getBaseAddr(), it->getString().c_str());
+                                Simulation::getSimulation()->getCurrentSimCycle(), timestamp_, getName().c_str(), ev->getBaseAddr(), mshr_.at(it).getString().c_str());
                 }
                 return;
             }
         }
     }
 
-    if (mshr_.find(ev->getBaseAddr()) == mshr_.end()) {
+    if (!mshr_.contains(ev->getBaseAddr())) {
         doScratchWrite(write);
         sendResponse(response); /* Send response when request is sent to scratch since scratch doesn't respond */
         delete ev;
@@ -639,12 +643,12 @@ void Scratchpad::handleScratchWrite(MemEvent * ev) {
             cacheStatus_.at(ev->getBaseAddr()/scratchLineSize_) = directory_;
         }
     } else {
-        outstandingEventList_.insert(std::make_pair(ev->getID(),OutstandingEvent(ev,response)));
-        mshr_.find(ev->getBaseAddr())->second.push_back(MSHREntry(ev->getID(), Command::GetX, write));
+        outstandingEventList_.insert(ev->getID(), OutstandingEvent(ev,response));
+        mshr_.push_back(ev->getBaseAddr(), MSHREntry(ev->getID(), Command::GetX, write));
         
         if (is_debug_event(ev))
             dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:InsEv    0x%-16" PRIx64 " %s\n",
-                        Simulation::getSimulation()->getCurrentSimCycle(), timestamp_, getName().c_str(), ev->getBaseAddr(), mshr_.find(ev->getBaseAddr())->second.back().getString().c_str());
+                        Simulation::getSimulation()->getCurrentSimCycle(), timestamp_, getName().c_str(), ev->getBaseAddr(), mshr_.back(ev->getBaseAddr())->getString().c_str());
     }
 }
 
@@ -671,7 +675,7 @@ void Scratchpad::handleScratchGet(MemEventBase * event) {
     stat_ScratchGetReceived->addData(1);
 
     MoveEvent * response = ev->makeResponse();
-    outstandingEventList_.insert(std::make_pair(ev->getID(),OutstandingEvent(ev,response)));
+    outstandingEventList_.insert(ev->getID(), OutstandingEvent(ev,response));
 
     // Issue remote read
     ev->setSrcBaseAddr((ev->getSrcAddr() - remoteAddrOffset_) & ~(remoteLineSize_ - 1));
@@ -680,7 +684,7 @@ void Scratchpad::handleScratchGet(MemEventBase * event) {
     remoteRead->setRqstr(ev->getRqstr());
     remoteRead->setVirtualAddress(ev->getSrcVirtualAddress());
     remoteRead->setInstructionPointer(ev->getInstructionPointer());
-    responseIDMap_.insert(std::make_pair(remoteRead->getID(), ev->getID()));
+    responseTable_.insert(remoteRead->getID(), ResponseTarget(ev->getID()));
 
     if (is_debug_event(remoteRead)) {
         dbg.debug(_L10_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Get           0x%-16" PRIx64 " 0x%-16" PRIx64 " Remote Read (<%" PRIu64 ", %" PRIu32 ">, 0x%" PRIx64 ")\n",
@@ -695,18 +699,18 @@ void Scratchpad::handleScratchGet(MemEventBase * event) {
     uint32_t lineCount = 1 + (ev->getDstAddr() + ev->getSize() - ev->getDstBaseAddr() - 1)/ scratchLineSize_;
     for (uint32_t i = 0; i < lineCount; i++) {
         Addr baseAddr = ev->getDstBaseAddr() + i*scratchLineSize_;
-        if (mshr_.find(baseAddr) == mshr_.end()) {
+        if (!mshr_.contains(baseAddr)) {
             bool needAck = startGet(baseAddr, ev);
-            mshr_.insert(std::make_pair(baseAddr, std::list<MSHREntry>(1, MSHREntry(ev->getID(), Command::Get, true, needAck))));
+            mshr_.push_back(baseAddr, MSHREntry(ev->getID(), Command::Get, true, needAck));
         } else {
-            mshr_.find(baseAddr)->second.push_back(MSHREntry(ev->getID(), Command::Get, true));
+            mshr_.push_back(baseAddr, MSHREntry(ev->getID(), Command::Get, true));
         }
         
         if (is_debug_addr(baseAddr))
             dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:InsEv    0x%-16" PRIx64 " %s\n",
-                    Simulation::getSimulation()->getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, mshr_.find(baseAddr)->second.back().getString().c_str());
+                    Simulation::getSimulation()->getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, mshr_.back(baseAddr)->getString().c_str());
         
-        outstandingEventList_.find(ev->getID())->second.incrementCount();
+        outstandingEventList_.lookup(ev->getID())->incrementCount();
     }
 }
 
@@ -737,8 +741,15 @@ void Scratchpad::handleScratchPut(MemEventBase * event) {
     remoteWrite->setFlag(MemEvent::F_NONCACHEABLE);
     remoteWrite->setFlag(MemEvent::F_NORESPONSE);
 
-    outstandingEventList_.insert(std::make_pair(ev->getID(), OutstandingEvent(ev, response, remoteWrite)));
+    outstandingEventList_.insert(ev->getID(), OutstandingEvent(ev, response, remoteWrite));
     
+    // Lines that are neither busy nor cached can be read right away. Runs
+    // of them are combined into one scratch read of up to moveBurstSize_ bytes.
+    Addr burstAddr = 0;
+    Addr burstBase = 0;
+    uint32_t burstSize = 0;
+    uint32_t burstLines = 0;
+
     Addr addr = ev->getSrcAddr();
     Addr baseAddr = ev->getSrcBaseAddr();
     uint32_t bytesLeft = ev->getSize();
@@ -746,24 +757,41 @@ void Scratchpad::handleScratchPut(MemEventBase * event) {
         uint32_t size = (baseAddr + scratchLineSize_) - addr;
         if (size > bytesLeft) size = bytesLeft;
 
-        if (mshr_.find(baseAddr) == mshr_.end()) {
+        bool ready = !mshr_.contains(baseAddr) && !(caching_ && cacheStatus_.at(baseAddr/scratchLineSize_));
+        if (burstLines != 0 && (!ready || burstSize + size > moveBurstSize_)) {
+            issuePutRead(ev, burstAddr, burstBase, burstSize, burstLines);
+            burstLines = 0;
+        }
+
+        if (ready) {
+            if (burstLines == 0) {
+                burstAddr = addr;
+                burstBase = baseAddr;
+                burstSize = 0;
+            }
+            burstSize += size;
+            burstLines++;
+            mshr_.push_back(baseAddr, MSHREntry(ev->getID(), Command::Put, true, false));
+        } else if (!mshr_.contains(baseAddr)) {
             bool needAck = startPut(baseAddr, ev);
-            mshr_.insert(std::make_pair(baseAddr, std::list<MSHREntry>(1, MSHREntry(ev->getID(), Command::Put, !needAck, needAck))));
+            mshr_.push_back(baseAddr, MSHREntry(ev->getID(), Command::Put, !needAck, needAck));
         } else {
-            mshr_.find(baseAddr)->second.push_back(MSHREntry(ev->getID(), Command::Put));
+            mshr_.push_back(baseAddr, MSHREntry(ev->getID(), Command::Put));
         }
         
         if (is_debug_addr(baseAddr))
             dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:InsEv    0x%-16" PRIx64 " %s\n",
                     Simulation::getSimulation()->getCurrentSimCycle(), timestamp_, getName().c_str(), 
-                    baseAddr, mshr_.find(baseAddr)->second.back().getString().c_str());
+                    baseAddr, mshr_.back(baseAddr)->getString().c_str());
 
         bytesLeft -= size;
         baseAddr += scratchLineSize_;
         addr = baseAddr;
         
-        outstandingEventList_.find(ev->getID())->second.incrementCount();
+        outstandingEventList_.lookup(ev->getID())->incrementCount();
     }
+    if (burstLines != 0)
+        issuePutRead(ev, burstAddr, burstBase, burstSize, burstLines);
 }
 
 
@@ -775,22 +803,25 @@ void Scratchpad::handleScratchPut(MemEventBase * event) {
  *  All others (regular read responses): call finishRequest()
  */
 void Scratchpad::handleScratchResponse(SST::Event::id_type responseID) {
-    SST::Event::id_type requestID = responseIDMap_.find(responseID)->second;
-    responseIDMap_.erase(responseID);
-    
-    Addr baseAddr = responseIDAddrMap_.find(responseID)->second;
-    responseIDAddrMap_.erase(responseID);
+    ResponseTarget target;
+    responseTable_.remove(responseID, &target);
+    SST::Event::id_type requestID = target.requestID;
+    Addr baseAddr = target.baseAddr;
 
     if (is_debug_addr(baseAddr))
         dbg.debug(_L5_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Scratch:Recv  0x%-16" PRIx64 " <%" PRIu64 ", %" PRIu32 ">\n",
                 Simulation::getSimulation()->getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, responseID.first, responseID.second);
 
-    if (outstandingEventList_.find(requestID)->second.request->getCmd() == Command::Put) {
-        updatePut(requestID);
+    if (outstandingEventList_.lookup(requestID)->request->getCmd() == Command::Put) {
+        // A read for a Put may cover several lines, each with its own MSHR entry
+        for (uint32_t i = 0; i < target.lines; i++) {
+            updatePut(requestID);
+            updateMSHR(baseAddr + i*scratchLineSize_);
+        }
     } else { // Anything else - GetS, GetX, etc.
         finishRequest(requestID);
+        updateMSHR(baseAddr);
     }
-    updateMSHR(baseAddr);
 }
 
 
@@ -808,9 +839,9 @@ void Scratchpad::handleAckInv(MemEventBase * event) {
     Addr baseAddr = response->getBaseAddr();
     
     /* Look up request in mshr */
-    MSHREntry * entry = &(mshr_.find(baseAddr)->second.front());
+    MSHREntry * entry = mshr_.front(baseAddr);
     SST::Event::id_type requestID = entry->id;
-    MoveEvent * request = static_cast<MoveEvent*>(outstandingEventList_.find(requestID)->second.request);
+    MoveEvent * request = static_cast<MoveEvent*>(outstandingEventList_.lookup(requestID)->request);
     
     /* Update cache status */
     if (is_debug_addr(baseAddr))
@@ -847,20 +878,7 @@ void Scratchpad::handleAckInv(MemEventBase * event) {
 
         uint32_t size = deriveSize(addr, baseAddr, request->getSrcAddr(), request->getSize());
         
-        MemEvent * read = new MemEvent(getName(), addr, baseAddr, Command::GetS, size);
-        read->setRqstr(request->getRqstr());
-        read->setVirtualAddress(request->getSrcVirtualAddress());
-        read->setInstructionPointer(request->getInstructionPointer());
-        responseIDMap_.insert(std::make_pair(read->getID(),requestID));
-        responseIDAddrMap_.insert(std::make_pair(read->getID(), baseAddr));
-
-        std::vector<uint8_t> data = doScratchRead(read);
-        std::vector<uint8_t> payload = outstandingEventList_.find(requestID)->second.remoteWrite->getPayload();
-        uint32_t offset = addr - request->getSrcAddr();
-        for (uint32_t i = 0; i < size; i++) {
-            payload[i+offset] = data[i];
-        }
-        outstandingEventList_.find(requestID)->second.remoteWrite->setPayload(payload);
+        issuePutRead(request, addr, baseAddr, size, 1);
     } else {
         dbg.fatal(CALL_INFO, -1, "%s, Error: unhandled case in handleAckInv. Time = %" PRIu64 ", Event = (%s).\n",
                 getName().c_str(), timestamp_, event->getVerboseString().c_str());
@@ -883,9 +901,9 @@ void Scratchpad::handleFetchResp(MemEventBase * event) {
     Addr baseAddr = response->getBaseAddr();
 
     /* Look up request in mshr */
-    MSHREntry * entry = &(mshr_.find(baseAddr)->second.front());
+    MSHREntry * entry = mshr_.front(baseAddr);
     SST::Event::id_type requestID = entry->id;
-    MoveEvent * put = static_cast<MoveEvent*>(outstandingEventList_.find(requestID)->second.request);
+    MoveEvent * put = static_cast<MoveEvent*>(outstandingEventList_.lookup(requestID)->request);
 
     /* Update cache status */
     cacheStatus_.at(baseAddr/scratchLineSize_) = false;
@@ -907,12 +925,12 @@ void Scratchpad::handleFetchResp(MemEventBase * event) {
     uint32_t size = deriveSize(addr, baseAddr, put->getSrcAddr(), put->getSize());
 
     // Update write payload
-    std::vector<uint8_t> payload = outstandingEventList_.find(requestID)->second.remoteWrite->getPayload();
+    std::vector<uint8_t> payload = outstandingEventList_.lookup(requestID)->remoteWrite->getPayload();
     uint32_t offset = addr - put->getSrcAddr();
     for (uint32_t i = 0; i < size; i++) {
         payload[i+offset] = response->getPayload()[i];
     }
-    outstandingEventList_.find(requestID)->second.remoteWrite->setPayload(payload);
+    outstandingEventList_.lookup(requestID)->remoteWrite->setPayload(payload);
 
     // Clear this mshr entry
     updatePut(requestID);
@@ -935,13 +953,13 @@ void Scratchpad::handleNack(MemEventBase * event) {
      * been resolved.
      */
     MemEvent * nackedEvent = nack->getNACKedEvent();
-    if (mshr_.find(nackedEvent->getBaseAddr()) == mshr_.end()) {
+    if (!mshr_.contains(nackedEvent->getBaseAddr())) {
         delete nackedEvent;
         delete nack;
         return;
     }
 
-    MSHREntry * entry = &(mshr_.find(nackedEvent->getBaseAddr())->second.front());
+    MSHREntry * entry = mshr_.front(nackedEvent->getBaseAddr());
     if (entry->needAck) {
         // Determine whether nackedEvent actually matches request -> if not, don't resend
         // resend inv
@@ -977,8 +995,8 @@ void Scratchpad::handleRemoteRead(MemEvent * event) {
     request->setInstructionPointer(event->getInstructionPointer());
     
     MemEvent * response = event->makeResponse();
-    outstandingEventList_.insert(std::make_pair(event->getID(), OutstandingEvent(event, response)));
-    responseIDMap_.insert(std::make_pair(request->getID(), event->getID()));
+    outstandingEventList_.insert(event->getID(), OutstandingEvent(event, response));
+    responseTable_.insert(request->getID(), ResponseTarget(event->getID()));
     
     memMsgQueue_.insert(std::make_pair(timestamp_, request));
 }
@@ -1015,52 +1033,61 @@ void Scratchpad::handleRemoteWrite(MemEvent * event) {
  * Handle a read response from remote memory in response to a ScratchGet 
  * If from a ScratchGet, write data to scratchpad and send a response
  * to the processor once all data is written.
+ *
+ * Lines for which the Get is at the head of the MSHR are written now.
+ * Runs of such lines are combined into one scratch write of up to
+ * moveBurstSize_ bytes. Lines that are waiting behind another
+ * request keep a per-line write in their MSHR entry.
  */
 void Scratchpad::handleRemoteGetResponse(MemEvent * response, SST::Event::id_type requestID) {
     
-    MoveEvent * request = static_cast<MoveEvent*>(outstandingEventList_.find(requestID)->second.request);
-    
+    MoveEvent * request = static_cast<MoveEvent*>(outstandingEventList_.lookup(requestID)->request);
+    std::vector<uint8_t>& payload = response->getPayload();
+
     uint32_t bytesLeft = request->getSize();
     Addr addr = request->getDstAddr();
     Addr baseAddr = request->getDstBaseAddr();
     uint32_t payloadOffset = 0;
 
+    std::vector<Addr> burstLines;
+    Addr burstAddr = addr;
+    uint32_t burstOffset = 0;
+    uint32_t burstSize = 0;
+
     while (bytesLeft != 0) {
-        // Create write
         uint32_t size = (baseAddr + scratchLineSize_) - addr;
         if (size > bytesLeft) size = bytesLeft;
-        std::vector<uint8_t> data(response->getPayload()[payloadOffset],response->getPayload()[payloadOffset+size]);
-        MemEvent * write = new MemEvent(getName(), addr, baseAddr, Command::PutM, data);
-        write->setRqstr(request->getRqstr());
-        write->setVirtualAddress(request->getDstVirtualAddress());
-        write->setInstructionPointer(request->getInstructionPointer());
-        write->setFlag(MemEvent::F_NORESPONSE);
-        
-        if (mshr_.find(baseAddr)->second.front().id == requestID) {
-            doScratchWrite(write);
-            mshr_.find(baseAddr)->second.front().needData = false;
-            
-            if (is_debug_addr(baseAddr))
-                dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:Update   0x%-16" PRIx64 " %s\n",
-                        Simulation::getSimulation()->getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, mshr_.find(baseAddr)->second.front().getString().c_str());
-            
-            if (!mshr_.find(baseAddr)->second.front().needAck) {
-                updateGet(requestID);
-                updateMSHR(baseAddr);
+
+        if (!mshr_.contains(baseAddr)) {
+            dbg.fatal(CALL_INFO, -1, "ERROR: remoteGetResponse but no matching entry in mshr for address 0x%" PRIx64 "\n", baseAddr);
+        }
+
+        if (mshr_.front(baseAddr)->id == requestID) {
+            if (!burstLines.empty() && burstSize + size > moveBurstSize_) {
+                flushGetBurst(request, burstLines, burstAddr, payload, burstOffset, burstSize);
             }
+            if (burstLines.empty()) {
+                burstAddr = addr;
+                burstOffset = payloadOffset;
+                burstSize = 0;
+            }
+            burstLines.push_back(baseAddr);
+            burstSize += size;
         } else {
+            // Not contiguous with the next ready line, send what we have
+            if (!burstLines.empty())
+                flushGetBurst(request, burstLines, burstAddr, payload, burstOffset, burstSize);
+
             // Find it
-            if (mshr_.find(baseAddr) == mshr_.end()) {
-                dbg.fatal(CALL_INFO, -1, "ERROR: remoteGetResponse but no matching entry in mshr for address 0x%" PRIx64 "\n", baseAddr);
-            }
-            for (std::list<MSHREntry>::iterator it = mshr_.find(baseAddr)->second.begin(); it != mshr_.find(baseAddr)->second.end(); it++) {
-                if (it->id == requestID) {
-                    it->scratch = write;
-                    it->needData = false;
+            for (int it = mshr_.begin(baseAddr); it != MSHR::NIL; it = mshr_.next(it)) {
+                MSHREntry& entry = mshr_.at(it);
+                if (entry.id == requestID) {
+                    entry.scratch = createGetWrite(request, addr, baseAddr, payload, payloadOffset, size);
+                    entry.needData = false;
                     
                     if (is_debug_addr(baseAddr))
                         dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:Update   0x%-16" PRIx64 " %s\n",
-                                Simulation::getSimulation()->getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, mshr_.find(baseAddr)->second.front().getString().c_str());
+                                Simulation::getSimulation()->getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, mshr_.front(baseAddr)->getString().c_str());
                 }
             }
         }
@@ -1069,12 +1096,53 @@ void Scratchpad::handleRemoteGetResponse(MemEvent * response, SST::Event::id_typ
         baseAddr += scratchLineSize_;
         addr += size;
     }
+    if (!burstLines.empty())
+        flushGetBurst(request, burstLines, burstAddr, payload, burstOffset, burstSize);
+
     delete response;
 }
 
+/*
+ * Write a run of lines for a Get to scratch and update their MSHR entries.
+ * The write is sent before any MSHR update so that a request waiting behind
+ * the Get on one of these lines is ordered after the write.
+ */
+void Scratchpad::flushGetBurst(MoveEvent * get, std::vector<Addr>& lines, Addr addr, std::vector<uint8_t>& payload, uint32_t offset, uint32_t size) {
+    SST::Event::id_type requestID = get->getID();
+    doScratchWrite(createGetWrite(get, addr, lines.front(), payload, offset, size));
+
+    for (std::vector<Addr>::iterator it = lines.begin(); it != lines.end(); it++) {
+        Addr baseAddr = *it;
+        MSHREntry * entry = mshr_.front(baseAddr);
+        entry->needData = false;
+            
+        if (is_debug_addr(baseAddr))
+            dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:Update   0x%-16" PRIx64 " %s\n",
+                    Simulation::getSimulation()->getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, entry->getString().c_str());
+            
+        if (!entry->needAck) {
+            updateGet(requestID);
+            updateMSHR(baseAddr);
+        }
+    }
+    lines.clear();
+}
+
+MemEvent* Scratchpad::createGetWrite(MoveEvent * get, Addr addr, Addr baseAddr, std::vector<uint8_t>& payload, uint32_t offset, uint32_t size) {
+    std::vector<uint8_t> data(size, 0);
+    if (payload.size() >= offset + size) // Remote memory may not have returned data (no backing store)
+        data.assign(payload.begin() + offset, payload.begin() + offset + size);
+    MemEvent * write = new MemEvent(getName(), addr, baseAddr, Command::PutM, data);
+    write->setRqstr(get->getRqstr());
+    write->setVirtualAddress(get->getDstVirtualAddress());
+    write->setInstructionPointer(get->getInstructionPointer());
+    write->setFlag(MemEvent::F_NORESPONSE);
+    return write;
+}
+
 void Scratchpad::handleRemoteReadResponse(MemEvent * response, SST::Event::id_type requestID) {
     // Update response with payload and finish request
-    MemEvent * fwdResponse = static_cast<MemEvent*>(outstandingEventList_.find(requestID)->second.response);
+    MemEvent * fwdResponse = static_cast<MemEvent*>(outstandingEventList_.lookup(requestID)->response);
     fwdResponse->setPayload(response->getPayload());
     
     finishRequest(requestID);
@@ -1085,42 +1153,42 @@ void Scratchpad::handleRemoteReadResponse(MemEvent * response, SST::Event::id_ty
 // Update MSHR
 void Scratchpad::updateMSHR(Addr baseAddr) {
     // Remove top event
-    mshr_.find(baseAddr)->second.pop_front();
+    mshr_.pop_front(baseAddr);
 
     // Start next event
-    while (!mshr_.find(baseAddr)->second.empty()) {
-        MSHREntry * entry = &(mshr_.find(baseAddr)->second.front());
+    while (mshr_.contains(baseAddr)) {
+        MSHREntry * entry = mshr_.front(baseAddr);
         
         if (entry->cmd == Command::GetS) {
             std::vector<uint8_t> readData = doScratchRead(entry->scratch);
-            static_cast<MemEvent*>(outstandingEventList_.find(entry->id)->second.response)->setPayload(readData);
+            static_cast<MemEvent*>(outstandingEventList_.lookup(entry->id)->response)->setPayload(readData);
             
             if (is_debug_addr(baseAddr))
                 dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:Update   0x%-16" PRIx64 " %s\n",
                         Simulation::getSimulation()->getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, entry->getString().c_str());
             
-            if (caching_ && (outstandingEventList_.find(entry->id)->second.request->queryFlag(MemEvent::F_NONCACHEABLE))) {
+            if (caching_ && (outstandingEventList_.lookup(entry->id)->request->queryFlag(MemEvent::F_NONCACHEABLE))) {
                 cacheStatus_.at(baseAddr/scratchLineSize_) = true;
             }
             break;
         } else if (entry->cmd == Command::GetX) {
             doScratchWrite(entry->scratch);
             finishRequest(entry->id);
-            mshr_.find(baseAddr)->second.pop_front();
+            mshr_.pop_front(baseAddr);
             
             if (is_debug_addr(baseAddr))
                 dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:Remove   0x%-16" PRIx64 "\n",
                         Simulation::getSimulation()->getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr);
         
         } else if (entry->cmd == Command::Get) {
-            entry->needAck = startGet(baseAddr, static_cast<MoveEvent*>(outstandingEventList_.find(entry->id)->second.request));
+            entry->needAck = startGet(baseAddr, static_cast<MoveEvent*>(outstandingEventList_.lookup(entry->id)->request));
             if (!entry->needData) {
                 doScratchWrite(entry->scratch);
                 entry->scratch = nullptr;
             }
             if (!entry->needAck && !entry->needData) {
                 updateGet(entry->id);
-                mshr_.find(baseAddr)->second.pop_front();
+                mshr_.pop_front(baseAddr);
                 
                 if (is_debug_addr(baseAddr))
                     dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:Remove   0x%-16" PRIx64 "\n",
@@ -1133,7 +1201,7 @@ void Scratchpad::updateMSHR(Addr baseAddr) {
                 break; // Still waiting on something
             }
         } else if (entry->cmd == Command::Put) {
-            entry->needAck = startPut(baseAddr, static_cast<MoveEvent*>(outstandingEventList_.find(entry->id)->second.request));
+            entry->needAck = startPut(baseAddr, static_cast<MoveEvent*>(outstandingEventList_.lookup(entry->id)->request));
             entry->needData = !entry->needAck;
             
             if (is_debug_addr(baseAddr))
@@ -1146,10 +1214,8 @@ void Scratchpad::updateMSHR(Addr baseAddr) {
         }
     }
 
-    // Clear mshr entry if list is empty
-    if (mshr_.find(baseAddr)->second.empty()) {
-        mshr_.erase(baseAddr);
-        
+    // The mshr drops a line once its list is empty
+    if (!mshr_.contains(baseAddr)) {
         if (is_debug_addr(baseAddr))
             dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:Erase    0x%-16" PRIx64 "\n", Simulation::getSimulation()->getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr);
     }
@@ -1229,60 +1295,64 @@ bool Scratchpad::startPut(Addr baseAddr, MoveEvent * put) {
             addr = put->getSrcAddr();
         uint32_t size = deriveSize(addr, baseAddr, put->getSrcAddr(), put->getSize());
 
-        MemEvent * read = new MemEvent(getName(), addr, baseAddr, Command::GetS, size);
-        read->setRqstr(put->getRqstr());
-        read->setVirtualAddress(put->getSrcVirtualAddress());
-        read->setInstructionPointer(put->getInstructionPointer());
-        responseIDMap_.insert(std::make_pair(read->getID(), put->getID()));
-        responseIDAddrMap_.insert(std::make_pair(read->getID(), baseAddr));
-        
-        std::vector<uint8_t> data = doScratchRead(read);
-
-        std::vector<uint8_t> payload = outstandingEventList_.find(put->getID())->second.remoteWrite->getPayload();
-        uint32_t offset = addr - put->getSrcAddr();
-        for (uint32_t i = 0; i < size; i++) {
-            payload[i+offset] = data[i];
-        }
-        outstandingEventList_.find(put->getID())->second.remoteWrite->setPayload(payload);
+        issuePutRead(put, addr, baseAddr, size, 1);
         return false;
     }
 }
 
+/* Read 'size' bytes starting at 'addr' from scratch for a Put and
+ * copy the data into the Put's remote write. The read covers 'lines'
+ * lines starting at 'baseAddr'; each is updated when the response returns.
+ */
+void Scratchpad::issuePutRead(MoveEvent * put, Addr addr, Addr baseAddr, uint32_t size, uint32_t lines) {
+    MemEvent * read = new MemEvent(getName(), addr, baseAddr, Command::GetS, size);
+    read->setRqstr(put->getRqstr());
+    read->setVirtualAddress(put->getSrcVirtualAddress());
+    read->setInstructionPointer(put->getInstructionPointer());
+    responseTable_.insert(read->getID(), ResponseTarget(put->getID(), baseAddr, lines));
+    
+    std::vector<uint8_t> data = doScratchRead(read);
+
+    std::vector<uint8_t>& payload = outstandingEventList_.lookup(put->getID())->remoteWrite->getPayload();
+    uint32_t offset = addr - put->getSrcAddr();
+    std::copy(data.begin(), data.begin() + size, payload.begin() + offset);
+}
+
 void Scratchpad::updatePut(SST::Event::id_type putID) {
-    uint32_t count = outstandingEventList_.find(putID)->second.decrementCount();
+    uint32_t count = outstandingEventList_.lookup(putID)->decrementCount();
     if (count == 0) {
-        MoveEvent * put = static_cast<MoveEvent*>(outstandingEventList_.find(putID)->second.request);
+        MoveEvent * put = static_cast<MoveEvent*>(outstandingEventList_.lookup(putID)->request);
         dbg.debug(_L10_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Put            0x%-16" PRIx64 " 0x%-16" PRIx64 " Scratch Done (<%" PRIu64 ", %" PRIu32 ">, 0x%" PRIx64 ")\n",
                 Simulation::getSimulation()->getCurrentSimCycle(), timestamp_, getName().c_str(), 
                 put->getSrcBaseAddr(), 
                 put->getDstBaseAddr(), 
-                outstandingEventList_.find(putID)->second.remoteWrite->getID().first,
-                outstandingEventList_.find(putID)->second.remoteWrite->getID().second,
-                outstandingEventList_.find(putID)->second.remoteWrite->getBaseAddr());
+                outstandingEventList_.lookup(putID)->remoteWrite->getID().first,
+                outstandingEventList_.lookup(putID)->remoteWrite->getID().second,
+                outstandingEventList_.lookup(putID)->remoteWrite->getBaseAddr());
 //        dbg.debug(_L5_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Finish        0x%-16" PRIx64 " <%" PRIu64 ", %" PRIu32 ">\n",
-//                Simulation::getSimulation()->getCurrentSimCycle(), timestamp_, getName().c_str(), outstandingEventList_.find(putID)->second.remoteWrite->getBaseAddr(), baseAddr, responseID.first, responseID.second);
-        memMsgQueue_.insert(std::make_pair(timestamp_, outstandingEventList_.find(putID)->second.remoteWrite));
-        sendResponse(outstandingEventList_.find(putID)->second.response);
-        delete outstandingEventList_.find(putID)->second.request;
-        outstandingEventList_.erase(putID);
+//                Simulation::getSimulation()->getCurrentSimCycle(), timestamp_, getName().c_str(), outstandingEventList_.lookup(putID)->remoteWrite->getBaseAddr(), baseAddr, responseID.first, responseID.second);
+        memMsgQueue_.insert(std::make_pair(timestamp_, outstandingEventList_.lookup(putID)->remoteWrite));
+        sendResponse(outstandingEventList_.lookup(putID)->response);
+        delete outstandingEventList_.lookup(putID)->request;
+        outstandingEventList_.remove(putID);
     }
 
 }
 
 void Scratchpad::updateGet(SST::Event::id_type getID) {
-    uint32_t count = outstandingEventList_.find(getID)->second.decrementCount();
+    uint32_t count = outstandingEventList_.lookup(getID)->decrementCount();
     if (count == 0) {
-        sendResponse(outstandingEventList_.find(getID)->second.response);
-        delete outstandingEventList_.find(getID)->second.request;
-        outstandingEventList_.erase(getID);
+        sendResponse(outstandingEventList_.lookup(getID)->response);
+        delete outstandingEventList_.lookup(getID)->request;
+        outstandingEventList_.remove(getID);
     }
 }
 
 void Scratchpad::finishRequest(SST::Event::id_type requestID) {
-    if (outstandingEventList_.find(requestID)->second.response != nullptr)
-        sendResponse(outstandingEventList_.find(requestID)->second.response);
-    delete outstandingEventList_.find(requestID)->second.request;
-    outstandingEventList_.erase(requestID);
+    if (outstandingEventList_.lookup(requestID)->response != nullptr)
+        sendResponse(outstandingEventList_.lookup(requestID)->response);
+    delete outstandingEventList_.lookup(requestID)->request;
+    outstandingEventList_.remove(requestID);
 }
 
 uint32_t Scratchpad::deriveSize(Addr addr, Addr baseAddr, Addr requestAddr, uint32_t requestSize) {
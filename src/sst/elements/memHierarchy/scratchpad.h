@@ -29,6 +29,7 @@
 #include "sst/elements/memHierarchy/moveEvent.h"
 #include "sst/elements/memHierarchy/memEvent.h"
 #include "sst/elements/memHierarchy/memLinkBase.h"
+#include "sst/elements/memHierarchy/idSlotTable.h"
 
 namespace SST {
 namespace MemHierarchy {
@@ -50,6 +51,7 @@ public:
             {"backing_size_unit",   "(string) For 'malloc' backing stores, malloc granularity", "1MiB"},\
             {"memory_addr_offset",  "(uint) Amount to offset remote addresses by. Default is 'size' so that remote memory addresses start at 0", "size"},
             {"response_per_cycle",  "(uint) Maximum number of responses to return to processor each cycle. 0 is unlimited", "0"},
+            {"move_burst_size",     "(string) Largest scratch access issued for a Get or Put. Contiguous lines that are ready at the same time are combined up to this size. 0B issues one access per scratch line", "0B"},
             {"backendConvertor",    "(string) Backend convertor to use for the scratchpad", "memHierarchy.scratchpadBackendConvertor"},
             {"debug",               "(uint) Where to print debug output. Options: 0[no output], 1[stdout], 2[stderr], 3[file]", "0"},
             {"debug_level",         "(uint) Debug verbosity level. Between 0 and 10", "0"} )
@@ -101,6 +103,9 @@ private:
     uint64_t remoteAddrOffset_;   // Offset for remote addresses, defaults to scratchSize (i.e., CPU addr scratchSize = mem addr 0)
     uint64_t remoteLineSize_;
 
+    // Parameters - moves
+    uint64_t moveBurstSize_;    // Largest scratch access issued on behalf of a Get or Put
+
     // Backend
     ScratchBackendConvertor * scratch_;
 
@@ -144,6 +149,10 @@ private:
     bool startPut(Addr baseAddr, MoveEvent * put);
 
     void updateGet(SST::Event::id_type id);
+    MemEvent* createGetWrite(MoveEvent * get, Addr addr, Addr baseAddr, std::vector<uint8_t>& payload, uint32_t offset, uint32_t size);
+    void issuePutRead(MoveEvent * put, Addr addr, Addr baseAddr, uint32_t size, uint32_t lines);
+    void flushGetBurst(MoveEvent * get, std::vector<Addr>& lines, Addr addr, std::vector<uint8_t>& payload, uint32_t offset, uint32_t size);
+
     void updatePut(SST::Event::id_type id);
     void finishRequest(SST::Event::id_type id);
 
@@ -160,7 +169,8 @@ private:
             MemEvent * remoteWrite;     // For Put requests, collect scratch read responses here
             uint32_t count;             // Number of lines we are waiting on - when 0, the request is complete
                                         // i.e., for a read or write, just 1, for a get or put, the size/lineSize
-            
+
+            OutstandingEvent() : request(nullptr), response(nullptr), remoteWrite(nullptr), count(0) { }
             OutstandingEvent(MemEventBase * request, MemEventBase * response) : request(request), response(response), remoteWrite(nullptr), count(0) { }
             OutstandingEvent(MemEventBase * request, MemEventBase * response, MemEvent * write) : request(request), response(response), remoteWrite(write), count(0) { } 
 
@@ -222,10 +232,114 @@ private:
         }
     } eventDI;
 
-    std::map<SST::Event::id_type,SST::Event::id_type> responseIDMap_;   // Map a forwarded request ID to a original request ID
-    std::map<SST::Event::id_type,Addr> responseIDAddrMap_;              // Map an outstanding scratch request ID to the request's baseAddr
-    std::map<SST::Event::id_type,OutstandingEvent> outstandingEventList_; // List of all outstanding events
-    std::map<Addr,std::list<MSHREntry> > mshr_; // MSHR for scratch accesses
+    /*
+     * MSHR for scratch accesses
+     * Lines are found through an address-hashed slot table and each line's
+     * waiters are kept in arrival order on an intrusive list threaded through
+     * a shared entry pool, so queueing behind a line does not allocate once
+     * the pool has warmed up.  A line is dropped when its last waiter is popped.
+     * Entry pointers are only valid until the next push.
+     */
+    class MSHR {
+        public:
+            static const int NIL = -1;
+
+            bool contains(Addr baseAddr) { return lines.contains(baseAddr); }
+
+            MSHREntry* front(Addr baseAddr) {
+                Line * line = lines.lookup(baseAddr);
+                return line ? &pool[line->head].entry : nullptr;
+            }
+
+            MSHREntry* back(Addr baseAddr) {
+                Line * line = lines.lookup(baseAddr);
+                return line ? &pool[line->tail].entry : nullptr;
+            }
+
+            void push_back(Addr baseAddr, const MSHREntry& entry) {
+                int slot = alloc(entry);
+                Line * line = lines.lookup(baseAddr);
+                if (line) {
+                    pool[line->tail].next = slot;
+                    line->tail = slot;
+                } else {
+                    lines.insert(baseAddr, Line(slot));
+                }
+            }
+
+            void pop_front(Addr baseAddr) {
+                Line * line = lines.lookup(baseAddr);
+                int slot = line->head;
+                line->head = pool[slot].next;
+                release(slot);
+                if (line->head == NIL)
+                    lines.remove(baseAddr);
+            }
+
+            /* Iteration over a line's waiters, oldest first */
+            int begin(Addr baseAddr) {
+                Line * line = lines.lookup(baseAddr);
+                return line ? line->head : NIL;
+            }
+            int next(int slot) { return pool[slot].next; }
+            MSHREntry& at(int slot) { return pool[slot].entry; }
+
+            /* Insert 'entry' ahead of the waiter at 'pos', which must not be the head. Returns the new slot. */
+            int insert(Addr baseAddr, int pos, const MSHREntry& entry) {
+                int slot = alloc(entry);
+                int prev = lines.lookup(baseAddr)->head;
+                while (pool[prev].next != pos) prev = pool[prev].next;
+                pool[slot].next = pos;
+                pool[prev].next = slot;
+                return slot;
+            }
+
+        private:
+            struct Line {
+                Line() : head(NIL), tail(NIL) { }
+                Line(int slot) : head(slot), tail(slot) { }
+                int head, tail;
+            };
+            struct Node {
+                Node(const MSHREntry& entry) : entry(entry), next(NIL) { }
+                MSHREntry entry;
+                int next;
+            };
+
+            int alloc(const MSHREntry& entry) {
+                if (freeList.empty()) {
+                    pool.push_back(Node(entry));
+                    return pool.size() - 1;
+                }
+                int slot = freeList.back();
+                freeList.pop_back();
+                pool[slot] = Node(entry);
+                return slot;
+            }
+
+            void release(int slot) {
+                pool[slot].entry.scratch = nullptr;
+                freeList.push_back(slot);
+            }
+
+            IDSlotTable<Line, Addr> lines;
+            std::vector<Node> pool;
+            std::vector<int> freeList;
+    };
+
+    /* Where to route a response from scratch or remote memory */
+    struct ResponseTarget {
+        SST::Event::id_type requestID;  // Original request ID
+        Addr baseAddr;                  // For scratch accesses, the first line accessed
+        uint32_t lines;                 // For scratch accesses, the number of lines accessed
+
+        ResponseTarget() : requestID(0,0), baseAddr(0), lines(0) { }
+        ResponseTarget(SST::Event::id_type id, Addr addr = 0, uint32_t lines = 1) : requestID(id), baseAddr(addr), lines(lines) { }
+    };
+
+    IDSlotTable<ResponseTarget> responseTable_;                 // Map a forwarded request ID to the original request ID (and scratch lines)
+    IDSlotTable<OutstandingEvent> outstandingEventList_;        // All outstanding events
+    MSHR mshr_;
 
 
     // Outgoing message queues - map send timestamp to event
@@ -239,7 +353,6 @@ private:
     bool caching_;  // Whether or not caching is possible
     bool directory_; // Whether or not a directory is managing the caches - if so we cannot assume on a writeback that the data is not cached
     std::vector<bool> cacheStatus_; // One entry per scratchpad line, whether line may be cached
-    std::map<SST::Event::id_type, uint64_t> cacheCounters_; // Map of a Get or Put ID to the number of cache acks/data responses we are waiting for
 
     // Statistics
     Statistic<uint64_t>* stat_ScratchReadReceived;
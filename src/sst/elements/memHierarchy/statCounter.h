@@ -0,0 +1,93 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_STAT_COUNTER_H
+#define MEMHIERARCHY_STAT_COUNTER_H
+
+#include <stdint.h>
+#include <array>
+#include <functional>
+
+#include <sst/core/sst_types.h>
+#include <sst/core/subcomponent.h>
+
+namespace SST {
+namespace MemHierarchy {
+
+/*
+ * Event-count statistic for the per-event paths of the coherence managers.
+ *
+ * Assigned from registerStatistic() like a Statistic<uint64_t>*, and used
+ * the same way except through '.' instead of '->'.  Normally addData()
+ * goes straight to the statistic.  Once deferred, addData(1) only
+ * increments a local count, and flush() passes the whole count to the
+ * statistic with one addDataNTimes() call, which gives the same sum,
+ * count and histogram as adding the ones separately.  The owner has to
+ * flush before the statistic is output.
+ */
+class StatCounter {
+public:
+    StatCounter() : stat_(nullptr), pending_(0), deferred_(false) { }
+
+    StatCounter& operator=(Statistic<uint64_t>* stat) {
+        flush();
+        stat_ = stat;
+        return *this;
+    }
+
+    void addData(uint64_t value) {
+        if (deferred_ && value == 1)
+            pending_++;
+        else
+            stat_->addData(value);
+    }
+
+    void setDeferred(bool deferred) {
+        if (!deferred) flush();
+        deferred_ = deferred;
+    }
+
+    void flush() {
+        if (pending_ == 0) return;
+        stat_->addDataNTimes(pending_, 1);
+        pending_ = 0;
+    }
+
+    Statistic<uint64_t>* getStatistic() { return stat_; }
+
+private:
+    Statistic<uint64_t>* stat_;
+    uint64_t pending_;
+    bool deferred_;
+};
+
+typedef std::function<void(StatCounter&)> StatCounterVisitor;
+
+/* Apply 'visit' to a counter or to every counter in a (nested) array of them */
+inline void visitStatCounters(StatCounter& counter, const StatCounterVisitor& visit) { visit(counter); }
+
+template<typename T, size_t N>
+void visitStatCounters(T (&counters)[N], const StatCounterVisitor& visit) {
+    for (size_t i = 0; i < N; i++) visitStatCounters(counters[i], visit);
+}
+
+template<typename T, size_t N>
+void visitStatCounters(std::array<T, N>& counters, const StatCounterVisitor& visit) {
+    for (size_t i = 0; i < N; i++) visitStatCounters(counters[i], visit);
+}
+
+}}
+
+#endif
@@ -0,0 +1,189 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+#include "testcpu/benchCPU.h"
+
+#include <sst/core/params.h>
+#include <sst/core/simulation.h>
+#include <sst/core/interfaces/simpleMem.h>
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+
+benchCPU::benchCPU(ComponentId_t id, Params& params) :
+    Component(id), rng(id, 13)
+{
+    out.init("BenchCPU:@p:@l: ", params.find<unsigned int>("verbose", 0), 0, Output::STDOUT);
+
+    // The stream depends only on the seed and the core, not on the component id
+    coreID = params.find<uint32_t>("core_id", 0);
+    uint32_t seed = params.find<uint32_t>("rngseed", 7);
+    rng.restart(seed + coreID, 13 + coreID);
+
+    std::string pattern = params.find<std::string>("pattern", "stream");
+    if (pattern == "stream") {
+        randomPattern = false;
+    } else if (pattern == "random") {
+        randomPattern = true;
+    } else {
+        out.fatal(CALL_INFO, -1, "%s, Error: unknown pattern '%s', valid options are stream and random\n", getName().c_str(), pattern.c_str());
+    }
+
+    lineSize = params.find<uint64_t>("lineSize", 64);
+    if (lineSize == 0) {
+        out.fatal(CALL_INFO, -1, "%s, Error: lineSize must be greater than 0\n", getName().c_str());
+    }
+
+    uint64_t footprint = params.find<uint64_t>("footprint", 1024*1024);
+    uint64_t sharedFootprint = params.find<uint64_t>("shared_footprint", 64*1024);
+    privateLines = footprint / lineSize;
+    sharedLines = sharedFootprint / lineSize;
+    privateBase = sharedLines * lineSize + coreID * privateLines * lineSize;
+
+    sharedPercent = params.find<uint32_t>("shared_percent", 0);
+    writePercent = params.find<uint32_t>("write_percent", 25);
+    if (sharedPercent > 100 || writePercent > 100) {
+        out.fatal(CALL_INFO, -1, "%s, Error: shared_percent and write_percent must be between 0 and 100\n", getName().c_str());
+    }
+    if (privateLines == 0 && sharedPercent < 100) {
+        out.fatal(CALL_INFO, -1, "%s, Error: footprint must hold at least one line\n", getName().c_str());
+    }
+    if (sharedLines == 0 && sharedPercent > 0) {
+        out.fatal(CALL_INFO, -1, "%s, Error: shared_footprint must hold at least one line\n", getName().c_str());
+    }
+
+    maxOutstanding = params.find<uint64_t>("maxOutstanding", 16);
+    maxReqsPerIssue = params.find<uint32_t>("reqsPerIssue", 1);
+    if (maxOutstanding < 1 || maxReqsPerIssue < 1) {
+        out.fatal(CALL_INFO, -1, "%s, Error: maxOutstanding and reqsPerIssue must be at least 1\n", getName().c_str());
+    }
+
+    numRequests = params.find<uint64_t>("num_requests", 10000);
+
+    statReads = registerStatistic<uint64_t>("reads");
+    statWrites = registerStatistic<uint64_t>("writes");
+    statLatency = registerStatistic<uint64_t>("latency");
+
+    // tell the simulator not to end without us
+    registerAsPrimaryComponent();
+    primaryComponentDoNotEndSim();
+
+    std::string clockFreq = params.find<std::string>("clock", "1GHz");
+    clockHandler = new Clock::Handler<benchCPU>(this, &benchCPU::clockTic);
+    clockTC = registerClock(clockFreq, clockHandler);
+
+    memory = loadUserSubComponent<Interfaces::SimpleMem>("memory", ComponentInfo::SHARE_NONE, clockTC, new Interfaces::SimpleMem::Handler<benchCPU>(this, &benchCPU::handleEvent));
+
+    if (!memory) {
+        Params interfaceParams;
+        interfaceParams.insert("port", "mem_link");
+        memory = loadAnonymousSubComponent<Interfaces::SimpleMem>("memHierarchy.memInterface", "memory", 0, ComponentInfo::SHARE_PORTS | ComponentInfo::INSERT_STATS,
+                interfaceParams, clockTC, new Interfaces::SimpleMem::Handler<benchCPU>(this, &benchCPU::handleEvent));
+    }
+
+    nextLine = 0;
+    issued = completed = 0;
+    totalLatency = 0;
+    clock_ticks = 0;
+    endTime = 0;
+    requests.reserve(maxOutstanding);
+}
+
+benchCPU::benchCPU() :
+    Component(-1)
+{
+    // for serialization only
+}
+
+void benchCPU::init(unsigned int phase)
+{
+    memory->init(phase);
+}
+
+void benchCPU::finish()
+{
+    // One line per core for the benchmark runner
+    out.output("BENCH core=%" PRIu32 " issued=%" PRIu64 " completed=%" PRIu64 " latency_ns=%" PRIu64 " cycles=%" PRIu64 " end_ns=%" PRIu64 "\n",
+            coreID, issued, completed, totalLatency, clock_ticks, endTime);
+}
+
+void benchCPU::handleEvent(Interfaces::SimpleMem::Request *req)
+{
+    std::unordered_map<uint64_t, Pending>::iterator it = requests.find(req->id);
+    if (it == requests.end()) {
+        out.fatal(CALL_INFO, -1, "%s, Error: response for unknown request (%" PRIx64 ")\n", getName().c_str(), req->id);
+    }
+
+    uint64_t latency = getCurrentSimTimeNano() - it->second.issueTime;
+    totalLatency += latency;
+    statLatency->addData(latency);
+    if (it->second.write) statWrites->addData(1);
+    else statReads->addData(1);
+
+    requests.erase(it);
+    completed++;
+    delete req;
+}
+
+Interfaces::SimpleMem::Addr benchCPU::nextAddress()
+{
+    if (sharedPercent > 0 && (rng.generateNextUInt32() % 100) < sharedPercent) {
+        return (rng.generateNextUInt64() % sharedLines) * lineSize;
+    }
+
+    uint64_t line;
+    if (randomPattern) {
+        line = rng.generateNextUInt64() % privateLines;
+    } else {
+        line = nextLine;
+        nextLine = (nextLine + 1 == privateLines) ? 0 : nextLine + 1;
+    }
+    return privateBase + line * lineSize;
+}
+
+bool benchCPU::clockTic(Cycle_t)
+{
+    ++clock_ticks;
+
+    for (uint32_t i = 0; i < maxReqsPerIssue && issued < numRequests && requests.size() < maxOutstanding; i++) {
+        Interfaces::SimpleMem::Addr addr = nextAddress();
+        bool write = (rng.generateNextUInt32() % 100) < writePercent;
+
+        Interfaces::SimpleMem::Request *req = new Interfaces::SimpleMem::Request(
+                write ? Interfaces::SimpleMem::Request::Write : Interfaces::SimpleMem::Request::Read, addr, lineSize);
+        if (write) {
+            req->data.resize(lineSize, (uint8_t)coreID);
+        }
+
+        Pending pending;
+        pending.issueTime = getCurrentSimTimeNano();
+        pending.write = write;
+        requests[req->id] = pending;
+
+        out.verbose(CALL_INFO, 2, 0, "%s: Issued %s for address 0x%" PRIx64 "\n", getName().c_str(), write ? "Write" : "Read", addr);
+        memory->sendRequest(req);
+        issued++;
+    }
+
+    if (issued == numRequests && requests.empty()) {
+        endTime = getCurrentSimTimeNano();
+        out.verbose(CALL_INFO, 1, 0, "%s: completed %" PRIu64 " requests\n", getName().c_str(), completed);
+        primaryComponentOKToEndSim();
+        return true;
+    }
+
+    return false;
+}
@@ -0,0 +1,130 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _BENCHCPU_H
+#define _BENCHCPU_H
+
+#ifndef __STDC_FORMAT_MACROS
+#define __STDC_FORMAT_MACROS
+#endif
+#include <inttypes.h>
+#include <unordered_map>
+
+#include <sst/core/event.h>
+#include <sst/core/sst_types.h>
+#include <sst/core/component.h>
+#include <sst/core/link.h>
+#include <sst/core/timeConverter.h>
+#include <sst/core/output.h>
+#include <sst/core/interfaces/simpleMem.h>
+#include <sst/core/rng/marsaglia.h>
+
+namespace SST {
+namespace MemHierarchy {
+
+/*
+ * Deterministic request generator for measuring simulator throughput.
+ *
+ * Each core works in a private region of 'footprint' bytes and, for
+ * 'shared_percent' of its requests, in a region of 'shared_footprint' bytes
+ * common to every core.  The address stream depends only on rngseed and
+ * core_id, so a configuration produces the same traffic on every run and
+ * every build.  finish() prints a single "BENCH" line of key=value pairs for
+ * tests/perf/runBench.py.
+ */
+class benchCPU : public SST::Component {
+public:
+/* Element Library Info */
+    SST_ELI_REGISTER_COMPONENT(benchCPU, "memHierarchy", "benchCPU", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "Deterministic request generator for memHierarchy performance benchmarks", COMPONENT_CATEGORY_PROCESSOR)
+
+    SST_ELI_DOCUMENT_PARAMS(
+            {"verbose",             "(uint) Determine how verbose the output from the CPU is", "0"},
+            {"clock",               "(string) Clock frequency", "1GHz"},
+            {"rngseed",             "(uint) Seed for the address stream, combined with core_id", "7"},
+            {"core_id",             "(uint) Index of this core, selects its private region and its random stream", "0"},
+            {"pattern",             "(string) Private access pattern: stream (sequential lines) or random", "stream"},
+            {"footprint",           "(uint) Bytes in each core's private region", "1048576"},
+            {"shared_footprint",    "(uint) Bytes in the region shared by all cores, placed at address 0", "65536"},
+            {"shared_percent",      "(uint) Percent of requests to the shared region", "0"},
+            {"write_percent",       "(uint) Percent of requests that are writes", "25"},
+            {"lineSize",            "(uint) Request size and alignment", "64"},
+            {"maxOutstanding",      "(uint) Maximum number of outstanding requests", "16"},
+            {"reqsPerIssue",        "(uint) Maximum number of requests to issue per cycle", "1"},
+            {"num_requests",        "(uint) Stop after this many requests", "10000"} )
+
+    SST_ELI_DOCUMENT_PORTS( {"mem_link", "Connection to cache", { "memHierarchy.MemEventBase" } } )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+            {"reads",       "Number of reads completed", "count", 1},
+            {"writes",      "Number of writes completed", "count", 1},
+            {"latency",     "Request latency", "ns", 1} )
+
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS( { "memory", "Interface to memory hierarchy", "SST::Interfaces::SimpleMem" } )
+
+/* Begin class definition */
+    benchCPU(SST::ComponentId_t id, SST::Params& params);
+    void init(unsigned int phase);
+    void finish();
+
+private:
+    benchCPU();  // for serialization only
+    benchCPU(const benchCPU&); // do not implement
+    void operator=(const benchCPU&); // do not implement
+
+    void handleEvent( Interfaces::SimpleMem::Request *ev );
+    bool clockTic( SST::Cycle_t );
+    Interfaces::SimpleMem::Addr nextAddress();
+
+    Output out;
+    uint32_t coreID;
+    bool randomPattern;
+    uint64_t lineSize;
+    uint64_t privateBase;
+    uint64_t privateLines;
+    uint64_t sharedLines;
+    uint32_t sharedPercent;
+    uint32_t writePercent;
+    uint64_t maxOutstanding;
+    uint32_t maxReqsPerIssue;
+    uint64_t numRequests;
+
+    uint64_t nextLine;
+    uint64_t issued, completed;
+    uint64_t totalLatency;
+    uint64_t clock_ticks;
+    SimTime_t endTime;
+
+    Statistic<uint64_t>* statReads;
+    Statistic<uint64_t>* statWrites;
+    Statistic<uint64_t>* statLatency;
+
+    struct Pending {
+        SimTime_t issueTime;
+        bool write;
+    };
+    std::unordered_map<uint64_t, Pending> requests;
+
+    Interfaces::SimpleMem *memory;
+
+    SST::RNG::MarsagliaRNG rng;
+
+    TimeConverter *clockTC;
+    Clock::HandlerBase *clockHandler;
+};
+
+}
+}
+#endif /* _BENCHCPU_H */
@@ -0,0 +1,85 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+#include "testcpu/dmaCPU.h"
+#include "dmaEngine.h"
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+
+DMACPU::DMACPU(ComponentId_t id, Params& params) : Component(id)
+{
+    out.init("", params.find<int>("verbose", 0), 0, Output::STDOUT);
+
+    transferSize = params.find<uint64_t>("transferSize", 4096);
+    numTransfers = params.find<uint64_t>("numTransfers", 4);
+    maxOutstanding = params.find<uint64_t>("maxOutstandingTransfers", 2);
+    srcBase = params.find<uint64_t>("srcBase", 0);
+    dstBase = params.find<uint64_t>("dstBase", 1048576);
+    maxCycles = params.find<uint64_t>("maxCycles", 1000000);
+
+    if (transferSize == 0) out.fatal(CALL_INFO, -1, "Error (%s): invalid param 'transferSize' - must be at least 1\n", getName().c_str());
+    if (maxOutstanding == 0) out.fatal(CALL_INFO, -1, "Error (%s): invalid param 'maxOutstandingTransfers' - must be at least 1\n", getName().c_str());
+    if (srcBase < dstBase + numTransfers * transferSize && dstBase < srcBase + numTransfers * transferSize)
+        out.fatal(CALL_INFO, -1, "Error (%s): invalid params 'srcBase'/'dstBase' - source and destination ranges overlap\n", getName().c_str());
+
+    UnitAlgebra clock = params.find<UnitAlgebra>("clock", "1GHz");
+    TimeConverter * clockTC = registerClock( clock, new Clock::Handler<DMACPU>(this, &DMACPU::tick) );
+
+    dmaLink = configureLink("dmaLink", clockTC, NULL);
+    if (!dmaLink) out.fatal(CALL_INFO, -1, "Error (%s): port 'dmaLink' is not connected\n", getName().c_str());
+
+    // tell the simulator not to end without us
+    registerAsPrimaryComponent();
+    primaryComponentDoNotEndSim();
+
+    cycles = issued = completed = bytesCompleted = 0;
+}
+
+void DMACPU::finish() {
+    out.output("DMACPU %s Finished after %" PRIu64 " issued transfers, %" PRIu64 " returned, %" PRIu64 " bytes, %" PRIu64 " cycles\n",
+            getName().c_str(), issued, completed, bytesCompleted, cycles);
+}
+
+bool DMACPU::tick(Cycle_t time) {
+    cycles++;
+
+    while (Event * ev = dmaLink->recv()) {
+        DMACommand * cmd = static_cast<DMACommand*>(ev);
+        out.verbose(CALL_INFO, 2, 0, "%s: transfer of %zu bytes from %#" PRIx64 " to %#" PRIx64 " returned\n",
+                getName().c_str(), cmd->size, cmd->src, cmd->dst);
+        completed++;
+        bytesCompleted += cmd->size;
+        delete cmd;
+    }
+
+    if (completed == numTransfers) {
+        primaryComponentOKToEndSim(); // All copies have returned -> DONE!
+        return true;
+    }
+
+    if (cycles >= maxCycles) {
+        out.fatal(CALL_INFO, -1, "Error (%s): %" PRIu64 " of %" PRIu64 " transfers have not returned after %" PRIu64 " cycles\n",
+                getName().c_str(), numTransfers - completed, numTransfers, cycles);
+    }
+
+    while (issued < numTransfers && issued - completed < maxOutstanding) {
+        dmaLink->send(new DMACommand(this, dstBase + issued * transferSize, srcBase + issued * transferSize, transferSize));
+        issued++;
+    }
+
+    return false;
+}
@@ -0,0 +1,81 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _DMACPU_H
+#define _DMACPU_H
+
+#include <sst/core/component.h>
+#include <sst/core/link.h>
+#include <sst/core/params.h>
+#include <sst/core/output.h>
+
+namespace SST {
+namespace MemHierarchy {
+
+/*
+ * Test driver for the DMAEngine.  Issues a fixed number of non-overlapping
+ * copies and ends the simulation once all of them have been returned.  If
+ * they have not all returned after maxCycles, the run fails.
+ */
+class DMACPU : public Component {
+
+public:
+/* Element Library Info */
+    SST_ELI_REGISTER_COMPONENT(DMACPU, "memHierarchy", "DMACPU", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "Simple test CPU for the DMA engine", COMPONENT_CATEGORY_PROCESSOR)
+
+    SST_ELI_DOCUMENT_PARAMS(
+            {"clock",                   "(string) Clock frequency in Hz or period in s", "1GHz"},
+            {"verbose",                 "(uint) Output verbosity", "0"},
+            {"transferSize",            "(uint) Size in bytes of each copy", "4096"},
+            {"numTransfers",            "(uint) Number of copies to issue", "4"},
+            {"maxOutstandingTransfers", "(uint) Maximum number of copies outstanding at a time", "2"},
+            {"srcBase",                 "(uint) Source address of the first copy; later copies follow it", "0"},
+            {"dstBase",                 "(uint) Destination address of the first copy; later copies follow it", "1048576"},
+            {"maxCycles",               "(uint) Fail if the copies have not all returned after this many cycles", "1000000"} )
+
+    SST_ELI_DOCUMENT_PORTS( {"dmaLink", "Connection to the DMA engine's cmdLink", { "memHierarchy.DMACommand" } } )
+
+/* Begin class definition */
+    DMACPU(ComponentId_t id, Params& params);
+    ~DMACPU() {}
+    virtual void init(unsigned int phase) {}
+    virtual void setup() {}
+    virtual void finish();
+
+private:
+    bool tick( Cycle_t );
+
+    Output out;
+    Link * dmaLink;
+
+    // Parameters
+    uint64_t transferSize;
+    uint64_t numTransfers;
+    uint64_t maxOutstanding;
+    uint64_t srcBase;
+    uint64_t dstBase;
+    uint64_t maxCycles;
+
+    // Local variables
+    uint64_t cycles;
+    uint64_t issued;
+    uint64_t completed;
+    uint64_t bytesCompleted;
+};
+
+}
+}
+#endif /* _DMACPU_H */
@@ -82,10 +82,12 @@ sst testBackendReorderRow.py > refFiles/test_memHA_BackendReorderRow.out &
 sst testBackendReorderSimple.py > refFiles/test_memHA_BackendReorderSimple.out &    
 sst testBackendSimpleDRAM-1.py > refFiles/test_memHA_BackendSimpleDRAM_1.out &  
 sst testBackendSimpleDRAM-2.py > refFiles/test_memHA_BackendSimpleDRAM_2.out &     
+sst testBackendCoalesce.py > refFiles/test_memHA_BackendCoalesce.out &
 sst testBackendTimingDRAM-1.py > refFiles/test_memHA_BackendTimingDRAM_1.out &    
 sst testBackendTimingDRAM-2.py > refFiles/test_memHA_BackendTimingDRAM_2.out &    
 sst testBackendTimingDRAM-3.py > refFiles/test_memHA_BackendTimingDRAM_3.out &    
 sst testBackendTimingDRAM-4.py > refFiles/test_memHA_BackendTimingDRAM_4.out &    
+sst testBackendTimingDRAM-5.py > refFiles/test_memHA_BackendTimingDRAM_5.out &
 sst testBackendVaultSim.py > refFiles/test_memHA_BackendVaultSim.out &
 wait
 
@@ -11,6 +11,7 @@ componentlist = (
     "memHierarchy.multithreadL1",
     "memHierarchy.streamCPU",
     "memHierarchy.trivialCPU",
+    "memHierarchy.benchCPU",
     "memHierarchy.DelayBuffer",
     "memHierarchy.IncoherentController",
     "memHierarchy.L1CoherenceController",
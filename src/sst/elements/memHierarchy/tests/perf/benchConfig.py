@@ -0,0 +1,226 @@
+# memHierarchy performance benchmark configuration.
+#
+# Builds one of the standard hierarchies below for any number of cores, each
+# driven by a memHierarchy.benchCPU.  Usually run through runBench.py, but can
+# be run directly:
+#
+#   sst benchConfig.py --model-options="--cores 16 --hierarchy directory"
+#
+# Hierarchies:
+#   bus       - private L1 per core, one bus, a shared L2 and one memory
+#   directory - private L1 and L2 per core on a merlin crossbar with
+#               line-interleaved directories and memories
+import sst
+import argparse
+
+parser = argparse.ArgumentParser(description="memHierarchy benchmark configuration")
+parser.add_argument("--cores", type=int, default=1)
+parser.add_argument("--hierarchy", choices=["bus", "directory"], default="bus")
+parser.add_argument("--backend", choices=["simpleMem", "simpleDRAM", "timingDRAM"], default="simpleMem")
+parser.add_argument("--pattern", choices=["stream", "random"], default="stream")
+parser.add_argument("--requests", type=int, default=10000, help="requests per core")
+parser.add_argument("--footprint", default="1MiB", help="private bytes per core")
+parser.add_argument("--shared-footprint", default="64KiB")
+parser.add_argument("--shared-percent", type=int, default=0)
+parser.add_argument("--write-percent", type=int, default=25)
+parser.add_argument("--outstanding", type=int, default=16)
+parser.add_argument("--seed", type=int, default=7)
+parser.add_argument("--memories", type=int, default=0, help="directories/memories for the directory hierarchy, 0 picks one per 16 cores")
+parser.add_argument("--coherence", choices=["MESI", "MSI"], default="MESI")
+parser.add_argument("--stats", default="", help="write statistics to this CSV file")
+args = parser.parse_args()
+
+coreclock = "2.4GHz"
+uncoreclock = "1.4GHz"
+network_bw = "80GB/s"
+line_size = 64
+
+def to_bytes(size):
+    units = { "KiB" : 1024, "MiB" : 1024**2, "GiB" : 1024**3, "KB" : 1000, "MB" : 1000**2, "GB" : 1000**3, "B" : 1 }
+    for suffix in sorted(units, key=len, reverse=True):
+        if size.endswith(suffix):
+            return int(size[:-len(suffix)]) * units[suffix]
+    return int(size)
+
+footprint = to_bytes(args.footprint)
+shared_footprint = to_bytes(args.shared_footprint)
+
+# Round the memory up to a power of two that holds every region
+mem_bytes = 1024 * 1024
+while mem_bytes < shared_footprint + footprint * args.cores:
+    mem_bytes *= 2
+
+def cpu(x):
+    comp_cpu = sst.Component("cpu" + str(x), "memHierarchy.benchCPU")
+    comp_cpu.addParams({
+        "clock" : coreclock,
+        "core_id" : x,
+        "rngseed" : args.seed,
+        "pattern" : args.pattern,
+        "footprint" : footprint,
+        "shared_footprint" : shared_footprint,
+        "shared_percent" : args.shared_percent,
+        "write_percent" : args.write_percent,
+        "lineSize" : line_size,
+        "maxOutstanding" : args.outstanding,
+        "num_requests" : args.requests,
+    })
+    return comp_cpu.setSubComponent("memory", "memHierarchy.memInterface")
+
+def l1cache(x):
+    l1 = sst.Component("l1cache" + str(x), "memHierarchy.Cache")
+    l1.addParams({
+        "cache_frequency" : coreclock,
+        "access_latency_cycles" : 2,
+        "replacement_policy" : "lru",
+        "coherence_protocol" : args.coherence,
+        "cache_size" : "32KiB",
+        "associativity" : 8,
+        "cache_line_size" : line_size,
+        "L1" : 1,
+    })
+    return l1
+
+def backend(memctrl, size):
+    if args.backend == "simpleMem":
+        mem = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+        mem.addParams({ "access_time" : "50ns", "mem_size" : str(size) + "B" })
+    elif args.backend == "simpleDRAM":
+        mem = memctrl.setSubComponent("backend", "memHierarchy.simpleDRAM")
+        mem.addParams({
+            "mem_size" : str(size) + "B",
+            "tCAS" : 3, "tRCD" : 3, "tRP" : 3,
+            "cycle_time" : "5ns",
+            "row_size" : "8KiB",
+            "row_policy" : "open",
+        })
+    else:
+        mem = memctrl.setSubComponent("backend", "memHierarchy.timingDRAM")
+        mem.addParams({
+            "mem_size" : str(size) + "B",
+            "id" : 0,
+            "addrMapper" : "memHierarchy.roundRobinAddrMapper",
+            "addrMapper.interleave_size" : str(line_size) + "B",
+            "addrMapper.row_size" : "1KiB",
+            "clock" : "1.2GHz",
+            "channels" : 2,
+            "channel.transaction_Q_size" : 32,
+            "channel.numRanks" : 2,
+            "channel.rank.numBanks" : 16,
+            "channel.rank.bank.CL" : 14,
+            "channel.rank.bank.CL_WR" : 12,
+            "channel.rank.bank.RCD" : 14,
+            "channel.rank.bank.TRP" : 14,
+            "channel.rank.bank.dataCycles" : 2,
+            "channel.rank.bank.pagePolicy" : "memHierarchy.simplePagePolicy",
+            "channel.rank.bank.transactionQ" : "memHierarchy.reorderTransactionQ",
+            "channel.rank.bank.pagePolicy.close" : 0,
+        })
+
+def build_bus():
+    bus = sst.Component("bus", "memHierarchy.Bus")
+    bus.addParams({ "bus_frequency" : uncoreclock })
+
+    for x in range(args.cores):
+        iface = cpu(x)
+        l1 = l1cache(x)
+        sst.Link("link_cpu_l1_" + str(x)).connect( (iface, "port", "500ps"), (l1, "high_network_0", "500ps") )
+        sst.Link("link_l1_bus_" + str(x)).connect( (l1, "low_network_0", "100ps"), (bus, "high_network_" + str(x), "100ps") )
+
+    l2 = sst.Component("l2cache", "memHierarchy.Cache")
+    l2.addParams({
+        "cache_frequency" : uncoreclock,
+        "access_latency_cycles" : 10,
+        "replacement_policy" : "lru",
+        "coherence_protocol" : args.coherence,
+        "cache_size" : str(max(1, args.cores // 4)) + "MiB",
+        "associativity" : 16,
+        "cache_line_size" : line_size,
+        "mshr_num_entries" : 16 * args.cores,
+    })
+    sst.Link("link_bus_l2").connect( (bus, "low_network_0", "100ps"), (l2, "high_network_0", "100ps") )
+
+    memctrl = sst.Component("memory", "memHierarchy.MemController")
+    memctrl.addParams({ "clock" : "1GHz", "backing" : "none", "addr_range_end" : mem_bytes - 1 })
+    backend(memctrl, mem_bytes)
+    sst.Link("link_l2_mem").connect( (l2, "low_network_0", "100ps"), (memctrl, "direct_link", "100ps") )
+
+def build_directory():
+    memories = args.memories if args.memories > 0 else max(1, args.cores // 16)
+
+    router = sst.Component("network", "merlin.hr_router")
+    router.addParams({
+        "xbar_bw" : network_bw,
+        "link_bw" : network_bw,
+        "input_buf_size" : "2KiB",
+        "output_buf_size" : "2KiB",
+        "num_ports" : args.cores + 2 * memories,
+        "flit_size" : "36B",
+        "id" : "0",
+        "topology" : "merlin.singlerouter",
+    })
+
+    for x in range(args.cores):
+        iface = cpu(x)
+        l1 = l1cache(x)
+        l1up = l1.setSubComponent("cpulink", "memHierarchy.MemLink")
+        l1down = l1.setSubComponent("memlink", "memHierarchy.MemLink")
+
+        l2 = sst.Component("l2cache" + str(x), "memHierarchy.Cache")
+        l2.addParams({
+            "cache_frequency" : coreclock,
+            "access_latency_cycles" : 8,
+            "replacement_policy" : "lru",
+            "coherence_protocol" : args.coherence,
+            "cache_size" : "256KiB",
+            "associativity" : 8,
+            "cache_line_size" : line_size,
+        })
+        l2up = l2.setSubComponent("cpulink", "memHierarchy.MemLink")
+        l2nic = l2.setSubComponent("memlink", "memHierarchy.MemNIC")
+        l2nic.addParams({ "group" : 1, "network_bw" : network_bw })
+
+        sst.Link("link_cpu_l1_" + str(x)).connect( (iface, "port", "500ps"), (l1up, "port", "500ps") )
+        sst.Link("link_l1_l2_" + str(x)).connect( (l1down, "port", "100ps"), (l2up, "port", "100ps") )
+        sst.Link("link_l2_net_" + str(x)).connect( (l2nic, "port", "100ps"), (router, "port" + str(x), "100ps") )
+
+    for x in range(memories):
+        interleave = {
+            "interleave_size" : str(line_size) + "B",
+            "interleave_step" : str(memories * line_size) + "B",
+            "addr_range_start" : x * line_size,
+            "addr_range_end" : mem_bytes - ((memories - x) * line_size) + line_size - 1,
+        }
+
+        dirctrl = sst.Component("directory" + str(x), "memHierarchy.DirectoryController")
+        dirctrl.addParams({
+            "clock" : uncoreclock,
+            "coherence_protocol" : args.coherence,
+            "entry_cache_size" : 32768,
+            "mshr_num_entries" : 16 * args.cores,
+        })
+        dirctrl.addParams(interleave)
+        dirnic = dirctrl.setSubComponent("cpulink", "memHierarchy.MemNIC")
+        dirnic.addParams({ "group" : 2, "network_bw" : network_bw })
+
+        memctrl = sst.Component("memory" + str(x), "memHierarchy.MemController")
+        memctrl.addParams({ "clock" : "1GHz", "backing" : "none" })
+        memctrl.addParams(interleave)
+        memnic = memctrl.setSubComponent("cpulink", "memHierarchy.MemNIC")
+        memnic.addParams({ "group" : 3, "network_bw" : network_bw })
+        backend(memctrl, mem_bytes // memories)
+
+        sst.Link("link_dir_net_" + str(x)).connect( (dirnic, "port", "100ps"), (router, "port" + str(args.cores + x), "100ps") )
+        sst.Link("link_mem_net_" + str(x)).connect( (memnic, "port", "100ps"), (router, "port" + str(args.cores + memories + x), "100ps") )
+
+if args.hierarchy == "bus":
+    build_bus()
+else:
+    build_directory()
+
+if args.stats:
+    sst.setStatisticLoadLevel(1)
+    sst.setStatisticOutput("sst.statOutputCSV")
+    sst.setStatisticOutputOptions({ "filepath" : args.stats, "separator" : "," })
+    for comp in ("memHierarchy.Cache", "memHierarchy.DirectoryController", "memHierarchy.MemController", "memHierarchy.benchCPU"):
+        sst.enableAllStatisticsForComponentType(comp)
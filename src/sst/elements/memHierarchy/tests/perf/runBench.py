@@ -0,0 +1,253 @@
+#!/usr/bin/env python
+#
+# memHierarchy performance benchmark runner.
+#
+# Runs benchConfig.py over a matrix of hierarchies, core counts and access
+# patterns and writes one JSON document describing every run:
+#
+#   wall_seconds           wall-clock time of the sst process
+#   peak_rss_kib           peak resident set size of the sst process
+#   sim_time_ns            simulated time at which the last core finished
+#   requests               requests completed by the benchCPUs
+#   events                 memory events received by caches, directories and
+#                          memory controllers (from their statistics)
+#   events_per_second      events / wall_seconds
+#   component_time         with --profile, share of samples per component
+#                          class taken with 'perf record'
+#
+# Every generator is deterministic, so the same configuration produces the
+# same simulated results on every run; only the timings should change.
+#
+# Examples:
+#   ./runBench.py --quick -o bench.json
+#   ./runBench.py --hierarchy directory --cores 1,16,64,256 --profile -o bench.json
+
+from __future__ import print_function
+
+import argparse
+import csv
+import datetime
+import json
+import os
+import platform
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+SCHEMA_VERSION = 1
+
+here = os.path.dirname(os.path.abspath(__file__))
+config = os.path.join(here, "benchConfig.py")
+
+def parse_args():
+    parser = argparse.ArgumentParser(description="Run the memHierarchy performance benchmarks")
+    parser.add_argument("--sst", default="sst", help="sst executable")
+    parser.add_argument("--hierarchy", default="bus,directory", help="comma separated list: bus, directory")
+    parser.add_argument("--cores", default="1,2,4,8,16,32,64,128,256", help="comma separated core counts")
+    parser.add_argument("--pattern", default="stream,random", help="comma separated list: stream, random")
+    parser.add_argument("--backend", default="simpleMem", help="simpleMem, simpleDRAM or timingDRAM")
+    parser.add_argument("--requests", type=int, default=10000, help="requests per core")
+    parser.add_argument("--shared-percent", type=int, default=10)
+    parser.add_argument("--repeat", type=int, default=1, help="runs per configuration, the fastest is reported")
+    parser.add_argument("--quick", action="store_true", help="small smoke-test matrix")
+    parser.add_argument("--profile", action="store_true", help="sample each run with 'perf record' to attribute time to components")
+    parser.add_argument("--timeout", type=int, default=3600, help="seconds before a run is abandoned")
+    parser.add_argument("-o", "--output", default="-", help="JSON output file, '-' for stdout")
+    args = parser.parse_args()
+
+    if args.quick:
+        args.cores = "1,4,16"
+        args.requests = 2000
+    return args
+
+def split(value, convert=str):
+    return [convert(v) for v in value.split(",") if v]
+
+def sst_version(sst):
+    try:
+        out = subprocess.check_output([sst, "--version"], stderr=subprocess.STDOUT)
+        return out.decode("utf-8", "replace").strip()
+    except (OSError, subprocess.CalledProcessError):
+        return "unknown"
+
+def run_process(cmd, timeout):
+    """Run cmd, returning (returncode, stdout, wall seconds, peak RSS in KiB)"""
+    out = tempfile.TemporaryFile()
+    start = time.time()
+    proc = subprocess.Popen(cmd, stdout=out, stderr=subprocess.STDOUT)
+    while True:
+        pid, status, usage = os.wait4(proc.pid, os.WNOHANG)
+        if pid != 0:
+            break
+        if time.time() - start > timeout:
+            proc.kill()
+            pid, status, usage = os.wait4(proc.pid, 0)
+            break
+        time.sleep(0.01)
+    wall = time.time() - start
+    proc.returncode = os.WEXITSTATUS(status) if os.WIFEXITED(status) else -1
+
+    # ru_maxrss is in KiB on Linux and bytes on macOS
+    rss = usage.ru_maxrss // 1024 if sys.platform == "darwin" else usage.ru_maxrss
+
+    out.seek(0)
+    text = out.read().decode("utf-8", "replace")
+    out.close()
+    return proc.returncode, text, wall, rss
+
+bench_line = re.compile(r"BENCH (.*)$")
+
+def parse_cores(text):
+    cores = []
+    for line in text.splitlines():
+        m = bench_line.search(line)
+        if m:
+            cores.append(dict((k, int(v)) for k, v in (f.split("=") for f in m.group(1).split())))
+    return cores
+
+def count_events(stats_file):
+    """Events received per component class, from the statistics CSV"""
+    per_component = {}
+    with open(stats_file) as f:
+        rows = csv.reader(f)
+        header = [h.strip() for h in next(rows)]
+        comp_col = header.index("ComponentName")
+        stat_col = header.index("StatisticName")
+        sum_col = [i for i, h in enumerate(header) if h.startswith("Sum.")][0]
+        for row in rows:
+            comp, stat = row[comp_col].strip(), row[stat_col].strip()
+            value = int(row[sum_col])
+            entry = per_component.setdefault(comp, { "total" : None, "recv" : 0 })
+            if stat == "TotalEventsReceived":
+                entry["total"] = value
+            elif stat.endswith("_recv") or stat.startswith("requests_received_"):
+                entry["recv"] += value
+
+    # Caches report a total; directories and memories only per-command counts
+    events = {}
+    for comp, entry in per_component.items():
+        kind = re.sub(r"\d+$", "", comp.split(":")[0])
+        value = entry["total"] if entry["total"] is not None else entry["recv"]
+        if value:
+            events[kind] = events.get(kind, 0) + value
+    return events
+
+def profile_breakdown(perf_data):
+    """Share of samples per class, e.g. 'MemHierarchy::Cache', from perf report"""
+    try:
+        out = subprocess.check_output(["perf", "report", "-i", perf_data, "--stdio", "--no-children",
+                                       "--sort", "symbol", "--percent-limit", "0"], stderr=subprocess.STDOUT)
+    except (OSError, subprocess.CalledProcessError):
+        return None
+
+    shares = {}
+    for line in out.decode("utf-8", "replace").splitlines():
+        m = re.match(r"\s*([\d.]+)%\s+.*\[[.k]\]\s+(.*)$", line)
+        if not m:
+            continue
+        share, symbol = float(m.group(1)), m.group(2)
+        c = re.search(r"SST::((?:[A-Za-z_]+::)*[A-Za-z_]+)::[~A-Za-z_0-9]+\(", symbol)
+        if c:
+            name = c.group(1)
+        elif "sst" in symbol.lower():
+            name = "sst-core"
+        else:
+            name = "other"
+        shares[name] = round(shares.get(name, 0.0) + share, 3)
+    return shares
+
+def run_one(args, hierarchy, cores, pattern, workdir):
+    stats = os.path.join(workdir, "stats.csv")
+    options = ["--cores", str(cores), "--hierarchy", hierarchy, "--pattern", pattern, "--backend", args.backend,
+               "--requests", str(args.requests), "--shared-percent", str(args.shared_percent), "--stats", stats]
+    cmd = [args.sst, "--print-timing-info", "--model-options=" + " ".join(options), config]
+
+    perf_data = os.path.join(workdir, "perf.data")
+    if args.profile:
+        cmd = ["perf", "record", "-q", "-F", "499", "-o", perf_data, "--"] + cmd
+
+    result = {
+        "hierarchy" : hierarchy,
+        "cores" : cores,
+        "pattern" : pattern,
+        "backend" : args.backend,
+        "requests_per_core" : args.requests,
+        "shared_percent" : args.shared_percent,
+    }
+
+    best = None
+    for _ in range(args.repeat):
+        if os.path.exists(stats):
+            os.remove(stats)
+        code, text, wall, rss = run_process(cmd, args.timeout)
+        if code != 0:
+            result["error"] = "sst exited with status %d" % code
+            result["log_tail"] = text.splitlines()[-20:]
+            return result
+        if best is None or wall < best[0]:
+            best = (wall, rss, text)
+
+    wall, rss, text = best
+    per_core = parse_cores(text)
+    events = count_events(stats) if os.path.exists(stats) else {}
+    total_events = sum(events.values())
+
+    result.update({
+        "wall_seconds" : round(wall, 4),
+        "peak_rss_kib" : rss,
+        "sim_time_ns" : max([c["end_ns"] for c in per_core] or [0]),
+        "requests" : sum(c["completed"] for c in per_core),
+        "mean_latency_ns" : round(float(sum(c["latency_ns"] for c in per_core)) / max(1, sum(c["completed"] for c in per_core)), 3),
+        "events" : total_events,
+        "events_by_component" : events,
+        "events_per_second" : round(total_events / wall, 1) if wall > 0 else None,
+        "requests_per_second" : round(sum(c["completed"] for c in per_core) / wall, 1) if wall > 0 else None,
+    })
+
+    if args.profile:
+        result["component_time"] = profile_breakdown(perf_data)
+    return result
+
+def main():
+    args = parse_args()
+
+    report = {
+        "schema_version" : SCHEMA_VERSION,
+        "date" : datetime.datetime.utcnow().strftime("%Y-%m-%dT%H:%M:%SZ"),
+        "host" : platform.node(),
+        "platform" : platform.platform(),
+        "sst_version" : sst_version(args.sst),
+        "runs" : [],
+    }
+
+    workdir = tempfile.mkdtemp(prefix="mh-bench-")
+    failed = 0
+    try:
+        for hierarchy in split(args.hierarchy):
+            for pattern in split(args.pattern):
+                for cores in split(args.cores, int):
+                    print("running %s/%s/%d cores..." % (hierarchy, pattern, cores), file=sys.stderr)
+                    result = run_one(args, hierarchy, cores, pattern, workdir)
+                    if "error" in result:
+                        failed += 1
+                        print("  %s" % result["error"], file=sys.stderr)
+                    else:
+                        print("  %.2fs, %d events/s, %d KiB" % (result["wall_seconds"], result["events_per_second"] or 0, result["peak_rss_kib"]), file=sys.stderr)
+                    report["runs"].append(result)
+    finally:
+        shutil.rmtree(workdir, ignore_errors=True)
+
+    text = json.dumps(report, indent=2, sort_keys=True)
+    if args.output == "-":
+        print(text)
+    else:
+        with open(args.output, "w") as f:
+            f.write(text + "\n")
+
+    return 1 if failed else 0
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,87 @@
+# Four streaming cores share an L2 in front of a memory controller that
+# gathers adjacent queued lines into bursts (backendConvertor.coalesce).
+# The cores interleave their misses at the memory, so the convertor has to
+# pull each core's next line forward to keep its stream in the open row.
+import sst
+from mhlib import componentlist
+
+cores = 4
+line_size = 64
+footprint = 256 * 1024
+
+bus = sst.Component("bus", "memHierarchy.Bus")
+bus.addParams({
+    "bus_frequency" : "2GHz",
+})
+
+for x in range(cores):
+    cpu = sst.Component("cpu" + str(x), "memHierarchy.benchCPU")
+    cpu.addParams({
+        "clock" : "2GHz",
+        "core_id" : x,
+        "rngseed" : 7,
+        "pattern" : "stream",
+        "footprint" : footprint,
+        "shared_footprint" : 0,
+        "write_percent" : 25,
+        "lineSize" : line_size,
+        "maxOutstanding" : 16,
+        "num_requests" : 2000,
+    })
+    iface = cpu.setSubComponent("memory", "memHierarchy.memInterface")
+
+    l1 = sst.Component("l1cache" + str(x), "memHierarchy.Cache")
+    l1.addParams({
+        "cache_frequency" : "2GHz",
+        "access_latency_cycles" : 2,
+        "replacement_policy" : "lru",
+        "coherence_protocol" : "MESI",
+        "cache_size" : "4KiB",
+        "associativity" : 4,
+        "cache_line_size" : line_size,
+        "L1" : 1,
+    })
+
+    sst.Link("link_cpu_l1_" + str(x)).connect( (iface, "port", "500ps"), (l1, "high_network_0", "500ps") )
+    sst.Link("link_l1_bus_" + str(x)).connect( (l1, "low_network_0", "100ps"), (bus, "high_network_" + str(x), "100ps") )
+
+l2 = sst.Component("l2cache", "memHierarchy.Cache")
+l2.addParams({
+    "cache_frequency" : "2GHz",
+    "access_latency_cycles" : 8,
+    "replacement_policy" : "lru",
+    "coherence_protocol" : "MESI",
+    "cache_size" : "32KiB",
+    "associativity" : 8,
+    "cache_line_size" : line_size,
+    "mshr_num_entries" : 64,
+})
+sst.Link("link_bus_l2").connect( (bus, "low_network_0", "100ps"), (l2, "high_network_0", "100ps") )
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "clock" : "1GHz",
+    "backing" : "none",
+    "addr_range_end" : cores * footprint - 1,
+    "backendConvertor.coalesce" : 1,
+    "backendConvertor.coalesce_window" : 16,
+    "backendConvertor.coalesce_max_bytes" : 256,
+    "backendConvertor.coalesce_page_size" : 8192,
+})
+memory = memctrl.setSubComponent("backend", "memHierarchy.simpleDRAM")
+memory.addParams({
+    "mem_size" : str(cores * footprint) + "B",
+    "tCAS" : 3,
+    "tRCD" : 3,
+    "tRP" : 3,
+    "cycle_time" : "5ns",
+    "row_size" : "8KiB",
+    "row_policy" : "open",
+})
+sst.Link("link_l2_mem").connect( (l2, "low_network_0", "100ps"), (memctrl, "direct_link", "100ps") )
+
+# Enable statistics
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputConsole")
+for a in componentlist:
+    sst.enableAllStatisticsForComponentType(a)
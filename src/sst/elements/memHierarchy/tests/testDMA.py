@@ -0,0 +1,75 @@
+# Automatically generated SST Python input
+import sst
+from mhlib import componentlist
+
+DEBUG_DMA = 0
+DEBUG_MEM = 0
+
+# Each copy is 16 times max_outstanding * line_size, so the engine
+# has to keep cycling its window to finish. The CPU calls fatal if a copy
+# has not returned after maxCycles, so a deadlocked engine fails the run
+# without a reference file: sst testDMA.py
+comp_cpu = sst.Component("cpu", "memHierarchy.DMACPU")
+comp_cpu.addParams({
+    "clock" : "1GHz",
+    "transferSize" : 4096,
+    "numTransfers" : 4,
+    "maxOutstandingTransfers" : 2,
+    "srcBase" : 0,
+    "dstBase" : 65536,
+    "maxCycles" : 1000000,
+    "verbose" : 1,
+})
+comp_dma = sst.Component("dma", "memHierarchy.DMAEngine")
+comp_dma.addParams({
+    "debug" : DEBUG_DMA,
+    "debug_level" : 10,
+    "clockRate" : "1GHz",
+    "line_size" : "64B",
+    "max_burst_size" : "64B",
+    "max_outstanding" : 4,
+    "max_issue_per_cycle" : 2,
+    "max_active_commands" : 2,
+    "printStats" : 1,
+    "memNIC.network_bw" : "50GB/s",
+})
+comp_net = sst.Component("network", "merlin.hr_router")
+comp_net.addParams({
+    "xbar_bw" : "50GB/s",
+    "link_bw" : "50GB/s",
+    "input_buf_size" : "1KiB",
+    "output_buf_size" : "1KiB",
+    "flit_size" : "72B",
+    "id" : "0",
+    "topology" : "merlin.singlerouter",
+    "num_ports" : 2
+})
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "debug" : DEBUG_MEM,
+    "debug_level" : 10,
+    "backing" : "none",
+    "clock" : "1GHz",
+    "verbose" : 2,
+    "backend.access_time" : "50ns",
+    "backend.mem_size" : "512MiB",
+    "memNIC.network_bw" : "50GB/s",
+    "memNIC.addr_range_start" : 0,
+})
+
+# Enable statistics
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputConsole")
+for a in componentlist:
+    sst.enableAllStatisticsForComponentType(a)
+sst.enableAllStatisticsForComponentType("memHierarchy.DMAEngine")
+
+
+# Define the simulation links
+link_cpu_dma = sst.Link("link_cpu_dma")
+link_cpu_dma.connect( (comp_cpu, "dmaLink", "1000ps"), (comp_dma, "cmdLink", "1000ps") )
+link_dma_net = sst.Link("link_dma_net")
+link_dma_net.connect( (comp_dma, "netLink", "100ps"), (comp_net, "port0", "100ps") )
+link_mem_net = sst.Link("link_mem_net")
+link_mem_net.connect( (memctrl, "network", "100ps"), (comp_net, "port1", "100ps") )
+# End of generated output.
@@ -0,0 +1,230 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _MEMHIERARCHY_TRANSLATIONFRONTEND_H_
+#define _MEMHIERARCHY_TRANSLATIONFRONTEND_H_
+
+#include <stdint.h>
+#include <vector>
+
+namespace SST { namespace MemHierarchy {
+
+/*
+ * Address translation timing model used by MultiThreadL1.
+ *
+ * Like Samba in SE mode, translation is modelled for timing only; the
+ * addresses the threads send are not rewritten.  Each translation looks
+ * up a private L1 TLB, then a shared L2 TLB, then walks a 4-level radix
+ * page table, skipping the upper levels that hit in the page walk caches.
+ * All structures are fixed-size arrays so a lookup is a handful of
+ * compares with no allocation.
+ */
+
+/* Set-associative tag array with LRU replacement, used for the TLBs and page walk caches */
+class TranslationCache {
+public:
+    TranslationCache() : sets(0), ways(0), tick(0) { }
+
+    void init(unsigned entries, unsigned assoc) {
+        if (assoc == 0 || assoc > entries) assoc = entries;
+        ways = assoc;
+        sets = (entries == 0) ? 0 : entries / assoc;
+        uint64_t invalid = INVALID;
+        tags.assign(sets * ways, invalid);
+        lru.assign(sets * ways, 0);
+    }
+
+    bool enabled() const { return sets != 0; }
+
+    /* Returns true on hit and updates LRU */
+    bool lookup(uint64_t tag) {
+        if (!sets) return false;
+        unsigned base = (tag % sets) * ways;
+        for (unsigned i = base; i < base + ways; i++) {
+            if (tags[i] == tag) {
+                lru[i] = ++tick;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void insert(uint64_t tag) {
+        if (!sets) return;
+        unsigned base = (tag % sets) * ways;
+        unsigned victim = base;
+        for (unsigned i = base; i < base + ways; i++) {
+            if (tags[i] == INVALID) {
+                victim = i;
+                break;
+            }
+            if (lru[i] < lru[victim]) victim = i;
+        }
+        tags[victim] = tag;
+        lru[victim] = ++tick;
+    }
+
+private:
+    static const uint64_t INVALID = ~(uint64_t)0;
+
+    unsigned sets;
+    unsigned ways;
+    uint64_t tick;
+    std::vector<uint64_t> tags;
+    std::vector<uint64_t> lru;
+};
+
+/*
+ * Radix page table, 4 levels of 512 entries as on x86-64.  Nodes live in
+ * one pool and refer to each other by index; pages are mapped on first
+ * touch.  touch() returns the number of levels that had to be created,
+ * i.e., 0 if the page was already mapped.
+ */
+class RadixPageTable {
+public:
+    static const unsigned LEVELS = 4;
+    static const unsigned BITS_PER_LEVEL = 9;
+    static const unsigned ENTRIES = 1 << BITS_PER_LEVEL;
+
+    RadixPageTable() : mappedPages(0) {
+        nodes.push_back(Node());    // Root
+    }
+
+    unsigned touch(uint64_t vpn) {
+        unsigned created = 0;
+        uint32_t node = 0;
+        for (int level = LEVELS - 1; level > 0; level--) {
+            unsigned idx = (vpn >> (level * BITS_PER_LEVEL)) & (ENTRIES - 1);
+            uint32_t next = nodes[node].child[idx];
+            if (next == 0) {
+                next = nodes.size();
+                nodes.push_back(Node());
+                nodes[node].child[idx] = next;
+                created++;
+            }
+            node = next;
+        }
+        unsigned idx = vpn & (ENTRIES - 1);
+        if (nodes[node].child[idx] == 0) {
+            nodes[node].child[idx] = 1; // Leaf entries only record presence
+            mappedPages++;
+            created++;
+        }
+        return created;
+    }
+
+    uint64_t getMappedPages() const { return mappedPages; }
+
+private:
+    struct Node {
+        Node() : child(ENTRIES, 0) { }
+        std::vector<uint32_t> child;
+    };
+
+    std::vector<Node> nodes;
+    uint64_t mappedPages;
+};
+
+class TranslationFrontEnd {
+public:
+    struct Config {
+        uint64_t pageSize;
+        unsigned l1Entries, l1Assoc, l1Latency;
+        unsigned l2Entries, l2Assoc, l2Latency;
+        unsigned pwcEntries, pwcAssoc, pwcLatency;
+        unsigned walkLatency;       // Per page table level not covered by a page walk cache
+        unsigned faultLatency;      // Added when a page is touched for the first time
+    };
+
+    /* Counters, read by the owner to update statistics */
+    struct Result {
+        bool l1Hit;
+        bool l2Hit;
+        unsigned walkLevels;        // Page table levels accessed by the walk
+        bool fault;
+        uint64_t latency;
+    };
+
+    void init(unsigned threads, const Config& cfg) {
+        config = cfg;
+        pageShift = 0;
+        while ((UINT64_C(1) << pageShift) < cfg.pageSize) pageShift++;
+
+        l1.resize(threads);
+        for (unsigned i = 0; i < threads; i++)
+            l1[i].init(cfg.l1Entries, cfg.l1Assoc);
+        l2.init(cfg.l2Entries, cfg.l2Assoc);
+        // One page walk cache per non-leaf level, tagged by the VPN prefix at that level
+        for (unsigned i = 0; i < RadixPageTable::LEVELS - 1; i++)
+            pwc[i].init(cfg.pwcEntries, cfg.pwcAssoc);
+    }
+
+    Result translate(unsigned thread, uint64_t vaddr) {
+        Result res = { false, false, 0, false, config.l1Latency };
+        uint64_t vpn = vaddr >> pageShift;
+
+        if (l1[thread].lookup(vpn)) {
+            res.l1Hit = true;
+            return res;
+        }
+
+        res.latency += config.l2Latency;
+        if (l2.lookup(vpn)) {
+            res.l2Hit = true;
+            l1[thread].insert(vpn);
+            return res;
+        }
+
+        // Page walk: find the deepest level whose prefix hits in a page walk cache
+        // pwc[0] caches PMD entries (prefix = vpn >> 9), pwc[2] caches PGD entries
+        unsigned levels = RadixPageTable::LEVELS;
+        for (unsigned i = 0; i < RadixPageTable::LEVELS - 1; i++) {
+            uint64_t prefix = vpn >> ((i + 1) * RadixPageTable::BITS_PER_LEVEL);
+            if (pwc[i].lookup(prefix)) {
+                levels = i + 1;
+                break;
+            }
+        }
+        if (levels != RadixPageTable::LEVELS) res.latency += config.pwcLatency;
+
+        res.walkLevels = levels;
+        res.latency += (uint64_t)levels * config.walkLatency;
+
+        if (pageTable.touch(vpn) != 0) {
+            res.fault = true;
+            res.latency += config.faultLatency;
+        }
+
+        for (unsigned i = 0; i < RadixPageTable::LEVELS - 1; i++)
+            pwc[i].insert(vpn >> ((i + 1) * RadixPageTable::BITS_PER_LEVEL));
+        l2.insert(vpn);
+        l1[thread].insert(vpn);
+        return res;
+    }
+
+    uint64_t getMappedPages() const { return pageTable.getMappedPages(); }
+
+private:
+    Config config;
+    unsigned pageShift;
+    std::vector<TranslationCache> l1;
+    TranslationCache l2;
+    TranslationCache pwc[RadixPageTable::LEVELS - 1];
+    RadixPageTable pageTable;
+};
+
+}}
+
+#endif /* _MEMHIERARCHY_TRANSLATIONFRONTEND_H_ */
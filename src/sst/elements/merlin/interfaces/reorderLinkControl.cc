@@ -33,6 +33,7 @@ ReorderLinkControl::ReorderLinkControl(Component* parent, Params &params) :
     SimpleNetwork(parent),
     receiveFunctor(NULL)
 {
+    configureReorder(params);
     std::string networkIF = params.find<std::string>("rlc:networkIF", "merlin.linkcontrol");
 DISABLE_WARN_DEPRECATED_DECLARATION
     link_control = static_cast<SimpleNetwork*>(loadSubComponent(networkIF, params));
@@ -45,6 +46,7 @@ ReorderLinkControl::ReorderLinkControl(ComponentId_t cid, Params &params, int vn
     receiveFunctor(NULL),
     vns(vns)
 {
+    configureReorder(params);
     if ( isUser() ) {
         // Need to see if the network_if was loaded as a user subcomponent
         link_control = loadUserSubComponent<SimpleNetwork>("networkIF", ComponentInfo::SHARE_NONE, vns);
@@ -76,6 +78,30 @@ ReorderLinkControl::ReorderLinkControl(ComponentId_t cid, Params &params, int vn
 
 ReorderLinkControl::~ReorderLinkControl() {
     delete [] input_buf;
+    for ( size_t i = 0; i < reorder_table.size(); i++ ) delete reorder_table[i];
+    for ( auto it = reorder_info.begin(); it != reorder_info.end(); ++it ) delete it->second;
+}
+
+void
+ReorderLinkControl::configureReorder(Params &params)
+{
+    int window = params.find<int>("reorder_window", 64);
+    if ( window < 1 ) {
+        merlin_abort.fatal(CALL_INFO,1,"ReorderLinkControl: reorder_window must be at least 1\n");
+    }
+    reorder_window = 1;
+    while ( reorder_window < (uint32_t)window ) reorder_window *= 2;
+
+    int num_peers = params.find<int>("num_peers", 0);
+    if ( num_peers > 0 ) reorder_table.resize(num_peers, NULL);
+}
+
+ReorderInfo*
+ReorderLinkControl::getReorderInfo(SimpleNetwork::nid_t nid)
+{
+    ReorderInfo*& info = ( nid >= 0 && (size_t)nid < reorder_table.size() ) ? reorder_table[nid] : reorder_info[nid];
+    if ( info == NULL ) info = new ReorderInfo(reorder_window);
+    return info;
 }
 
 #ifndef SST_ENABLE_PREVIEW_BUILD
@@ -151,13 +177,7 @@ bool ReorderLinkControl::send(SimpleNetwork::Request* req, int vn) {
     delete req;
     
     // Need to put in the sequence number
-    
-    // See if we already have reorder_info for this dest
-    if ( reorder_info.find(my_req->dest) == reorder_info.end() ) {
-        ReorderInfo* info = new ReorderInfo();
-        reorder_info[my_req->dest] = info;
-    }
-    ReorderInfo* info = reorder_info[my_req->dest];
+    ReorderInfo* info = getReorderInfo(my_req->dest);
     my_req->seq = info->send++;
 
     // // To test, just going to switch order
@@ -232,25 +252,17 @@ bool ReorderLinkControl::handle_event(int vn) {
 
     // std::cout << id << ": recieved packet with sequence number " << my_req->seq << std::endl;
     
-    if ( reorder_info.find(my_req->src) == reorder_info.end() ) {
-        ReorderInfo* info = new ReorderInfo();
-        reorder_info[my_req->src] = info;
-    }
-
-    ReorderInfo* info = reorder_info[my_req->src];
+    ReorderInfo* info = getReorderInfo(my_req->src);
 
-    // See if this is the expected sequence number, if not, put it
-    // into the ReorderInfo.queue.
+    // See if this is the expected sequence number, if not, hold it
+    // in the ReorderInfo window.
     if ( my_req->seq == info->recv ) {
         input_buf[vn].push(my_req);
         info->recv++;
         // Need to also see if we have any other fragments which are
         // now ready to be delivered
-        my_req = info->queue.top();
-        while ( my_req->seq == info->recv ) {
+        while ( (my_req = info->next()) != NULL ) {
             input_buf[vn].push(my_req);
-            info->queue.pop();
-            my_req = info->queue.top();
             info->recv++;
         }
 
@@ -266,7 +278,7 @@ bool ReorderLinkControl::handle_event(int vn) {
         
     }
     else {
-        info->queue.push(my_req);
+        info->hold(my_req);
     }
 
     return true;
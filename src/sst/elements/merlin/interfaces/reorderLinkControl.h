@@ -28,6 +28,7 @@
 
 #include <queue>
 #include <unordered_map>
+#include <vector>
 
 namespace SST {
 
@@ -64,19 +65,6 @@ public:
 
     ~ReorderRequest() {}
 
-    
-    // This is here just for the priority_queue insertion, so is
-    // sorting based on what comes out of queue first (i.e. lowest
-    // number, which makes this look backwards)
-    class Priority {
-    public:
-        bool operator()(ReorderRequest* const& lhs, ReorderRequest* const& rhs) {
-            return lhs->seq > rhs->seq;
-        }    
-    };
-
-    typedef std::priority_queue<ReorderRequest*, std::vector<ReorderRequest*>, Priority> PriorityQueue;
-
     void serialize_order(SST::Core::Serialization::serializer &ser)  override {
         SST::Interfaces::SimpleNetwork::Request::serialize_order(ser);
         ser & seq;
@@ -88,22 +76,61 @@ private:
 
 
 
+// Sequence state for one peer.  Requests that arrive ahead of the
+// next expected sequence number wait in a circular window indexed by
+// seq modulo the window size (a power of two); a NULL slot is a
+// missing request.  The window is only allocated when the first
+// request has to be held, so peers that are only sent to cost no
+// window, and it doubles if a request arrives more than a window
+// ahead.  Sequence numbers are compared as offsets from recv, so they
+// may wrap.
 struct ReorderInfo {
     uint32_t send;
     uint32_t recv;
-    ReorderRequest::PriorityQueue queue;
+    uint32_t pending;
+    uint32_t window_size;
+    std::vector<ReorderRequest*> window;
 
-    ReorderInfo() :
+    ReorderInfo(uint32_t window_size) :
         send(0),
-        recv(0)
-    {
-        // Put a dummy entry into queue to avoid checks for NULL later
-        // on when looking for fragments to deliver.  This does mean
-        // we can't handle more than 4 billion fragments to each host
-        // with overflow.
-        ReorderRequest* req = new ReorderRequest();
-        req->seq = 0xffffffff;
-        queue.push(req);
+        recv(0),
+        pending(0),
+        window_size(window_size)
+    {}
+
+    ~ReorderInfo() {
+        for ( size_t i = 0; i < window.size(); i++ ) delete window[i];
+    }
+
+    // Hold a request that arrived before seq recv
+    void hold(ReorderRequest* req) {
+        uint32_t offset = req->seq - recv;
+        if ( offset >= window.size() ) grow(offset);
+        window[req->seq & (window.size() - 1)] = req;
+        pending++;
+    }
+
+    // Returns the held request with seq recv, or NULL
+    ReorderRequest* next() {
+        if ( pending == 0 ) return NULL;
+        ReorderRequest*& slot = window[recv & (window.size() - 1)];
+        ReorderRequest* req = slot;
+        if ( req != NULL ) {
+            slot = NULL;
+            pending--;
+        }
+        return req;
+    }
+
+private:
+    void grow(uint32_t offset) {
+        size_t size = window.empty() ? window_size : window.size();
+        while ( size <= offset ) size *= 2;
+        std::vector<ReorderRequest*> bigger(size, NULL);
+        for ( size_t i = 0; i < window.size(); i++ ) {
+            if ( window[i] != NULL ) bigger[window[i]->seq & (size - 1)] = window[i];
+        }
+        window.swap(bigger);
     }
 };
 
@@ -124,7 +151,9 @@ public:
     
     SST_ELI_DOCUMENT_PARAMS(
         {"rlc:networkIF","SimpleNetwork subcomponent to be used for connecting to network", "merlin.linkcontrol"},
-        {"networkIF","SimpleNetwork subcomponent to be used for connecting to network", "merlin.linkcontrol"}
+        {"networkIF","SimpleNetwork subcomponent to be used for connecting to network", "merlin.linkcontrol"},
+        {"num_peers","Number of endpoints on the network.  If set, per peer sequence state is kept in a table indexed by endpoint id", "0"},
+        {"reorder_window","Initial number of out of order requests held per peer before the window grows.  Rounded up to a power of two", "64"}
     )
 
     SST_ELI_DOCUMENT_PORTS(
@@ -145,7 +174,11 @@ private:
     UnitAlgebra link_bw;
     int id;
 
+    // Peers with ids below num_peers are in reorder_table, any others
+    // in reorder_info
+    std::vector<ReorderInfo*> reorder_table;
     std::unordered_map<SST::Interfaces::SimpleNetwork::nid_t, ReorderInfo*> reorder_info;
+    uint32_t reorder_window;
     
     // One buffer for each virtual network.  At the NIC level, we just
     // provide a virtual channel abstraction.  Don't need output
@@ -209,6 +242,8 @@ public:
     
 private:
 
+    void configureReorder(Params &params);
+    ReorderInfo* getReorderInfo(SST::Interfaces::SimpleNetwork::nid_t nid);
     bool handle_event(int vn);
 };
 
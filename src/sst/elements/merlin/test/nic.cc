@@ -71,6 +71,7 @@ nic::nic(ComponentId_t cid, Params& params) :
     remap = params.find<int>("remap", 0);
 
     send_untimed_data = params.find<bool>("send_untimed_data","true");
+    check_order = params.find<bool>("check_order",false);
 
     
     group_offset = params.find<int>("group_offset", 0); 
@@ -538,13 +539,10 @@ nic::clock_handler(Cycle_t cycle)
             }
 
             
-#if 0
-            if ( next_seq[src-group_offset] != ev->seq ) {
-                output.output("%d received packet %d from %d Expected sequence number %d\n",
-                              net_id, ev->seq, ev->src, next_seq[ev->src-group_offset]);
-                assert(false);
+            if ( check_order && next_seq[src-group_offset] != ev->seq ) {
+                output.fatal(CALL_INFO,-1,"%d received packet %d from %d, expected sequence number %d\n",
+                             net_id, ev->seq, src, next_seq[src-group_offset]);
             }
-#endif
             next_seq[src-group_offset]++;
             //std::cout << cycle << ": " << id << " Received an event on vn " << rec_ev->vn << " from " << rec_ev->src << " (packet "<<packets_recd<<" )"<< std::endl;
             delete ev;
@@ -56,7 +56,8 @@ public:
         {"remap",        "Creates a logical to physical mapping shifted by remap amount.", "0"},
         {"group_offset",   "If dividing network into multiple groups of test nics, this is offset for this group.", "0"},
         {"group_peers",   "If dividing network into multiple groups of test nics, this is offset for this group.", "0"},
-        {"linkcontrol_type","Set the SimpleNetwork ", "merlin.linkcontrol"}
+        {"linkcontrol_type","Set the SimpleNetwork ", "merlin.linkcontrol"},
+        {"check_order",  "Fatal error if messages from a peer are not received in the order they were sent.", "false"}
     )
 
     SST_ELI_DOCUMENT_PORTS(
@@ -94,6 +95,7 @@ private:
     int init_broadcast_count;
 
     bool send_untimed_data;
+    bool check_order;
     
     SST::Interfaces::SimpleNetwork* link_control;
 
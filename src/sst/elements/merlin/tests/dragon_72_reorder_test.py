@@ -0,0 +1,65 @@
+#!/usr/bin/env python
+#
+# Copyright 2009-2015 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2015, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+# Adaptive dragonfly routing delivers packets out of order.  Each test
+# NIC talks through a reorderlinkcontrol and checks that every peer's
+# messages still arrive in the order they were sent.  The reorder window
+# starts at one entry, so it has to grow, and each peer sends many more
+# messages than the window holds, so the window indices wrap.
+
+import sst
+from sst.merlin import *
+
+class ReorderTestEndPoint(TestEndPoint):
+    def build(self, nID, extraKeys):
+        (nic, port, lat) = TestEndPoint.build(self, nID, extraKeys)
+        nic.addParam("check_order", 1)
+
+        rlc = nic.setSubComponent("networkIF", "merlin.reorderlinkcontrol")
+        rlc.addParams({
+            "num_peers" : sst.merlin._params["num_peers"],
+            "reorder_window" : 1,
+            "link_bw" : sst.merlin._params["link_bw"],
+            "input_buf_size" : "1kB",
+            "output_buf_size" : "1kB",
+        })
+        return (rlc, "rtr_port", lat)
+
+if __name__ == "__main__":
+
+    topo = topoDragonFly2()
+    endPoint = ReorderTestEndPoint()
+
+    sst.merlin._params["dragonfly:hosts_per_router"] = "2"
+    sst.merlin._params["dragonfly:routers_per_group"] = "4"
+    sst.merlin._params["dragonfly:intergroup_links"] = "1"
+    sst.merlin._params["dragonfly:num_groups"] = "9"
+    sst.merlin._params["dragonfly:algorithm"] = "adaptive-local"
+    sst.merlin._params["dragonfly:adaptive_threshold"] = "2.0"
+
+    sst.merlin._params["link_bw"] = "4GB/s"
+    sst.merlin._params["link_lat"] = "20ns"
+    sst.merlin._params["flit_size"] = "8B"
+    sst.merlin._params["xbar_bw"] = "4GB/s"
+    sst.merlin._params["input_latency"] = "20ns"
+    sst.merlin._params["output_latency"] = "20ns"
+    sst.merlin._params["input_buf_size"] = "4kB"
+    sst.merlin._params["output_buf_size"] = "4kB"
+    sst.merlin._params["num_messages"] = "50"
+
+    sst.merlin._params["xbar_arb"] = "merlin.xbar_arb_lru"
+
+    topo.prepParams()
+    endPoint.prepParams()
+    topo.setEndPoint(endPoint)
+    topo.build()
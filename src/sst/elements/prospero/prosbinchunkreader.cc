@@ -0,0 +1,235 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+#include "prosbinchunkreader.h"
+#include "zlib.h"
+
+#include <algorithm>
+
+using namespace SST::Prospero;
+using namespace SST::ArielComponent;
+
+#ifndef SST_ENABLE_PREVIEW_BUILD  // inserted by script
+ProsperoChunkedTraceReader::ProsperoChunkedTraceReader( Component* owner, Params& params ) :
+	ProsperoTraceReader(owner, params) {
+
+	std::string traceFile = params.find<std::string>("file", "");
+	const char* error = openTrace(traceFile, params.find<uint64_t>("start_record", 0), params.find<uint64_t>("start_time_ps", 0));
+
+	if(NULL != error) {
+		fprintf(stderr, "Fatal: Error reading chunked trace file: %s: %s.\n",
+			traceFile.c_str(), error);
+		exit(-1);
+	}
+}
+#endif  // inserted by script
+
+ProsperoChunkedTraceReader::ProsperoChunkedTraceReader( ComponentId_t id, Params& params, Output* out ) :
+	ProsperoTraceReader(id, params, out) {
+
+	std::string traceFile = params.find<std::string>("file", "");
+	const char* error = openTrace(traceFile, params.find<uint64_t>("start_record", 0), params.find<uint64_t>("start_time_ps", 0));
+
+	if(NULL != error) {
+		output->fatal(CALL_INFO, -1, "%s, Fatal: Error reading chunked trace file: %s: %s.\n",
+			getName().c_str(), traceFile.c_str(), error);
+	}
+}
+
+ProsperoChunkedTraceReader::~ProsperoChunkedTraceReader() {
+	if(NULL != traceInput) {
+		fclose(traceInput);
+	}
+}
+
+const char* ProsperoChunkedTraceReader::openTrace(const std::string& traceFile,
+	const uint64_t startRecord, const uint64_t startTime) {
+
+	currentChunk = 0;
+	recordsInChunk = 0;
+	nextRecord = 0;
+
+	traceInput = fopen(traceFile.c_str(), "rb");
+	if(NULL == traceInput) {
+		return "unable to open file";
+	}
+
+	TraceChunk::FileHeader header;
+	if(1 != fread(&header, sizeof(header), 1, traceInput) ||
+		0 != memcmp(header.magic, TraceChunk::FILE_MAGIC, sizeof(header.magic))) {
+		return "not a chunked trace";
+	}
+
+	if(header.version != TraceChunk::VERSION || header.recordSize != TraceChunk::RECORD_SIZE) {
+		return "unsupported trace version";
+	}
+
+	const char* error = buildIndex();
+	if(NULL != error) {
+		return error;
+	}
+
+	// Find the chunk holding the first record to replay
+	size_t chunk = 0;
+	uint64_t skip = 0;
+	if(startTime > 0) {
+		// First chunk that may hold a record at or after startTime
+		for(chunk = 0; chunk + 1 < index.size() && index[chunk + 1].firstPicoS <= startTime; chunk++) { }
+	} else if(startRecord > 0) {
+		for(chunk = 0; chunk + 1 < index.size() && index[chunk + 1].firstRecord <= startRecord; chunk++) { }
+		if(chunk < index.size()) skip = std::min(startRecord - index[chunk].firstRecord, index[chunk].records);
+	}
+
+	if(chunk < index.size()) {
+		error = loadChunk(chunk);
+		if(NULL != error) {
+			return error;
+		}
+		nextRecord = skip;
+
+		if(startTime > 0) {
+			// Timestamps are in issue order, so skip forward within the chunk
+			while(true) {
+				while(nextRecord < recordsInChunk) {
+					uint64_t picoS;
+					memcpy(&picoS, &records[nextRecord * TraceChunk::RECORD_SIZE], sizeof(uint64_t));
+					if(picoS >= startTime) break;
+					nextRecord++;
+				}
+				if(nextRecord < recordsInChunk || currentChunk + 1 >= index.size()) break;
+				error = loadChunk(currentChunk + 1);
+				if(NULL != error) {
+					return error;
+				}
+			}
+		}
+	}
+
+	return NULL;
+}
+
+const char* ProsperoChunkedTraceReader::buildIndex() {
+	// Use the index at the end of the file if there is one
+	TraceChunk::Footer footer;
+	if(0 == fseeko(traceInput, -((off_t) sizeof(footer)), SEEK_END) &&
+		1 == fread(&footer, sizeof(footer), 1, traceInput) &&
+		0 == memcmp(footer.magic, TraceChunk::INDEX_MAGIC, sizeof(footer.magic))) {
+
+		index.resize(footer.chunks);
+		if(footer.chunks == 0) {
+			return NULL;
+		}
+		if(0 == fseeko(traceInput, (off_t) footer.indexOffset, SEEK_SET) &&
+			footer.chunks == fread(index.data(), sizeof(IndexEntry), footer.chunks, traceInput)) {
+			return NULL;
+		}
+		index.clear();
+	}
+
+	// Otherwise (the run did not finish) walk the chunk headers
+	if(0 != fseeko(traceInput, (off_t) sizeof(TraceChunk::FileHeader), SEEK_SET)) {
+		return "unable to seek";
+	}
+
+	uint64_t records = 0;
+	while(true) {
+		IndexEntry entry;
+		entry.offset = (uint64_t) ftello(traceInput);
+
+		TraceChunk::ChunkHeader header;
+		if(1 != fread(&header, sizeof(header), 1, traceInput) ||
+			header.rawSize != header.records * TraceChunk::RECORD_SIZE ||
+			0 != fseeko(traceInput, (off_t) header.storedSize, SEEK_CUR)) {
+			break;
+		}
+
+		entry.firstRecord = records;
+		entry.records = header.records;
+		entry.firstPicoS = header.firstPicoS;
+		index.push_back(entry);
+		records += header.records;
+	}
+
+	// The last chunk may be incomplete
+	if(!index.empty()) {
+		off_t end = ftello(traceInput);
+		fseeko(traceInput, 0, SEEK_END);
+		if(ftello(traceInput) < end) index.pop_back();
+	}
+
+	return NULL;
+}
+
+const char* ProsperoChunkedTraceReader::loadChunk(const size_t chunk) {
+	TraceChunk::ChunkHeader header;
+	if(0 != fseeko(traceInput, (off_t) index[chunk].offset, SEEK_SET) ||
+		1 != fread(&header, sizeof(header), 1, traceInput)) {
+		return "unable to read chunk header";
+	}
+
+	records.resize(header.rawSize);
+
+	if(header.codec == TraceChunk::CODEC_NONE) {
+		if(header.rawSize != fread(records.data(), 1, header.rawSize, traceInput)) {
+			return "truncated chunk";
+		}
+	} else if(header.codec == TraceChunk::CODEC_ZLIB) {
+		stored.resize(header.storedSize);
+		if(header.storedSize != fread(stored.data(), 1, header.storedSize, traceInput)) {
+			return "truncated chunk";
+		}
+		uLongf rawSize = header.rawSize;
+		if(Z_OK != uncompress((Bytef*) records.data(), &rawSize, (const Bytef*) stored.data(), header.storedSize) ||
+			rawSize != header.rawSize) {
+			return "corrupt chunk";
+		}
+	} else {
+		return "unknown chunk compression";
+	}
+
+	currentChunk = chunk;
+	recordsInChunk = header.records;
+	nextRecord = 0;
+	return NULL;
+}
+
+ProsperoTraceEntry* ProsperoChunkedTraceReader::readNextEntry() {
+	while(nextRecord == recordsInChunk) {
+		if(index.empty() || currentChunk + 1 >= index.size()) {
+			output->verbose(CALL_INFO, 2, 0, "End of trace file reached, returning empty request.\n");
+			return NULL;
+		}
+
+		const char* error = loadChunk(currentChunk + 1);
+		if(NULL != error) {
+			output->verbose(CALL_INFO, 2, 0, "Error reading chunk %" PRIu64 " (%s), returning empty request.\n",
+				(uint64_t) (currentChunk + 1), error);
+			recordsInChunk = nextRecord = 0;
+			index.clear();
+			return NULL;
+		}
+	}
+
+	uint64_t reqCycles;
+	char reqType;
+	uint64_t reqAddress;
+	uint32_t reqLength;
+	TraceChunk::decodeRecord(&records[nextRecord * TraceChunk::RECORD_SIZE], &reqCycles, &reqType, &reqAddress, &reqLength);
+	nextRecord++;
+
+	return new ProsperoTraceEntry(reqCycles, reqAddress, reqLength,
+		(reqType == 'R' || reqType == 'r') ? READ : WRITE);
+}
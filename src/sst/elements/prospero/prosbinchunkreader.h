@@ -0,0 +1,80 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_PROSPERO_CHUNKED_BINARY_READER
+#define _H_SST_PROSPERO_CHUNKED_BINARY_READER
+
+#include <stdio.h>
+#include <vector>
+
+#include "prosreader.h"
+#include "sst/elements/ariel/arieltracechunk.h"
+
+namespace SST {
+namespace Prospero {
+
+/*
+ * Reads the indexed, chunk-compressed traces written by
+ * ariel.ChunkedTraceGenerator one chunk at a time.  The chunk index lets
+ * a run start at any record or timestamp without decompressing what
+ * comes before it.
+ */
+class ProsperoChunkedTraceReader : public ProsperoTraceReader {
+
+public:
+#ifndef SST_ENABLE_PREVIEW_BUILD  // inserted by script
+        ProsperoChunkedTraceReader( Component* owner, Params& params );
+#endif  // inserted by script
+        ProsperoChunkedTraceReader( ComponentId_t id, Params& params, Output* out );
+        ~ProsperoChunkedTraceReader();
+        ProsperoTraceEntry* readNextEntry();
+
+	SST_ELI_REGISTER_SUBCOMPONENT_DERIVED(
+               	ProsperoChunkedTraceReader,
+               	"prospero",
+               	"ProsperoChunkedTraceReader",
+               	SST_ELI_ELEMENT_VERSION(1,0,0),
+               	"Chunked Compressed Binary Trace Reader (traces from ariel.ChunkedTraceGenerator)",
+	       	SST::Prospero::ProsperoTraceReader
+	)
+
+       	SST_ELI_DOCUMENT_PARAMS(
+               	{ "file", "Sets the file for the trace reader to use", "" },
+               	{ "start_record", "Skip to this record before reading", "0" },
+               	{ "start_time_ps", "Skip to the first record issued at or after this time (picoseconds), overrides start_record", "0" }
+       	)
+
+private:
+	typedef ArielComponent::TraceChunk::IndexEntry IndexEntry;
+
+	const char* openTrace(const std::string& traceFile, const uint64_t startRecord, const uint64_t startTime);
+	const char* buildIndex();
+	const char* loadChunk(const size_t chunk);
+
+	FILE* traceInput;
+	std::vector<IndexEntry> index;
+	std::vector<char> stored;
+	std::vector<char> records;
+	size_t currentChunk;
+	uint64_t recordsInChunk;
+	uint64_t nextRecord;
+
+};
+
+}
+}
+
+#endif
@@ -34,6 +34,10 @@ def main():
                 # print "args are ", o, "and", a
                 Tracetype = "CompressedBinary"
                 traceFile = "sstprospero-0-0-gz.trace"
+            elif a == "chunked":
+                # converted from the binary trace by trace-tochunked.py
+                Tracetype = "Chunked"
+                traceFile = "sstprospero-0-0-chunk.trace"
             else:
                 print "no match a= ", a
                 print  "Found nothing for o", o
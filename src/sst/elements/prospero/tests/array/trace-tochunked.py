@@ -0,0 +1,46 @@
+# Convert a binary Prospero trace (as written by ariel.BinaryTraceGenerator)
+# into the chunked format read by prospero.ProsperoChunkedTraceReader.
+#
+# The records are copied unchanged, so replaying the converted trace must
+# give the same output as replaying the binary trace.
+#
+# Usage: python trace-tochunked.py <binary trace> <chunked trace> [records per chunk]
+import struct
+import sys
+import zlib
+
+RECORD_SIZE = 8 + 1 + 8 + 4
+CODEC_ZLIB = 1
+
+def convert(binTrace, chunkTrace, chunkRecords):
+    with open(binTrace, "rb") as f:
+        data = f.read()
+    totalRecords = len(data) // RECORD_SIZE
+
+    out = open(chunkTrace, "wb")
+    out.write(struct.pack("=8sII", b"ARIELCHK", 1, RECORD_SIZE))
+
+    index = []
+    for first in range(0, totalRecords, chunkRecords):
+        records = min(chunkRecords, totalRecords - first)
+        raw = data[first * RECORD_SIZE : (first + records) * RECORD_SIZE]
+        stored = zlib.compress(raw, 1)
+        firstPicoS = struct.unpack_from("=Q", raw, 0)[0]
+        lastPicoS = struct.unpack_from("=Q", raw, (records - 1) * RECORD_SIZE)[0]
+
+        index.append((out.tell(), first, records, firstPicoS))
+        out.write(struct.pack("=IIQQQQQ", CODEC_ZLIB, 0, len(stored), len(raw),
+            records, firstPicoS, lastPicoS))
+        out.write(stored)
+
+    indexOffset = out.tell()
+    for entry in index:
+        out.write(struct.pack("=QQQQ", *entry))
+    out.write(struct.pack("=QQQ8s", indexOffset, len(index), totalRecords, b"ARIELIDX"))
+    out.close()
+
+if __name__ == "__main__":
+    if len(sys.argv) < 3:
+        sys.stderr.write("Usage: %s <binary trace> <chunked trace> [records per chunk]\n" % sys.argv[0])
+        sys.exit(1)
+    convert(sys.argv[1], sys.argv[2], int(sys.argv[3]) if len(sys.argv) > 3 else 4096)
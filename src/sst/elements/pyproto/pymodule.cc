@@ -335,6 +335,8 @@ static int pyProto_Init(PyProto_t *self, PyObject *args, PyObject *kwds)
     self->name = strdup(name);
     self->clocks = new PyProto_t::clockArray_t();
     self->links = new PyProto_t::linkArray_t();
+    self->clockScheduled = new std::vector<bool>();
+    self->linkBatched = new std::vector<bool>();
     self->constructed = false;
 
     PyObject* sys_mod_dict = PyImport_GetModuleDict();
@@ -355,6 +357,8 @@ static void pyProto_Dealloc(PyProto_t *self)
     Py_XDECREF((PyObject*)self->tcomponent);
     delete self->links;
     delete self->clocks;
+    delete self->linkBatched;
+    delete self->clockScheduled;
     free(self->name);
     self->ob_type->tp_free((PyObject*)self);
 }
@@ -372,9 +376,11 @@ static PyObject* pyProto_addLink(PyObject *self, PyObject *args)
     PyObject *slink = NULL;
     char *lat = NULL;
     PyObject *cb = NULL;
-    if ( !PyArg_ParseTuple(args, "Os|O", &slink, &lat, &cb) ) {
+    PyObject *batch = NULL;
+    if ( !PyArg_ParseTuple(args, "Os|OO", &slink, &lat, &cb, &batch) ) {
         return NULL;
     }
+    if ( cb == Py_None ) cb = NULL;
 
     size_t pnum = pself->links->size();
     char port[16] = {0};
@@ -385,6 +391,7 @@ static PyObject* pyProto_addLink(PyObject *self, PyObject *args)
     /* Push the callback (or NULL) onto the stack */
     Py_XINCREF(cb);
     pself->links->push_back(std::make_pair(port, cb));
+    pself->linkBatched->push_back(cb && batch && 1 == PyObject_IsTrue(batch));
     if ( (pnum+1) != pself->links->size() )
         SST::Output::getDefaultObject().fatal(CALL_INFO, -1,
                 "Looks like a threading bug!\n");
@@ -410,14 +417,16 @@ static PyObject* pyProto_addClock(PyObject *self, PyObject *args)
 
     PyObject *cb = NULL;
     char *freq = NULL;
+    PyObject *scheduled = NULL;
 
-    if ( !PyArg_ParseTuple(args, "Os", &cb, &freq) ) {
+    if ( !PyArg_ParseTuple(args, "Os|O", &cb, &freq, &scheduled) ) {
         SST::Output::getDefaultObject().output("Bad arguments for function PyProto.addClock()\n");
         return NULL;
     }
 
     Py_INCREF(cb);
     pself->clocks->push_back(std::make_pair(cb, freq));
+    pself->clockScheduled->push_back(scheduled && 1 == PyObject_IsTrue(scheduled));
 
     return PyInt_FromLong(0);
 }
@@ -48,6 +48,8 @@ struct PyProto_t {
 
     clockArray_t *clocks;
     linkArray_t  *links;
+    std::vector<bool> *clockScheduled; /* Callback may return cycles until its next call */
+    std::vector<bool> *linkBatched; /* Callback gets a list of the events of one cycle */
     bool constructed;
 
 };
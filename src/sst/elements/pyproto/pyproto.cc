@@ -59,13 +59,23 @@ PyProto::PyProto(SST::ComponentId_t id, SST::Params &params) : Component(id)
     PyObject_CallMethod((PyObject*)that, (char*)"construct", (char*)"");
     /* Load up links and clocks */
 
-    for ( auto c : (*that->clocks) ) {
-        PyObject *cb = c.first;
-        std::string &rate = c.second;
-        registerClock(rate, new Clock::Handler<PyProto, PyObject*>(this, &PyProto::clock, cb));
+    size_t numClocks = that->clocks->size();
+    clockInfo.resize(numClocks);
+    for ( size_t nc = 0 ; nc < numClocks ; nc++ ) {
+        std::string &rate = that->clocks->at(nc).second;
+        ClockInfo &ci = clockInfo[nc];
+        ci.handler = new Clock::Handler<PyProto, size_t>(this, &PyProto::clock, nc);
+        ci.tc = registerClock(rate, ci.handler);
+        if ( that->clockScheduled->at(nc) ) {
+            char name[32];
+            snprintf(name, sizeof(name), "clock%zu_wake", nc);
+            ci.wake = configureSelfLink(name, rate,
+                    new Event::Handler<PyProto, size_t>(this, &PyProto::wakeClock, nc));
+        }
     }
 
     size_t numLinks = that->links->size();
+    batches.resize(numLinks);
     for ( size_t nl = 0 ; nl < numLinks ; nl++ ) {
         std::string &port = that->links->at(nl).first;
         PyObject *cb = that->links->at(nl).second;
@@ -73,6 +83,10 @@ PyProto::PyProto(SST::ComponentId_t id, SST::Params &params) : Component(id)
         SST::Link *link = NULL;
         if ( cb ) {
             link = configureLink(port, new Event::Handler<PyProto, size_t>(this, &PyProto::linkAction, nl));
+            if ( that->linkBatched->at(nl) ) {
+                batches[nl].flush = configureSelfLink(port + "_batch", "1ps",
+                        new Event::Handler<PyProto, size_t>(this, &PyProto::deliverBatch, nl));
+            }
         } else {
             link = configureLink(port);
         }
@@ -87,6 +101,14 @@ PyProto::PyProto(SST::ComponentId_t id, SST::Params &params) : Component(id)
 
 PyProto::~PyProto()
 {
+    /* Events still waiting for a batch flush when the simulation ended */
+    for ( size_t nl = 0 ; nl < batches.size() ; nl++ ) {
+        std::vector<PyEvent_t*> &events = batches[nl].events;
+        for ( size_t i = 0 ; i < events.size() ; i++ ) {
+            Py_XDECREF(events[i]);
+        }
+        events.clear();
+    }
     Py_XDECREF(that);
 }
 
@@ -139,9 +161,16 @@ void PyProto::linkAction(Event *event, size_t linkNum)
     /* Translate the Event to a Python-readable thing */
     /* Do something with the callback */
     PyEvent_t *pe = convertEventToPython(event);
-    if ( pe ) {
-        PyObject *args = Py_BuildValue("(O)", pe);
-        PyObject *res = PyObject_CallObject(cb, args);
+    Batch &batch = batches[linkNum];
+    if ( pe && batch.flush ) {
+        /* The flush runs 1ps (the core's finest time step) after the first
+         * event, so every event that arrives at the same time is in the
+         * list. Clock ticks and other events due within that 1ps run first. */
+        if ( batch.events.empty() ) batch.flush->send(0, new NullEvent());
+        batch.events.push_back(pe);
+    } else if ( pe ) {
+        PyObject *res = PyObject_CallFunctionObjArgs(cb, (PyObject*)pe, NULL);
+        if ( !res ) PyErr_Print();
         Py_XDECREF(res);
         Py_XDECREF(pe);
     }
@@ -149,17 +178,64 @@ void PyProto::linkAction(Event *event, size_t linkNum)
 }
 
 
-bool PyProto::clock(SST::Cycle_t cycle, PyObject *cb)
+void PyProto::deliverBatch(Event *event, size_t linkNum)
+{
+    delete event;
+
+    PyObject *cb = that->links->at(linkNum).second;
+    std::vector<PyEvent_t*> &events = batches[linkNum].events;
+    PyObject *list = PyList_New(events.size());
+    for ( size_t i = 0 ; i < events.size() ; i++ ) {
+        PyList_SET_ITEM(list, i, (PyObject*)events[i]); /* Steals the reference */
+    }
+    events.clear();
+
+    PyObject *res = PyObject_CallFunctionObjArgs(cb, list, NULL);
+    if ( !res ) PyErr_Print();
+    Py_XDECREF(res);
+    Py_DECREF(list);
+}
+
+
+bool PyProto::clock(SST::Cycle_t cycle, size_t clockNum)
 {
-    PyObject *args = Py_BuildValue("(K)", cycle);
-    PyObject *res = PyObject_CallObject(cb, args);
+    PyObject *cb = that->clocks->at(clockNum).first;
+    PyObject *arg = PyLong_FromUnsignedLongLong(cycle);
+    PyObject *res = PyObject_CallFunctionObjArgs(cb, arg, NULL);
+    Py_DECREF(arg);
     if ( !res ) PyErr_Print();
+
+    if ( res && clockInfo[clockNum].wake && !PyBool_Check(res) &&
+            ( PyInt_Check(res) || PyLong_Check(res) ) ) {
+        long long wait = PyLong_AsLongLong(res);
+        Py_DECREF(res);
+        if ( wait == -1 && PyErr_Occurred() ) {
+            PyErr_Print();
+            return false;
+        }
+        if ( wait < 2 ) return false;
+
+        /* Off the clock until the cycle before the one asked for.  The wake
+         * link has one cycle of latency and its event runs after that
+         * cycle's clock ticks, so reregisterClock() resumes at cycle + wait */
+        clockInfo[clockNum].wake->send(wait - 2, new NullEvent());
+        return true;
+    }
+
     bool bres = (res && 1 == PyObject_IsTrue(res));
     Py_XDECREF(res);
     return bres;
 }
 
 
+void PyProto::wakeClock(Event *event, size_t clockNum)
+{
+    delete event;
+    ClockInfo &ci = clockInfo[clockNum];
+    reregisterClock(ci.tc, ci.handler);
+}
+
+
 
 std::vector<PyProto_t*> PyProto::pyObjects;
 std::atomic<size_t> PyProto::pyObjIdx(0);
@@ -87,12 +87,29 @@ public:
 
 
 protected:
-    bool clock(SST::Cycle_t cycle, PyObject *cb);
+    bool clock(SST::Cycle_t cycle, size_t clockNum);
     void linkAction(Event *event, size_t linkNum);
+    void deliverBatch(Event *event, size_t linkNum);
+    void wakeClock(Event *event, size_t clockNum);
 
 private:
+    struct Batch {
+        Batch() : flush(NULL) {}
+        SST::Link *flush; /* Self link that delivers the batch, NULL if not batched */
+        std::vector<PyEvent_t*> events; /* Each holds one reference */
+    };
+
     PyProto_t *that; /* The Python-space representation of this */
     std::vector<SST::Link*> links;
+    struct ClockInfo {
+        ClockInfo() : tc(NULL), handler(NULL), wake(NULL) {}
+        TimeConverter *tc;
+        Clock::HandlerBase *handler;
+        SST::Link *wake; /* Self link that reregisters a scheduled clock, NULL if not scheduled */
+    };
+
+    std::vector<Batch> batches;
+    std::vector<ClockInfo> clockInfo;
 
     static std::vector<PyProto_t*> pyObjects;
     static std::atomic<size_t> pyObjIdx;
@@ -34,9 +34,14 @@ class PyLink():
 class PyProto():
     def __init__(self, name):
         pass
-    def addLink(self, link, latency, callback = None):
-        pass
-    def addClock(self, callback, rate):
+    # With batch, callback is called with a list of all the events that
+    # arrive at the same time, 1ps after they arrive.  Clock callbacks and
+    # other events due in that 1ps run before it.
+    def addLink(self, link, latency, callback = None, batch = False):
+        pass
+    # With scheduled, callback may return an int N > 0 to be called next in
+    # N cycles; the clock is unregistered for the cycles in between
+    def addClock(self, callback, rate, scheduled = False):
         pass
     def construct(self):
         pass
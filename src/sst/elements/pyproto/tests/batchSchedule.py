@@ -0,0 +1,84 @@
+import os
+import sst
+from sst.pyproto import *
+
+# Alice's clock is scheduled: each call asks to be called again in PERIOD
+# cycles and sends BURST events to Bob.  Bob's link is batched, so each
+# burst has to reach him as one list, in the order it was sent.
+# Exits with status 1 from finish() if either side sees something else.
+
+PERIOD = 5
+BURST = 3
+ROUNDS = 10
+
+
+class SeqEvent(PyEvent):
+    def __init__(self, cycle, seq):
+        PyEvent.__init__(self)
+        self.cycle = cycle
+        self.seq = seq
+
+    def __str__(self):
+        return "{%d, %d}"%(self.cycle, self.seq)
+
+
+def check(name, ok, msg):
+    if not ok:
+        print name, "FAIL:", msg
+        os._exit(1)
+
+
+class Sender(PyProto):
+    def __init__(self, name):
+        PyProto.__init__(self, name)
+        self.name = name
+        self.calls = []
+        self.addClock(self._clockHandle, "1MHz", True)
+
+    def setLink(self, link):
+        self.myLink = self.addLink(link, "1us")
+
+    def _clockHandle(self, cycle):
+        if self.calls:
+            check(self.name, cycle - self.calls[-1] == PERIOD,
+                    "called at cycle %d, %d cycles after the last call"%(cycle, cycle - self.calls[-1]))
+        self.calls.append(cycle)
+        for seq in range(BURST):
+            self.myLink.send(SeqEvent(cycle, seq))
+        if len(self.calls) == ROUNDS:
+            return True
+        return PERIOD
+
+    def finish(self):
+        check(self.name, len(self.calls) == ROUNDS, "%d clock calls"%len(self.calls))
+        print self.name, "PASS", self.calls
+
+
+class Receiver(PyProto):
+    def __init__(self, name):
+        PyProto.__init__(self, name)
+        self.name = name
+        self.batches = []
+
+    def setLink(self, link):
+        self.myLink = self.addLink(link, "1us", self._batchHandle, True)
+
+    def _batchHandle(self, events):
+        check(self.name, len(events) == BURST, "batch of %d events"%len(events))
+        for seq, ev in enumerate(events):
+            check(self.name, ev.seq == seq and ev.cycle == events[0].cycle,
+                    "event %s at position %d of batch"%(ev, seq))
+        self.batches.append(events[0].cycle)
+
+    def finish(self):
+        check(self.name, len(self.batches) == ROUNDS, "%d batches"%len(self.batches))
+        print self.name, "PASS", self.batches
+
+
+link = sst.Link("Mylink")
+
+alice = Sender("Alice")
+alice.setLink(link)
+
+bob = Receiver("Bob")
+bob.setLink(link)
@@ -22,9 +22,13 @@
 
 #include <vector>
 #include <map>
+#include <algorithm>
+#include <cmath>
 
 #include "AllocInfo.h"
+#include "FSTProfile.h"
 #include "Job.h"
+#include "Machine.h"
 #include "output.h"
 #include "Scheduler.h"
 #include "allocators/SimpleAllocator.h"
@@ -35,11 +39,16 @@
 using namespace SST::Scheduler;
 using namespace std;
 
-FST::FST(int inrelaxed)
+FST::FST(int inrelaxed, bool infullSimulation)
 {
     //keeps track of job copies so we have a pointer when they actually start
     running = new vector<Job*>;
     toRun = new vector<Job*>;
+    incremental = false;
+    fullSimulation = infullSimulation;
+    profile = NULL;
+    lastStart = 0;
+    coresPerNode = 1;
     schedout.init("", 8, 0, Output::STDOUT);
 
     if (inrelaxed == 1) {
@@ -51,12 +60,18 @@ FST::FST(int inrelaxed)
     }
 }
 
+FST::~FST()
+{
+    delete profile;
+}
+
 //This would normally be a part of the constructor but we need the number of
-//jobs, so schedComponent calls it later. 
+//jobs, so schedComponent calls it later.  When the trace is streamed the
+//number is not known up front and the table grows as jobs arrive.
 void FST::setup(int innumjobs)
 {
     numjobs = innumjobs;
-    jobFST = new unsigned long[numjobs]; 
+    jobFST.resize(numjobs);
 }
 
 //used as a comparator to make sure our simulation considers events in the
@@ -75,6 +90,22 @@ bool compevents(Job* j1, Job* j2) {
 void FST::jobArrives(Job *inj, Scheduler* insched, Machine* inmach)
 { 
     schedout.debug(CALL_INFO, 7, 0, "%s arriving to FST\n", inj -> toString().c_str());
+
+    if (inj -> getJobNum() >= numjobs) {
+        numjobs = inj -> getJobNum() + 1;
+        jobFST.resize(numjobs);
+    }
+
+    //the scheduler does not change, so decide once how FST is computed
+    if (NULL == profile) {
+        incremental = !fullSimulation && insched -> startsInArrivalOrder();
+        coresPerNode = inmach -> coresPerNode;
+        profile = new FSTProfile(inmach -> numNodes);
+    }
+    if (incremental) {
+        jobArrivesIncremental(inj);
+        return;
+    }
     
     Job *j = new Job(*inj); //must copy the job because they keep track of when they each start
 
@@ -284,10 +315,68 @@ bool FST::FSTstart(std::multimap<Job*, unsigned long, bool(*)(Job*, Job*)>* endt
     return false; 
 }
 
+//When jobs start in arrival order (no backfilling), a job cannot start
+//before the job that arrived just before it, and once that job has started
+//nodes only become free.  Its FST is therefore the first time after both
+//its arrival and the previous job's predicted start at which enough nodes
+//are free in the profile of predicted runs (with actual running times).
+//This is the same answer the simulation gives, relaxed or not, found with a
+//walk over the profile instead of a copy of the whole queue.
+void FST::jobArrivesIncremental(Job* inj)
+{
+    Job *j = new Job(*inj); //copy kept until the job completes, as in the simulation
+    toRun -> push_back(j);
+
+    Reservation r;
+    r.nodes = ceil(((float) j -> getProcsNeeded()) / coresPerNode);
+    unsigned long notBefore = max(j -> getArrivalTime(), lastStart);
+    r.start = profile -> earliestStart(notBefore, r.nodes, j -> getActualTime());
+    if (FSTProfile::NEVER == r.start) schedout.fatal(CALL_INFO, 1, "Could not find time for %s in FST\n", j -> toString().c_str());
+    r.end = r.start + j -> getActualTime();
+    profile -> reserve(r.start, r.end, r.nodes);
+    reservations[j -> getJobNum()] = r;
+    lastStart = r.start;
+
+    jobFST[j -> getJobNum()] = r.start;
+    schedout.debug(CALL_INFO, 7, 0, "Assigning FST of %lu to Job %ld\n", jobFST[j -> getJobNum()], j -> getJobNum());
+}
+
+//The real schedule left the predicted one (a job started or finished at
+//another time, e.g., because of allocation or communication effects).  FST
+//values already assigned stand, but the waiting jobs' predicted runs are
+//what later arrivals are measured against, so redo only those.
+void FST::replanWaiting(unsigned long time)
+{
+    for (unsigned int x = 0; x < toRun -> size(); x++) {
+        Reservation& r = reservations[toRun -> at(x) -> getJobNum()];
+        profile -> release(r.start, r.end, r.nodes);
+    }
+    lastStart = time;
+    for (unsigned int x = 0; x < toRun -> size(); x++) {
+        Job* j = toRun -> at(x);
+        Reservation& r = reservations[j -> getJobNum()];
+        unsigned long notBefore = max(j -> getArrivalTime(), lastStart);
+        r.start = profile -> earliestStart(notBefore, r.nodes, j -> getActualTime());
+        if (FSTProfile::NEVER == r.start) schedout.fatal(CALL_INFO, 1, "Could not find time for %s in FST\n", j -> toString().c_str());
+        r.end = r.start + j -> getActualTime();
+        profile -> reserve(r.start, r.end, r.nodes);
+        lastStart = r.start;
+    }
+}
+
 //when a job finishes, we just remove it from running
-void FST::jobCompletes(Job* j)
+void FST::jobCompletes(Job* j, unsigned long time)
 {
     schedout.debug(CALL_INFO, 7, 0, "%s completing in FST\n", j -> toString().c_str());
+    if (incremental) {
+        map<long, Reservation>::iterator res = reservations.find(j -> getJobNum());
+        if (res == reservations.end()) schedout.fatal(CALL_INFO, 1, "FST has no reservation for completing %s\n", j -> toString().c_str());
+        bool replan = (res -> second.end != time);
+        profile -> release(res -> second.start, res -> second.end, res -> second.nodes);
+        reservations.erase(res);
+        profile -> discardBefore(time);
+        if (replan) replanWaiting(time);
+    }
     for(vector<Job*>::iterator it = running -> begin(); it != running -> end(); it++) {
         if ((*it) -> getJobNum() == j -> getJobNum()) {
             delete *it;
@@ -310,6 +399,16 @@ void FST::jobStarts(Job* j, unsigned long time)
             startingjob -> startsAtTime(time);
             running -> push_back(startingjob); 
             toRun -> erase (toRun -> begin() + x);
+            if (incremental) {
+                Reservation& r = reservations[j -> getJobNum()];
+                if (r.start != time) {
+                    profile -> release(r.start, r.end, r.nodes);
+                    r.start = time;
+                    r.end = time + startingjob -> getActualTime();
+                    profile -> reserve(r.start, r.end, r.nodes);
+                    replanWaiting(time);
+                }
+            }
             return;
         } 
     }
@@ -31,20 +31,40 @@ namespace SST {
         class Job;
         class Statistics;
         class TaskMapInfo;
+        class FSTProfile;
 
         class FST {
             private:
                 std::vector<Job*>* running;
                 std::vector<Job*>* toRun;
                 int numjobs;
-                unsigned long* jobFST; //array to hold the FST values for jobs 1....numjobs
+                std::vector<unsigned long> jobFST; //FST values for jobs 0....numjobs-1; grows as jobs arrive
                 bool relaxed;
 
+                //when the scheduler starts jobs in arrival order, FST is
+                //tracked in an availability profile of the predicted
+                //schedule instead of by simulating a copy of the scheduler
+                struct Reservation {
+                    unsigned long start;
+                    unsigned long end;
+                    int nodes;
+                };
+                bool incremental;
+                bool fullSimulation; //never use the profile, e.g., to check it
+                FSTProfile* profile;
+                std::map<long, Reservation> reservations; //job number -> predicted run of running and waiting jobs
+                unsigned long lastStart; //predicted start of the last waiting job
+                int coresPerNode;
+
+                void jobArrivesIncremental(Job* j);
+                void replanWaiting(unsigned long time);
+
             public:
                 void jobArrives(Job* j, Scheduler* insched, Machine* inmach);
-                void jobCompletes(Job* j);
+                void jobCompletes(Job* j, unsigned long time);
                 void jobStarts(Job* j, unsigned long time);
-                FST(int inrelaxed); 
+                FST(int inrelaxed, bool infullSimulation = false); 
+                ~FST();
                 bool FSTstart(std::multimap<Job*, unsigned long, bool(*)(Job*, Job*)>* endtimes, 
                               std::map<Job*, TaskMapInfo*>* jobToAi, Job* j, Scheduler* sched,
                               Allocator* alloc, Machine* mach, Statistics* stats, unsigned long time);
@@ -0,0 +1,118 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+/*
+ * Availability profile used by FST
+ */
+
+#include "sst_config.h"
+#include "FSTProfile.h"
+
+#include <map>
+
+using namespace SST::Scheduler;
+using namespace std;
+
+const unsigned long FSTProfile::NEVER;
+
+FSTProfile::FSTProfile(int inNumNodes)
+{
+    numNodes = inNumNodes;
+    floor = 0;
+    levels[0] = 0;
+}
+
+void FSTProfile::reserve(unsigned long start, unsigned long end, int nodes)
+{
+    add(start, end, nodes);
+}
+
+void FSTProfile::release(unsigned long start, unsigned long end, int nodes)
+{
+    add(start, end, -nodes);
+}
+
+//returns the entry starting at time, adding one with the level in effect
+//at time if needed
+map<unsigned long, int>::iterator FSTProfile::split(unsigned long time)
+{
+    map<unsigned long, int>::iterator it = levels.upper_bound(time);
+    --it;
+    if (it -> first == time) return it;
+    return levels.insert(it, pair<unsigned long, int>(time, it -> second));
+}
+
+void FSTProfile::add(unsigned long start, unsigned long end, int nodes)
+{
+    if (start < floor) start = floor;
+    if (end <= start || nodes == 0) return;
+
+    map<unsigned long, int>::iterator first = split(start);
+    map<unsigned long, int>::iterator last = split(end);
+    for (map<unsigned long, int>::iterator it = first; it != last; it++) {
+        it -> second += nodes;
+    }
+
+    //merge steps that no longer change the level so the profile stays as
+    //small as the number of distinct start and end times
+    if (last -> second == (--map<unsigned long, int>::iterator(last)) -> second) {
+        levels.erase(last);
+    }
+    if (first != levels.begin()) {
+        map<unsigned long, int>::iterator prev = first;
+        --prev;
+        if (prev -> second == first -> second) levels.erase(first);
+    }
+}
+
+int FSTProfile::busyAt(unsigned long time) const
+{
+    if (time < floor) time = floor;
+    map<unsigned long, int>::const_iterator it = levels.upper_bound(time);
+    --it;
+    return it -> second;
+}
+
+unsigned long FSTProfile::earliestStart(unsigned long notBefore, int nodes, unsigned long duration) const
+{
+    if (nodes > numNodes) return NEVER;
+    if (notBefore < floor) notBefore = floor;
+    if (duration == 0) duration = 1; //the nodes must still be free when the job starts
+    const int maxBusy = numNodes - nodes;
+
+    //walk the steps from notBefore; a candidate start is notBefore or the
+    //end of the last step that was too busy
+    map<unsigned long, int>::const_iterator it = levels.upper_bound(notBefore);
+    --it;
+    unsigned long candidate = notBefore;
+    for (; it != levels.end(); it++) {
+        if (it -> first >= candidate + duration) return candidate;
+        if (it -> second > maxBusy) {
+            map<unsigned long, int>::const_iterator next = it;
+            ++next;
+            if (next == levels.end()) return NEVER;
+            candidate = next -> first;
+        }
+    }
+    return candidate; //the last level is always 0 busy nodes
+}
+
+void FSTProfile::discardBefore(unsigned long time)
+{
+    if (time <= floor) return;
+    map<unsigned long, int>::iterator it = split(time);
+    levels.erase(levels.begin(), it);
+    floor = time;
+}
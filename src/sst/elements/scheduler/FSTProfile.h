@@ -0,0 +1,63 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+/*
+ * Availability profile used by FST: the number of busy nodes over time as
+ * a step function, built from the (predicted) start and end times of
+ * running and waiting jobs.
+ */
+
+#ifndef SST_SCHEDULER_FSTPROFILE_H__
+#define SST_SCHEDULER_FSTPROFILE_H__
+
+#include <map>
+
+namespace SST {
+    namespace Scheduler {
+
+        class FSTProfile {
+            public:
+                static const unsigned long NEVER = (unsigned long) -1;
+
+                FSTProfile(int numNodes);
+
+                //mark nodes busy (reserve) or free (release) over [start, end)
+                void reserve(unsigned long start, unsigned long end, int nodes);
+                void release(unsigned long start, unsigned long end, int nodes);
+
+                //number of busy nodes at time
+                int busyAt(unsigned long time) const;
+
+                //earliest time >= notBefore at which nodes are free for the
+                //whole of [time, time + duration); NEVER if there is none
+                unsigned long earliestStart(unsigned long notBefore, int nodes, unsigned long duration) const;
+
+                //forget everything before time; later changes before time are ignored
+                void discardBefore(unsigned long time);
+
+            private:
+                void add(unsigned long start, unsigned long end, int nodes);
+                std::map<unsigned long, int>::iterator split(unsigned long time);
+
+                //busy nodes from each time until the next entry; the first
+                //entry is always at floor and the last level is 0 nodes
+                std::map<unsigned long, int> levels;
+                unsigned long floor;
+                int numNodes;
+        };
+
+    }
+}
+#endif
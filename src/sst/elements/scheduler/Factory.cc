@@ -656,6 +656,24 @@ int Factory::getFST(SST::Params& params)
     return 0; 
 }
 
+//"strict[full]" or "relaxed[full]" always simulates a copy of the queue,
+//even for schedulers whose FST can be tracked in a profile
+bool Factory::getFSTFullSimulation(SST::Params& params)
+{
+    if(params.find<std::string>("FST").empty()){
+        return false;
+    }
+    vector<string>* FSTparams = parseparams(params.find<std::string>("FST"));
+    bool full = false;
+    if (FSTparams -> size() == 2 && FSTparams -> at(1) == "full") {
+        full = true;
+    } else if (FSTparams -> size() > 1) {
+        schedout.fatal(CALL_INFO, 1, "FST takes one optional parameter, full");
+    }
+    delete FSTparams;
+    return full;
+}
+
 vector<double>* Factory::getTimePerDistance(SST::Params& params)
 {
     vector<double>* ret = new vector<double>;
@@ -47,6 +47,7 @@ namespace SST {
                 Allocator* getAllocator(SST::Params& params, Machine* m, schedComponent* sc);
                 TaskMapper* getTaskMapper(SST::Params& params, Machine* mach);
                 int getFST(SST::Params& params);
+                bool getFSTFullSimulation(SST::Params& params);
                 std::vector<double>* getTimePerDistance(SST::Params& params);
             private:
                 std::vector<std::string>* parseparams(std::string inparam);
@@ -33,10 +33,86 @@
 
 #include <iostream> //debug
 
+#ifdef HAVE_LIBZ
+#include <zlib.h>
+#endif
+
 using namespace std;
 using namespace SST;
 using namespace SST::Scheduler;
 
+namespace SST {
+    namespace Scheduler {
+
+        //Reads a job trace line by line.  With libz, gzip-compressed traces
+        //are decompressed as they are read (uncompressed ones pass through).
+        class TraceReader {
+            public:
+                TraceReader() : isOpen(false) { }
+                ~TraceReader() { close(); }
+
+                bool open(const string & name)
+                {
+                    close();
+#ifdef HAVE_LIBZ
+                    input = gzopen(name.c_str(), "rb");
+                    isOpen = (NULL != input);
+                    if (isOpen) {
+                        gzbuffer(input, 1 << 17);
+                    }
+#else
+                    if (name.size() > 3 && name.compare(name.size() - 3, 3, ".gz") == 0) {
+                        schedout.fatal(CALL_INFO, 1, "Job trace %s is compressed but the scheduler was built without libz\n", name.c_str());
+                    }
+                    input.open(name.c_str());
+                    isOpen = input.is_open();
+#endif
+                    return isOpen;
+                }
+
+                //false once the trace is exhausted
+                bool getLine(string & line)
+                {
+                    line.clear();
+                    if (!isOpen) return false;
+#ifdef HAVE_LIBZ
+                    char buf[4096];
+                    while (NULL != gzgets(input, buf, sizeof(buf))) {
+                        line += buf;
+                        if (line[line.size() - 1] == '\n') {
+                            line.erase(line.size() - 1);
+                            return true;
+                        }
+                    }
+                    return !line.empty();
+#else
+                    return (bool) getline(input, line);
+#endif
+                }
+
+                void close()
+                {
+                    if (!isOpen) return;
+#ifdef HAVE_LIBZ
+                    gzclose(input);
+#else
+                    input.close();
+#endif
+                    isOpen = false;
+                }
+
+            private:
+#ifdef HAVE_LIBZ
+                gzFile input;
+#else
+                ifstream input;
+#endif
+                bool isOpen;
+        };
+
+    }
+}
+
 JobParser::JobParser(Machine* machine,
           SST::Params& params,
           bool* useYumYumSimulationKill,
@@ -83,16 +159,18 @@ JobParser::JobParser(Machine* machine,
     }
 
     fileNamePath = fileName;
+    jobStream = NULL;
+}
+
+JobParser::~JobParser()
+{
+    delete jobStream;
 }
 
 std::vector<Job*> JobParser::parseJobs(SimTime_t currSimTime)
 {
-    ifstream input;
-    input.open( fileName.c_str() );
-    if(!input.is_open()){
-        input.open(jobTrace.c_str());  //try without directory
-    }                     
-    if(!input.is_open()){
+    TraceReader input;
+    if(!input.open(fileName) && !input.open(jobTrace)){  //try without directory
         schedout.fatal(CALL_INFO, 1, "Unable to open job trace file: %s\n", fileName.c_str());
     }
     
@@ -102,9 +180,7 @@ std::vector<Job*> JobParser::parseJobs(SimTime_t currSimTime)
 
     //read line by line
     string line;
-    while (!input.eof()) {
-        //DEBUG
-        getline(input, line);
+    while (input.getLine(line)) {
         if (useYumYumTraceFormat) {
             newYumYumJobLine(line, currSimTime);
         } else {
@@ -117,6 +193,32 @@ std::vector<Job*> JobParser::parseJobs(SimTime_t currSimTime)
     return jobs;
 }
 
+void JobParser::openJobStream()
+{
+    delete jobStream;
+    jobStream = new TraceReader();
+    if(!jobStream->open(fileName) && !jobStream->open(jobTrace)){  //try without directory
+        schedout.fatal(CALL_INFO, 1, "Unable to open job trace file: %s\n", fileName.c_str());
+    }
+    jobs.clear();
+}
+
+Job* JobParser::nextJob()
+{
+    //newJobLine() leaves a valid job in jobs and drops an invalid one
+    string line;
+    while (jobs.empty() && jobStream->getLine(line)) {
+        newJobLine(line);
+    }
+    if (jobs.empty()) {
+        jobStream->close();
+        return NULL;
+    }
+    Job* job = jobs.back();
+    jobs.clear();
+    return job;
+}
+
 //NetworkSim: parser for completedJobTrace
 std::map<int, unsigned long> JobParser::parseJobsEmberCompleted()
 {
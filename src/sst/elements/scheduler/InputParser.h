@@ -29,6 +29,7 @@ namespace SST {
 
         class Job;
         class Machine;
+        class TraceReader;
         
         // the maximum length of a job ID.  used primarily for job list parsing.
 #define JobIDlength 16
@@ -40,9 +41,13 @@ namespace SST {
                           bool* useYumYumSimulationKill, 
                           bool* YumYumSimulationKillFlag,
                           bool* doDetailedNetworkSim); //NetworkSim: added bool parameter 
-                ~JobParser() { };
+                ~JobParser();
                         
                 std::vector<Job*> parseJobs(SimTime_t currSimTime);
+                //streaming: open the trace once, then read it one job at a
+                //time; nextJob() returns NULL at the end of the trace
+                void openJobStream();
+                Job* nextJob();
                 //NetworkSim: parse the files for jobs completed/running on ember
                 std::map<int, unsigned long> parseJobsEmberCompleted();
                 std::map<int, std::pair<unsigned long, int> > parseJobsEmberRunning();
@@ -56,6 +61,7 @@ namespace SST {
                 std::string fileName;
                 std::string fileNamePath;
                 std::string jobTrace;
+                TraceReader* jobStream;
 
                 std::string completedJobTrace; // NetworkSim: File that lists all jobs that has been completed in ember
                 std::string runningJobTrace; // NetworkSim: File that lists all jobs that are still running on ember
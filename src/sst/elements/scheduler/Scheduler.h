@@ -67,6 +67,11 @@ namespace SST {
 
                 //used for FST, returns an exact copy of the current schedule
                 virtual Scheduler* copy(std::vector<Job*>* running, std::vector<Job*>* toRun) = 0;
+
+                //used for FST; true if jobs always start in arrival order
+                //without backfilling, so FST can be computed from an
+                //availability profile instead of by simulating a copy
+                virtual bool startsInArrivalOrder() { return false; }
             
             protected:
                 Job* nextToStart; //next ready job - used to give feedback to schedComponent
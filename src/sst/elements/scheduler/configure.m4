@@ -5,5 +5,8 @@ AC_DEFUN([SST_scheduler_CONFIG], [
   #check for GLPK
   SST_CHECK_GLPK([],[],[AC_MSG_ERROR([GLPK requested but could not be found])])
 
+  # Use LIBZ for compressed job traces
+  SST_CHECK_LIBZ()
+
   AS_IF([test "x$sst_scheduler_happy" = "xyes"], [$1], [$2])
 ])
@@ -155,7 +155,7 @@ schedComponent::schedComponent(ComponentId_t id, Params& params) :
 
     string trace = params.find<std::string>("traceName");
     if (FSTtype > 0) {
-        calcFST = new FST(FSTtype);  //must call calcFST -> setup() once we know the number of jobs (in other words, in setup())
+        calcFST = new FST(FSTtype, factory.getFSTFullSimulation(params));  //must call calcFST -> setup() once we know the number of jobs (in other words, in setup())
     } else {
         calcFST = NULL;
     }
@@ -207,6 +207,22 @@ schedComponent::schedComponent(ComponentId_t id, Params& params) :
 
     jobParser = new JobParser(machine, params, &useYumYumSimulationKill, &YumYumSimulationKillFlag, &doDetailedNetworkSim);
 
+    jobWindow = params.find<int>("jobWindow", 0);
+    if (jobWindow < 0) {
+        schedout.fatal(CALL_INFO, 1, "jobWindow must be 0 or positive\n");
+    }
+    if (jobWindow > 0 && (useYumYumTraceFormat || useYumYumSimulationKill || doDetailedNetworkSim)) {
+        schedout.fatal(CALL_INFO, 1, "jobWindow cannot be used with YumYum traces or detailedNetworkSim\n");
+    }
+    nextJobIndex = 0;
+    jobsAhead = 0;
+    liveJobs = 0;
+    traceExhausted = false;
+    retired.count = 0;
+    retired.waitTime = 0;
+    retired.responseTime = 0;
+    retired.maxWaitTime = 0;
+
     machine -> reset();
     scheduler -> reset();
 
@@ -227,6 +243,19 @@ void schedComponent::setup()
         setNetworkSim-> reply = doDetailedNetworkSim;
         (*nodeIter)->send( setNetworkSim );
     }
+    if (jobWindow > 0) {
+        //read only the first window of jobs; the rest are read as jobs arrive
+        jobParser -> openJobStream();
+        readJobWindow();
+        if (FSTtype > 0) {
+            calcFST -> setup(0);
+        }
+        if (0 == liveJobs) {
+            unregisterYourself();
+        }
+        return;
+    }
+
     // done setting up the links, now read the job list
     jobs = jobParser -> parseJobs(getCurrentSimTime());
 
@@ -381,7 +410,7 @@ void schedComponent::handleCompletionEvent(Event *ev, int node)
                 fte->forceExecute = true;
             selfLink->send(0, fte); //send back an event at the same time so we know it finished 
         }
-        if (jobNum == jobs.back()->jobNum) {
+        if (0 == jobWindow && jobNum == jobs.back()->jobNum) {
             if (jobs.empty()) {
                 unregisterYourself();
             }
@@ -433,6 +462,7 @@ void schedComponent::handleCompletionEvent(Event *ev, int node)
                 stats->jobFinishes(tmi, getCurrentSimTime() );
                 scheduler->jobFinishes(tmi->job, getCurrentSimTime() , *machine);
             }
+            Job* faultedJob = tmi -> job;
             //the job is done and deleted from our records; don't need
             delete runningJobs.find( jobNum )->second.tmi; 
             
@@ -441,7 +471,9 @@ void schedComponent::handleCompletionEvent(Event *ev, int node)
 
             startNextJob();
 
-            if (jobNum == jobs.back()->jobNum) {
+            if (jobWindow > 0) {
+                retireJob(faultedJob, getCurrentSimTime());
+            } else if (jobNum == jobs.back()->jobNum) {
                 while (!jobs.empty() && 
                        runningJobs.find(jobs.back()->jobNum) == runningJobs.end() && 
                        jobs.back()->hasRun == true) {
@@ -509,6 +541,13 @@ void schedComponent::handleJobArrivalEvent(Event *ev)
         finishingarr.push_back(arevent);
         //NetworkSim: keep track of the last job that has arrived
         jobNumLastArrived = arevent->getJobIndex();
+
+        if (jobWindow > 0) {
+            //read ahead before the final time event is sent so that jobs
+            //arriving now are still handled with this time step's arrivals
+            jobsAhead--;
+            readJobWindow();
+        }
         
         FinalTimeEvent* fte = new FinalTimeEvent();
         if (useYumYumSimulationKill xor YumYumSimulationKillFlag) {
@@ -543,14 +582,17 @@ void schedComponent::handleJobArrivalEvent(Event *ev)
                 scheduler -> jobFinishes(tmi->job, getCurrentSimTime() + 1, *machine);
             } else {
                 if (FSTtype > 0){
-                    calcFST -> jobCompletes(tmi->job);
+                    calcFST -> jobCompletes(tmi->job, getCurrentSimTime());
                 }
                 stats -> jobFinishes(tmi, getCurrentSimTime());
                 scheduler -> jobFinishes(tmi->job, getCurrentSimTime(), *machine);
             }
+            Job* finishedJob = tmi -> job;
             delete tmi;
 
-            if (finishedJobNum == jobs.back()->jobNum) {
+            if (jobWindow > 0) {
+                retireJob(finishedJob, getCurrentSimTime());
+            } else if (finishedJobNum == jobs.back()->jobNum) {
                 while (!jobs.empty() && 
                        runningJobs.find(jobs.back()->jobNum) == runningJobs.end() && 
                        jobs.back()->hasRun == true) {
@@ -571,7 +613,14 @@ void schedComponent::handleJobArrivalEvent(Event *ev)
         //events not at the same time step, and they should already be sorted
         //by number because they are given to SST (and therefore come back) that way.
         while (!finishingarr.empty()) {
-            Job* arrivingjob = jobs[finishingarr.front() -> getJobIndex()];
+            Job* arrivingjob;
+            if (jobWindow > 0) {
+                std::map<int, Job*>::iterator streamed = streamedJobs.find(finishingarr.front() -> getJobIndex());
+                arrivingjob = streamed -> second;
+                streamedJobs.erase(streamed);
+            } else {
+                arrivingjob = jobs[finishingarr.front() -> getJobIndex()];
+            }
             if (FSTtype == 2) { 
                 //relaxed, so do FST before we tell the scheduler about the job
                 calcFST -> jobArrives(arrivingjob, scheduler, machine);
@@ -615,10 +664,56 @@ void schedComponent::finish()
             schedout.output("In Sched component: sim finished\n");
         }
     }
+    if (jobWindow > 0 && retired.count > 0) {
+        schedout.output("%lu streamed jobs finished: mean wait %.2f, max wait %lu, mean response %.2f\n",
+                        retired.count,
+                        (double) retired.waitTime / retired.count,
+                        retired.maxWaitTime,
+                        (double) retired.responseTime / retired.count);
+    }
     stats -> done();
     theAllocator -> done();
 }
 
+//Keep up to jobWindow jobs read ahead of their arrival
+void schedComponent::readJobWindow()
+{
+    while (!traceExhausted && jobsAhead < jobWindow) {
+        Job* job = jobParser -> nextJob();
+        if (NULL == job) {
+            traceExhausted = true;
+            break;
+        }
+        if (job -> getArrivalTime() < getCurrentSimTime()) {
+            schedout.fatal(CALL_INFO, 1, "Job %ld arrives at %lu, before the current time %llu; jobWindow needs a trace sorted by arrival time\n",
+                           job -> getJobNum(), job -> getArrivalTime(), getCurrentSimTime());
+        }
+        streamedJobs[nextJobIndex] = job;
+        selfLink -> send(job -> getArrivalTime() - getCurrentSimTime(), new ArrivalEvent(job -> getArrivalTime(), nextJobIndex));
+        nextJobIndex++;
+        jobsAhead++;
+        liveJobs++;
+    }
+}
+
+//Statistics have been written for the finished job, so only its totals are kept
+void schedComponent::retireJob(Job* job, unsigned long endTime)
+{
+    unsigned long wait = job -> getStartTime() - job -> getArrivalTime();
+    retired.count++;
+    retired.waitTime += wait;
+    retired.responseTime += endTime - job -> getArrivalTime();
+    if (wait > retired.maxWaitTime) {
+        retired.maxWaitTime = wait;
+    }
+    delete job;
+    liveJobs--;
+
+    if (0 == liveJobs && traceExhausted) {
+        unregisterYourself();
+    }
+}
+
 void schedComponent::startJob(Job* job) 
 {
     //allocate & update machine
@@ -87,7 +87,7 @@ namespace SST {
                         "Simple task mapper"
                     },
                     { "FST",
-                      "Metric to analyze scheduler in terms of social justice",
+                      "Metric to analyze scheduler in terms of social justice: none, strict or relaxed; [full] always simulates the queue instead of using the incremental profile",
                       "None"
                     },
                     { "timeperdistance",
@@ -165,6 +165,10 @@ namespace SST {
                     { "runningJobsTrace",
                         "A file that lists all jobs that are still running on ember, needed for detailed network sim",
                         "none"
+                    },
+                    { "jobWindow",
+                        "Stream the job trace, keeping at most this many jobs read ahead of their arrival; finished jobs are deleted. The trace must be sorted by arrival time. 0 reads the whole trace at setup",
+                        "0"
                     }
                 )
 
@@ -212,6 +216,10 @@ namespace SST {
                 void startNextJob();
                 void startJob(Job* job);
 
+                //streaming (jobWindow > 0)
+                void readJobWindow();
+                void retireJob(Job* job, unsigned long endTime);
+
                 void logJobStart(ITMI itmi);
                 void logJobFinish(ITMI itmi);
                 void logJobFault(ITMI itmi, FaultEvent * faultEvent );
@@ -254,6 +262,22 @@ namespace SST {
 
                 JobParser* jobParser;
 
+                //streaming: jobs read from the trace whose arrival has not
+                //been handled yet, by arrival event index
+                int jobWindow;
+                std::map<int, Job*> streamedJobs;
+                int nextJobIndex;
+                int jobsAhead;        // arrival events sent but not yet received
+                long liveJobs;        // jobs read and not yet retired
+                bool traceExhausted;
+                //finished jobs are deleted; finish() reports these totals instead
+                struct RetiredJobs {
+                    unsigned long count;
+                    unsigned long long waitTime;
+                    unsigned long long responseTime;
+                    unsigned long maxWaitTime;
+                } retired;
+
                 bool useYumYumSimulationKill;         // should the simulation end on a special job (true), or just when the job list is exhausted (false)?
                 bool YumYumSimulationKillFlag;        // this will signal the schedComponent to unregister itself iff useYumYumSimulationKill == true
                 int YumYumPollWait;                   // this is the length of time in ms to wait between checks for new jobs
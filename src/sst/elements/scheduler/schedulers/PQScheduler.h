@@ -65,6 +65,7 @@ namespace SST {
                     bool operator()(Job*& j1, Job*& j2);
                     bool operator()(Job* const& j1, Job* const& j2);
                     std::string toString();
+                    bool isFIFO() { return type == FIFO; }
 
                 private:
                     JobComparator(ComparatorType type);
@@ -86,6 +87,8 @@ namespace SST {
 
                 void reset();
 
+                bool startsInArrivalOrder() { return origcomp -> isFIFO(); }
+
             protected:
                 std::priority_queue<Job*,std::vector<Job*>,JobComparator>* toRun;  //jobs waiting to run
         };
@@ -0,0 +1,31 @@
+# scheduler simulation input file
+# FST for a FIFO queue, e.g. "sst test_scheduler_FST.py -- strict[full]"
+import sst
+import sys
+
+FST = sys.argv[1] if len(sys.argv) > 1 else "strict"
+
+# Define SST core options
+sst.setProgramOption("run-mode", "both")
+
+# Define the simulation components
+scheduler = sst.Component("myScheduler",             "scheduler.schedComponent")
+scheduler.addParams({
+      "traceName" : "../simulations/test_scheduler_Atlas.sim",
+      "machine" : "mesh[5,4,4]",
+      "coresPerNode" : "4",
+      "scheduler" : "pqueue[fifo]",
+      "allocator" : "bestfit",
+      "timeperdistance" : ".001865[.1569,0.0129]",
+      "dMatrixFile" : "none",
+      "FST" : FST
+})
+
+# nodes and links
+for i in range(80):
+    n = sst.Component("n%d"%i, "scheduler.nodeComponent")
+    n.addParams({
+          "nodeNum" : "%d"%i,
+    })
+    l = sst.Link("l%d"%i)
+    l.connect( (scheduler, "nodeLink%d"%i, "0 ns"), (n, "Scheduler", "0 ns") )
@@ -0,0 +1,29 @@
+#!/bin/bash
+
+# With a FIFO queue FST is tracked incrementally in a profile of predicted
+# runs. Simulating the whole queue for each arrival ([full]) must give the
+# same job log, FST column included.
+#
+# Run from this directory; on success the output matches
+# refFiles/test_scheduler_FST.out.
+failed=0
+for fst in strict relaxed; do
+    for mode in $fst "$fst[full]"; do
+        echo "running test_scheduler_FST.py with FST $mode"
+        rm -f test_scheduler_Atlas.sim.time
+        if ! sst test_scheduler_FST.py -- "$mode" > /dev/null 2>&1; then
+            echo "FAILED: sst exited with an error for FST $mode"
+            failed=1
+        fi
+        # The log header records when the run started
+        grep -v "^# Simulation for trace" test_scheduler_Atlas.sim.time > "FST_$mode.time"
+    done
+    if diff -q "FST_$fst.time" "FST_$fst[full].time" > /dev/null; then
+        rm -f "FST_$fst.time" "FST_$fst[full].time"
+    else
+        echo "FAILED: incremental $fst FST differs from the full simulation"
+        failed=1
+    fi
+done
+rm -f test_scheduler_Atlas.sim.time
+exit $failed
@@ -0,0 +1,26 @@
+#!/bin/bash
+
+# Streaming the trace through a small look-ahead window must schedule the
+# jobs exactly as reading the whole trace does.
+#
+# Run from this directory; on success the output matches
+# refFiles/test_scheduler_jobWindow.out.
+failed=0
+for window in 0 2; do
+    echo "running test_scheduler_jobWindow.py with jobWindow $window"
+    rm -f test_scheduler_Atlas.sim.time
+    if ! sst test_scheduler_jobWindow.py -- $window > /dev/null 2>&1; then
+        echo "FAILED: sst exited with an error for jobWindow $window"
+        failed=1
+    fi
+    # The log header records when the run started
+    grep -v "^# Simulation for trace" test_scheduler_Atlas.sim.time > jobWindow_$window.time
+done
+if diff -q jobWindow_0.time jobWindow_2.time > /dev/null; then
+    rm -f jobWindow_0.time jobWindow_2.time
+else
+    echo "FAILED: the jobWindow=2 job log differs from jobWindow=0"
+    failed=1
+fi
+rm -f test_scheduler_Atlas.sim.time
+exit $failed
@@ -0,0 +1,203 @@
+
+#include <sst_config.h>
+
+#include "shogun_event.h"
+#include "shogunmatcharb.h"
+#include "shogun_stat_bundle.h"
+
+using namespace SST::Shogun;
+
+ShogunMatchArbitrator::ShogunMatchArbitrator(const int iterations)
+    : ports(0), iterations(iterations), words(0)
+{
+}
+
+ShogunMatchArbitrator::~ShogunMatchArbitrator() {}
+
+void ShogunMatchArbitrator::resize(const int port_count)
+{
+    ports = port_count;
+    words = (port_count + 63) / 64;
+
+    requests.assign(static_cast<size_t>(port_count) * words, 0);
+    activeInputs.assign(words, 0);
+    outputRequested.assign(port_count, false);
+    sent.assign(port_count, 0);
+    requestedOutputs.reserve(port_count);
+}
+
+int ShogunMatchArbitrator::findRequest(const int out, const int start) const
+{
+    const uint64_t* row = &requests[static_cast<size_t>(out) * words];
+
+    int w = start >> 6;
+    uint64_t bits = row[w] & (~UINT64_C(0) << (start & 63));
+
+    // Walk the words once around, finishing with the low bits of the first
+    for (int n = 0; n <= words; ++n) {
+        if (bits != 0) {
+            return (w << 6) + __builtin_ctzll(bits);
+        }
+
+        w = (w + 1 == words) ? 0 : w + 1;
+        bits = row[w];
+    }
+
+    return -1;
+}
+
+void ShogunMatchArbitrator::moveEvents(const int num_events,
+                                       const int port_count,
+                                       ShogunQueue<ShogunEvent*>** inputQueues,
+                                       int32_t output_slots,
+                                       ShogunEvent*** outputEvents,
+                                       uint64_t cycle ) {
+
+    output->verbose(CALL_INFO, 4, 0, "BEGIN: Arbitration --------------------------------------------------\n");
+
+    if (port_count != ports) {
+        resize(port_count);
+    }
+
+    if (0 == num_events) {
+        output->verbose(CALL_INFO, 4, 0, "END: Arbitration ----------------------------------------------------\n");
+        return;
+    }
+
+    for (int32_t i = 0; i < port_count; ++i) {
+        if (!inputQueues[i]->empty()) {
+            setBit(&activeInputs[0], i);
+            sent[i] = 0;
+        }
+    }
+
+    int32_t moved_count = 0;
+
+    for (int iter = 0; iterations < 0 || iter < iterations; ++iter) {
+
+        // Request: every active input asks for the destination of its head event
+        requestedOutputs.clear();
+
+        for (int w = 0; w < words; ++w) {
+            uint64_t bits = activeInputs[w];
+
+            while (bits != 0) {
+                const int in = (w << 6) + __builtin_ctzll(bits);
+                bits &= bits - 1;
+
+                const int dest = inputQueues[in]->peek()->getDestination();
+                setBit(&requests[static_cast<size_t>(dest) * words], in);
+
+                if (!outputRequested[dest]) {
+                    outputRequested[dest] = true;
+                    requestedOutputs.push_back(dest);
+                }
+            }
+        }
+
+        if (requestedOutputs.empty()) {
+            break;
+        }
+
+        // Grant: each output takes requesters in priority order while it has free slots
+        int32_t grants = 0;
+
+        for (auto out : requestedOutputs) {
+            uint64_t* row = &requests[static_cast<size_t>(out) * words];
+            ShogunEvent** slots = outputEvents[out];
+            int32_t k = 0;
+
+            int in = findRequest(out, grantStart(out));
+
+            while (in >= 0) {
+                while (k < output_slots && slots[k] != nullptr) {
+                    ++k;
+                }
+
+                if (k == output_slots) {
+                    output->verbose(CALL_INFO, 4, 0, "  -> output %" PRIi32 " full...\n", out);
+                    break;
+                }
+
+                output->verbose(CALL_INFO, 4, 0, "  (%d)-> moving event from: %" PRIi32 " to: %" PRIi32 "\n", iter, in, out);
+
+                slots[k] = inputQueues[in]->pop();
+                clearBit(row, in);
+                moved_count++;
+                grants++;
+                sent[in]++;
+
+                if (0 == iter) {
+                    firstIterationGrant(out, in);
+                }
+
+                if (inputQueues[in]->empty() || (num_events > 0 && sent[in] >= num_events)) {
+                    clearBit(&activeInputs[0], in);
+                }
+
+                in = findRequest(out, (in + 1 == port_count) ? 0 : in + 1);
+            }
+
+            // Anything still requesting is blocked behind a full output for this cycle
+            for (int w = 0; w < words; ++w) {
+                activeInputs[w] &= ~row[w];
+                row[w] = 0;
+            }
+
+            outputRequested[out] = false;
+        }
+
+        if (0 == grants) {
+            break;
+        }
+    }
+
+    for (int w = 0; w < words; ++w) {
+        activeInputs[w] = 0;
+    }
+
+    endCycle();
+
+    bundle->getPacketsMoved()->addData(moved_count);
+    output->verbose(CALL_INFO, 4, 0, "END: Arbitration ----------------------------------------------------\n");
+}
+
+ShogunISLIPArbitrator::ShogunISLIPArbitrator(const int iterations)
+    : ShogunMatchArbitrator(iterations)
+{
+}
+
+ShogunISLIPArbitrator::~ShogunISLIPArbitrator() {}
+
+int ShogunISLIPArbitrator::grantStart(const int out) const
+{
+    return (static_cast<size_t>(out) < grantPointer.size()) ? grantPointer[out] : 0;
+}
+
+void ShogunISLIPArbitrator::firstIterationGrant(const int out, const int in)
+{
+    if (grantPointer.size() != static_cast<size_t>(ports)) {
+        grantPointer.assign(ports, 0);
+    }
+
+    grantPointer[out] = (in + 1 == ports) ? 0 : in + 1;
+}
+
+ShogunWavefrontArbitrator::ShogunWavefrontArbitrator(const int iterations)
+    : ShogunMatchArbitrator(iterations), priorityDiagonal(0)
+{
+}
+
+ShogunWavefrontArbitrator::~ShogunWavefrontArbitrator() {}
+
+int ShogunWavefrontArbitrator::grantStart(const int out) const
+{
+    // Input i is on diagonal (i + out) % ports
+    const int start = (priorityDiagonal - out) % ports;
+    return (start < 0) ? start + ports : start;
+}
+
+void ShogunWavefrontArbitrator::endCycle()
+{
+    priorityDiagonal = (priorityDiagonal + 1 == ports) ? 0 : priorityDiagonal + 1;
+}
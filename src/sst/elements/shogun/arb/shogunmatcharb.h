@@ -0,0 +1,118 @@
+#ifndef _H_SHOGUN_MATCH_ARB_H
+#define _H_SHOGUN_MATCH_ARB_H
+
+#include <vector>
+
+#include "shogun_event.h"
+#include "shogunarb.h"
+
+namespace SST {
+namespace Shogun {
+
+    /*
+     * Separable input/output allocator working on request bitmasks.
+     *
+     * Each iteration every input that can still send requests the destination
+     * of the event at the head of its queue, setting its bit in that output's
+     * request mask.  Each requested output then grants inputs in rotating
+     * priority order (found with a find-first-set over the mask) until its
+     * output slots are full.  Inputs left requesting a full output are blocked
+     * for the rest of the cycle, inputs that were granted may request again in
+     * the next iteration until they have sent num_events events.  Only ports
+     * with a request are visited, so a cycle costs O(active ports) plus
+     * O(ports / 64) per requested output rather than O(ports^2).
+     *
+     * Subclasses choose where each output starts granting.
+     */
+    class ShogunMatchArbitrator : public ShogunArbitrator {
+
+    public:
+        ShogunMatchArbitrator(const int iterations);
+        virtual ~ShogunMatchArbitrator();
+
+        void moveEvents(const int num_events,
+                        const int port_count,
+                        ShogunQueue<ShogunEvent*>** inputQueues,
+                        int32_t output_slots,
+                        ShogunEvent*** outputEvents,
+                        uint64_t cycle ) override;
+
+    protected:
+        // First input port output 'out' considers when granting
+        virtual int grantStart(const int out) const = 0;
+
+        // Called for every grant made in the first iteration of a cycle
+        virtual void firstIterationGrant(const int out, const int in) {}
+
+        // Called once at the end of every cycle
+        virtual void endCycle() {}
+
+        int ports;
+
+    private:
+        void resize(const int port_count);
+        int findRequest(const int out, const int start) const;
+
+        static void setBit(uint64_t* mask, const int bit)
+        {
+            mask[bit >> 6] |= (UINT64_C(1) << (bit & 63));
+        }
+
+        static void clearBit(uint64_t* mask, const int bit)
+        {
+            mask[bit >> 6] &= ~(UINT64_C(1) << (bit & 63));
+        }
+
+        const int iterations;
+        int words;
+
+        std::vector<uint64_t> requests;         // ports x words, inputs requesting each output
+        std::vector<uint64_t> activeInputs;     // inputs which may still send this cycle
+        std::vector<int> requestedOutputs;      // outputs with a request this iteration
+        std::vector<bool> outputRequested;
+        std::vector<int> sent;                  // events sent by each input this cycle
+    };
+
+    /*
+     * iSLIP: every output keeps a grant pointer which moves to one past the
+     * last input it granted in the first iteration, so a busy output serves
+     * its requesters in turn.
+     */
+    class ShogunISLIPArbitrator : public ShogunMatchArbitrator {
+
+    public:
+        ShogunISLIPArbitrator(const int iterations);
+        ~ShogunISLIPArbitrator();
+
+    protected:
+        int grantStart(const int out) const override;
+        void firstIterationGrant(const int out, const int in) override;
+
+    private:
+        std::vector<int> grantPointer;
+    };
+
+    /*
+     * Wavefront: input i requesting output j sits on diagonal (i + j) of the
+     * request matrix and the diagonal with the highest priority rotates every
+     * cycle, so each output starts granting at the input whose diagonal is the
+     * current priority diagonal.
+     */
+    class ShogunWavefrontArbitrator : public ShogunMatchArbitrator {
+
+    public:
+        ShogunWavefrontArbitrator(const int iterations);
+        ~ShogunWavefrontArbitrator();
+
+    protected:
+        int grantStart(const int out) const override;
+        void endCycle() override;
+
+    private:
+        int priorityDiagonal;
+    };
+
+}
+}
+
+#endif
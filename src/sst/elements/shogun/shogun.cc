@@ -19,6 +19,7 @@
 #include <sst/core/output.h>
 #include <sst/core/unitAlgebra.h>
 
+#include "arb/shogunmatcharb.h"
 #include "arb/shogunrrarb.h"
 #include "shogun.h"
 #include "shogun_credit_event.h"
@@ -43,13 +44,26 @@ ShogunComponent::ShogunComponent(ComponentId_t id, Params& params)
     previousCycle = 0;
     pending_events = 0;
 
-    arb = new ShogunRoundRobinArbitrator();
-
     const int32_t verbosity = params.find<uint32_t>("verbose", 0);
 
     char prefix[256];
     sprintf(prefix, "[t=@t][%s]: ", getName().c_str());
     output = new SST::Output(prefix, verbosity, 0, Output::STDOUT);
+
+    const std::string arbitration = params.find<std::string>("arbitration", "roundrobin");
+    const int arb_iterations = params.find<int>("arbitration_iterations", -1);
+
+    if ("roundrobin" == arbitration) {
+        arb = new ShogunRoundRobinArbitrator();
+    } else if ("islip" == arbitration) {
+        arb = new ShogunISLIPArbitrator(arb_iterations);
+    } else if ("wavefront" == arbitration) {
+        arb = new ShogunWavefrontArbitrator(arb_iterations);
+    } else {
+        output->fatal(CALL_INFO, -1, "Error: unknown arbitration scheme: %s, valid options are roundrobin, islip or wavefront\n",
+            arbitration.c_str());
+    }
+
     arb->setOutput(output);
 
     port_count = params.find<int32_t>("port_count", -1);
@@ -142,17 +156,25 @@ bool ShogunComponent::tick(SST::Cycle_t currentCycle)
     previousCycle = currentCycle;
     eventCycles->addData(1);
 
-    printStatus();
+    const bool debugStatus = output->getVerboseLevel() >= 4;
+
+    if (debugStatus) {
+        printStatus();
+    }
 
     // Migrate events across the cross-bar
     arb->moveEvents( input_message_slots, port_count, inputQueues, output_message_slots, pendingOutputs, static_cast<uint64_t>( currentCycle ) );
 
-    printStatus();
+    if (debugStatus) {
+        printStatus();
+    }
 
     // Send any events which can be sent this cycle
     emitOutputs();
 
-    printStatus();
+    if (debugStatus) {
+        printStatus();
+    }
 
     output->verbose(CALL_INFO, 4, 0, "Pending event count: %" PRIi32 "\n", pending_events);
     // If we have pending events to process, then schedule another tick
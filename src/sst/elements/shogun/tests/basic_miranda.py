@@ -1,4 +1,8 @@
 import sst
+import sys
+
+# Crossbar arbitration, e.g. "sst basic_miranda.py -- islip"
+arbitration = sys.argv[1] if len(sys.argv) > 1 else "roundrobin"
 
 # Define SST core options
 sst.setProgramOption("timebase", "1ps")
@@ -149,6 +153,7 @@ shogun_xbar = sst.Component("shogunxbar", "shogun.ShogunXBar")
 shogun_xbar.addParams({
        "clock" : "1.0GHz",
        "port_count" : 4,
+       "arbitration" : arbitration,
        "verbose" : 0
 })
 
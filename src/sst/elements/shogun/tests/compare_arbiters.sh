@@ -0,0 +1,19 @@
+#!/bin/bash
+
+# The crossbar arbiter changes timing but not what the CPUs issue, so every
+# arbiter must complete the same requests as the round-robin reference.
+pattern='^ cpu[01]\.\(read_reqs\|write_reqs\|total_bytes_read\|total_bytes_write\) '
+grep "$pattern" refFiles/test_shogun_basic_miranda.out > ref.reqs
+
+failed=0
+for arb in islip wavefront; do
+    echo "running basic_miranda.py with $arb"
+    sst basic_miranda.py -- $arb > test_shogun_basic_miranda_$arb.out 2>&1
+    if ! grep -q "Simulation is complete" test_shogun_basic_miranda_$arb.out ||
+       ! grep "$pattern" test_shogun_basic_miranda_$arb.out | diff -q ref.reqs - > /dev/null; then
+        echo "FAILED: $arb does not complete the reference requests"
+        failed=1
+    fi
+done
+rm -f ref.reqs
+exit $failed
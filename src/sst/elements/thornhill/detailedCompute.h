@@ -17,6 +17,8 @@
 #define _H_THORNHILL_DETAILED_COMPUTE
 
 #include <sst/core/subcomponent.h>
+#include <deque>
+#include <memory>
 
 namespace SST {
 namespace Thornhill {
@@ -32,6 +34,17 @@ class DetailedCompute : public SubComponent {
 		SST::Params params;
 	};
 
+	// The generators for one compute phase. A motif can build a phase
+	// once and start it many times; it is shared, not copied.
+	typedef std::deque< std::pair< std::string, SST::Params > > Work;
+	typedef std::shared_ptr<const Work> Phase;
+
+	static Phase makePhase( const std::string& name, const SST::Params& params ) {
+		std::shared_ptr<Work> work = std::make_shared<Work>();
+		work->push_back( std::make_pair( name, params ) );
+		return work;
+	}
+
     DetailedCompute( ComponentId_t id ) : SubComponent( id ) {}
 #ifndef SST_ENABLE_PREVIEW_BUILD  // inserted by script
     DetailedCompute( Component* owner ) : SubComponent( owner ) {}
@@ -44,6 +57,11 @@ class DetailedCompute : public SubComponent {
     virtual ~DetailedCompute(){};
     virtual void start( std::deque< std::pair< std::string, SST::Params > >&,
                  std::function<int()> retFunc, std::function<int()> finiFunc) = 0;
+    virtual void start( const Phase& phase,
+                 std::function<int()> retFunc, std::function<int()> finiFunc) {
+		Work work( *phase );
+		start( work, retFunc, finiFunc );
+	}
     virtual bool isConnected() = 0;
 	virtual std::string getModelName() = 0;
 };
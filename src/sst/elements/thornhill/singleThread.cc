@@ -50,7 +50,7 @@ void SingleThread::eventHandler( SST::Event* ev )
 	m_busy = false;
 	if ( ! m_pendingQ.empty() ){
 		Pending& pending =  m_pendingQ.front();
-		start2( pending.work, pending.retHandler, pending.finiHandler );
+		start2( *pending.work, pending.retHandler, pending.finiHandler );
 		m_pendingQ.pop();  
 	}
 }
@@ -49,9 +49,9 @@ class SingleThread : public DetailedCompute {
     ~SingleThread(){};
 
 	struct Pending {
-		Pending( std::deque< std::pair< std::string, SST::Params > >& work,
+		Pending( const Phase& work,
                  std::function<int()> retHandler, std::function<int()> finiHandler) : work(work), retHandler(retHandler), finiHandler(finiHandler) {}
-    	std::deque< std::pair< std::string, SST::Params > > work; 
+    	Phase work; 
         std::function<int()> retHandler;
 		std::function<int()> finiHandler; 
 	};
@@ -60,6 +60,15 @@ class SingleThread : public DetailedCompute {
 	{
 		if ( ! m_busy ) {
 			start2( work, retHandler, finiHandler ); 
+		} else {
+			m_pendingQ.push( Pending( std::make_shared<Work>( work ), retHandler, finiHandler ) ); 
+		}
+	}
+    virtual void start( const Phase& work, 
+                 std::function<int()> retHandler, std::function<int()> finiHandler ) 
+	{
+		if ( ! m_busy ) {
+			start2( *work, retHandler, finiHandler ); 
 		} else {
 			m_pendingQ.push( Pending( work, retHandler, finiHandler ) ); 
 		}